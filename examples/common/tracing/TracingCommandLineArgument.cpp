@@ -74,6 +74,15 @@ void TracingSetup::EnableTracingFor(const char * cliArg)
             }
             chip::Tracing::Register(mJsonBackend);
         }
+        else if (StartsWith(value, "binary:"))
+        {
+            // Events are kept in memory and only written out when tracing stops.
+            if (mBinaryFileName.empty())
+            {
+                chip::Tracing::Register(mBinaryBackend);
+            }
+            mBinaryFileName.assign(value.data() + 7, value.size() - 7);
+        }
 #if ENABLE_PERFETTO_TRACING
         else if (value.data_equal(CharSpan::fromCharString("perfetto")))
         {
@@ -113,6 +122,18 @@ void TracingSetup::StopTracing()
 #endif
 
     chip::Tracing::Unregister(mJsonBackend);
+
+    if (!mBinaryFileName.empty())
+    {
+        chip::Tracing::Unregister(mBinaryBackend);
+
+        CHIP_ERROR err = mBinaryBackend.DumpToFile(mBinaryFileName.c_str());
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(AppServer, "Failed to write binary trace output: %" CHIP_ERROR_FORMAT, err.Format());
+        }
+        mBinaryFileName.clear();
+    }
 }
 
 } // namespace CommandLineApp
@@ -19,6 +19,7 @@
 
 #include "tracing/enabled_features.h"
 
+#include <tracing/binary/binary_tracing.h>
 #include <tracing/json/json_tracing.h>
 
 #if ENABLE_PERFETTO_TRACING
@@ -26,12 +27,14 @@
 #include <tracing/perfetto/perfetto_tracing.h> // nogncheck
 #endif
 
+#include <string>
+
 /// A string with supported command line tracing targets
 /// to be pretty-printed in help strings if needed
 #if ENABLE_PERFETTO_TRACING
-#define SUPPORTED_COMMAND_LINE_TRACING_TARGETS "json:log, json:<path>, perfetto, perfetto:<path>"
+#define SUPPORTED_COMMAND_LINE_TRACING_TARGETS "json:log, json:<path>, binary:<path>, perfetto, perfetto:<path>"
 #else
-#define SUPPORTED_COMMAND_LINE_TRACING_TARGETS "json:log, json:<path>"
+#define SUPPORTED_COMMAND_LINE_TRACING_TARGETS "json:log, json:<path>, binary:<path>"
 #endif
 
 namespace chip {
@@ -59,6 +62,9 @@ public:
 private:
     ::chip::Tracing::Json::JsonBackend mJsonBackend;
 
+    ::chip::Tracing::Binary::BinaryBackend mBinaryBackend;
+    std::string mBinaryFileName; // empty unless mBinaryBackend is registered
+
 #if ENABLE_PERFETTO_TRACING
     chip::Tracing::Perfetto::FileTraceOutput mPerfettoFileOutput;
     chip::Tracing::Perfetto::PerfettoBackend mPerfettoBackend;
@@ -76,6 +76,13 @@ public:
     // Initializes BDX transfer-related metadata. Should always be called first.
     CHIP_ERROR InitializeTransfer(chip::FabricIndex fabricIndex, chip::NodeId nodeId);
 
+    // Whether the sender was initialized for a transfer to the given node.
+    bool IsInitializedFor(chip::FabricIndex fabricIndex, chip::NodeId nodeId) const
+    {
+        return mInitialized && mFabricIndex.ValueOr(chip::kUndefinedFabricIndex) == fabricIndex &&
+            mNodeId.ValueOr(chip::kUndefinedNodeId) == nodeId;
+    }
+
     void SetCallbacks(BdxOtaSenderCallbacks callbacks);
 
     /**
@@ -336,10 +336,8 @@ void ApplicationInit()
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
 
-    BdxOtaSender * bdxOtaSender = gOtaProvider.GetBdxOtaSender();
-    VerifyOrReturn(bdxOtaSender != nullptr);
     err = chip::Server::GetInstance().GetExchangeManager().RegisterUnsolicitedMessageHandlerForProtocol(chip::Protocols::BDX::Id,
-                                                                                                        bdxOtaSender);
+                                                                                                        &gOtaProvider);
     if (err != CHIP_NO_ERROR)
     {
         ChipLogDetail(SoftwareUpdate, "RegisterUnsolicitedMessageHandler failed: %s", chip::ErrorStr(err));
@@ -417,7 +415,10 @@ public:
         CHIP_ERROR err = chip::DeviceLayer::PlatformMgr().ScheduleWork([](intptr_t) {
             ChipLogDetail(SoftwareUpdate, "Scheduling BdxOtaSender to ABORT TRANSFER");
 
-            gOtaProvider.GetBdxOtaSender()->AbortTransfer();
+            for (size_t i = 0; i < OTAProviderExample::kMaxBdxTransfers; i++)
+            {
+                gOtaProvider.GetBdxOtaSender(i)->AbortTransfer();
+            }
 
             SuccessOrDie(chip::DeviceLayer::PlatformMgr().StopEventLoopTask());
         });
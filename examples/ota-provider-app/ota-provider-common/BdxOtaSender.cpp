@@ -22,14 +22,20 @@
 #include <lib/support/CHIPMemString.h>
 #include <messaging/ExchangeContext.h>
 #include <messaging/Flags.h>
+#include <ota-provider-common/FileBlockSource.h>
 #include <protocols/bdx/BdxTransferSession.h>
 
-#include <fstream>
-
 using chip::bdx::StatusCode;
 using chip::bdx::TransferControlFlags;
 using chip::bdx::TransferSession;
 
+namespace {
+
+// Shared by all the senders, so that concurrent transfers of the same image read it through a single open file.
+FileBlockSourcePool gOtaImageFiles;
+
+} // namespace
+
 BdxOtaSender::BdxOtaSender()
 {
     memset(mFileDesignator, 0, chip::bdx::kMaxFileDesignatorLen);
@@ -103,6 +109,23 @@ void BdxOtaSender::HandleTransferSessionOutput(TransferSession::OutputEvent & ev
         break;
     }
     case TransferSession::OutputEventType::kInitReceived: {
+        // Store the file designator used during block query
+        uint16_t fdl       = 0;
+        const uint8_t * fd = mTransfer.GetFileDesignator(fdl);
+        VerifyOrReturn(fdl < chip::bdx::kMaxFileDesignatorLen,
+                       ChipLogError(BDX, "Cannot store file designator with length = %d", fdl));
+        memcpy(mFileDesignator, fd, fdl);
+        mFileDesignator[fdl] = 0;
+
+        // Keep the OTA file open for the whole transfer rather than opening it for every block
+        mBlockSource = gOtaImageFiles.Acquire(mFileDesignator);
+        if (mBlockSource == nullptr)
+        {
+            ChipLogError(BDX, "OTA file open failed");
+            TEMPORARY_RETURN_IGNORED mTransfer.RejectTransfer(StatusCode::kFileDesignatorUnknown);
+            return;
+        }
+
         // TransferSession will automatically reject a transfer if there are no
         // common supported control modes. It will also default to the smaller
         // block size.
@@ -111,40 +134,23 @@ void BdxOtaSender::HandleTransferSessionOutput(TransferSession::OutputEvent & ev
         acceptData.MaxBlockSize = mTransfer.GetTransferBlockSize();
         acceptData.StartOffset  = mTransfer.GetStartOffset();
         acceptData.Length       = mTransfer.GetTransferLength();
-        VerifyOrReturn(mTransfer.AcceptTransfer(acceptData) == CHIP_NO_ERROR,
-                       ChipLogError(BDX, "AcceptTransfer failed: %" CHIP_ERROR_FORMAT, err.Format()));
-
-        // Store the file designator used during block query
-        uint16_t fdl       = 0;
-        const uint8_t * fd = mTransfer.GetFileDesignator(fdl);
-        VerifyOrReturn(fdl < chip::bdx::kMaxFileDesignatorLen,
-                       ChipLogError(BDX, "Cannot store file designator with length = %d", fdl));
-        memcpy(mFileDesignator, fd, fdl);
-        mFileDesignator[fdl] = 0;
+        err                     = mTransfer.AcceptTransfer(acceptData);
+        VerifyOrReturn(err == CHIP_NO_ERROR, ChipLogError(BDX, "AcceptTransfer failed: %" CHIP_ERROR_FORMAT, err.Format()));
 
         break;
     }
     case TransferSession::OutputEventType::kQueryReceived:
     case TransferSession::OutputEventType::kQueryWithSkipReceived: {
-        TransferSession::BlockData blockData;
-        uint16_t blockSize   = mTransfer.GetTransferBlockSize();
-        uint16_t bytesToRead = blockSize;
-        uint64_t bytesToSkip = 0;
+        VerifyOrReturn(mBlockSource != nullptr);
 
+        uint64_t bytesToSkip = 0;
         if (event.EventType == TransferSession::OutputEventType::kQueryWithSkipReceived)
         {
             bytesToSkip = event.bytesToSkip.BytesToSkip;
         }
-        uint64_t seekOffset = mNumBytesSent + bytesToSkip;
+        uint64_t offset = mNumBytesSent + bytesToSkip;
 
-        // TODO: This should be a utility function in TransferSession
-        if ((mTransfer.GetTransferLength() > 0) && ((seekOffset + blockSize) > mTransfer.GetTransferLength()))
-        {
-            // cast should be safe because of condition above
-            bytesToRead = static_cast<uint16_t>(mTransfer.GetTransferLength() - seekOffset);
-        }
-
-        chip::System::PacketBufferHandle blockBuf = chip::System::PacketBufferHandle::New(bytesToRead);
+        chip::System::PacketBufferHandle blockBuf = chip::System::PacketBufferHandle::New(mTransfer.GetTransferBlockSize());
         if (blockBuf.IsNull())
         {
             // TODO(#13981): AbortTransfer() needs to support GeneralStatusCode failures as well as BDX specific errors.
@@ -152,35 +158,19 @@ void BdxOtaSender::HandleTransferSessionOutput(TransferSession::OutputEvent & ev
             return;
         }
 
-        std::ifstream otaFile(mFileDesignator, std::ifstream::in);
-        if (!otaFile.good())
-        {
-            ChipLogError(BDX, "OTA file open failed");
-            TEMPORARY_RETURN_IGNORED mTransfer.AbortTransfer(StatusCode::kFileDesignatorUnknown);
-            return;
-        }
-
-        if (seekOffset > static_cast<uint64_t>(std::numeric_limits<std::streamoff>::max()))
-        {
-            ChipLogError(BDX, "Seek offset too large");
-            TEMPORARY_RETURN_IGNORED mTransfer.AbortTransfer(StatusCode::kLengthTooLarge);
-            return;
-        }
-        otaFile.seekg(static_cast<std::streamoff>(seekOffset));
-        otaFile.read(reinterpret_cast<char *>(blockBuf->Start()), bytesToRead);
-        if (!(otaFile.good() || otaFile.eof()))
+        TransferSession::BlockData blockData;
+        chip::MutableByteSpan block(blockBuf->Start(), mTransfer.GetTransferBlockSize());
+        err = mBlockSource->ReadTransferBlock(offset, mTransfer.GetTransferLength(), block, blockData.IsEof);
+        if (err != CHIP_NO_ERROR)
         {
-            ChipLogError(BDX, "OTA file read failed");
+            ChipLogError(BDX, "OTA file read failed: %" CHIP_ERROR_FORMAT, err.Format());
             TEMPORARY_RETURN_IGNORED mTransfer.AbortTransfer(StatusCode::kFileDesignatorUnknown);
             return;
         }
 
-        blockData.Data   = blockBuf->Start();
-        blockData.Length = static_cast<size_t>(otaFile.gcount());
-        blockData.IsEof  = (blockData.Length < blockSize) ||
-            (seekOffset + static_cast<uint64_t>(blockData.Length) == mTransfer.GetTransferLength() || (otaFile.peek() == EOF));
-        mNumBytesSent = static_cast<uint32_t>(seekOffset + blockData.Length);
-        otaFile.close();
+        blockData.Data   = block.data();
+        blockData.Length = block.size();
+        mNumBytesSent    = static_cast<uint32_t>(offset + blockData.Length);
 
         err = mTransfer.PrepareBlock(blockData);
         if (err != CHIP_NO_ERROR)
@@ -232,6 +222,12 @@ void BdxOtaSender::Reset()
         mExchangeCtx = nullptr;
     }
 
+    if (mBlockSource != nullptr)
+    {
+        gOtaImageFiles.Release(mBlockSource);
+        mBlockSource = nullptr;
+    }
+
     mInitialized  = false;
     mNumBytesSent = 0;
     memset(mFileDesignator, 0, chip::bdx::kMaxFileDesignatorLen);
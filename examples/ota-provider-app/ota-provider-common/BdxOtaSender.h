@@ -15,6 +15,7 @@
  *    limitations under the License.
  */
 
+#include <protocols/bdx/BdxBlockSource.h>
 #include <protocols/bdx/BdxTransferSession.h>
 #include <protocols/bdx/TransferFacilitator.h>
 
@@ -28,6 +29,13 @@ public:
     // Initializes BDX transfer-related metadata. Should always be called first.
     CHIP_ERROR InitializeTransfer(chip::FabricIndex fabricIndex, chip::NodeId nodeId);
 
+    // Whether the sender was initialized for a transfer to the given node.
+    bool IsInitializedFor(chip::FabricIndex fabricIndex, chip::NodeId nodeId) const
+    {
+        return mInitialized && mFabricIndex.ValueOr(chip::kUndefinedFabricIndex) == fabricIndex &&
+            mNodeId.ValueOr(chip::kUndefinedNodeId) == nodeId;
+    }
+
     void AbortTransfer();
 
 private:
@@ -39,6 +47,9 @@ private:
     // Null-terminated string representing file designator
     char mFileDesignator[chip::bdx::kMaxFileDesignatorLen];
 
+    // Source of the OTA file, shared with the other transfers of the same file
+    chip::bdx::BlockSource * mBlockSource = nullptr;
+
     uint32_t mNumBytesSent = 0;
 
     bool mInitialized = false;
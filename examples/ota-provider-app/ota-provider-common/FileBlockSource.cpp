@@ -0,0 +1,167 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <ota-provider-common/FileBlockSource.h>
+
+#include <lib/support/CHIPMemString.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/SafeInt.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <system/SystemError.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+
+using chip::MutableByteSpan;
+using chip::bdx::BlockSource;
+
+CHIP_ERROR FileBlockSource::Open(const char * path)
+{
+    VerifyOrReturnError(!IsOpen(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(path != nullptr && strlen(path) < sizeof(mPath), CHIP_ERROR_INVALID_ARGUMENT);
+
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    VerifyOrReturnError(fd >= 0, CHIP_ERROR_POSIX(errno));
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || !S_ISREG(info.st_mode))
+    {
+        close(fd);
+        return CHIP_ERROR_INVALID_ARGUMENT;
+    }
+
+    mFd   = fd;
+    mSize = static_cast<uint64_t>(info.st_size);
+    chip::Platform::CopyString(mPath, path);
+
+#ifdef POSIX_FADV_SEQUENTIAL
+    posix_fadvise(mFd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+    ReadAhead(0, 2 * kReadAheadSize);
+
+    ChipLogProgress(BDX, "Serving %s (%" PRIu64 " bytes)", mPath, mSize);
+    return CHIP_NO_ERROR;
+}
+
+void FileBlockSource::Close()
+{
+    VerifyOrReturn(IsOpen());
+
+    close(mFd);
+    mFd      = -1;
+    mSize    = 0;
+    mPath[0] = '\0';
+}
+
+CHIP_ERROR FileBlockSource::ReadBlock(uint64_t offset, MutableByteSpan & buffer)
+{
+    VerifyOrReturnError(IsOpen(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(offset <= mSize, CHIP_ERROR_INVALID_ARGUMENT);
+
+    size_t length = buffer.size();
+    if (mSize - offset < length)
+    {
+        length = static_cast<size_t>(mSize - offset);
+    }
+
+    // Transfers mostly read the file sequentially. Whenever a block enters a new window of kReadAheadSize bytes, ask for the
+    // window after it, so that the following blocks are already in memory when they are queried. This only depends on the
+    // block, as concurrent transfers of the file are at different offsets.
+    const uint64_t window = (offset + length) / kReadAheadSize;
+    if (window != offset / kReadAheadSize)
+    {
+        ReadAhead((window + 1) * kReadAheadSize, kReadAheadSize);
+    }
+
+    size_t bytesRead = 0;
+    while (bytesRead < length)
+    {
+        VerifyOrReturnError(chip::CanCastTo<off_t>(offset + bytesRead), CHIP_ERROR_INVALID_ARGUMENT);
+        ssize_t result = pread(mFd, buffer.data() + bytesRead, length - bytesRead, static_cast<off_t>(offset + bytesRead));
+        if (result < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        VerifyOrReturnError(result >= 0, CHIP_ERROR_POSIX(errno));
+        if (result == 0)
+        {
+            // The file was truncated since it was opened.
+            break;
+        }
+        bytesRead += static_cast<size_t>(result);
+    }
+
+    buffer.reduce_size(bytesRead);
+    return CHIP_NO_ERROR;
+}
+
+void FileBlockSource::ReadAhead(uint64_t start, uint64_t length)
+{
+#ifdef POSIX_FADV_WILLNEED
+    VerifyOrReturn(start < mSize && chip::CanCastTo<off_t>(start));
+    posix_fadvise(mFd, static_cast<off_t>(start), static_cast<off_t>(std::min(length, mSize - start)), POSIX_FADV_WILLNEED);
+#endif
+}
+
+BlockSource * FileBlockSourcePool::Acquire(const char * path)
+{
+    VerifyOrReturnValue(path != nullptr, nullptr);
+
+    Entry * freeEntry = nullptr;
+    for (auto & entry : mEntries)
+    {
+        if (entry.mUseCount > 0 && strcmp(entry.mSource.GetPath(), path) == 0)
+        {
+            entry.mUseCount++;
+            return &entry.mSource;
+        }
+        if (entry.mUseCount == 0 && freeEntry == nullptr)
+        {
+            freeEntry = &entry;
+        }
+    }
+
+    VerifyOrReturnValue(freeEntry != nullptr, nullptr, ChipLogError(BDX, "Too many files served concurrently"));
+
+    CHIP_ERROR err = freeEntry->mSource.Open(path);
+    VerifyOrReturnValue(err == CHIP_NO_ERROR, nullptr,
+                        ChipLogError(BDX, "Cannot open %s: %" CHIP_ERROR_FORMAT, path, err.Format()));
+
+    freeEntry->mUseCount = 1;
+    return &freeEntry->mSource;
+}
+
+void FileBlockSourcePool::Release(BlockSource * source)
+{
+    for (auto & entry : mEntries)
+    {
+        if (&entry.mSource == source)
+        {
+            VerifyOrReturn(entry.mUseCount > 0);
+            if (--entry.mUseCount == 0)
+            {
+                entry.mSource.Close();
+            }
+            return;
+        }
+    }
+}
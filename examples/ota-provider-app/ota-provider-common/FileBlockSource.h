@@ -0,0 +1,89 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/support/Span.h>
+#include <protocols/bdx/BdxBlockSource.h>
+#include <protocols/bdx/BdxMessages.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * A bdx::BlockSource serving a file which is kept open for as long as it is served.
+ *
+ * Blocks are read with pread(), so that concurrent transfers do not share a file position, and the kernel is asked to read
+ * the next part of the file ahead of each transfer. The file is not mapped in memory: reading a mapping of a file which was
+ * truncated in the meantime would raise SIGBUS. A file truncated while it is served ends early instead.
+ */
+class FileBlockSource : public chip::bdx::BlockSource
+{
+public:
+    FileBlockSource() = default;
+    ~FileBlockSource() override { Close(); }
+
+    FileBlockSource(const FileBlockSource &)             = delete;
+    FileBlockSource & operator=(const FileBlockSource &) = delete;
+
+    CHIP_ERROR Open(const char * path);
+    void Close();
+
+    bool IsOpen() const { return mFd >= 0; }
+    const char * GetPath() const { return mPath; }
+
+    uint64_t GetSize() const override { return mSize; }
+    CHIP_ERROR ReadBlock(uint64_t offset, chip::MutableByteSpan & buffer) override;
+
+private:
+    static constexpr size_t kReadAheadSize = 64 * 1024;
+
+    void ReadAhead(uint64_t start, uint64_t length);
+
+    int mFd        = -1;
+    uint64_t mSize = 0;
+    char mPath[chip::bdx::kMaxFileDesignatorLen + 1];
+};
+
+/**
+ * The files served by the concurrent transfers of an OTA Provider. Transfers of the same file share a single FileBlockSource.
+ */
+class FileBlockSourcePool
+{
+public:
+    static constexpr size_t kMaxOpenFiles = 4;
+
+    /**
+     * @return The source serving the file at the given path, opening it if it is not served yet, or nullptr on failure.
+     */
+    chip::bdx::BlockSource * Acquire(const char * path);
+
+    /**
+     * Releases a source returned by Acquire, closing its file once no transfer uses it.
+     */
+    void Release(chip::bdx::BlockSource * source);
+
+private:
+    struct Entry
+    {
+        FileBlockSource mSource;
+        uint16_t mUseCount = 0;
+    };
+
+    Entry mEntries[kMaxOpenFiles];
+};
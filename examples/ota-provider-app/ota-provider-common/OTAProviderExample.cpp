@@ -271,11 +271,12 @@ void OTAProviderExample::SendQueryImageResponse(app::CommandHandler * commandObj
         // Initialize the transfer session in prepartion for a BDX transfer
         BitFlags<TransferControlFlags> bdxFlags;
         bdxFlags.Set(TransferControlFlags::kReceiverDrive);
-        if (mBdxOtaSender.InitializeTransfer(commandObj->GetSubjectDescriptor().fabricIndex,
-                                             commandObj->GetSubjectDescriptor().subject) == CHIP_NO_ERROR)
+        BdxOtaSender * bdxOtaSender =
+            InitializeBdxOtaSender(commandObj->GetSubjectDescriptor().fabricIndex, commandObj->GetSubjectDescriptor().subject);
+        if (bdxOtaSender != nullptr)
         {
             CHIP_ERROR error =
-                mBdxOtaSender.PrepareForTransfer(&chip::DeviceLayer::SystemLayer(), chip::bdx::TransferRole::kSender, bdxFlags,
+                bdxOtaSender->PrepareForTransfer(&chip::DeviceLayer::SystemLayer(), chip::bdx::TransferRole::kSender, bdxFlags,
                                                  mMaxBDXBlockSize, kBdxTimeout, chip::System::Clock::Milliseconds32(mPollInterval));
             if (error != CHIP_NO_ERROR)
             {
@@ -291,7 +292,7 @@ void OTAProviderExample::SendQueryImageResponse(app::CommandHandler * commandObj
         }
         else
         {
-            // Another BDX transfer in progress
+            // As many BDX transfers as supported are in progress
             mQueryImageStatus = OTAQueryStatus::kBusy;
         }
     }
@@ -439,3 +440,42 @@ void OTAProviderExample::HandleNotifyUpdateApplied(app::CommandHandler * command
 
     commandObj->AddStatus(commandPath, Status::Success);
 }
+
+CHIP_ERROR OTAProviderExample::OnUnsolicitedMessageReceived(const chip::PayloadHeader & payloadHeader,
+                                                            const chip::SessionHandle & session,
+                                                            chip::Messaging::ExchangeDelegate *& newDelegate)
+{
+    chip::Access::SubjectDescriptor subject = session->GetSubjectDescriptor();
+    for (auto & sender : mBdxOtaSenders)
+    {
+        if (sender.IsInitializedFor(subject.fabricIndex, subject.subject))
+        {
+            newDelegate = &sender;
+            return CHIP_NO_ERROR;
+        }
+    }
+
+    ChipLogError(BDX, "No transfer prepared for node " ChipLogFormatX64, ChipLogValueX64(subject.subject));
+    return CHIP_ERROR_NOT_FOUND;
+}
+
+BdxOtaSender * OTAProviderExample::InitializeBdxOtaSender(FabricIndex fabricIndex, NodeId nodeId)
+{
+    // A requestor querying again while its transfer is in progress restarts it on the same sender
+    for (auto & sender : mBdxOtaSenders)
+    {
+        if (sender.IsInitializedFor(fabricIndex, nodeId))
+        {
+            return (sender.InitializeTransfer(fabricIndex, nodeId) == CHIP_NO_ERROR) ? &sender : nullptr;
+        }
+    }
+
+    for (auto & sender : mBdxOtaSenders)
+    {
+        if (sender.InitializeTransfer(fabricIndex, nodeId) == CHIP_NO_ERROR)
+        {
+            return &sender;
+        }
+    }
+    return nullptr;
+}
@@ -23,17 +23,31 @@
 #include <app/clusters/ota-provider/OTAProviderUserConsentDelegate.h>
 #include <app/clusters/ota-provider/ota-provider-delegate.h>
 #include <lib/core/OTAImageHeader.h>
+#include <messaging/ExchangeDelegate.h>
 #include <ota-provider-common/BdxOtaSender.h>
 #include <vector>
 
+/**
+ * OTA_PROVIDER_EXAMPLE_MAX_BDX_TRANSFERS
+ *
+ * The number of OTA Requestors which can download an image at the same time.
+ */
+#ifndef OTA_PROVIDER_EXAMPLE_MAX_BDX_TRANSFERS
+#define OTA_PROVIDER_EXAMPLE_MAX_BDX_TRANSFERS 4
+#endif
+
 /**
  * A reference implementation for an OTA Provider. Includes a method for providing a path to a local OTA file to serve.
+ *
+ * The provider is also the handler of the unsolicited BDX messages, which it dispatches to the sender initialized for the peer.
  */
-class OTAProviderExample : public chip::app::Clusters::OTAProviderDelegate
+class OTAProviderExample : public chip::app::Clusters::OTAProviderDelegate, public chip::Messaging::UnsolicitedMessageHandler
 {
 public:
     OTAProviderExample();
 
+    static constexpr size_t kMaxBdxTransfers = OTA_PROVIDER_EXAMPLE_MAX_BDX_TRANSFERS;
+
     using OTAQueryStatus       = chip::app::Clusters::OtaSoftwareUpdateProvider::OTAQueryStatus;
     using OTAApplyUpdateAction = chip::app::Clusters::OtaSoftwareUpdateProvider::OTAApplyUpdateAction;
 
@@ -69,7 +83,7 @@ public:
     //////////// OTAProviderExample public APIs ///////////////
     void SetOTAFilePath(const char * path);
     void SetImageUri(const char * imageUri);
-    BdxOtaSender * GetBdxOtaSender() { return &mBdxOtaSender; }
+    BdxOtaSender * GetBdxOtaSender(size_t index = 0) { return (index < kMaxBdxTransfers) ? &mBdxOtaSenders[index] : nullptr; }
 
     void SetOTACandidates(std::vector<OTAProviderExample::DeviceSoftwareVersionModel> candidates);
     void SetIgnoreQueryImageCount(uint32_t count) { mIgnoreQueryImageCount = count; }
@@ -91,7 +105,16 @@ public:
 
     void SetMaxBDXBlockSize(uint16_t blockSize) { mMaxBDXBlockSize = blockSize; }
 
+    //////////// UnsolicitedMessageHandler Implementation ///////////////
+    CHIP_ERROR OnUnsolicitedMessageReceived(const chip::PayloadHeader & payloadHeader, const chip::SessionHandle & session,
+                                            chip::Messaging::ExchangeDelegate *& newDelegate) override;
+
 private:
+    /**
+     * Returns a sender initialized for a transfer to the given node, or nullptr if all the senders are busy.
+     */
+    BdxOtaSender * InitializeBdxOtaSender(chip::FabricIndex fabricIndex, chip::NodeId nodeId);
+
     bool SelectOTACandidate(const uint16_t requestorVendorID, const uint16_t requestorProductID,
                             const uint32_t requestorSoftwareVersion,
                             OTAProviderExample::DeviceSoftwareVersionModel & finalCandidate);
@@ -110,7 +133,7 @@ private:
     SendQueryImageResponse(chip::app::CommandHandler * commandObj, const chip::app::ConcreteCommandPath & commandPath,
                            const chip::app::Clusters::OtaSoftwareUpdateProvider::Commands::QueryImage::DecodableType & commandData);
 
-    BdxOtaSender mBdxOtaSender;
+    BdxOtaSender mBdxOtaSenders[kMaxBdxTransfers];
     std::vector<DeviceSoftwareVersionModel> mCandidates;
     char mOTAFilePath[kFilepathBufLen]; // null-terminated
     char mImageUri[kUriMaxLen];
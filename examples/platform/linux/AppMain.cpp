@@ -1027,6 +1027,9 @@ void ChipLinuxAppMainLoop(AppMainLoopImplementation * impl)
     sigaction(SIGTERM, &sa, nullptr);
 #endif
 
+    // Let the cryptographic work of CASE handshakes run alongside the event loop.
+    TEMPORARY_RETURN_IGNORED DeviceLayer::PlatformMgr().StartBackgroundEventLoopTask();
+
     if (impl != nullptr)
     {
         impl->RunMainLoop();
@@ -1037,6 +1040,8 @@ void ChipLinuxAppMainLoop(AppMainLoopImplementation * impl)
     }
     gMainLoopImplementation = nullptr;
 
+    TEMPORARY_RETURN_IGNORED DeviceLayer::PlatformMgr().StopBackgroundEventLoopTask();
+
     ApplicationShutdown();
 
 #if defined(ENABLE_CHIP_SHELL)
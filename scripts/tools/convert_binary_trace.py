@@ -0,0 +1,167 @@
+#!/usr/bin/env -S python3 -B
+
+#
+#    Copyright (c) 2025 Project CHIP Authors
+#    All rights reserved.
+#
+#    Licensed under the Apache License, Version 2.0 (the "License");
+#    you may not use this file except in compliance with the License.
+#    You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#    Unless required by applicable law or agreed to in writing, software
+#    distributed under the License is distributed on an "AS IS" BASIS,
+#    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#    See the License for the specific language governing permissions and
+#    limitations under the License.
+#
+
+"""Converts dumps of the binary tracing backend (src/tracing/binary) into
+Chrome trace event JSON, which can be opened in Perfetto UI or chrome://tracing.
+"""
+
+import json
+import logging
+import struct
+import sys
+import typing
+
+import click
+
+log = logging.getLogger(__name__)
+
+MAGIC = b'MTRBTRC\0'
+VERSION = 1
+
+LABEL_STRINGS = 0
+GROUP_STRINGS = 1
+
+# Matches chip::Tracing::Binary::BinaryBackend::RecordType
+RECORD_BEGIN = 1
+RECORD_END = 2
+RECORD_INSTANT = 3
+RECORD_COUNTER = 4
+RECORD_METRIC = 5
+
+# Matches chip::Tracing::Binary::BinaryBackend::Record
+RECORD_FORMAT = struct.Struct('=QIHBB')
+
+
+class Reader:
+    def __init__(self, data: bytes, byteorder: str):
+        self.data = data
+        self.offset = 0
+        self.byteorder = byteorder
+
+    def read(self, fmt: str) -> typing.Tuple:
+        s = struct.Struct(self.byteorder + fmt)
+        if self.offset + s.size > len(self.data):
+            raise ValueError('Truncated trace dump')
+        values = s.unpack_from(self.data, self.offset)
+        self.offset += s.size
+        return values
+
+    def read_bytes(self, size: int) -> bytes:
+        if self.offset + size > len(self.data):
+            raise ValueError('Truncated trace dump')
+        value = self.data[self.offset:self.offset + size]
+        self.offset += size
+        return value
+
+
+def detect_byteorder(data: bytes) -> str:
+    """ Dumps are written in the byte order of the device, recognized through the version field. """
+    for byteorder in ['<', '>']:
+        if len(data) >= 12 and struct.unpack_from(byteorder + 'I', data, 8)[0] == VERSION:
+            return byteorder
+    raise ValueError('Unsupported trace dump version')
+
+
+def convert(data: bytes) -> typing.Dict:
+    if not data.startswith(MAGIC):
+        raise ValueError('Not a binary trace dump')
+
+    byteorder = detect_byteorder(data)
+    record_format = struct.Struct(byteorder + RECORD_FORMAT.format[1:])
+
+    reader = Reader(data, byteorder)
+    reader.read_bytes(len(MAGIC))
+    _, record_size, string_count, thread_count = reader.read('IIII')
+    if record_size != record_format.size:
+        raise ValueError('Unexpected record size %d' % record_size)
+
+    strings = {}
+    for _ in range(string_count):
+        kind, string_id, length = reader.read('BHH')
+        strings[(kind, string_id)] = reader.read_bytes(length).decode('utf-8', errors='replace')
+
+    events = []
+    start_ns = None
+    for _ in range(thread_count):
+        thread_id, written, count = reader.read('QQI')
+        if written > count:
+            log.warning('Thread %d: %d oldest events were overwritten', thread_id, written - count)
+
+        for _ in range(count):
+            timestamp_ns, value, label, group, record_type = record_format.unpack(reader.read_bytes(record_format.size))
+            if start_ns is None or timestamp_ns < start_ns:
+                start_ns = timestamp_ns
+
+            # Identical strings may have several identifiers, events refer to them by text
+            # so that they get merged back.
+            event = {
+                'name': strings.get((LABEL_STRINGS, label), '<unknown>'),
+                'cat': strings.get((GROUP_STRINGS, group), '<unknown>'),
+                'pid': 0,
+                'tid': thread_id,
+                'ts': timestamp_ns,
+            }
+
+            if record_type == RECORD_BEGIN:
+                event['ph'] = 'B'
+            elif record_type == RECORD_END:
+                event['ph'] = 'E'
+            elif record_type == RECORD_INSTANT:
+                event['ph'] = 'i'
+                event['s'] = 't'
+            elif record_type == RECORD_COUNTER:
+                event['ph'] = 'C'
+                event['args'] = {'count': value}
+            elif record_type == RECORD_METRIC:
+                event['ph'] = 'i'
+                event['s'] = 't'
+                event['args'] = {'value': value}
+            else:
+                log.warning('Skipping record of unknown type %d', record_type)
+                continue
+
+            events.append(event)
+
+    # Timestamps are in microseconds, relative to the oldest event.
+    for event in events:
+        event['ts'] = (event['ts'] - start_ns) / 1000.0
+    events.sort(key=lambda e: e['ts'])
+
+    return {'traceEvents': events, 'displayTimeUnit': 'ns'}
+
+
+@click.command()
+@click.option('--input', 'input_path', type=click.Path(exists=True), required=True, help='Binary trace dump')
+@click.option('--output', 'output_path', type=click.Path(exists=False), default='-', show_default=True, help='JSON output file')
+def main(input_path: str, output_path: str):
+    logging.basicConfig(level=logging.INFO)
+
+    with open(input_path, 'rb') as f:
+        trace = convert(f.read())
+
+    if output_path == '-':
+        json.dump(trace, sys.stdout)
+    else:
+        with open(output_path, 'w') as f:
+            json.dump(trace, f)
+    return 0
+
+
+if __name__ == '__main__':
+    main(auto_envvar_prefix='CHIP')
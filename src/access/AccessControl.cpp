@@ -49,27 +49,6 @@ static_assert(((unsigned(Privilege::kAdminister) & unsigned(Privilege::kManage))
                   ((unsigned(Privilege::kView) & unsigned(Privilege::kProxyView)) == 0),
               "Privilege bits must be unique");
 
-bool CheckRequestPrivilegeAgainstEntryPrivilege(Privilege requestPrivilege, Privilege entryPrivilege)
-{
-    switch (entryPrivilege)
-    {
-    case Privilege::kView:
-        return requestPrivilege == Privilege::kView;
-    case Privilege::kProxyView:
-        return requestPrivilege == Privilege::kProxyView || requestPrivilege == Privilege::kView;
-    case Privilege::kOperate:
-        return requestPrivilege == Privilege::kOperate || requestPrivilege == Privilege::kView;
-    case Privilege::kManage:
-        return requestPrivilege == Privilege::kManage || requestPrivilege == Privilege::kOperate ||
-            requestPrivilege == Privilege::kView;
-    case Privilege::kAdminister:
-        return requestPrivilege == Privilege::kAdminister || requestPrivilege == Privilege::kManage ||
-            requestPrivilege == Privilege::kOperate || requestPrivilege == Privilege::kView ||
-            requestPrivilege == Privilege::kProxyView;
-    }
-    return false;
-}
-
 constexpr bool IsValidCaseNodeId(NodeId aNodeId)
 {
     if (IsOperationalNodeId(aNodeId))
@@ -194,6 +173,27 @@ char GetRequestTypeStringForLogging(RequestType requestType)
 
 } // namespace
 
+bool CheckRequestPrivilegeAgainstEntryPrivilege(Privilege requestPrivilege, Privilege entryPrivilege)
+{
+    switch (entryPrivilege)
+    {
+    case Privilege::kView:
+        return requestPrivilege == Privilege::kView;
+    case Privilege::kProxyView:
+        return requestPrivilege == Privilege::kProxyView || requestPrivilege == Privilege::kView;
+    case Privilege::kOperate:
+        return requestPrivilege == Privilege::kOperate || requestPrivilege == Privilege::kView;
+    case Privilege::kManage:
+        return requestPrivilege == Privilege::kManage || requestPrivilege == Privilege::kOperate ||
+            requestPrivilege == Privilege::kView;
+    case Privilege::kAdminister:
+        return requestPrivilege == Privilege::kAdminister || requestPrivilege == Privilege::kManage ||
+            requestPrivilege == Privilege::kOperate || requestPrivilege == Privilege::kView ||
+            requestPrivilege == Privilege::kProxyView;
+    }
+    return false;
+}
+
 Global<AccessControl::Entry::Delegate> AccessControl::Entry::mDefaultDelegate;
 Global<AccessControl::EntryIterator::Delegate> AccessControl::EntryIterator::mDefaultDelegate;
 
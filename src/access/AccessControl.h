@@ -704,6 +704,12 @@ private:
 #endif
 };
 
+/**
+ * Check whether an ACL entry granting entryPrivilege also grants requestPrivilege,
+ * following the privilege hierarchy of the spec (e.g. Administer subsumes Manage).
+ */
+bool CheckRequestPrivilegeAgainstEntryPrivilege(Privilege requestPrivilege, Privilege entryPrivilege);
+
 /**
  * Get the global instance set by SetAccessControl, or the default.
  *
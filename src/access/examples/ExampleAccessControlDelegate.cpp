@@ -952,6 +952,296 @@ CHIP_ERROR Copy(const Entry & entry, EntryStorage & storage)
     return CopyViaInterface(entry, storage);
 }
 
+#if CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_INDEXED_CHECK
+
+// Compiled form of the access control list, used to answer checks without walking every entry
+// (and every subject and target of every entry) through the entry and iterator delegates.
+//
+// Subjects of all entries are kept in a table sorted by (fabric, auth mode, subject), so the
+// entries that can possibly match a subject descriptor are found with a few binary searches:
+// one for the subject itself, one for entries without subjects (which match any subject), and
+// one per CAT of the descriptor (since all versions of a CAT identifier sort together). Only
+// those entries then have their privilege and targets checked.
+//
+// The table is rebuilt lazily on the first check after the access control list changes, and
+// recent decisions are remembered until then.
+class CheckIndex
+{
+public:
+    void Invalidate()
+    {
+        mBuilt = false;
+#if CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_CHECK_CACHE_SIZE > 0
+        for (auto & decision : mDecisions)
+        {
+            decision.valid = false;
+        }
+#endif // CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_CHECK_CACHE_SIZE > 0
+    }
+
+    // Same contract as AccessControl::Delegate::Check: CHIP_ERROR_NOT_IMPLEMENTED hands the
+    // check over to the default algorithm, which is done for anything the index can't decide.
+    CHIP_ERROR Check(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath, Privilege requestPrivilege)
+    {
+        // Only CASE and group subjects are checked against entries (e.g. PASE is implicitly admin).
+        VerifyOrReturnError(subjectDescriptor.authMode == AuthMode::kCase || subjectDescriptor.authMode == AuthMode::kGroup,
+                            CHIP_ERROR_NOT_IMPLEMENTED);
+
+        if (!mBuilt)
+        {
+            Build();
+        }
+        VerifyOrReturnError(mUsable, CHIP_ERROR_NOT_IMPLEMENTED);
+
+#if CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_CHECK_CACHE_SIZE > 0
+        Decision & decision = mDecisions[Hash(subjectDescriptor, requestPath, requestPrivilege) % MATTER_ARRAY_SIZE(mDecisions)];
+        if (decision.Matches(subjectDescriptor, requestPath, requestPrivilege))
+        {
+            return decision.allowed ? CHIP_NO_ERROR : CHIP_ERROR_ACCESS_DENIED;
+        }
+#endif // CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_CHECK_CACHE_SIZE > 0
+
+        const Result result = Evaluate(subjectDescriptor, requestPath, requestPrivilege);
+
+        // Device type targets need the device type resolver, which only the default algorithm has.
+        VerifyOrReturnError(result != Result::kUndetermined, CHIP_ERROR_NOT_IMPLEMENTED);
+
+#if CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_CHECK_CACHE_SIZE > 0
+        decision.Set(subjectDescriptor, requestPath, requestPrivilege, result == Result::kAllowed);
+#endif // CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_CHECK_CACHE_SIZE > 0
+
+        return (result == Result::kAllowed) ? CHIP_NO_ERROR : CHIP_ERROR_ACCESS_DENIED;
+    }
+
+private:
+    enum class Result : uint8_t
+    {
+        kDenied,
+        kAllowed,
+        kUndetermined,
+    };
+
+    struct SubjectKey
+    {
+        NodeId subject;
+        FabricIndex fabricIndex;
+        AuthMode authMode;
+        uint16_t entry; // absolute index in the access control list
+
+        bool operator<(const SubjectKey & other) const
+        {
+            if (fabricIndex != other.fabricIndex)
+            {
+                return fabricIndex < other.fabricIndex;
+            }
+            if (authMode != other.authMode)
+            {
+                return authMode < other.authMode;
+            }
+            return subject < other.subject;
+        }
+    };
+
+#if CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_CHECK_CACHE_SIZE > 0
+    struct Decision
+    {
+        bool valid = false;
+        bool allowed;
+        FabricIndex fabricIndex;
+        AuthMode authMode;
+        Privilege privilege;
+        EndpointId endpoint;
+        ClusterId cluster;
+        NodeId subject;
+        chip::CATValues cats;
+
+        bool Matches(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath, Privilege requestPrivilege) const
+        {
+            // CATs are compared exactly (not as sets) so reordered CATs simply miss.
+            return valid && fabricIndex == subjectDescriptor.fabricIndex && authMode == subjectDescriptor.authMode &&
+                privilege == requestPrivilege && endpoint == requestPath.endpoint && cluster == requestPath.cluster &&
+                subject == subjectDescriptor.subject && cats.values == subjectDescriptor.cats.values;
+        }
+
+        void Set(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath, Privilege requestPrivilege,
+                 bool isAllowed)
+        {
+            valid       = true;
+            allowed     = isAllowed;
+            fabricIndex = subjectDescriptor.fabricIndex;
+            authMode    = subjectDescriptor.authMode;
+            privilege   = requestPrivilege;
+            endpoint    = requestPath.endpoint;
+            cluster     = requestPath.cluster;
+            subject     = subjectDescriptor.subject;
+            cats        = subjectDescriptor.cats;
+        }
+    };
+
+    static size_t Hash(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath, Privilege requestPrivilege)
+    {
+        uint64_t hash = subjectDescriptor.subject;
+        for (auto cat : subjectDescriptor.cats.values)
+        {
+            hash = (hash * 31) ^ cat;
+        }
+        hash = (hash * 31) ^ requestPath.cluster;
+        hash = (hash * 31) ^ requestPath.endpoint;
+        hash = (hash * 31) ^ static_cast<uint64_t>(requestPrivilege);
+        hash = (hash * 31) ^ subjectDescriptor.fabricIndex;
+        hash ^= hash >> 32;
+        return static_cast<size_t>(hash);
+    }
+#endif // CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_CHECK_CACHE_SIZE > 0
+
+    // Entries are validated when created or updated, so any inconsistency found here means the
+    // index can't be trusted to produce the same result as the default algorithm, which is
+    // left to report it.
+    void Build()
+    {
+        constexpr auto & acl = EntryStorage::acl;
+
+        mBuilt        = true;
+        mUsable       = false;
+        mSubjectCount = 0;
+
+        for (size_t i = 0; i < MATTER_ARRAY_SIZE(acl) && acl[i].InUse(); ++i)
+        {
+            const auto & storage = acl[i];
+            VerifyOrReturn(storage.mAuthMode == AuthMode::kCase || storage.mAuthMode == AuthMode::kGroup);
+
+            bool hasSubjects = false;
+            for (const auto & subjectStorage : storage.mSubjects)
+            {
+                NodeId subject = kUndefinedNodeId;
+                if (subjectStorage.Get(subject) != CHIP_NO_ERROR)
+                {
+                    break;
+                }
+                const bool isCaseSubject = chip::IsOperationalNodeId(subject) || chip::IsCASEAuthTag(subject);
+                VerifyOrReturn(isCaseSubject ? (storage.mAuthMode == AuthMode::kCase)
+                                             : (chip::IsGroupId(subject) && storage.mAuthMode == AuthMode::kGroup));
+                AddSubject(storage, i, subject);
+                hasSubjects = true;
+            }
+
+            if (!hasSubjects)
+            {
+                // No subjects means any subject: index it under the undefined node ID, which no subject can be.
+                AddSubject(storage, i, kUndefinedNodeId);
+            }
+        }
+
+        std::sort(mSubjects, mSubjects + mSubjectCount);
+        mUsable = true;
+    }
+
+    void AddSubject(const EntryStorage & storage, size_t entry, NodeId subject)
+    {
+        mSubjects[mSubjectCount++] = { subject, storage.mFabricIndex, storage.mAuthMode, static_cast<uint16_t>(entry) };
+    }
+
+    Result Evaluate(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath, Privilege requestPrivilege) const
+    {
+        const FabricIndex fabricIndex = subjectDescriptor.fabricIndex;
+        const AuthMode authMode       = subjectDescriptor.authMode;
+        Result result                 = Result::kDenied;
+
+        auto evaluateRange = [&](NodeId first, NodeId last) {
+            const SubjectKey * const keysEnd = mSubjects + mSubjectCount;
+            const SubjectKey * begin = std::lower_bound(mSubjects, keysEnd, SubjectKey{ first, fabricIndex, authMode, 0 });
+            const SubjectKey * end   = std::upper_bound(begin, keysEnd, SubjectKey{ last, fabricIndex, authMode, 0 });
+            for (const auto * key = begin; key < end && result != Result::kAllowed; ++key)
+            {
+                const Result entryResult = EvaluateEntry(EntryStorage::acl[key->entry], requestPath, requestPrivilege);
+                if (entryResult != Result::kDenied)
+                {
+                    result = entryResult;
+                }
+            }
+        };
+
+        // Entries without subjects...
+        evaluateRange(kUndefinedNodeId, kUndefinedNodeId);
+
+        // ...entries listing the subject itself (CATs only ever match through the descriptor's CATs)...
+        if (result != Result::kAllowed && subjectDescriptor.subject != kUndefinedNodeId &&
+            !chip::IsCASEAuthTag(subjectDescriptor.subject))
+        {
+            evaluateRange(subjectDescriptor.subject, subjectDescriptor.subject);
+        }
+
+        // ...and entries listing a CAT of the descriptor with the same identifier and a version that is not newer.
+        if (authMode == AuthMode::kCase)
+        {
+            for (auto cat : subjectDescriptor.cats.values)
+            {
+                if (result == Result::kAllowed)
+                {
+                    break;
+                }
+                if (cat == chip::kUndefinedCAT || chip::GetCASEAuthTagVersion(cat) == 0)
+                {
+                    continue;
+                }
+                const auto firstVersion = static_cast<chip::CASEAuthTag>((cat & chip::kTagIdentifierMask) | 1);
+                evaluateRange(chip::NodeIdFromCASEAuthTag(firstVersion), chip::NodeIdFromCASEAuthTag(cat));
+            }
+        }
+
+        return result;
+    }
+
+    static Result EvaluateEntry(const EntryStorage & storage, const RequestPath & requestPath, Privilege requestPrivilege)
+    {
+        VerifyOrReturnValue(CheckRequestPrivilegeAgainstEntryPrivilege(requestPrivilege, storage.mPrivilege), Result::kDenied);
+
+        bool hasTargets   = false;
+        bool undetermined = false;
+        for (const auto & targetStorage : storage.mTargets)
+        {
+            Target target;
+            if (targetStorage.Get(target) != CHIP_NO_ERROR)
+            {
+                break;
+            }
+            hasTargets = true;
+            if ((target.flags & Target::kCluster) && target.cluster != requestPath.cluster)
+            {
+                continue;
+            }
+            if ((target.flags & Target::kEndpoint) && target.endpoint != requestPath.endpoint)
+            {
+                continue;
+            }
+            if (target.flags & Target::kDeviceType)
+            {
+                undetermined = true;
+                continue;
+            }
+            return Result::kAllowed;
+        }
+
+        if (!hasTargets)
+        {
+            return Result::kAllowed;
+        }
+        return undetermined ? Result::kUndetermined : Result::kDenied;
+    }
+
+    static constexpr size_t kMaxSubjectKeys = MATTER_ARRAY_SIZE(EntryStorage::acl) * EntryStorage::kMaxSubjects;
+
+    bool mBuilt          = false;
+    bool mUsable         = false;
+    size_t mSubjectCount = 0;
+    SubjectKey mSubjects[kMaxSubjectKeys];
+#if CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_CHECK_CACHE_SIZE > 0
+    Decision mDecisions[CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_CHECK_CACHE_SIZE];
+#endif // CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_CHECK_CACHE_SIZE > 0
+};
+
+#endif // CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_INDEXED_CHECK
+
 class AccessControlDelegate : public AccessControl::Delegate
 {
 public:
@@ -962,6 +1252,7 @@ public:
         {
             storage.Clear();
         }
+        AccessControlListChanged();
         return CHIP_NO_ERROR;
     }
 
@@ -1042,6 +1333,7 @@ public:
             CHIP_ERROR err = Copy(entry, *storage);
             if (err == CHIP_NO_ERROR)
             {
+                AccessControlListChanged();
                 if (fabricIndex != nullptr)
                 {
                     *fabricIndex = storage->mFabricIndex;
@@ -1078,6 +1370,8 @@ public:
     {
         if (auto * storage = EntryStorage::FindUsedInAcl(index, fabricIndex))
         {
+            // Copy may fail part way, so consider the entry changed regardless.
+            AccessControlListChanged();
             return Copy(entry, *storage);
         }
         return CHIP_ERROR_SENTINEL;
@@ -1122,6 +1416,7 @@ public:
                 delegate.FixAfterDelete(*storage);
             }
 
+            AccessControlListChanged();
             return CHIP_NO_ERROR;
         }
 
@@ -1141,8 +1436,24 @@ public:
     CHIP_ERROR Check(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
                      Privilege requestPrivilege) override
     {
+#if CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_INDEXED_CHECK
+        return mCheckIndex.Check(subjectDescriptor, requestPath, requestPrivilege);
+#else
         return CHIP_ERROR_NOT_IMPLEMENTED;
+#endif // CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_INDEXED_CHECK
     }
+
+private:
+    void AccessControlListChanged()
+    {
+#if CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_INDEXED_CHECK
+        mCheckIndex.Invalidate();
+#endif // CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_INDEXED_CHECK
+    }
+
+#if CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_INDEXED_CHECK
+    CheckIndex mCheckIndex;
+#endif // CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_INDEXED_CHECK
 };
 
 static_assert(std::is_pod<SubjectStorage>(), "Storage type must be POD");
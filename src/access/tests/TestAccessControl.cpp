@@ -1761,6 +1761,60 @@ TEST_F(TestAccessControl, TestCheck)
     }
 }
 
+// Checks may be answered from remembered decisions, so make sure changes to entries are
+// reflected by the very next check.
+TEST_F(TestAccessControl, TestCheckAfterEntryChanges)
+{
+    EXPECT_SUCCESS(LoadAccessControl(accessControl, entryData1, entryData1Count));
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        for (const auto & checkData : checkData1)
+        {
+            CHIP_ERROR expectedResult = checkData.allow ? CHIP_NO_ERROR : CHIP_ERROR_ACCESS_DENIED;
+            auto requestPath          = checkData.requestPath;
+#if CHIP_CONFIG_USE_ACCESS_RESTRICTIONS
+            requestPath.requestType = Access::RequestType::kAttributeReadRequest;
+#endif
+            EXPECT_EQ(accessControl.Check(checkData.subjectDescriptor, requestPath, checkData.privilege), expectedResult);
+        }
+    }
+
+    EXPECT_SUCCESS(ClearAccessControl(accessControl));
+    for (const auto & checkData : checkData1)
+    {
+        CHIP_ERROR expectedResult =
+            (checkData.subjectDescriptor.authMode == AuthMode::kPase) ? CHIP_NO_ERROR : CHIP_ERROR_ACCESS_DENIED;
+        auto requestPath = checkData.requestPath;
+#if CHIP_CONFIG_USE_ACCESS_RESTRICTIONS
+        requestPath.requestType = Access::RequestType::kAttributeReadRequest;
+#endif
+        EXPECT_EQ(accessControl.Check(checkData.subjectDescriptor, requestPath, checkData.privilege), expectedResult);
+    }
+
+    const SubjectDescriptor subjectDescriptor = { .fabricIndex = 1, .authMode = AuthMode::kCase, .subject = kOperationalNodeId3 };
+    RequestPath requestPath                   = { .cluster = kOnOffCluster, .endpoint = 1 };
+#if CHIP_CONFIG_USE_ACCESS_RESTRICTIONS
+    requestPath.requestType = Access::RequestType::kAttributeReadRequest;
+#endif
+
+    EntryData data = { .fabricIndex = 1, .privilege = Privilege::kView, .authMode = AuthMode::kCase };
+    EXPECT_SUCCESS(LoadAccessControl(accessControl, &data, 1));
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kView), CHIP_NO_ERROR);
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kOperate), CHIP_ERROR_ACCESS_DENIED);
+
+    data.privilege = Privilege::kOperate;
+    {
+        Entry entry;
+        EXPECT_SUCCESS(accessControl.PrepareEntry(entry));
+        EXPECT_SUCCESS(LoadEntry(entry, data));
+        EXPECT_SUCCESS(accessControl.UpdateEntry(0, entry));
+    }
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kOperate), CHIP_NO_ERROR);
+
+    EXPECT_SUCCESS(accessControl.DeleteEntry(0));
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kView), CHIP_ERROR_ACCESS_DENIED);
+}
+
 TEST_F(TestAccessControl, TestCreateReadEntry)
 {
     for (size_t i = 0; i < entryData1Count; ++i)
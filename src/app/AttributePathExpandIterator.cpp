@@ -18,6 +18,7 @@
 
 #include <app/GlobalAttributes.h>
 #include <app/data-model-provider/MetadataLookup.h>
+#include <app/data-model-provider/MetadataSnapshot.h>
 #include <app/data-model-provider/MetadataTypes.h>
 #include <lib/core/DataModelTypes.h>
 #include <lib/support/CodeUtils.h>
@@ -34,6 +35,50 @@ AttributePathExpandIterator::AttributePathExpandIterator(DataModel::Provider * d
     mDataModelProvider(dataModel), mPosition(position)
 {}
 
+void AttributePathExpandIterator::RefreshSnapshot()
+{
+    const DataModel::MetadataSnapshot * snapshot = mDataModelProvider->GetMetadataSnapshot();
+    const uint32_t generation                    = (snapshot != nullptr) ? snapshot->Generation() : 0;
+
+    VerifyOrReturn((snapshot != mSnapshot) || (generation != mSnapshotGeneration));
+
+    mSnapshot           = snapshot;
+    mSnapshotGeneration = generation;
+
+    // Current lists may reference the previous snapshot content. Invalid indexes make
+    // every level re-fetch its list and re-position based on the current output path.
+    mEndpointIndex  = kInvalidIndex;
+    mClusterIndex   = kInvalidIndex;
+    mAttributeIndex = kInvalidIndex;
+    mEndpoints      = ReadOnlyBuffer<DataModel::EndpointEntry>();
+    mClusters       = ReadOnlyBuffer<DataModel::ServerClusterEntry>();
+    mAttributes     = ReadOnlyBuffer<DataModel::AttributeEntry>();
+}
+
+ReadOnlyBuffer<DataModel::EndpointEntry> AttributePathExpandIterator::FetchEndpoints()
+{
+    VerifyOrReturnValue(mSnapshot != nullptr, mDataModelProvider->EndpointsIgnoreError());
+
+    Span<const DataModel::EndpointEntry> endpoints = mSnapshot->Endpoints();
+    return ReadOnlyBuffer<DataModel::EndpointEntry>(endpoints.data(), endpoints.size(), /* allocated = */ false);
+}
+
+ReadOnlyBuffer<DataModel::ServerClusterEntry> AttributePathExpandIterator::FetchServerClusters(EndpointId endpointId)
+{
+    VerifyOrReturnValue(mSnapshot != nullptr, mDataModelProvider->ServerClustersIgnoreError(endpointId));
+
+    Span<const DataModel::ServerClusterEntry> clusters = mSnapshot->ServerClusters(endpointId);
+    return ReadOnlyBuffer<DataModel::ServerClusterEntry>(clusters.data(), clusters.size(), /* allocated = */ false);
+}
+
+ReadOnlyBuffer<DataModel::AttributeEntry> AttributePathExpandIterator::FetchAttributes(const ConcreteClusterPath & path)
+{
+    VerifyOrReturnValue(mSnapshot != nullptr, mDataModelProvider->AttributesIgnoreError(path));
+
+    Span<const DataModel::AttributeEntry> attributes = mSnapshot->Attributes(path);
+    return ReadOnlyBuffer<DataModel::AttributeEntry>(attributes.data(), attributes.size(), /* allocated = */ false);
+}
+
 bool AttributePathExpandIterator::AdvanceOutputPath(std::optional<DataModel::AttributeEntry> * entry)
 {
     /// Output path invariants
@@ -95,6 +140,8 @@ bool AttributePathExpandIterator::AdvanceOutputPath(std::optional<DataModel::Att
 
 bool AttributePathExpandIterator::Next(ConcreteAttributePath & path, std::optional<DataModel::AttributeEntry> * entry)
 {
+    RefreshSnapshot();
+
     while (mPosition.mAttributePath != nullptr)
     {
         if (AdvanceOutputPath(entry))
@@ -122,7 +169,7 @@ std::optional<AttributeId> AttributePathExpandIterator::NextAttribute(std::optio
     if (mAttributeIndex == kInvalidIndex)
     {
         // start a new iteration of attributes on the current cluster path.
-        mAttributes = mDataModelProvider->AttributesIgnoreError(mPosition.mOutputPath);
+        mAttributes = FetchAttributes(mPosition.mOutputPath);
 
         if (mPosition.mOutputPath.mAttributeId != kInvalidAttributeId)
         {
@@ -144,11 +191,11 @@ std::optional<AttributeId> AttributePathExpandIterator::NextAttribute(std::optio
             //
             // For wildcard expansion, we validate that this is a valid attribute for the given
             // cluster on the given endpoint. If not a wildcard expansion, return it as-is.
-            DataModel::AttributeFinder finder(mDataModelProvider);
-
             const ConcreteAttributePath attributePath(mPosition.mOutputPath.mEndpointId, mPosition.mOutputPath.mClusterId,
                                                       mPosition.mAttributePath->mValue.mAttributeId);
-            std::optional<DataModel::AttributeEntry> foundEntry = finder.Find(attributePath);
+            std::optional<DataModel::AttributeEntry> foundEntry = (mSnapshot != nullptr)
+                ? mSnapshot->FindAttribute(attributePath)
+                : DataModel::AttributeFinder(mDataModelProvider).Find(attributePath);
 
             // if the entry is valid, we can just return it
             if (foundEntry.has_value())
@@ -214,7 +261,7 @@ std::optional<ClusterId> AttributePathExpandIterator::NextClusterId()
     if (mClusterIndex == kInvalidIndex)
     {
         // start a new iteration on the current endpoint
-        mClusters = mDataModelProvider->ServerClustersIgnoreError(mPosition.mOutputPath.mEndpointId);
+        mClusters = FetchServerClusters(mPosition.mOutputPath.mEndpointId);
 
         if (mPosition.mOutputPath.mClusterId != kInvalidClusterId)
         {
@@ -276,7 +323,7 @@ std::optional<EndpointId> AttributePathExpandIterator::NextEndpointId()
     if (mEndpointIndex == kInvalidIndex)
     {
         // index is missing, have to start a new iteration
-        mEndpoints = mDataModelProvider->EndpointsIgnoreError();
+        mEndpoints = FetchEndpoints();
 
         if (mPosition.mOutputPath.mEndpointId != kInvalidEndpointId)
         {
@@ -19,6 +19,7 @@
 
 #include <app/AttributePathParams.h>
 #include <app/ConcreteAttributePath.h>
+#include <app/data-model-provider/MetadataSnapshot.h>
 #include <app/data-model-provider/MetadataTypes.h>
 #include <app/data-model-provider/Provider.h>
 #include <lib/core/DataModelTypes.h>
@@ -146,6 +147,20 @@ private:
     ReadOnlyBuffer<DataModel::AttributeEntry> mAttributes; // all attributes ON THE CURRENT cluster
     size_t mAttributeIndex = kInvalidIndex;
 
+    // When the provider has a metadata snapshot, the lists above reference it in place instead of
+    // being allocated on every step. They are only valid while the snapshot generation stays the same.
+    const DataModel::MetadataSnapshot * mSnapshot = nullptr;
+    uint32_t mSnapshotGeneration                 = 0;
+
+    /// Picks up the current metadata snapshot of the provider (if any).
+    ///
+    /// If the snapshot changed, all lists are re-fetched (and re-positioned) on their next use.
+    void RefreshSnapshot();
+
+    ReadOnlyBuffer<DataModel::EndpointEntry> FetchEndpoints();
+    ReadOnlyBuffer<DataModel::ServerClusterEntry> FetchServerClusters(EndpointId endpointId);
+    ReadOnlyBuffer<DataModel::AttributeEntry> FetchAttributes(const ConcreteClusterPath & path);
+
     /// Move to the next endpoint/cluster/attribute triplet that is valid given
     /// the current mOutputPath and mpAttributePath.
     ///
@@ -19,7 +19,8 @@
 #include "system/SystemPacketBuffer.h"
 #include <app/ClusterStateCache.h>
 #include <app/InteractionModelEngine.h>
-#include <tuple>
+
+#include <algorithm>
 
 namespace chip {
 namespace app {
@@ -49,8 +50,8 @@ uint32_t SizeOfStatusIB(const StatusIB & aStatus)
 
 } // anonymous namespace
 
-template <bool CanEnableDataCaching>
-CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::GetElementTLVSize(TLV::TLVReader * apData, uint32_t & aSize)
+template <bool CanEnableDataCaching, ClusterStateCacheStorageMode kStorageMode>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching, kStorageMode>::GetElementTLVSize(TLV::TLVReader * apData, uint32_t & aSize)
 {
     Platform::ScopedMemoryBufferWithSize<uint8_t> backingBuffer;
     TLV::TLVReader reader;
@@ -65,17 +66,17 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::GetElementTLVSize(TLV::TLVR
     return CHIP_NO_ERROR;
 }
 
-template <bool CanEnableDataCaching>
-CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateCache(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData,
-                                                                 const StatusIB & aStatus)
+template <bool CanEnableDataCaching, ClusterStateCacheStorageMode kStorageMode>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching, kStorageMode>::UpdateCache(const ConcreteDataAttributePath & aPath,
+                                                                               TLV::TLVReader * apData, const StatusIB & aStatus)
 {
     AttributeState state;
     bool endpointIsNew = false;
 
-    if (mCache.find(aPath.mEndpointId) == mCache.end())
+    if (!mCache.HasEndpoint(aPath.mEndpointId))
     {
         //
-        // Since we might potentially be creating a new entry at mCache[aPath.mEndpointId][aPath.mClusterId] that
+        // Since we might potentially be creating a new entry for aPath.mEndpointId that
         // wasn't there before, we need to check if an entry didn't exist there previously and remember that so that
         // we can appropriately notify our clients of the addition of a new endpoint.
         //
@@ -91,12 +92,12 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateCache(const ConcreteD
         {
             if (mCacheData)
             {
-                Platform::ScopedMemoryBufferWithSize<uint8_t> backingBuffer;
-                backingBuffer.Calloc(elementSize);
-                VerifyOrReturnError(backingBuffer.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
-                TLV::ScopedBufferTLVWriter writer(std::move(backingBuffer), elementSize);
+                AttributeData backingBuffer;
+                ReturnErrorOnFailure(mAttributeDataAllocator.Allocate(elementSize, backingBuffer));
+                TLV::TLVWriter writer;
+                writer.Init(backingBuffer.Get(), elementSize);
                 ReturnErrorOnFailure(writer.CopyElement(TLV::AnonymousTag(), *apData));
-                ReturnErrorOnFailure(writer.Finalize(backingBuffer));
+                ReturnErrorOnFailure(writer.Finalize());
 
                 state.template Set<AttributeData>(std::move(backingBuffer));
             }
@@ -114,7 +115,7 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateCache(const ConcreteD
         // Clear out the committed data version and only set it again once we have received all data for this cluster.
         // Otherwise, we may have incomplete data that looks like it's complete since it has a valid data version.
         //
-        mCache[aPath.mEndpointId][aPath.mClusterId].mCommittedDataVersion.ClearValue();
+        mCache.GetOrCreateCluster(aPath.mEndpointId, aPath.mClusterId).mCommittedDataVersion.ClearValue();
 
         // This commits a pending data version if the last report path is valid and it is different from the current path.
         if (mLastReportDataPath.IsValidConcreteClusterPath() && mLastReportDataPath != aPath)
@@ -135,7 +136,7 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateCache(const ConcreteD
         // if this data item is encompassed by a wildcard path, let's go ahead and update its pending data version.
         if (foundEncompassingWildcardPath)
         {
-            mCache[aPath.mEndpointId][aPath.mClusterId].mPendingDataVersion = aPath.mDataVersion;
+            mCache.GetOrCreateCluster(aPath.mEndpointId, aPath.mClusterId).mPendingDataVersion = aPath.mDataVersion;
         }
 
         mLastReportDataPath = aPath;
@@ -168,19 +169,20 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateCache(const ConcreteD
         mAddedEndpoints.push_back(aPath.mEndpointId);
     }
 
-    mCache[aPath.mEndpointId][aPath.mClusterId].mAttributes[aPath.mAttributeId] = std::move(state);
+    mCache.SetAttribute(aPath, std::move(state));
 
     if (mCacheData)
     {
-        mChangedAttributeSet.insert(aPath);
+        mChangedAttributes.push_back(aPath);
     }
 
     return CHIP_NO_ERROR;
 }
 
-template <bool CanEnableDataCaching>
-CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateEventCache(const EventHeader & aEventHeader, TLV::TLVReader * apData,
-                                                                      const StatusIB * apStatus)
+template <bool CanEnableDataCaching, ClusterStateCacheStorageMode kStorageMode>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching, kStorageMode>::UpdateEventCache(const EventHeader & aEventHeader,
+                                                                                    TLV::TLVReader * apData,
+                                                                                    const StatusIB * apStatus)
 {
     if (apData)
     {
@@ -227,24 +229,24 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateEventCache(const Even
     return CHIP_NO_ERROR;
 }
 
-template <bool CanEnableDataCaching>
-void ClusterStateCacheT<CanEnableDataCaching>::OnReportBegin()
+template <bool CanEnableDataCaching, ClusterStateCacheStorageMode kStorageMode>
+void ClusterStateCacheT<CanEnableDataCaching, kStorageMode>::OnReportBegin()
 {
     mLastReportDataPath = ConcreteClusterPath(kInvalidEndpointId, kInvalidClusterId);
-    mChangedAttributeSet.clear();
+    mChangedAttributes.clear();
     mAddedEndpoints.clear();
     mCallback.OnReportBegin();
 }
 
-template <bool CanEnableDataCaching>
-void ClusterStateCacheT<CanEnableDataCaching>::CommitPendingDataVersion()
+template <bool CanEnableDataCaching, ClusterStateCacheStorageMode kStorageMode>
+void ClusterStateCacheT<CanEnableDataCaching, kStorageMode>::CommitPendingDataVersion()
 {
     if (!mLastReportDataPath.IsValidConcreteClusterPath())
     {
         return;
     }
 
-    auto & lastClusterInfo = mCache[mLastReportDataPath.mEndpointId][mLastReportDataPath.mClusterId];
+    auto & lastClusterInfo = mCache.GetOrCreateCluster(mLastReportDataPath.mEndpointId, mLastReportDataPath.mClusterId);
     if (lastClusterInfo.mPendingDataVersion.HasValue())
     {
         lastClusterInfo.mCommittedDataVersion = lastClusterInfo.mPendingDataVersion;
@@ -252,26 +254,32 @@ void ClusterStateCacheT<CanEnableDataCaching>::CommitPendingDataVersion()
     }
 }
 
-template <bool CanEnableDataCaching>
-void ClusterStateCacheT<CanEnableDataCaching>::OnReportEnd()
+template <bool CanEnableDataCaching, ClusterStateCacheStorageMode kStorageMode>
+void ClusterStateCacheT<CanEnableDataCaching, kStorageMode>::OnReportEnd()
 {
     CommitPendingDataVersion();
     mLastReportDataPath = ConcreteClusterPath(kInvalidEndpointId, kInvalidClusterId);
-    std::set<std::tuple<EndpointId, ClusterId>> changedClusters;
 
     //
-    // Add the EndpointId and ClusterId into a set so that we only
-    // convey unique combinations in the subsequent OnClusterChanged callback.
+    // Report each changed path once, in path order. Once sorted, the paths of a cluster are contiguous, so unique
+    // (EndpointId, ClusterId) combinations for the subsequent OnClusterChanged callback fall out of a second pass.
     //
-    for (auto & path : mChangedAttributeSet)
+    std::sort(mChangedAttributes.begin(), mChangedAttributes.end());
+    mChangedAttributes.erase(std::unique(mChangedAttributes.begin(), mChangedAttributes.end()), mChangedAttributes.end());
+
+    for (auto & path : mChangedAttributes)
     {
         mCallback.OnAttributeChanged(this, path);
-        changedClusters.insert(std::make_tuple(path.mEndpointId, path.mClusterId));
     }
 
-    for (auto & item : changedClusters)
+    for (size_t i = 0; i < mChangedAttributes.size(); i++)
     {
-        mCallback.OnClusterChanged(this, std::get<0>(item), std::get<1>(item));
+        const auto & path = mChangedAttributes[i];
+        if (i == 0 || path.mEndpointId != mChangedAttributes[i - 1].mEndpointId ||
+            path.mClusterId != mChangedAttributes[i - 1].mClusterId)
+        {
+            mCallback.OnClusterChanged(this, path.mEndpointId, path.mClusterId);
+        }
     }
 
     for (auto endpoint : mAddedEndpoints)
@@ -282,35 +290,38 @@ void ClusterStateCacheT<CanEnableDataCaching>::OnReportEnd()
     mCallback.OnReportEnd();
 }
 
-template <>
-CHIP_ERROR ClusterStateCacheT<true>::Get(const ConcreteAttributePath & path, TLV::TLVReader & reader) const
+template <bool CanEnableDataCaching, ClusterStateCacheStorageMode kStorageMode>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching, kStorageMode>::Get(const ConcreteAttributePath & path,
+                                                                       TLV::TLVReader & reader) const
 {
-    CHIP_ERROR err;
-    auto attributeState = GetAttributeState(path.mEndpointId, path.mClusterId, path.mAttributeId, err);
-    ReturnErrorOnFailure(err);
-
-    if (attributeState->template Is<StatusIB>())
+    if constexpr (CanEnableDataCaching)
     {
-        return CHIP_ERROR_IM_STATUS_CODE_RECEIVED;
-    }
+        CHIP_ERROR err;
+        auto attributeState = GetAttributeState(path, err);
+        ReturnErrorOnFailure(err);
+
+        if (attributeState->template Is<StatusIB>())
+        {
+            return CHIP_ERROR_IM_STATUS_CODE_RECEIVED;
+        }
 
-    if (!attributeState->template Is<AttributeData>())
+        if (!attributeState->template Is<AttributeData>())
+        {
+            return CHIP_ERROR_KEY_NOT_FOUND;
+        }
+
+        reader.Init(attributeState->template Get<AttributeData>().Get(),
+                    attributeState->template Get<AttributeData>().AllocatedSize());
+        return reader.Next();
+    }
+    else
     {
         return CHIP_ERROR_KEY_NOT_FOUND;
     }
-
-    reader.Init(attributeState->template Get<AttributeData>().Get(), attributeState->template Get<AttributeData>().AllocatedSize());
-    return reader.Next();
-}
-
-template <>
-CHIP_ERROR ClusterStateCacheT<false>::Get(const ConcreteAttributePath & path, TLV::TLVReader & reader) const
-{
-    return CHIP_ERROR_KEY_NOT_FOUND;
 }
 
-template <bool CanEnableDataCaching>
-CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::Get(EventNumber eventNumber, TLV::TLVReader & reader) const
+template <bool CanEnableDataCaching, ClusterStateCacheStorageMode kStorageMode>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching, kStorageMode>::Get(EventNumber eventNumber, TLV::TLVReader & reader) const
 {
     CHIP_ERROR err;
 
@@ -326,67 +337,19 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::Get(EventNumber eventNumber
     return CHIP_NO_ERROR;
 }
 
-template <bool CanEnableDataCaching>
-const typename ClusterStateCacheT<CanEnableDataCaching>::EndpointState *
-ClusterStateCacheT<CanEnableDataCaching>::GetEndpointState(EndpointId endpointId, CHIP_ERROR & err) const
+template <bool CanEnableDataCaching, ClusterStateCacheStorageMode kStorageMode>
+const typename ClusterStateCacheT<CanEnableDataCaching, kStorageMode>::AttributeState *
+ClusterStateCacheT<CanEnableDataCaching, kStorageMode>::GetAttributeState(const ConcreteAttributePath & path,
+                                                                          CHIP_ERROR & err) const
 {
-    auto endpointIter = mCache.find(endpointId);
-    if (endpointIter == mCache.end())
-    {
-        err = CHIP_ERROR_KEY_NOT_FOUND;
-        return nullptr;
-    }
-
-    err = CHIP_NO_ERROR;
-    return &endpointIter->second;
-}
-
-template <bool CanEnableDataCaching>
-const typename ClusterStateCacheT<CanEnableDataCaching>::ClusterState *
-ClusterStateCacheT<CanEnableDataCaching>::GetClusterState(EndpointId endpointId, ClusterId clusterId, CHIP_ERROR & err) const
-{
-    auto endpointState = GetEndpointState(endpointId, err);
-    if (err != CHIP_NO_ERROR)
-    {
-        return nullptr;
-    }
-
-    auto clusterState = endpointState->find(clusterId);
-    if (clusterState == endpointState->end())
-    {
-        err = CHIP_ERROR_KEY_NOT_FOUND;
-        return nullptr;
-    }
-
-    err = CHIP_NO_ERROR;
-    return &clusterState->second;
+    auto attributeState = mCache.FindAttribute(path);
+    err                 = (attributeState != nullptr) ? CHIP_NO_ERROR : CHIP_ERROR_KEY_NOT_FOUND;
+    return attributeState;
 }
 
-template <bool CanEnableDataCaching>
-const typename ClusterStateCacheT<CanEnableDataCaching>::AttributeState *
-ClusterStateCacheT<CanEnableDataCaching>::GetAttributeState(EndpointId endpointId, ClusterId clusterId, AttributeId attributeId,
-                                                            CHIP_ERROR & err) const
-{
-    auto clusterState = GetClusterState(endpointId, clusterId, err);
-    if (err != CHIP_NO_ERROR)
-    {
-        return nullptr;
-    }
-
-    auto attributeState = clusterState->mAttributes.find(attributeId);
-    if (attributeState == clusterState->mAttributes.end())
-    {
-        err = CHIP_ERROR_KEY_NOT_FOUND;
-        return nullptr;
-    }
-
-    err = CHIP_NO_ERROR;
-    return &attributeState->second;
-}
-
-template <bool CanEnableDataCaching>
-const typename ClusterStateCacheT<CanEnableDataCaching>::EventData *
-ClusterStateCacheT<CanEnableDataCaching>::GetEventData(EventNumber eventNumber, CHIP_ERROR & err) const
+template <bool CanEnableDataCaching, ClusterStateCacheStorageMode kStorageMode>
+const typename ClusterStateCacheT<CanEnableDataCaching, kStorageMode>::EventData *
+ClusterStateCacheT<CanEnableDataCaching, kStorageMode>::GetEventData(EventNumber eventNumber, CHIP_ERROR & err) const
 {
     EventData compareKey;
 
@@ -402,9 +365,9 @@ ClusterStateCacheT<CanEnableDataCaching>::GetEventData(EventNumber eventNumber,
     return &(*eventData);
 }
 
-template <bool CanEnableDataCaching>
-void ClusterStateCacheT<CanEnableDataCaching>::OnAttributeData(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData,
-                                                               const StatusIB & aStatus)
+template <bool CanEnableDataCaching, ClusterStateCacheStorageMode kStorageMode>
+void ClusterStateCacheT<CanEnableDataCaching, kStorageMode>::OnAttributeData(const ConcreteDataAttributePath & aPath,
+                                                                             TLV::TLVReader * apData, const StatusIB & aStatus)
 {
     //
     // Since the cache itself is a ReadClient::Callback, it may be incorrectly passed in directly when registering with the
@@ -434,21 +397,20 @@ void ClusterStateCacheT<CanEnableDataCaching>::OnAttributeData(const ConcreteDat
     mCallback.OnAttributeData(aPath, apData ? &dataSnapshot : nullptr, aStatus);
 }
 
-template <bool CanEnableDataCaching>
-CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::GetVersion(const ConcreteClusterPath & aPath,
-                                                                Optional<DataVersion> & aVersion) const
+template <bool CanEnableDataCaching, ClusterStateCacheStorageMode kStorageMode>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching, kStorageMode>::GetVersion(const ConcreteClusterPath & aPath,
+                                                                              Optional<DataVersion> & aVersion) const
 {
     VerifyOrReturnError(aPath.IsValidConcreteClusterPath(), CHIP_ERROR_INVALID_ARGUMENT);
-    CHIP_ERROR err;
-    auto clusterState = GetClusterState(aPath.mEndpointId, aPath.mClusterId, err);
-    ReturnErrorOnFailure(err);
-    aVersion = clusterState->mCommittedDataVersion;
+    auto clusterVersions = mCache.FindCluster(aPath.mEndpointId, aPath.mClusterId);
+    VerifyOrReturnError(clusterVersions != nullptr, CHIP_ERROR_KEY_NOT_FOUND);
+    aVersion = clusterVersions->mCommittedDataVersion;
     return CHIP_NO_ERROR;
 }
 
-template <bool CanEnableDataCaching>
-void ClusterStateCacheT<CanEnableDataCaching>::OnEventData(const EventHeader & aEventHeader, TLV::TLVReader * apData,
-                                                           const StatusIB * apStatus)
+template <bool CanEnableDataCaching, ClusterStateCacheStorageMode kStorageMode>
+void ClusterStateCacheT<CanEnableDataCaching, kStorageMode>::OnEventData(const EventHeader & aEventHeader, TLV::TLVReader * apData,
+                                                                         const StatusIB * apStatus)
 {
     VerifyOrDie(apData != nullptr || apStatus != nullptr);
 
@@ -462,31 +424,34 @@ void ClusterStateCacheT<CanEnableDataCaching>::OnEventData(const EventHeader & a
     mCallback.OnEventData(aEventHeader, apData ? &dataSnapshot : nullptr, apStatus);
 }
 
-template <>
-CHIP_ERROR ClusterStateCacheT<true>::GetStatus(const ConcreteAttributePath & path, StatusIB & status) const
+template <bool CanEnableDataCaching, ClusterStateCacheStorageMode kStorageMode>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching, kStorageMode>::GetStatus(const ConcreteAttributePath & path,
+                                                                             StatusIB & status) const
 {
-    CHIP_ERROR err;
+    if constexpr (CanEnableDataCaching)
+    {
+        CHIP_ERROR err;
 
-    auto attributeState = GetAttributeState(path.mEndpointId, path.mClusterId, path.mAttributeId, err);
-    ReturnErrorOnFailure(err);
+        auto attributeState = GetAttributeState(path, err);
+        ReturnErrorOnFailure(err);
+
+        if (!attributeState->template Is<StatusIB>())
+        {
+            return CHIP_ERROR_INVALID_ARGUMENT;
+        }
 
-    if (!attributeState->template Is<StatusIB>())
+        status = attributeState->template Get<StatusIB>();
+        return CHIP_NO_ERROR;
+    }
+    else
     {
         return CHIP_ERROR_INVALID_ARGUMENT;
     }
-
-    status = attributeState->template Get<StatusIB>();
-    return CHIP_NO_ERROR;
-}
-
-template <>
-CHIP_ERROR ClusterStateCacheT<false>::GetStatus(const ConcreteAttributePath & path, StatusIB & status) const
-{
-    return CHIP_ERROR_INVALID_ARGUMENT;
 }
 
-template <bool CanEnableDataCaching>
-CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::GetStatus(const ConcreteEventPath & path, StatusIB & status) const
+template <bool CanEnableDataCaching, ClusterStateCacheStorageMode kStorageMode>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching, kStorageMode>::GetStatus(const ConcreteEventPath & path,
+                                                                             StatusIB & status) const
 {
     auto statusIter = mEventStatusCache.find(path);
     if (statusIter == mEventStatusCache.end())
@@ -498,66 +463,62 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::GetStatus(const ConcreteEve
     return CHIP_NO_ERROR;
 }
 
-template <bool CanEnableDataCaching>
-void ClusterStateCacheT<CanEnableDataCaching>::GetSortedFilters(std::vector<std::pair<DataVersionFilter, size_t>> & aVector) const
+template <bool CanEnableDataCaching, ClusterStateCacheStorageMode kStorageMode>
+void ClusterStateCacheT<CanEnableDataCaching, kStorageMode>::GetSortedFilters(
+    std::vector<std::pair<DataVersionFilter, size_t>> & aVector) const
 {
-    for (auto const & endpointIter : mCache)
-    {
-        EndpointId endpointId = endpointIter.first;
-        for (auto const & clusterIter : endpointIter.second)
+    CHIP_ERROR err = mCache.ForEachCluster([&](EndpointId endpointId, ClusterId clusterId, const ClusterVersions & versions) {
+        if (!versions.mCommittedDataVersion.HasValue())
         {
-            if (!clusterIter.second.mCommittedDataVersion.HasValue())
-            {
-                continue;
-            }
-            DataVersion dataVersion = clusterIter.second.mCommittedDataVersion.Value();
-            size_t clusterSize      = 0;
-            ClusterId clusterId     = clusterIter.first;
+            return CHIP_NO_ERROR;
+        }
+        DataVersion dataVersion = versions.mCommittedDataVersion.Value();
+        size_t clusterSize      = 0;
 
-            for (auto const & attributeIter : clusterIter.second.mAttributes)
+        ReturnErrorOnFailure(mCache.ForEachAttribute(endpointId, clusterId, [&](AttributeId, const AttributeState & state) {
+            if constexpr (CanEnableDataCaching)
             {
-                if constexpr (CanEnableDataCaching)
+                if (state.template Is<StatusIB>())
                 {
-                    if (attributeIter.second.template Is<StatusIB>())
-                    {
-                        clusterSize += SizeOfStatusIB(attributeIter.second.template Get<StatusIB>());
-                    }
-                    else if (attributeIter.second.template Is<uint32_t>())
-                    {
-                        clusterSize += attributeIter.second.template Get<uint32_t>();
-                    }
-                    else
-                    {
-                        VerifyOrDie(attributeIter.second.template Is<AttributeData>());
-                        TLV::TLVReader bufReader;
-                        bufReader.Init(attributeIter.second.template Get<AttributeData>().Get(),
-                                       attributeIter.second.template Get<AttributeData>().AllocatedSize());
-                        ReturnOnFailure(bufReader.Next());
-                        // Skip to the end of the element.
-                        ReturnOnFailure(bufReader.Skip());
-
-                        // Compute the amount of value data
-                        clusterSize += bufReader.GetLengthRead();
-                    }
+                    clusterSize += SizeOfStatusIB(state.template Get<StatusIB>());
+                }
+                else if (state.template Is<uint32_t>())
+                {
+                    clusterSize += state.template Get<uint32_t>();
                 }
                 else
                 {
-                    clusterSize += attributeIter.second;
+                    VerifyOrDie(state.template Is<AttributeData>());
+                    TLV::TLVReader bufReader;
+                    bufReader.Init(state.template Get<AttributeData>().Get(), state.template Get<AttributeData>().AllocatedSize());
+                    ReturnErrorOnFailure(bufReader.Next());
+                    // Skip to the end of the element.
+                    ReturnErrorOnFailure(bufReader.Skip());
+
+                    // Compute the amount of value data
+                    clusterSize += bufReader.GetLengthRead();
                 }
             }
-
-            if (clusterSize == 0)
+            else
             {
-                // No data in this cluster, so no point in sending a dataVersion
-                // along at all.
-                continue;
+                clusterSize += state;
             }
+            return CHIP_NO_ERROR;
+        }));
 
-            DataVersionFilter filter(endpointId, clusterId, dataVersion);
-
-            aVector.push_back(std::make_pair(filter, clusterSize));
+        if (clusterSize == 0)
+        {
+            // No data in this cluster, so no point in sending a dataVersion
+            // along at all.
+            return CHIP_NO_ERROR;
         }
-    }
+
+        DataVersionFilter filter(endpointId, clusterId, dataVersion);
+
+        aVector.push_back(std::make_pair(filter, clusterSize));
+        return CHIP_NO_ERROR;
+    });
+    VerifyOrReturn(err == CHIP_NO_ERROR);
 
     std::sort(aVector.begin(), aVector.end(),
               [](const std::pair<DataVersionFilter, size_t> & x, const std::pair<DataVersionFilter, size_t> & y) {
@@ -565,8 +526,8 @@ void ClusterStateCacheT<CanEnableDataCaching>::GetSortedFilters(std::vector<std:
               });
 }
 
-template <bool CanEnableDataCaching>
-CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::OnUpdateDataVersionFilterList(
+template <bool CanEnableDataCaching, ClusterStateCacheStorageMode kStorageMode>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching, kStorageMode>::OnUpdateDataVersionFilterList(
     DataVersionFilterIBs::Builder & aDataVersionFilterIBsBuilder, const Span<AttributePathParams> & aAttributePaths,
     bool & aEncodedDataVersionList)
 {
@@ -640,49 +601,26 @@ exit:
     return err;
 }
 
-template <bool CanEnableDataCaching>
-void ClusterStateCacheT<CanEnableDataCaching>::ClearAttributes(EndpointId endpointId)
+template <bool CanEnableDataCaching, ClusterStateCacheStorageMode kStorageMode>
+void ClusterStateCacheT<CanEnableDataCaching, kStorageMode>::ClearAttributes(EndpointId endpointId)
 {
-    mCache.erase(endpointId);
+    mCache.EraseEndpoint(endpointId);
 }
 
-template <bool CanEnableDataCaching>
-void ClusterStateCacheT<CanEnableDataCaching>::ClearAttributes(const ConcreteClusterPath & cluster)
+template <bool CanEnableDataCaching, ClusterStateCacheStorageMode kStorageMode>
+void ClusterStateCacheT<CanEnableDataCaching, kStorageMode>::ClearAttributes(const ConcreteClusterPath & cluster)
 {
-    // Can't use GetEndpointState here, since that only handles const things.
-    auto endpointIter = mCache.find(cluster.mEndpointId);
-    if (endpointIter == mCache.end())
-    {
-        return;
-    }
-
-    auto & endpointState = endpointIter->second;
-    endpointState.erase(cluster.mClusterId);
+    mCache.EraseCluster(cluster);
 }
 
-template <bool CanEnableDataCaching>
-void ClusterStateCacheT<CanEnableDataCaching>::ClearAttribute(const ConcreteAttributePath & attribute)
+template <bool CanEnableDataCaching, ClusterStateCacheStorageMode kStorageMode>
+void ClusterStateCacheT<CanEnableDataCaching, kStorageMode>::ClearAttribute(const ConcreteAttributePath & attribute)
 {
-    // Can't use GetClusterState here, since that only handles const things.
-    auto endpointIter = mCache.find(attribute.mEndpointId);
-    if (endpointIter == mCache.end())
-    {
-        return;
-    }
-
-    auto & endpointState = endpointIter->second;
-    auto clusterIter     = endpointState.find(attribute.mClusterId);
-    if (clusterIter == endpointState.end())
-    {
-        return;
-    }
-
-    auto & clusterState = clusterIter->second;
-    clusterState.mAttributes.erase(attribute.mAttributeId);
+    mCache.EraseAttribute(attribute);
 }
 
-template <bool CanEnableDataCaching>
-CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::GetLastReportDataPath(ConcreteClusterPath & aPath)
+template <bool CanEnableDataCaching, ClusterStateCacheStorageMode kStorageMode>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching, kStorageMode>::GetLastReportDataPath(ConcreteClusterPath & aPath)
 {
     if (mLastReportDataPath.IsValidConcreteClusterPath())
     {
@@ -693,8 +631,10 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::GetLastReportDataPath(Concr
 }
 
 // Ensure that our out-of-line template methods actually get compiled.
-template class ClusterStateCacheT<true>;
-template class ClusterStateCacheT<false>;
+template class ClusterStateCacheT<true, ClusterStateCacheStorageMode::kTree>;
+template class ClusterStateCacheT<false, ClusterStateCacheStorageMode::kTree>;
+template class ClusterStateCacheT<true, ClusterStateCacheStorageMode::kFlat>;
+template class ClusterStateCacheT<false, ClusterStateCacheStorageMode::kFlat>;
 
 } // namespace app
 } // namespace chip
@@ -24,6 +24,7 @@
 #include <app/AppConfig.h>
 #include <app/AttributePathParams.h>
 #include <app/BufferedReadCallback.h>
+#include <app/ClusterStateCacheStorage.h>
 #include <app/ConcreteAttributePath.h>
 #include <app/ReadClient.h>
 #include <app/data-model/DecodableList.h>
@@ -62,12 +63,15 @@ namespace app {
  * through to a registered callback. In addition, it provides its own enhancements to the base ReadClient::Callback
  * to make it easier to know what has changed in the cache.
  *
+ * The attribute state can be kept either in nested maps (the default) or in sorted flat vectors with values packed
+ * into an arena, see ClusterStateCacheStorageMode. The two modes behave identically as far as the API is concerned.
+ *
  * **NOTE**
  * 1. This already includes the BufferedReadCallback, so there is no need to add that to the ReadClient callback chain.
  * 2. The same cache cannot be used by multiple subscribe/read interactions at the same time.
  *
  */
-template <bool CanEnableDataCaching>
+template <bool CanEnableDataCaching, ClusterStateCacheStorageMode kStorageMode = ClusterStateCacheStorageMode::kTree>
 class ClusterStateCacheT : protected ReadClient::Callback
 {
 public:
@@ -373,18 +377,12 @@ public:
     template <typename IteratorFunc>
     CHIP_ERROR ForEachAttribute(EndpointId endpointId, ClusterId clusterId, IteratorFunc func) const
     {
-        CHIP_ERROR err;
+        VerifyOrReturnError(mCache.FindCluster(endpointId, clusterId) != nullptr, CHIP_ERROR_KEY_NOT_FOUND);
 
-        auto clusterState = GetClusterState(endpointId, clusterId, err);
-        ReturnErrorOnFailure(err);
-
-        for (auto & attributeIter : clusterState->mAttributes)
-        {
-            const ConcreteAttributePath path(endpointId, clusterId, attributeIter.first);
-            ReturnErrorOnFailure(func(path));
-        }
-
-        return CHIP_NO_ERROR;
+        return mCache.ForEachAttribute(endpointId, clusterId, [&](AttributeId attributeId, const AttributeState &) {
+            const ConcreteAttributePath path(endpointId, clusterId, attributeId);
+            return func(path);
+        });
     }
 
     /*
@@ -403,21 +401,13 @@ public:
     template <typename IteratorFunc>
     CHIP_ERROR ForEachAttribute(ClusterId clusterId, IteratorFunc func) const
     {
-        for (auto & endpointIter : mCache)
-        {
-            for (auto & clusterIter : endpointIter.second)
-            {
-                if (clusterIter.first == clusterId)
-                {
-                    for (auto & attributeIter : clusterIter.second.mAttributes)
-                    {
-                        const ConcreteAttributePath path(endpointIter.first, clusterId, attributeIter.first);
-                        ReturnErrorOnFailure(func(path));
-                    }
-                }
-            }
-        }
-        return CHIP_NO_ERROR;
+        return mCache.ForEachCluster([&](EndpointId endpointId, ClusterId cachedClusterId, const ClusterVersions &) {
+            VerifyOrReturnError(cachedClusterId == clusterId, CHIP_NO_ERROR);
+            return mCache.ForEachAttribute(endpointId, clusterId, [&](AttributeId attributeId, const AttributeState &) {
+                const ConcreteAttributePath path(endpointId, clusterId, attributeId);
+                return func(path);
+            });
+        });
     }
 
     /*
@@ -435,18 +425,12 @@ public:
     template <typename IteratorFunc>
     CHIP_ERROR ForEachAttribute(IteratorFunc func) const
     {
-        for (const auto & [endpointId, endpointState] : mCache)
-        {
-            for (const auto & [clusterId, clusterState] : endpointState)
-            {
-                for (const auto & attributeIter : clusterState.mAttributes)
-                {
-                    const ConcreteAttributePath path(endpointId, clusterId, attributeIter.first);
-                    ReturnErrorOnFailure(func(path));
-                }
-            }
-        }
-        return CHIP_NO_ERROR;
+        return mCache.ForEachCluster([&](EndpointId endpointId, ClusterId clusterId, const ClusterVersions &) {
+            return mCache.ForEachAttribute(endpointId, clusterId, [&](AttributeId attributeId, const AttributeState &) {
+                const ConcreteAttributePath path(endpointId, clusterId, attributeId);
+                return func(path);
+            });
+        });
     }
 
     /*
@@ -465,15 +449,8 @@ public:
     template <typename IteratorFunc>
     CHIP_ERROR ForEachCluster(EndpointId endpointId, IteratorFunc func) const
     {
-        auto endpointIter = mCache.find(endpointId);
-        if (endpointIter->first == endpointId)
-        {
-            for (auto & clusterIter : endpointIter->second)
-            {
-                ReturnErrorOnFailure(func(clusterIter.first));
-            }
-        }
-        return CHIP_NO_ERROR;
+        return mCache.ForEachCluster(endpointId,
+                                     [&](EndpointId, ClusterId clusterId, const ClusterVersions &) { return func(clusterId); });
     }
 
     /*
@@ -590,21 +567,21 @@ private:
     // The data for a single attribute is not going to be gigabytes in size, so
     // using uint32_t for the size is fine; on 64-bit systems this can save
     // quite a bit of space.
-    using AttributeData  = Platform::ScopedMemoryBufferWithSize<uint8_t>;
-    using AttributeState = std::conditional_t<CanEnableDataCaching, Variant<StatusIB, AttributeData, uint32_t>, uint32_t>;
+    static constexpr bool kFlatStorage = (kStorageMode == ClusterStateCacheStorageMode::kFlat);
+
+    using AttributeDataAllocator = std::conditional_t<kFlatStorage, ClusterStateCacheStorage::ArenaAttributeDataAllocator,
+                                                      ClusterStateCacheStorage::HeapAttributeDataAllocator>;
+    using AttributeData          = typename AttributeDataAllocator::Buffer;
+    using AttributeState         = std::conditional_t<CanEnableDataCaching, Variant<StatusIB, AttributeData, uint32_t>, uint32_t>;
+
     // mPendingDataVersion represents a tentative data version for a cluster that we have gotten some reports for.
     //
-    // mCurrentDataVersion represents a known data version for a cluster.  In order for this to have a
+    // mCommittedDataVersion represents a known data version for a cluster.  In order for this to have a
     // value the cluster must be included in a path in mRequestPathSet that has a wildcard attribute
     // and we must not be in the middle of receiving reports for that cluster.
-    struct ClusterState
-    {
-        std::map<AttributeId, AttributeState> mAttributes;
-        Optional<DataVersion> mPendingDataVersion;
-        Optional<DataVersion> mCommittedDataVersion;
-    };
-    using EndpointState = std::map<ClusterId, ClusterState>;
-    using NodeState     = std::map<EndpointId, EndpointState>;
+    using ClusterVersions = ClusterStateCacheStorage::ClusterVersions;
+    using NodeState       = std::conditional_t<kFlatStorage, ClusterStateCacheStorage::FlatNodeState<AttributeState>,
+                                         ClusterStateCacheStorage::TreeNodeState<AttributeState>>;
 
     struct Comparator
     {
@@ -629,21 +606,10 @@ private:
     };
 
     /*
-     * These functions provide a way to index into the cached state with different sub-sets of a path, returning
-     * appropriate slices of the data as requested.
-     *
-     * In all variants, the respective slice is returned if a valid path is provided. 'err' is updated to reflect
-     * the status of the operation.
-     *
-     * Notable status values:
-     *      - If a cluster instance corresponding to endpointId and clusterId doesn't exist in the cache,
-     *        CHIP_ERROR_KEY_NOT_FOUND shall be returned.
-     *
+     * Returns the cached state of an attribute. 'err' is set to CHIP_ERROR_KEY_NOT_FOUND if the cache has no state
+     * for that attribute, and to CHIP_NO_ERROR otherwise.
      */
-    const EndpointState * GetEndpointState(EndpointId endpointId, CHIP_ERROR & err) const;
-    const ClusterState * GetClusterState(EndpointId endpointId, ClusterId clusterId, CHIP_ERROR & err) const;
-    const AttributeState * GetAttributeState(EndpointId endpointId, ClusterId clusterId, AttributeId attributeId,
-                                             CHIP_ERROR & err) const;
+    const AttributeState * GetAttributeState(const ConcreteAttributePath & path, CHIP_ERROR & err) const;
 
     const EventData * GetEventData(EventNumber number, CHIP_ERROR & err) const;
 
@@ -719,7 +685,9 @@ private:
 
     Callback & mCallback;
     NodeState mCache;
-    std::set<ConcreteAttributePath> mChangedAttributeSet;
+    AttributeDataAllocator mAttributeDataAllocator;
+    // Paths updated during the current report, in arrival order; sorted and de-duplicated in OnReportEnd.
+    std::vector<ConcreteAttributePath> mChangedAttributes;
     std::set<AttributePathParams, Comparator> mRequestPathSet; // wildcard attribute request path only
     std::vector<EndpointId> mAddedEndpoints;
 
@@ -731,8 +699,10 @@ private:
     const bool mCacheData                   = CanEnableDataCaching;
 };
 
-using ClusterStateCache       = ClusterStateCacheT<true>;
-using ClusterStateCacheNoData = ClusterStateCacheT<false>;
+using ClusterStateCache           = ClusterStateCacheT<true>;
+using ClusterStateCacheNoData     = ClusterStateCacheT<false>;
+using FlatClusterStateCache       = ClusterStateCacheT<true, ClusterStateCacheStorageMode::kFlat>;
+using FlatClusterStateCacheNoData = ClusterStateCacheT<false, ClusterStateCacheStorageMode::kFlat>;
 
 };     // namespace app
 };     // namespace chip
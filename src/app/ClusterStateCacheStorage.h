@@ -0,0 +1,615 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/ConcreteAttributePath.h>
+#include <app/ConcreteClusterPath.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/core/Optional.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/SafeInt.h>
+#include <lib/support/ScopedBuffer.h>
+
+#include <algorithm>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace chip {
+namespace app {
+
+/*
+ * How a ClusterStateCacheT stores the attribute state of the node it mirrors.
+ *
+ *  - kTree: nested std::maps by endpoint, cluster and attribute, with one heap allocation per attribute value.
+ *    Cheap to update in any order.
+ *
+ *  - kFlat: sorted vectors of clusters and attributes, with attribute values packed into shared arena blocks.
+ *    Uses a fraction of the memory and allocations of kTree, iterates over contiguous memory and looks single
+ *    attributes up through a hash index. Attributes are appended cheaply when they arrive in path order, which is
+ *    how reports are generated; out-of-order insertions shift the tail of the vector.
+ */
+enum class ClusterStateCacheStorageMode : uint8_t
+{
+    kTree,
+    kFlat,
+};
+
+namespace ClusterStateCacheStorage {
+
+// Data version bookkeeping for a cluster, see ClusterStateCacheT.
+struct ClusterVersions
+{
+    Optional<DataVersion> mPendingDataVersion;
+    Optional<DataVersion> mCommittedDataVersion;
+};
+
+/*
+ * Allocates every attribute value as its own heap buffer.
+ */
+class HeapAttributeDataAllocator
+{
+public:
+    using Buffer = Platform::ScopedMemoryBufferWithSize<uint8_t>;
+
+    CHIP_ERROR Allocate(size_t size, Buffer & buffer)
+    {
+        buffer.Calloc(size);
+        return buffer.Get() != nullptr ? CHIP_NO_ERROR : CHIP_ERROR_NO_MEMORY;
+    }
+};
+
+/*
+ * Packs attribute values into reference-counted blocks. A block is freed once every value allocated from it has
+ * been released and the allocator has moved on to a new block; values larger than a quarter of a block get a
+ * block of their own.
+ *
+ * Blocks are small, as a single value that outlives its neighbours keeps the whole of its block allocated. Values
+ * are not moved between blocks, so a cache whose attributes change at different rates would otherwise end up
+ * holding mostly empty blocks.
+ *
+ * A Buffer stays valid until it is destroyed, regardless of other allocations, so values handed out by the cache
+ * keep the same lifetime as with the heap allocator.
+ */
+class ArenaAttributeDataAllocator
+{
+    struct Block
+    {
+        uint32_t mReferences;
+        uint32_t mCapacity;
+        uint32_t mUsed;
+
+        uint8_t * Data() { return reinterpret_cast<uint8_t *>(this + 1); }
+    };
+
+public:
+    static constexpr uint32_t kBlockSize = 512;
+
+    class Buffer
+    {
+    public:
+        Buffer() = default;
+        ~Buffer() { Release(); }
+
+        Buffer(Buffer && other) noexcept : mBlock(other.mBlock), mOffset(other.mOffset), mSize(other.mSize)
+        {
+            other.mBlock = nullptr;
+        }
+        Buffer & operator=(Buffer && other) noexcept
+        {
+            if (this != &other)
+            {
+                Release();
+                mBlock       = other.mBlock;
+                mOffset      = other.mOffset;
+                mSize        = other.mSize;
+                other.mBlock = nullptr;
+            }
+            return *this;
+        }
+
+        Buffer(const Buffer &)             = delete;
+        Buffer & operator=(const Buffer &) = delete;
+
+        uint8_t * Get() const { return mBlock != nullptr ? mBlock->Data() + mOffset : nullptr; }
+        size_t AllocatedSize() const { return mBlock != nullptr ? mSize : 0; }
+
+    private:
+        friend class ArenaAttributeDataAllocator;
+
+        void Release()
+        {
+            ArenaAttributeDataAllocator::Unref(mBlock);
+            mBlock = nullptr;
+        }
+
+        Block * mBlock   = nullptr;
+        uint32_t mOffset = 0;
+        uint32_t mSize   = 0;
+    };
+
+    ArenaAttributeDataAllocator() = default;
+    ~ArenaAttributeDataAllocator() { Unref(mCurrent); }
+
+    ArenaAttributeDataAllocator(const ArenaAttributeDataAllocator &)             = delete;
+    ArenaAttributeDataAllocator & operator=(const ArenaAttributeDataAllocator &) = delete;
+
+    CHIP_ERROR Allocate(size_t size, Buffer & buffer)
+    {
+        VerifyOrReturnError(CanCastTo<uint32_t>(size) && size <= UINT32_MAX - sizeof(Block), CHIP_ERROR_NO_MEMORY);
+        const uint32_t size32 = static_cast<uint32_t>(size);
+
+        Block * block = nullptr;
+        if (size32 > kBlockSize / 4)
+        {
+            block = NewBlock(size32);
+            VerifyOrReturnError(block != nullptr, CHIP_ERROR_NO_MEMORY);
+        }
+        else
+        {
+            if (mCurrent == nullptr || mCurrent->mCapacity - mCurrent->mUsed < size32)
+            {
+                Block * newBlock = NewBlock(kBlockSize);
+                VerifyOrReturnError(newBlock != nullptr, CHIP_ERROR_NO_MEMORY);
+                Unref(mCurrent);
+                mCurrent = newBlock;
+            }
+            block = mCurrent;
+            block->mReferences++;
+        }
+
+        buffer         = Buffer();
+        buffer.mBlock  = block;
+        buffer.mOffset = block->mUsed;
+        buffer.mSize   = size32;
+        block->mUsed += size32;
+        return CHIP_NO_ERROR;
+    }
+
+private:
+    static Block * NewBlock(uint32_t capacity)
+    {
+        auto * block = static_cast<Block *>(Platform::MemoryAlloc(sizeof(Block) + capacity));
+        if (block != nullptr)
+        {
+            block->mReferences = 1;
+            block->mCapacity   = capacity;
+            block->mUsed       = 0;
+        }
+        return block;
+    }
+
+    static void Unref(Block * block)
+    {
+        if (block != nullptr && --block->mReferences == 0)
+        {
+            Platform::MemoryFree(block);
+        }
+    }
+
+    // The block small values are carved out of; holds a reference of its own.
+    Block * mCurrent = nullptr;
+};
+
+/*
+ * Attribute state stored as std::map<EndpointId, std::map<ClusterId, {versions, std::map<AttributeId, state>}>>.
+ */
+template <typename AttributeState>
+class TreeNodeState
+{
+public:
+    bool HasEndpoint(EndpointId endpointId) const { return mEndpoints.find(endpointId) != mEndpoints.end(); }
+
+    ClusterVersions & GetOrCreateCluster(EndpointId endpointId, ClusterId clusterId)
+    {
+        return mEndpoints[endpointId][clusterId].mVersions;
+    }
+
+    const ClusterVersions * FindCluster(EndpointId endpointId, ClusterId clusterId) const
+    {
+        const ClusterState * clusterState = FindClusterState(endpointId, clusterId);
+        return clusterState != nullptr ? &clusterState->mVersions : nullptr;
+    }
+
+    const AttributeState * FindAttribute(const ConcreteAttributePath & path) const
+    {
+        const ClusterState * clusterState = FindClusterState(path.mEndpointId, path.mClusterId);
+        VerifyOrReturnValue(clusterState != nullptr, nullptr);
+
+        auto attributeIter = clusterState->mAttributes.find(path.mAttributeId);
+        return attributeIter != clusterState->mAttributes.end() ? &attributeIter->second : nullptr;
+    }
+
+    void SetAttribute(const ConcreteAttributePath & path, AttributeState && state)
+    {
+        mEndpoints[path.mEndpointId][path.mClusterId].mAttributes[path.mAttributeId] = std::move(state);
+    }
+
+    /*
+     * Calls func(endpointId, clusterId, versions) for every cluster, in increasing (endpoint, cluster) order.
+     */
+    template <typename Func>
+    CHIP_ERROR ForEachCluster(Func func) const
+    {
+        for (const auto & [endpointId, endpointState] : mEndpoints)
+        {
+            for (const auto & [clusterId, clusterState] : endpointState)
+            {
+                ReturnErrorOnFailure(func(endpointId, clusterId, clusterState.mVersions));
+            }
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    template <typename Func>
+    CHIP_ERROR ForEachCluster(EndpointId endpointId, Func func) const
+    {
+        auto endpointIter = mEndpoints.find(endpointId);
+        VerifyOrReturnError(endpointIter != mEndpoints.end(), CHIP_NO_ERROR);
+        for (const auto & [clusterId, clusterState] : endpointIter->second)
+        {
+            ReturnErrorOnFailure(func(endpointId, clusterId, clusterState.mVersions));
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    /*
+     * Calls func(attributeId, state) for every attribute of a cluster, in increasing attribute order.
+     */
+    template <typename Func>
+    CHIP_ERROR ForEachAttribute(EndpointId endpointId, ClusterId clusterId, Func func) const
+    {
+        const ClusterState * clusterState = FindClusterState(endpointId, clusterId);
+        VerifyOrReturnError(clusterState != nullptr, CHIP_NO_ERROR);
+        for (const auto & [attributeId, state] : clusterState->mAttributes)
+        {
+            ReturnErrorOnFailure(func(attributeId, state));
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    void EraseEndpoint(EndpointId endpointId) { mEndpoints.erase(endpointId); }
+
+    void EraseCluster(const ConcreteClusterPath & path)
+    {
+        auto endpointIter = mEndpoints.find(path.mEndpointId);
+        VerifyOrReturn(endpointIter != mEndpoints.end());
+        endpointIter->second.erase(path.mClusterId);
+    }
+
+    void EraseAttribute(const ConcreteAttributePath & path)
+    {
+        auto endpointIter = mEndpoints.find(path.mEndpointId);
+        VerifyOrReturn(endpointIter != mEndpoints.end());
+        auto clusterIter = endpointIter->second.find(path.mClusterId);
+        VerifyOrReturn(clusterIter != endpointIter->second.end());
+        clusterIter->second.mAttributes.erase(path.mAttributeId);
+    }
+
+private:
+    struct ClusterState
+    {
+        std::map<AttributeId, AttributeState> mAttributes;
+        ClusterVersions mVersions;
+    };
+
+    const ClusterState * FindClusterState(EndpointId endpointId, ClusterId clusterId) const
+    {
+        auto endpointIter = mEndpoints.find(endpointId);
+        VerifyOrReturnValue(endpointIter != mEndpoints.end(), nullptr);
+
+        auto clusterIter = endpointIter->second.find(clusterId);
+        return clusterIter != endpointIter->second.end() ? &clusterIter->second : nullptr;
+    }
+
+    std::map<EndpointId, std::map<ClusterId, ClusterState>> mEndpoints;
+};
+
+/*
+ * Attribute state stored as sorted vectors: one of endpoints, one of clusters keyed on the packed (endpoint, cluster)
+ * pair, and one of attributes keyed on the packed cluster key and the attribute id.
+ *
+ * Single attribute lookups go through an open-addressing index over the attribute vector instead of a binary search.
+ * Inserting or erasing anywhere but at the end shifts positions, so those operations drop the index and the next lookup
+ * rebuilds it; reports are applied in path order, so that happens about once per report rather than once per attribute.
+ */
+template <typename AttributeState>
+class FlatNodeState
+{
+public:
+    bool HasEndpoint(EndpointId endpointId) const { return std::binary_search(mEndpoints.begin(), mEndpoints.end(), endpointId); }
+
+    ClusterVersions & GetOrCreateCluster(EndpointId endpointId, ClusterId clusterId)
+    {
+        const uint64_t key = ClusterKey(endpointId, clusterId);
+        auto clusterIter   = LowerBoundCluster(key);
+        if (clusterIter == mClusters.end() || clusterIter->mKey != key)
+        {
+            auto endpointIter = std::lower_bound(mEndpoints.begin(), mEndpoints.end(), endpointId);
+            if (endpointIter == mEndpoints.end() || *endpointIter != endpointId)
+            {
+                mEndpoints.insert(endpointIter, endpointId);
+            }
+            clusterIter = mClusters.insert(clusterIter, ClusterEntry{ key, ClusterVersions() });
+        }
+        return clusterIter->mVersions;
+    }
+
+    const ClusterVersions * FindCluster(EndpointId endpointId, ClusterId clusterId) const
+    {
+        const uint64_t key = ClusterKey(endpointId, clusterId);
+        auto clusterIter   = LowerBoundCluster(key);
+        return (clusterIter != mClusters.end() && clusterIter->mKey == key) ? &clusterIter->mVersions : nullptr;
+    }
+
+    const AttributeState * FindAttribute(const ConcreteAttributePath & path) const
+    {
+        const size_t position = FindPosition(AttributeKey{ ClusterKey(path.mEndpointId, path.mClusterId), path.mAttributeId });
+        return position < mAttributes.size() ? &mAttributes[position].mState : nullptr;
+    }
+
+    void SetAttribute(const ConcreteAttributePath & path, AttributeState && state)
+    {
+        GetOrCreateCluster(path.mEndpointId, path.mClusterId);
+
+        const AttributeKey key{ ClusterKey(path.mEndpointId, path.mClusterId), path.mAttributeId };
+
+        // Reports are generated in path order, so most new attributes go at the end.
+        if (mAttributes.empty() || mAttributes.back().mKey < key)
+        {
+            mAttributes.push_back(AttributeEntry(key, std::move(state)));
+            if (mIndexValid && mAttributes.size() * 2 <= mIndex.size())
+            {
+                IndexInsert(mAttributes.size() - 1);
+            }
+            else
+            {
+                mIndexValid = false;
+            }
+            return;
+        }
+
+        if (mIndexValid)
+        {
+            const size_t position = FindPosition(key);
+            if (position < mAttributes.size())
+            {
+                mAttributes[position].mState = std::move(state);
+                return;
+            }
+        }
+
+        auto attributeIter = LowerBoundAttribute(key);
+        if (attributeIter != mAttributes.end() && attributeIter->mKey == key)
+        {
+            attributeIter->mState = std::move(state);
+            return;
+        }
+        mAttributes.insert(attributeIter, AttributeEntry(key, std::move(state)));
+        mIndexValid = false;
+    }
+
+    template <typename Func>
+    CHIP_ERROR ForEachCluster(Func func) const
+    {
+        for (const auto & cluster : mClusters)
+        {
+            ReturnErrorOnFailure(func(EndpointOf(cluster.mKey), ClusterOf(cluster.mKey), cluster.mVersions));
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    template <typename Func>
+    CHIP_ERROR ForEachCluster(EndpointId endpointId, Func func) const
+    {
+        for (auto clusterIter = LowerBoundCluster(ClusterKey(endpointId, 0));
+             clusterIter != mClusters.end() && EndpointOf(clusterIter->mKey) == endpointId; ++clusterIter)
+        {
+            ReturnErrorOnFailure(func(endpointId, ClusterOf(clusterIter->mKey), clusterIter->mVersions));
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    template <typename Func>
+    CHIP_ERROR ForEachAttribute(EndpointId endpointId, ClusterId clusterId, Func func) const
+    {
+        const uint64_t clusterKey = ClusterKey(endpointId, clusterId);
+        for (auto attributeIter = LowerBoundAttribute(AttributeKey{ clusterKey, 0 });
+             attributeIter != mAttributes.end() && attributeIter->mKey.mCluster == clusterKey; ++attributeIter)
+        {
+            ReturnErrorOnFailure(func(attributeIter->mKey.mAttribute, attributeIter->mState));
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    void EraseEndpoint(EndpointId endpointId)
+    {
+        auto endpointIter = std::lower_bound(mEndpoints.begin(), mEndpoints.end(), endpointId);
+        VerifyOrReturn(endpointIter != mEndpoints.end() && *endpointIter == endpointId);
+        mEndpoints.erase(endpointIter);
+
+        const uint64_t first = ClusterKey(endpointId, 0);
+        const uint64_t last  = ClusterKey(endpointId, kInvalidClusterId);
+        mClusters.erase(LowerBoundCluster(first), UpperBoundCluster(last));
+        mAttributes.erase(LowerBoundAttribute(AttributeKey{ first, 0 }),
+                          UpperBoundAttribute(AttributeKey{ last, kInvalidAttributeId }));
+        mIndexValid = false;
+    }
+
+    void EraseCluster(const ConcreteClusterPath & path)
+    {
+        const uint64_t key = ClusterKey(path.mEndpointId, path.mClusterId);
+        auto clusterIter   = LowerBoundCluster(key);
+        VerifyOrReturn(clusterIter != mClusters.end() && clusterIter->mKey == key);
+        mClusters.erase(clusterIter);
+        mAttributes.erase(LowerBoundAttribute(AttributeKey{ key, 0 }),
+                          UpperBoundAttribute(AttributeKey{ key, kInvalidAttributeId }));
+        mIndexValid = false;
+    }
+
+    void EraseAttribute(const ConcreteAttributePath & path)
+    {
+        const AttributeKey key{ ClusterKey(path.mEndpointId, path.mClusterId), path.mAttributeId };
+        auto attributeIter = LowerBoundAttribute(key);
+        VerifyOrReturn(attributeIter != mAttributes.end() && attributeIter->mKey == key);
+        mAttributes.erase(attributeIter);
+        mIndexValid = false;
+    }
+
+private:
+    static constexpr uint64_t ClusterKey(EndpointId endpointId, ClusterId clusterId)
+    {
+        return (static_cast<uint64_t>(endpointId) << 32) | clusterId;
+    }
+    static constexpr EndpointId EndpointOf(uint64_t key) { return static_cast<EndpointId>(key >> 32); }
+    static constexpr ClusterId ClusterOf(uint64_t key) { return static_cast<ClusterId>(key); }
+
+    struct AttributeKey
+    {
+        uint64_t mCluster;
+        AttributeId mAttribute;
+
+        bool operator==(const AttributeKey & other) const { return mCluster == other.mCluster && mAttribute == other.mAttribute; }
+        bool operator<(const AttributeKey & other) const
+        {
+            return mCluster < other.mCluster || (mCluster == other.mCluster && mAttribute < other.mAttribute);
+        }
+    };
+
+    struct ClusterEntry
+    {
+        uint64_t mKey;
+        ClusterVersions mVersions;
+    };
+
+    // Moves are declared noexcept so that growing the vector moves entries instead of copying them.
+    struct AttributeEntry
+    {
+        AttributeEntry(const AttributeKey & key, AttributeState && state) : mKey(key), mState(std::move(state)) {}
+        AttributeEntry(AttributeEntry && other) noexcept : mKey(other.mKey), mState(std::move(other.mState)) {}
+        AttributeEntry & operator=(AttributeEntry && other) noexcept
+        {
+            mKey   = other.mKey;
+            mState = std::move(other.mState);
+            return *this;
+        }
+
+        AttributeKey mKey;
+        AttributeState mState;
+    };
+
+    auto LowerBoundCluster(uint64_t key) const
+    {
+        return std::lower_bound(mClusters.begin(), mClusters.end(), key,
+                                [](const ClusterEntry & entry, uint64_t value) { return entry.mKey < value; });
+    }
+    auto LowerBoundCluster(uint64_t key)
+    {
+        return std::lower_bound(mClusters.begin(), mClusters.end(), key,
+                                [](const ClusterEntry & entry, uint64_t value) { return entry.mKey < value; });
+    }
+    auto UpperBoundCluster(uint64_t key)
+    {
+        return std::upper_bound(mClusters.begin(), mClusters.end(), key,
+                                [](uint64_t value, const ClusterEntry & entry) { return value < entry.mKey; });
+    }
+
+    auto LowerBoundAttribute(const AttributeKey & key) const
+    {
+        return std::lower_bound(mAttributes.begin(), mAttributes.end(), key,
+                                [](const AttributeEntry & entry, const AttributeKey & value) { return entry.mKey < value; });
+    }
+    auto LowerBoundAttribute(const AttributeKey & key)
+    {
+        return std::lower_bound(mAttributes.begin(), mAttributes.end(), key,
+                                [](const AttributeEntry & entry, const AttributeKey & value) { return entry.mKey < value; });
+    }
+    auto UpperBoundAttribute(const AttributeKey & key)
+    {
+        return std::upper_bound(mAttributes.begin(), mAttributes.end(), key,
+                                [](const AttributeKey & value, const AttributeEntry & entry) { return value < entry.mKey; });
+    }
+
+    static size_t Hash(const AttributeKey & key)
+    {
+        constexpr uint64_t kMultiplier = 0x9E37'79B9'7F4A'7C15;
+        return static_cast<size_t>((((key.mCluster * kMultiplier) ^ key.mAttribute) * kMultiplier) >> 32);
+    }
+
+    // Returns the position of the attribute in mAttributes, or mAttributes.size() if it is not there.
+    size_t FindPosition(const AttributeKey & key) const
+    {
+        if (!mIndexValid)
+        {
+            RebuildIndex();
+        }
+        VerifyOrReturnValue(!mIndex.empty(), mAttributes.size());
+
+        const size_t mask = mIndex.size() - 1;
+        for (size_t slot = Hash(key) & mask;; slot = (slot + 1) & mask)
+        {
+            const uint32_t entry = mIndex[slot];
+            VerifyOrReturnValue(entry != 0, mAttributes.size());
+            if (mAttributes[entry - 1].mKey == key)
+            {
+                return entry - 1;
+            }
+        }
+    }
+
+    void IndexInsert(size_t position) const
+    {
+        const size_t mask = mIndex.size() - 1;
+        size_t slot       = Hash(mAttributes[position].mKey) & mask;
+        while (mIndex[slot] != 0)
+        {
+            slot = (slot + 1) & mask;
+        }
+        mIndex[slot] = static_cast<uint32_t>(position + 1);
+    }
+
+    // Sizes the index to between a quarter and half full, so that appends can be indexed in place for a while.
+    void RebuildIndex() const
+    {
+        size_t slots = mAttributes.empty() ? 0 : 16;
+        while (slots != 0 && slots < mAttributes.size() * 4)
+        {
+            slots *= 2;
+        }
+        mIndex.assign(slots, 0);
+        for (size_t position = 0; position < mAttributes.size(); position++)
+        {
+            IndexInsert(position);
+        }
+        mIndexValid = true;
+    }
+
+    std::vector<EndpointId> mEndpoints;
+    std::vector<ClusterEntry> mClusters;
+    std::vector<AttributeEntry> mAttributes;
+
+    // Position + 1 of each attribute in mAttributes, 0 for empty slots; the size is zero or a power of two.
+    mutable std::vector<uint32_t> mIndex;
+    mutable bool mIndexValid = false;
+};
+
+} // namespace ClusterStateCacheStorage
+} // namespace app
+} // namespace chip
@@ -25,6 +25,7 @@
 #include <lib/support/CodeUtils.h>
 #include <lib/support/logging/CHIPLogging.h>
 
+#include <algorithm>
 #include <cassert>
 #include <cinttypes>
 
@@ -57,6 +58,59 @@ public:
     virtual ~CircularEventReader() = default;
 };
 
+/**
+ * @brief
+ *   A read-only TLVBackingStore over the data of a single CircularEventBuffer, starting some way into that data.
+ */
+class CircularEventBufferSegment : public TLV::TLVBackingStore
+{
+public:
+    CircularEventBufferSegment(const CircularEventBuffer & aBuffer, uint32_t aOffset) : mBuffer(aBuffer), mOffset(aOffset) {}
+
+    uint32_t DataLength() const { return mBuffer.DataLength() - mOffset; }
+
+    CHIP_ERROR OnInit(TLVReader & aReader, const uint8_t *& aBufStart, uint32_t & aBufLen) override
+    {
+        const uint32_t head  = static_cast<uint32_t>(mBuffer.QueueHead() - mBuffer.GetQueue());
+        const uint32_t start = static_cast<uint32_t>((static_cast<uint64_t>(head) + mOffset) % mBuffer.GetTotalDataLength());
+        aBufStart            = mBuffer.GetQueue() + start;
+        aBufLen              = std::min(DataLength(), mBuffer.GetTotalDataLength() - start);
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR GetNextBuffer(TLVReader & aReader, const uint8_t *& aBufStart, uint32_t & aBufLen) override
+    {
+        // The only data left is whatever wrapped around to the start of the queue; the reader stops at DataLength().
+        if (aBufStart == mBuffer.GetQueue() + mBuffer.GetTotalDataLength())
+        {
+            aBufStart = mBuffer.GetQueue();
+            aBufLen   = mBuffer.GetTotalDataLength();
+        }
+        else
+        {
+            aBufLen = 0;
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR OnInit(TLVWriter & aWriter, uint8_t *& aBufStart, uint32_t & aBufLen) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+    CHIP_ERROR GetNewBuffer(TLVWriter & aWriter, uint8_t *& aBufStart, uint32_t & aBufLen) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+    CHIP_ERROR FinalizeBuffer(TLVWriter & aWriter, uint8_t * aBufStart, uint32_t aBufLen) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+
+private:
+    const CircularEventBuffer & mBuffer;
+    const uint32_t mOffset;
+};
+
 EventManagement & EventManagement::GetInstance()
 {
     return sInstance;
@@ -66,6 +120,7 @@ struct ReclaimEventCtx
 {
     CircularEventBuffer * mpEventBuffer = nullptr;
     size_t mSpaceNeededForMovedEvent    = 0;
+    EventNumber mMovedEventNumber       = 0;
 };
 
 /**
@@ -124,7 +179,7 @@ CHIP_ERROR EventManagement::Init(Messaging::ExchangeManager * apExchangeManager,
     return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR EventManagement::CopyToNextBuffer(CircularEventBuffer * apEventBuffer)
+CHIP_ERROR EventManagement::CopyToNextBuffer(CircularEventBuffer * apEventBuffer, EventNumber aEventNumber)
 {
     CircularTLVWriter writer;
     CircularTLVReader reader;
@@ -134,7 +189,8 @@ CHIP_ERROR EventManagement::CopyToNextBuffer(CircularEventBuffer * apEventBuffer
     {
         return CHIP_ERROR_INVALID_ARGUMENT;
     }
-    CircularEventBuffer backup = *nextBuffer;
+    // Only the queue state can change below, so there is no need to back up the event index.
+    TLVCircularBuffer backup = *nextBuffer;
 
     // Set up the next buffer s.t. it fails if needs to evict an element
     nextBuffer->mProcessEvictedElement = AlwaysFail;
@@ -153,11 +209,13 @@ CHIP_ERROR EventManagement::CopyToNextBuffer(CircularEventBuffer * apEventBuffer
     err = writer.Finalize();
     SuccessOrExit(err);
 
+    nextBuffer->OnEventAppended(aEventNumber, writer.GetLengthWritten());
+
     ChipLogDetail(EventLogging, "Copy Event to next buffer with priority %u", static_cast<unsigned>(nextBuffer->GetPriority()));
 exit:
     if (err != CHIP_NO_ERROR)
     {
-        *nextBuffer = backup;
+        static_cast<TLVCircularBuffer &>(*nextBuffer) = backup;
     }
     return err;
 }
@@ -215,7 +273,7 @@ CHIP_ERROR EventManagement::EnsureSpaceInCircularBuffer(size_t aRequiredSpace, P
                     // Since we're calling CopyElement and we've checked
                     // that there is space in the next buffer, we don't expect
                     // this to fail.
-                    err = CopyToNextBuffer(eventBuffer);
+                    err = CopyToNextBuffer(eventBuffer, ctx.mMovedEventNumber);
                     SuccessOrExit(err);
                     // success; evict head unconditionally
                     eventBuffer->mProcessEvictedElement = nullptr;
@@ -469,6 +527,7 @@ CHIP_ERROR EventManagement::LogEventPrivate(EventLoggingDelegate * apDelegate, c
     SuccessOrExit(err);
 
     mBytesWritten += writer.GetLengthWritten();
+    mpEventBuffer->OnEventAppended(mLastEventNumber, writer.GetLengthWritten());
 
 exit:
     if (err != CHIP_NO_ERROR)
@@ -660,19 +719,37 @@ CHIP_ERROR EventManagement::FetchEventsSince(TLVWriter & aWriter, const SingleLi
     // TODO: Add particular set of event Paths in FetchEventsSince so that we can filter the interested paths
     CHIP_ERROR err     = CHIP_NO_ERROR;
     const bool recurse = false;
-    TLVReader reader;
-    CircularEventBufferWrapper bufWrapper;
     EventLoadOutContext context(aWriter, PriorityLevel::Invalid, aEventMin);
 
     context.mSubjectDescriptor     = aSubjectDescriptor;
     context.mpInterestedEventPaths = apEventPathList;
-    err                            = GetEventReader(reader, PriorityLevel::Critical, &bufWrapper);
-    SuccessOrExit(err);
 
-    err = TLV::Utilities::Iterate(reader, CopyEventsSince, &context, recurse);
-    if (err == CHIP_END_OF_TLV)
+    // Buffers are read from the most important one down, as GetEventReader would.  Each one is read on its own so that
+    // the events it holds that are older than aEventMin can be skipped without parsing them.
+    for (CircularEventBuffer * buffer = GetPriorityBuffer(PriorityLevel::Critical); buffer != nullptr;
+         buffer                       = buffer->GetPreviousCircularEventBuffer())
     {
-        err = CHIP_NO_ERROR;
+        uint32_t offset = 0;
+        if (!buffer->FindEventsSince(aEventMin, offset))
+        {
+            if (buffer->DataLength() != 0)
+            {
+                // Reading through the buffer would have left us at its last event.
+                context.mCurrentEventNumber = buffer->GetLastEventNumber();
+            }
+            continue;
+        }
+
+        CircularEventBufferSegment segment(*buffer, offset);
+        TLVReader reader;
+        SuccessOrExit(err = reader.Init(segment, segment.DataLength()));
+
+        err = TLV::Utilities::Iterate(reader, CopyEventsSince, &context, recurse);
+        if (err == CHIP_END_OF_TLV)
+        {
+            err = CHIP_NO_ERROR;
+        }
+        SuccessOrExit(err);
     }
 
 exit:
@@ -855,6 +932,7 @@ CHIP_ERROR EventManagement::EvictEvent(TLVCircularBuffer & apBuffer, void * apAp
 
     // event is not getting dropped. Note how much space it requires, and return.
     ctx->mSpaceNeededForMovedEvent = aReader.GetLengthRead();
+    ctx->mMovedEventNumber         = context.mEventNumber;
     return CHIP_END_OF_TLV;
 }
 
@@ -882,6 +960,62 @@ void CircularEventBuffer::Init(uint8_t * apBuffer, uint32_t aBufferLength, Circu
     mpPrev    = apPrev;
     mpNext    = apNext;
     mPriority = aPriorityLevel;
+
+    mEventIndexStart = 0;
+    mEventIndexCount = 0;
+    mBytesAppended   = 0;
+    mLastEventNumber = 0;
+}
+
+void CircularEventBuffer::OnEventAppended(EventNumber aEventNumber, uint32_t aLength)
+{
+    constexpr uint32_t kIndexSize = MATTER_ARRAY_SIZE(mEventIndex);
+
+    if (mEventIndexCount == kIndexSize)
+    {
+        mEventIndexStart = (mEventIndexStart + 1) % kIndexSize;
+        mEventIndexCount--;
+    }
+    mEventIndex[(mEventIndexStart + mEventIndexCount) % kIndexSize] = { aEventNumber, mBytesAppended };
+    mEventIndexCount++;
+
+    mBytesAppended += aLength;
+    mLastEventNumber = aEventNumber;
+}
+
+bool CircularEventBuffer::FindEventsSince(EventNumber aEventMin, uint32_t & aOffset) const
+{
+    constexpr uint32_t kIndexSize = MATTER_ARRAY_SIZE(mEventIndex);
+
+    aOffset = 0;
+    if (DataLength() == 0 || mLastEventNumber < aEventMin)
+    {
+        return false;
+    }
+
+    // Positions only ever grow, so unsigned wraparound keeps the offsets relative to the head correct.  Entries for events
+    // that have since been evicted come out at or beyond DataLength().
+    const uint32_t headPosition = mBytesAppended - DataLength();
+    uint32_t candidate          = 0;
+    for (uint32_t i = mEventIndexCount; i > 0; i--)
+    {
+        const EventIndexEntry & entry = mEventIndex[(mEventIndexStart + i - 1) % kIndexSize];
+        const uint32_t offset         = entry.mPosition - headPosition;
+        if (offset >= DataLength())
+        {
+            break;
+        }
+        if (entry.mEventNumber < aEventMin)
+        {
+            // The index holds consecutive events, so the candidate is the first event numbered aEventMin or higher.
+            aOffset = candidate;
+            return true;
+        }
+        candidate = offset;
+    }
+
+    // Everything the index knows about is of interest, but older events may be too.
+    return true;
 }
 
 bool CircularEventBuffer::IsFinalDestinationForPriority(PriorityLevel aPriority) const
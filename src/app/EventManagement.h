@@ -130,9 +130,53 @@ public:
     void SetRequiredSpaceforEvicted(size_t aRequiredSpace) { mRequiredSpaceForEvicted = aRequiredSpace; }
     size_t GetRequiredSpaceforEvicted() const { return mRequiredSpaceForEvicted; }
 
+    /**
+     * @brief
+     *   Record that an event was appended to this buffer, so that readers can later seek to it.
+     *
+     * @param[in] aEventNumber  The number of the appended event.
+     *
+     * @param[in] aLength       The number of bytes the event takes up in the buffer.
+     */
+    void OnEventAppended(EventNumber aEventNumber, uint32_t aLength);
+
+    /**
+     * @brief
+     *   Find where to start reading this buffer to get all of its events numbered aEventMin or higher.
+     *
+     * Events within a buffer are always in increasing event number order.  The index of the most recently
+     * appended events is used to skip the events numbered lower than aEventMin when it reaches back far
+     * enough; otherwise reading has to start at the beginning of the buffer.
+     *
+     * @param[in]  aEventMin  The lowest event number of interest.
+     *
+     * @param[out] aOffset    The offset, from the start of the buffer data, to start reading at.
+     *
+     * @retval true if the buffer holds events numbered aEventMin or higher, false otherwise.
+     */
+    bool FindEventsSince(EventNumber aEventMin, uint32_t & aOffset) const;
+
+    /**
+     * @brief
+     *   The number of the most recently appended event; only meaningful when the buffer is not empty.
+     */
+    EventNumber GetLastEventNumber() const { return mLastEventNumber; }
+
     ~CircularEventBuffer() override = default;
 
 private:
+    struct EventIndexEntry
+    {
+        EventNumber mEventNumber = 0;
+        uint32_t mPosition       = 0; ///< Position of the event in the stream of all bytes ever appended to the buffer
+    };
+
+    EventIndexEntry mEventIndex[CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE]; ///< Ring of the most recently appended events
+    uint32_t mEventIndexStart    = 0; ///< Slot of the oldest entry in mEventIndex
+    uint32_t mEventIndexCount    = 0; ///< Number of entries in mEventIndex
+    uint32_t mBytesAppended      = 0; ///< Total number of bytes ever appended to the buffer, wrapping around
+    EventNumber mLastEventNumber = 0;
+
     CircularEventBuffer * mpPrev = nullptr; ///< A pointer CircularEventBuffer storing events less important events
     CircularEventBuffer * mpNext = nullptr; ///< A pointer CircularEventBuffer storing events more important events
 
@@ -459,8 +503,10 @@ private:
      *
      * @param[in] apEventBuffer  CircularEventBuffer
      *
+     * @param[in] aEventNumber   The number of the event at the head of apEventBuffer
+     *
      */
-    CHIP_ERROR CopyToNextBuffer(CircularEventBuffer * apEventBuffer);
+    CHIP_ERROR CopyToNextBuffer(CircularEventBuffer * apEventBuffer, EventNumber aEventNumber);
 
     /**
      * @brief Ensure that:
@@ -47,12 +47,27 @@ constexpr TLV::Tag SimpleSubscriptionResumptionStorage::kAttributeIdTag;
 constexpr TLV::Tag SimpleSubscriptionResumptionStorage::kEventIdTag;
 constexpr TLV::Tag SimpleSubscriptionResumptionStorage::kEventPathTypeTag;
 constexpr TLV::Tag SimpleSubscriptionResumptionStorage::kResumptionRetriesTag;
+constexpr TLV::Tag SimpleSubscriptionResumptionStorage::kSubscriptionIndexTag;
 
 SimpleSubscriptionResumptionStorage::SimpleSubscriptionInfoIterator::SimpleSubscriptionInfoIterator(
     SimpleSubscriptionResumptionStorage & storage) :
     mStorage(storage)
 {
     mNextIndex = 0;
+
+    Platform::ScopedMemoryBuffer<SubscriptionIndex> index;
+    index.Calloc(1);
+    if (index && mStorage.LoadIndex(index[0]) == CHIP_NO_ERROR)
+    {
+        for (size_t i = 0; i < index[0].mSize; i++)
+        {
+            mIndexesToLoad.set(index[0].mEntries[i].mSubscriptionIndex);
+        }
+    }
+    else
+    {
+        mIndexesToLoad.set();
+    }
 }
 
 size_t SimpleSubscriptionResumptionStorage::SimpleSubscriptionInfoIterator::Count()
@@ -64,6 +79,11 @@ bool SimpleSubscriptionResumptionStorage::SimpleSubscriptionInfoIterator::Next(S
 {
     for (; mNextIndex < CHIP_IM_MAX_NUM_SUBSCRIPTIONS; mNextIndex++)
     {
+        if (!mIndexesToLoad.test(mNextIndex))
+        {
+            continue;
+        }
+
         CHIP_ERROR err = mStorage.Load(mNextIndex, output);
         if (err == CHIP_NO_ERROR)
         {
@@ -76,7 +96,7 @@ bool SimpleSubscriptionResumptionStorage::SimpleSubscriptionInfoIterator::Next(S
         {
             ChipLogError(DataManagement, "Failed to load subscription at index %u error %" CHIP_ERROR_FORMAT,
                          static_cast<unsigned>(mNextIndex), err.Format());
-            TEMPORARY_RETURN_IGNORED mStorage.Delete(mNextIndex);
+            TEMPORARY_RETURN_IGNORED mStorage.Remove(mNextIndex);
         }
     }
 
@@ -105,6 +125,9 @@ CHIP_ERROR SimpleSubscriptionResumptionStorage::Init(PersistentStorageDelegate *
         {
             TEMPORARY_RETURN_IGNORED Delete(subscriptionIndex);
         }
+
+        // The index may list the deleted subscriptions, have it rebuilt from the remaining ones
+        TEMPORARY_RETURN_IGNORED mStorage->SyncDeleteKeyValue(DefaultStorageKeyAllocator::SubscriptionResumptionIndex().KeyName());
     }
 
     // Always save the current CHIP_IM_MAX_NUM_SUBSCRIPTIONS
@@ -122,6 +145,13 @@ SubscriptionResumptionStorage::SubscriptionInfoIterator * SimpleSubscriptionResu
 
 uint16_t SimpleSubscriptionResumptionStorage::Count()
 {
+    Platform::ScopedMemoryBuffer<SubscriptionIndex> index;
+    index.Calloc(1);
+    if (index && LoadIndex(index[0]) == CHIP_NO_ERROR)
+    {
+        return static_cast<uint16_t>(index[0].mSize);
+    }
+
     uint16_t subscriptionCount = 0;
     for (uint16_t subscriptionIndex = 0; subscriptionIndex < CHIP_IM_MAX_NUM_SUBSCRIPTIONS; subscriptionIndex++)
     {
@@ -139,6 +169,148 @@ CHIP_ERROR SimpleSubscriptionResumptionStorage::Delete(uint16_t subscriptionInde
     return mStorage->SyncDeleteKeyValue(DefaultStorageKeyAllocator::SubscriptionResumption(subscriptionIndex).KeyName());
 }
 
+CHIP_ERROR SimpleSubscriptionResumptionStorage::Remove(uint16_t subscriptionIndex)
+{
+    Platform::ScopedMemoryBuffer<SubscriptionIndex> indexBuffer;
+    indexBuffer.Calloc(1);
+    VerifyOrReturnError(indexBuffer.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+    SubscriptionIndex & index = indexBuffer[0];
+    if (LoadIndex(index) == CHIP_NO_ERROR)
+    {
+        for (size_t i = 0; i < index.mSize; i++)
+        {
+            if (index.mEntries[i].mSubscriptionIndex == subscriptionIndex)
+            {
+                index.mEntries[i] = index.mEntries[--index.mSize];
+                ReturnErrorOnFailure(SaveIndex(index));
+                break;
+            }
+        }
+    }
+
+    return Delete(subscriptionIndex);
+}
+
+CHIP_ERROR SimpleSubscriptionResumptionStorage::LoadIndex(SubscriptionIndex & index)
+{
+    Platform::ScopedMemoryBuffer<uint8_t> backingBuffer;
+    backingBuffer.Calloc(MaxIndexSize());
+    VerifyOrReturnError(backingBuffer.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    uint16_t len = static_cast<uint16_t>(MaxIndexSize());
+    ReturnErrorOnFailure(mStorage->SyncGetKeyValue(DefaultStorageKeyAllocator::SubscriptionResumptionIndex().KeyName(),
+                                                   backingBuffer.Get(), len));
+
+    TLV::ScopedBufferTLVReader reader(std::move(backingBuffer), len);
+
+    ReturnErrorOnFailure(reader.Next(TLV::kTLVType_Array, TLV::AnonymousTag()));
+    TLV::TLVType arrayType;
+    ReturnErrorOnFailure(reader.EnterContainer(arrayType));
+
+    size_t count = 0;
+    CHIP_ERROR err;
+    while ((err = reader.Next(TLV::kTLVType_Structure, TLV::AnonymousTag())) == CHIP_NO_ERROR)
+    {
+        VerifyOrReturnError(count < MATTER_ARRAY_SIZE(index.mEntries), CHIP_ERROR_NO_MEMORY);
+        SubscriptionIndexEntry & entry = index.mEntries[count++];
+
+        TLV::TLVType entryContainerType;
+        ReturnErrorOnFailure(reader.EnterContainer(entryContainerType));
+
+        ReturnErrorOnFailure(reader.Next(kSubscriptionIndexTag));
+        ReturnErrorOnFailure(reader.Get(entry.mSubscriptionIndex));
+        VerifyOrReturnError(entry.mSubscriptionIndex < CHIP_IM_MAX_NUM_SUBSCRIPTIONS, CHIP_ERROR_INVALID_INTEGER_VALUE);
+
+        ReturnErrorOnFailure(reader.Next(kPeerNodeIdTag));
+        ReturnErrorOnFailure(reader.Get(entry.mNodeId));
+
+        ReturnErrorOnFailure(reader.Next(kFabricIndexTag));
+        ReturnErrorOnFailure(reader.Get(entry.mFabricIndex));
+
+        ReturnErrorOnFailure(reader.Next(kSubscriptionIdTag));
+        ReturnErrorOnFailure(reader.Get(entry.mSubscriptionId));
+
+        ReturnErrorOnFailure(reader.ExitContainer(entryContainerType));
+    }
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+
+    ReturnErrorOnFailure(reader.ExitContainer(arrayType));
+
+    index.mSize = count;
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR SimpleSubscriptionResumptionStorage::LoadOrRebuildIndex(SubscriptionIndex & index)
+{
+    CHIP_ERROR err = LoadIndex(index);
+    VerifyOrReturnError(err != CHIP_NO_ERROR, CHIP_NO_ERROR);
+
+    if (err != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+    {
+        ChipLogError(DataManagement, "Failed to load subscription index, rebuilding it: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+
+    // Storage written without an index (or whose index was lost): look at every entry of the flat list once.
+    index.mSize = 0;
+    for (uint16_t subscriptionIndex = 0; subscriptionIndex < CHIP_IM_MAX_NUM_SUBSCRIPTIONS; subscriptionIndex++)
+    {
+        SubscriptionInfo subscriptionInfo;
+        err = Load(subscriptionIndex, subscriptionInfo);
+        if (err == CHIP_NO_ERROR)
+        {
+            index.mEntries[index.mSize++] = { subscriptionIndex, subscriptionInfo.mNodeId, subscriptionInfo.mFabricIndex,
+                                              subscriptionInfo.mSubscriptionId };
+        }
+        else if (err != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+        {
+            ChipLogError(DataManagement, "Failed to load subscription at index %u error %" CHIP_ERROR_FORMAT,
+                         static_cast<unsigned>(subscriptionIndex), err.Format());
+            TEMPORARY_RETURN_IGNORED Delete(subscriptionIndex);
+        }
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR SimpleSubscriptionResumptionStorage::SaveIndex(const SubscriptionIndex & index)
+{
+    if (index.mSize == 0)
+    {
+        // Like the subscriptions themselves, the index is only kept in storage while it lists some.
+        CHIP_ERROR err = mStorage->SyncDeleteKeyValue(DefaultStorageKeyAllocator::SubscriptionResumptionIndex().KeyName());
+        return (err == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND) ? CHIP_NO_ERROR : err;
+    }
+
+    Platform::ScopedMemoryBuffer<uint8_t> backingBuffer;
+    backingBuffer.Calloc(MaxIndexSize());
+    VerifyOrReturnError(backingBuffer.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    TLV::ScopedBufferTLVWriter writer(std::move(backingBuffer), MaxIndexSize());
+
+    TLV::TLVType arrayType;
+    ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Array, arrayType));
+    for (size_t i = 0; i < index.mSize; i++)
+    {
+        TLV::TLVType entryContainerType;
+        ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, entryContainerType));
+        ReturnErrorOnFailure(writer.Put(kSubscriptionIndexTag, index.mEntries[i].mSubscriptionIndex));
+        ReturnErrorOnFailure(writer.Put(kPeerNodeIdTag, index.mEntries[i].mNodeId));
+        ReturnErrorOnFailure(writer.Put(kFabricIndexTag, index.mEntries[i].mFabricIndex));
+        ReturnErrorOnFailure(writer.Put(kSubscriptionIdTag, index.mEntries[i].mSubscriptionId));
+        ReturnErrorOnFailure(writer.EndContainer(entryContainerType));
+    }
+    ReturnErrorOnFailure(writer.EndContainer(arrayType));
+
+    const auto len = writer.GetLengthWritten();
+    VerifyOrReturnError(CanCastTo<uint16_t>(len), CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    ReturnErrorOnFailure(writer.Finalize(backingBuffer));
+
+    return mStorage->SyncSetKeyValue(DefaultStorageKeyAllocator::SubscriptionResumptionIndex().KeyName(), backingBuffer.Get(),
+                                     static_cast<uint16_t>(len));
+}
+
 CHIP_ERROR SimpleSubscriptionResumptionStorage::Load(uint16_t subscriptionIndex, SubscriptionInfo & subscriptionInfo)
 {
     Platform::ScopedMemoryBuffer<uint8_t> backingBuffer;
@@ -331,39 +503,47 @@ CHIP_ERROR SimpleSubscriptionResumptionStorage::Save(TLV::TLVWriter & writer, Su
 
 CHIP_ERROR SimpleSubscriptionResumptionStorage::Save(SubscriptionInfo & subscriptionInfo)
 {
-    // Find empty index or duplicate if exists
-    uint16_t subscriptionIndex;
-    uint16_t firstEmptySubscriptionIndex = CHIP_IM_MAX_NUM_SUBSCRIPTIONS; // initialize to out of bounds as "not set"
-    for (subscriptionIndex = 0; subscriptionIndex < CHIP_IM_MAX_NUM_SUBSCRIPTIONS; subscriptionIndex++)
+    Platform::ScopedMemoryBuffer<SubscriptionIndex> indexBuffer;
+    indexBuffer.Calloc(1);
+    VerifyOrReturnError(indexBuffer.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+    SubscriptionIndex & index = indexBuffer[0];
+    ReturnErrorOnFailure(LoadOrRebuildIndex(index));
+
+    // Overwrite the duplicate if it exists, otherwise use the first empty index
+    size_t position;
+    for (position = 0; position < index.mSize; position++)
     {
-        SubscriptionInfo currentSubscriptionInfo;
-        CHIP_ERROR err = Load(subscriptionIndex, currentSubscriptionInfo);
-
-        // if empty and firstEmptySubscriptionIndex isn't set yet, then mark empty spot
-        if ((firstEmptySubscriptionIndex == CHIP_IM_MAX_NUM_SUBSCRIPTIONS) && (err == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND))
+        const SubscriptionIndexEntry & entry = index.mEntries[position];
+        if ((subscriptionInfo.mNodeId == entry.mNodeId) && (subscriptionInfo.mFabricIndex == entry.mFabricIndex) &&
+            (subscriptionInfo.mSubscriptionId == entry.mSubscriptionId))
         {
-            firstEmptySubscriptionIndex = subscriptionIndex;
+            break;
         }
+    }
 
-        // delete duplicate
-        if (err == CHIP_NO_ERROR)
+    uint16_t subscriptionIndex;
+    if (position < index.mSize)
+    {
+        subscriptionIndex = index.mEntries[position].mSubscriptionIndex;
+    }
+    else
+    {
+        std::bitset<CHIP_IM_MAX_NUM_SUBSCRIPTIONS> usedIndexes;
+        for (size_t i = 0; i < index.mSize; i++)
+        {
+            usedIndexes.set(index.mEntries[i].mSubscriptionIndex);
+        }
+        for (subscriptionIndex = 0; subscriptionIndex < CHIP_IM_MAX_NUM_SUBSCRIPTIONS; subscriptionIndex++)
         {
-            if ((subscriptionInfo.mNodeId == currentSubscriptionInfo.mNodeId) &&
-                (subscriptionInfo.mFabricIndex == currentSubscriptionInfo.mFabricIndex) &&
-                (subscriptionInfo.mSubscriptionId == currentSubscriptionInfo.mSubscriptionId))
+            if (!usedIndexes.test(subscriptionIndex))
             {
-                TEMPORARY_RETURN_IGNORED Delete(subscriptionIndex);
-                // if duplicate is the first empty spot, then also set it
-                if (firstEmptySubscriptionIndex == CHIP_IM_MAX_NUM_SUBSCRIPTIONS)
-                {
-                    firstEmptySubscriptionIndex = subscriptionIndex;
-                }
+                break;
             }
         }
     }
 
     // Fail if no empty space
-    if (firstEmptySubscriptionIndex == CHIP_IM_MAX_NUM_SUBSCRIPTIONS)
+    if (subscriptionIndex == CHIP_IM_MAX_NUM_SUBSCRIPTIONS)
     {
         return CHIP_ERROR_NO_MEMORY;
     }
@@ -382,46 +562,45 @@ CHIP_ERROR SimpleSubscriptionResumptionStorage::Save(SubscriptionInfo & subscrip
 
     TEMPORARY_RETURN_IGNORED writer.Finalize(backingBuffer);
 
-    ReturnErrorOnFailure(
-        mStorage->SyncSetKeyValue(DefaultStorageKeyAllocator::SubscriptionResumption(firstEmptySubscriptionIndex).KeyName(),
-                                  backingBuffer.Get(), static_cast<uint16_t>(len)));
+    ReturnErrorOnFailure(mStorage->SyncSetKeyValue(DefaultStorageKeyAllocator::SubscriptionResumption(subscriptionIndex).KeyName(),
+                                                   backingBuffer.Get(), static_cast<uint16_t>(len)));
+
+    if (position == index.mSize)
+    {
+        index.mEntries[index.mSize++] = { subscriptionIndex, subscriptionInfo.mNodeId, subscriptionInfo.mFabricIndex,
+                                          subscriptionInfo.mSubscriptionId };
+        ReturnErrorOnFailure(SaveIndex(index));
+    }
 
     return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR SimpleSubscriptionResumptionStorage::Delete(NodeId nodeId, FabricIndex fabricIndex, SubscriptionId subscriptionId)
 {
+    Platform::ScopedMemoryBuffer<SubscriptionIndex> indexBuffer;
+    indexBuffer.Calloc(1);
+    VerifyOrReturnError(indexBuffer.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+    SubscriptionIndex & index = indexBuffer[0];
+    ReturnErrorOnFailure(LoadOrRebuildIndex(index));
+
     bool subscriptionFound   = false;
     CHIP_ERROR lastDeleteErr = CHIP_NO_ERROR;
 
-    uint16_t remainingSubscriptionsCount = 0;
-    for (uint16_t subscriptionIndex = 0; subscriptionIndex < CHIP_IM_MAX_NUM_SUBSCRIPTIONS; subscriptionIndex++)
+    for (size_t position = 0; position < index.mSize; position++)
     {
-        SubscriptionInfo subscriptionInfo;
-        CHIP_ERROR err = Load(subscriptionIndex, subscriptionInfo);
-
-        // delete match
-        if (err == CHIP_NO_ERROR)
+        const SubscriptionIndexEntry entry = index.mEntries[position];
+        if ((nodeId == entry.mNodeId) && (fabricIndex == entry.mFabricIndex) && (subscriptionId == entry.mSubscriptionId))
         {
-            if ((nodeId == subscriptionInfo.mNodeId) && (fabricIndex == subscriptionInfo.mFabricIndex) &&
-                (subscriptionId == subscriptionInfo.mSubscriptionId))
-            {
-                subscriptionFound    = true;
-                CHIP_ERROR deleteErr = Delete(subscriptionIndex);
-                if (deleteErr != CHIP_NO_ERROR)
-                {
-                    lastDeleteErr = deleteErr;
-                }
-            }
-            else
-            {
-                remainingSubscriptionsCount++;
-            }
+            subscriptionFound        = true;
+            index.mEntries[position] = index.mEntries[--index.mSize];
+            ReturnErrorOnFailure(SaveIndex(index));
+            lastDeleteErr = Delete(entry.mSubscriptionIndex);
+            break;
         }
     }
 
     // if there are no persisted subscriptions, the MaxCount can also be deleted
-    if (remainingSubscriptionsCount == 0)
+    if (index.mSize == 0)
     {
         TEMPORARY_RETURN_IGNORED DeleteMaxCount();
     }
@@ -441,28 +620,41 @@ CHIP_ERROR SimpleSubscriptionResumptionStorage::DeleteMaxCount()
 
 CHIP_ERROR SimpleSubscriptionResumptionStorage::DeleteAll(FabricIndex fabricIndex)
 {
+    Platform::ScopedMemoryBuffer<SubscriptionIndex> indexBuffer;
+    indexBuffer.Calloc(1);
+    VerifyOrReturnError(indexBuffer.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+    SubscriptionIndex & index = indexBuffer[0];
+    ReturnErrorOnFailure(LoadOrRebuildIndex(index));
+
     CHIP_ERROR deleteErr = CHIP_NO_ERROR;
 
-    uint16_t count = 0;
-    for (uint16_t subscriptionIndex = 0; subscriptionIndex < CHIP_IM_MAX_NUM_SUBSCRIPTIONS; subscriptionIndex++)
+    uint16_t indexesToDelete[CHIP_IM_MAX_NUM_SUBSCRIPTIONS];
+    size_t deleteCount = 0;
+    size_t count       = 0;
+    for (size_t position = 0; position < index.mSize; position++)
     {
-        SubscriptionInfo subscriptionInfo;
-        CHIP_ERROR err = Load(subscriptionIndex, subscriptionInfo);
+        if (fabricIndex == index.mEntries[position].mFabricIndex)
+        {
+            indexesToDelete[deleteCount++] = index.mEntries[position].mSubscriptionIndex;
+        }
+        else
+        {
+            index.mEntries[count++] = index.mEntries[position];
+        }
+    }
 
-        if (err == CHIP_NO_ERROR)
+    if (deleteCount > 0)
+    {
+        index.mSize = count;
+        ReturnErrorOnFailure(SaveIndex(index));
+    }
+
+    for (size_t i = 0; i < deleteCount; i++)
+    {
+        CHIP_ERROR err = Delete(indexesToDelete[i]);
+        if ((err != CHIP_NO_ERROR) && (err != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND))
         {
-            if (fabricIndex == subscriptionInfo.mFabricIndex)
-            {
-                err = Delete(subscriptionIndex);
-                if ((err != CHIP_NO_ERROR) && (err != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND))
-                {
-                    deleteErr = err;
-                }
-            }
-            else
-            {
-                count++;
-            }
+            deleteErr = err;
         }
     }
 
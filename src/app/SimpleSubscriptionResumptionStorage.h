@@ -29,6 +29,8 @@
 #include <lib/support/DefaultStorageKeyAllocator.h>
 #include <lib/support/Pool.h>
 
+#include <bitset>
+
 namespace chip {
 namespace app {
 
@@ -51,12 +53,36 @@ public:
     CHIP_ERROR DeleteAll(FabricIndex fabricIndex) override;
 
 protected:
+    // Identifies the subscription stored at a given index of the flat list.
+    struct SubscriptionIndexEntry
+    {
+        uint16_t mSubscriptionIndex;
+        NodeId mNodeId;
+        FabricIndex mFabricIndex;
+        SubscriptionId mSubscriptionId;
+    };
+
+    // Entries of the flat list which hold a subscription, so that subscriptions can be found and
+    // enumerated without reading every entry. The index is written after the entries it lists, and
+    // before the entries it no longer lists are deleted, so that it never lists an entry that was not
+    // fully written.
+    struct SubscriptionIndex
+    {
+        size_t mSize;
+        SubscriptionIndexEntry mEntries[CHIP_IM_MAX_NUM_SUBSCRIPTIONS];
+    };
+
     CHIP_ERROR Save(TLV::TLVWriter & writer, SubscriptionInfo & subscriptionInfo);
     CHIP_ERROR Load(uint16_t subscriptionIndex, SubscriptionInfo & subscriptionInfo);
     CHIP_ERROR Delete(uint16_t subscriptionIndex);
+    CHIP_ERROR Remove(uint16_t subscriptionIndex);
     uint16_t Count();
     CHIP_ERROR DeleteMaxCount();
 
+    CHIP_ERROR LoadIndex(SubscriptionIndex & index);
+    CHIP_ERROR LoadOrRebuildIndex(SubscriptionIndex & index);
+    CHIP_ERROR SaveIndex(const SubscriptionIndex & index);
+
     class SimpleSubscriptionInfoIterator : public SubscriptionInfoIterator
     {
     public:
@@ -68,6 +94,9 @@ protected:
     private:
         SimpleSubscriptionResumptionStorage & mStorage;
         uint16_t mNextIndex;
+
+        // Entries of the flat list left to read, all of them if the storage has no index.
+        std::bitset<CHIP_IM_MAX_NUM_SUBSCRIPTIONS> mIndexesToLoad;
     };
 
     static constexpr size_t MaxScopedNodeIdSize() { return TLV::EstimateStructOverhead(sizeof(NodeId), sizeof(FabricIndex)); }
@@ -82,6 +111,17 @@ protected:
                    CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_SUBSCRIPTIONS);
     }
 
+    static constexpr size_t MaxIndexEntrySize()
+    {
+        return TLV::EstimateStructOverhead(sizeof(uint16_t), sizeof(NodeId), sizeof(FabricIndex), sizeof(SubscriptionId));
+    }
+
+    static constexpr size_t MaxIndexSize()
+    {
+        // The max size of the list is (1 byte control + bytes for actual value) times max number of list items
+        return TLV::EstimateStructOverhead((1 + MaxIndexEntrySize()) * CHIP_IM_MAX_NUM_SUBSCRIPTIONS);
+    }
+
     static constexpr size_t MaxSubscriptionSize()
     {
         // All the fields added together
@@ -116,6 +156,13 @@ protected:
     //         Endpoint ID
     //         Cluster ID
     //         Event ID
+    //
+    // The index of the list is stored separately as an array of:
+    //   Structure of: (Index entry)
+    //     Index in the flat list
+    //     Node ID
+    //     Fabric Index
+    //     Subscription ID
 
     static constexpr TLV::Tag kPeerNodeIdTag         = TLV::ContextTag(1);
     static constexpr TLV::Tag kFabricIndexTag        = TLV::ContextTag(2);
@@ -133,6 +180,7 @@ protected:
     static constexpr TLV::Tag kEventIdTag            = TLV::ContextTag(14);
     static constexpr TLV::Tag kEventPathTypeTag      = TLV::ContextTag(16);
     static constexpr TLV::Tag kResumptionRetriesTag  = TLV::ContextTag(17);
+    static constexpr TLV::Tag kSubscriptionIndexTag  = TLV::ContextTag(18);
 
     PersistentStorageDelegate * mStorage;
     ObjectPool<SimpleSubscriptionInfoIterator, kIteratorsMax> mSubscriptionInfoIterators;
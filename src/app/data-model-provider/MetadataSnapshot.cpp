@@ -0,0 +1,189 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <app/data-model-provider/MetadataSnapshot.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/SafeInt.h>
+
+namespace chip {
+namespace app {
+namespace DataModel {
+
+namespace {
+
+/// Copies `items` to the end of `builder`.
+///
+/// Providers may return references to their own (possibly mutable) storage, so
+/// content always gets copied rather than referenced.
+template <typename T>
+CHIP_ERROR AppendCopy(ReadOnlyBufferBuilder<T> & builder, const ReadOnlyBuffer<T> & items)
+{
+    VerifyOrReturnError(!items.empty(), CHIP_NO_ERROR);
+    return builder.AppendElements(items);
+}
+
+template <typename T>
+CHIP_ERROR AppendStart(ReadOnlyBufferBuilder<uint32_t> & starts, const ReadOnlyBufferBuilder<T> & items)
+{
+    VerifyOrReturnError(CanCastTo<uint32_t>(items.Size()), CHIP_ERROR_NO_MEMORY);
+    return starts.Append(static_cast<uint32_t>(items.Size()));
+}
+
+} // namespace
+
+CHIP_ERROR MetadataSnapshot::Build(ProviderMetadataTree & provider)
+{
+    Clear();
+
+    CHIP_ERROR err = BuildFrom(provider);
+    if (err != CHIP_NO_ERROR)
+    {
+        Clear();
+    }
+    return err;
+}
+
+CHIP_ERROR MetadataSnapshot::BuildFrom(ProviderMetadataTree & provider)
+{
+    ReadOnlyBufferBuilder<EndpointEntry> endpointsBuilder;
+    ReturnErrorOnFailure(provider.Endpoints(endpointsBuilder));
+
+    ReadOnlyBufferBuilder<EndpointEntry> endpoints;
+    ReturnErrorOnFailure(AppendCopy(endpoints, endpointsBuilder.TakeBuffer()));
+    mEndpoints = endpoints.TakeBuffer();
+
+    ReadOnlyBufferBuilder<ServerClusterEntry> clusters;
+    ReadOnlyBufferBuilder<uint32_t> clusterStart;
+    ReturnErrorOnFailure(clusterStart.EnsureAppendCapacity(mEndpoints.size() + 1));
+
+    for (const EndpointEntry & endpoint : mEndpoints)
+    {
+        ReturnErrorOnFailure(AppendStart(clusterStart, clusters));
+
+        ReadOnlyBufferBuilder<ServerClusterEntry> endpointClustersBuilder;
+        ReturnErrorOnFailure(provider.ServerClusters(endpoint.id, endpointClustersBuilder));
+        ReadOnlyBuffer<ServerClusterEntry> endpointClusters = endpointClustersBuilder.TakeBuffer();
+
+        ReturnErrorOnFailure(clusters.EnsureAppendCapacity(endpointClusters.size()));
+        for (ServerClusterEntry entry : endpointClusters)
+        {
+            // data versions are not structure and would be stale as soon as the cluster changes
+            entry.dataVersion = 0;
+            ReturnErrorOnFailure(clusters.Append(entry));
+        }
+    }
+    ReturnErrorOnFailure(AppendStart(clusterStart, clusters));
+
+    mClusters     = clusters.TakeBuffer();
+    mClusterStart = clusterStart.TakeBuffer();
+
+    ReadOnlyBufferBuilder<AttributeEntry> attributes;
+    ReadOnlyBufferBuilder<uint32_t> attributeStart;
+    ReturnErrorOnFailure(attributeStart.EnsureAppendCapacity(mClusters.size() + 1));
+
+    for (size_t endpointIndex = 0; endpointIndex < mEndpoints.size(); endpointIndex++)
+    {
+        for (uint32_t clusterIndex = mClusterStart[endpointIndex]; clusterIndex < mClusterStart[endpointIndex + 1]; clusterIndex++)
+        {
+            ReturnErrorOnFailure(AppendStart(attributeStart, attributes));
+
+            ReadOnlyBufferBuilder<AttributeEntry> clusterAttributes;
+            ReturnErrorOnFailure(
+                provider.Attributes({ mEndpoints[endpointIndex].id, mClusters[clusterIndex].clusterId }, clusterAttributes));
+            ReturnErrorOnFailure(AppendCopy(attributes, clusterAttributes.TakeBuffer()));
+        }
+    }
+    ReturnErrorOnFailure(AppendStart(attributeStart, attributes));
+
+    mAttributes     = attributes.TakeBuffer();
+    mAttributeStart = attributeStart.TakeBuffer();
+
+    return CHIP_NO_ERROR;
+}
+
+void MetadataSnapshot::Clear()
+{
+    mEndpoints      = ReadOnlyBuffer<EndpointEntry>();
+    mClusters       = ReadOnlyBuffer<ServerClusterEntry>();
+    mAttributes     = ReadOnlyBuffer<AttributeEntry>();
+    mClusterStart   = ReadOnlyBuffer<uint32_t>();
+    mAttributeStart = ReadOnlyBuffer<uint32_t>();
+
+    mGeneration++;
+    if (mGeneration == 0)
+    {
+        mGeneration = 1;
+    }
+}
+
+size_t MetadataSnapshot::EndpointIndex(EndpointId endpointId) const
+{
+    for (size_t i = 0; i < mEndpoints.size(); i++)
+    {
+        if (mEndpoints[i].id == endpointId)
+        {
+            return i;
+        }
+    }
+    return kNotFound;
+}
+
+size_t MetadataSnapshot::ClusterIndex(const ConcreteClusterPath & path) const
+{
+    const size_t endpointIndex = EndpointIndex(path.mEndpointId);
+    VerifyOrReturnValue(endpointIndex != kNotFound, kNotFound);
+
+    for (size_t i = mClusterStart[endpointIndex]; i < mClusterStart[endpointIndex + 1]; i++)
+    {
+        if (mClusters[i].clusterId == path.mClusterId)
+        {
+            return i;
+        }
+    }
+    return kNotFound;
+}
+
+Span<const ServerClusterEntry> MetadataSnapshot::ServerClusters(EndpointId endpointId) const
+{
+    const size_t endpointIndex = EndpointIndex(endpointId);
+    VerifyOrReturnValue(endpointIndex != kNotFound, Span<const ServerClusterEntry>());
+
+    return mClusters.SubSpan(mClusterStart[endpointIndex], mClusterStart[endpointIndex + 1] - mClusterStart[endpointIndex]);
+}
+
+Span<const AttributeEntry> MetadataSnapshot::Attributes(const ConcreteClusterPath & path) const
+{
+    const size_t clusterIndex = ClusterIndex(path);
+    VerifyOrReturnValue(clusterIndex != kNotFound, Span<const AttributeEntry>());
+
+    return mAttributes.SubSpan(mAttributeStart[clusterIndex], mAttributeStart[clusterIndex + 1] - mAttributeStart[clusterIndex]);
+}
+
+std::optional<AttributeEntry> MetadataSnapshot::FindAttribute(const ConcreteAttributePath & path) const
+{
+    for (const AttributeEntry & entry : Attributes(path))
+    {
+        if (entry.attributeId == path.mAttributeId)
+        {
+            return entry;
+        }
+    }
+    return std::nullopt;
+}
+
+} // namespace DataModel
+} // namespace app
+} // namespace chip
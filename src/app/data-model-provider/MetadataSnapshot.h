@@ -0,0 +1,98 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <app/ConcreteAttributePath.h>
+#include <app/ConcreteClusterPath.h>
+#include <app/data-model-provider/MetadataTypes.h>
+#include <app/data-model-provider/ProviderMetadataTree.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/support/ReadOnlyBuffer.h>
+#include <lib/support/Span.h>
+
+#include <cstdint>
+#include <optional>
+
+namespace chip {
+namespace app {
+namespace DataModel {
+
+/// A flattened, read-only copy of the endpoint/cluster/attribute structure of a ProviderMetadataTree.
+///
+/// Wildcard path expansion walks this structure for every read and report. Going through the
+/// ProviderMetadataTree methods means building (and allocating) a new list on every step, while
+/// a snapshot holds all the lists in contiguous arrays that can be referenced in place.
+///
+/// A snapshot only captures structure. Data versions change independently of it, so
+/// ServerClusterEntry::dataVersion is always 0 within a snapshot: use ProviderMetadataTree::ServerClusters
+/// to get actual data versions.
+///
+/// Spans returned by a snapshot are valid until the next call to Build or Clear.
+class MetadataSnapshot
+{
+public:
+    MetadataSnapshot() = default;
+
+    MetadataSnapshot(const MetadataSnapshot &)             = delete;
+    MetadataSnapshot & operator=(const MetadataSnapshot &) = delete;
+
+    /// Replaces the content of the snapshot with the current structure of `provider`.
+    ///
+    /// On failure the snapshot is left empty.
+    CHIP_ERROR Build(ProviderMetadataTree & provider);
+
+    void Clear();
+
+    /// Changes every time the content of the snapshot changes (i.e. on every Build or Clear).
+    ///
+    /// Never 0, so that 0 can be used as a "no snapshot" marker.
+    uint32_t Generation() const { return mGeneration; }
+
+    Span<const EndpointEntry> Endpoints() const { return mEndpoints; }
+
+    /// Server clusters of the given endpoint. Empty if the endpoint does not exist.
+    Span<const ServerClusterEntry> ServerClusters(EndpointId endpointId) const;
+
+    /// Attributes of the given cluster. Empty if the cluster does not exist.
+    Span<const AttributeEntry> Attributes(const ConcreteClusterPath & path) const;
+
+    std::optional<AttributeEntry> FindAttribute(const ConcreteAttributePath & path) const;
+
+private:
+    static constexpr size_t kNotFound = SIZE_MAX;
+
+    size_t EndpointIndex(EndpointId endpointId) const;
+    size_t ClusterIndex(const ConcreteClusterPath & path) const;
+
+    CHIP_ERROR BuildFrom(ProviderMetadataTree & provider);
+
+    uint32_t mGeneration = 1;
+
+    ReadOnlyBuffer<EndpointEntry> mEndpoints;
+    ReadOnlyBuffer<ServerClusterEntry> mClusters;
+    ReadOnlyBuffer<AttributeEntry> mAttributes;
+
+    // Clusters of endpoint `i` are mClusters[mClusterStart[i], mClusterStart[i + 1]) and attributes
+    // of cluster `j` are mAttributes[mAttributeStart[j], mAttributeStart[j + 1]).
+    ReadOnlyBuffer<uint32_t> mClusterStart;
+    ReadOnlyBuffer<uint32_t> mAttributeStart;
+};
+
+} // namespace DataModel
+} // namespace app
+} // namespace chip
@@ -31,6 +31,8 @@ namespace chip {
 namespace app {
 namespace DataModel {
 
+class MetadataSnapshot;
+
 /// Provides metadata information for a data model
 ///
 /// The data model can be viewed as a tree of endpoint/cluster/(attribute+commands+events)
@@ -98,6 +100,16 @@ public:
     /// the attribute changes.
     virtual void Temporary_ReportAttributeChanged(const AttributePathParams & path) = 0;
 
+    /// Returns a snapshot of the current endpoint/cluster/attribute structure, for callers that walk
+    /// it repeatedly (like wildcard path expansion).
+    ///
+    /// Implementations that return a snapshot MUST keep it in sync with the methods above. The returned
+    /// object stays valid for the lifetime of the provider, however its content may be rebuilt on any
+    /// subsequent call: spans obtained from it are only valid while its Generation() stays the same.
+    ///
+    /// Returns nullptr if no snapshot is available, in which case callers use the methods above.
+    virtual const MetadataSnapshot * GetMetadataSnapshot() { return nullptr; }
+
     // "convenience" functions that just return the data and ignore the error
     // This returns the `ReadOnlyBufferBuilder<..>::TakeBuffer` from their equivalent fuctions as-is,
     // even after an error (e.g. not found would return empty data).
@@ -0,0 +1,486 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/AttributePathParams.h>
+#include <app/ConcreteAttributePath.h>
+#include <lib/core/CHIPError.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/Iterators.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+struct AttributePathParamsWithGeneration : public AttributePathParams
+{
+    AttributePathParamsWithGeneration() {}
+    AttributePathParamsWithGeneration(const AttributePathParams aPath) : AttributePathParams(aPath) {}
+    uint64_t mGeneration = 0;
+};
+
+/**
+ * A fixed-capacity set of dirty attribute paths, each tagged with the dirty set generation it was last marked dirty at.
+ *
+ * Paths are stored in a slot array and indexed by an open-addressing hash table keyed on (endpoint, cluster, attribute), so
+ * that:
+ *   - checking whether a concrete path is covered by the set costs one hash probe per wildcard shape currently present in the
+ *     set (at most 8), independently of the number of dirty paths;
+ *   - marking an already dirty concrete path dirty again is a single hash probe.
+ *
+ * The set never holds two paths with the same (endpoint, cluster, attribute): dirty paths that only differ by list index are
+ * coalesced into the whole attribute, which is what gets reported anyway.
+ *
+ * When the set is full, paths are coalesced hierarchically to make room: first the attributes of every cluster with more than
+ * one dirty attribute are merged into a wildcard attribute path, then the clusters of every endpoint with more than one dirty
+ * cluster into a wildcard cluster path, and only as a last resort everything into a single wildcard path.
+ *
+ * Generations must be non-zero, a generation of 0 marks a free slot.
+ */
+template <size_t kCapacity>
+class DirtyPathSet
+{
+public:
+    DirtyPathSet() { ReleaseAll(); }
+
+    DirtyPathSet(const DirtyPathSet &)             = delete;
+    DirtyPathSet & operator=(const DirtyPathSet &) = delete;
+
+    size_t Allocated() const { return mAllocated; }
+    bool Exhausted() const { return mAllocated == kCapacity; }
+
+    void ReleaseAll()
+    {
+        for (size_t slot = 0; slot < kCapacity; slot++)
+        {
+            mEntries[slot].mGeneration = 0;
+            mEntries[slot].mListIndex  = static_cast<ListIndex>(slot + 1);
+        }
+        for (auto & value : mIndex)
+        {
+            value = kEmptyIndexValue;
+        }
+        for (auto & count : mShapeCounts)
+        {
+            count = 0;
+        }
+        mFreeHead  = 0;
+        mAllocated = 0;
+    }
+
+    /**
+     * If a path of the set is a superset of aPath, bump its generation. Otherwise, if aPath is a superset of some paths of the
+     * set, replace them by aPath at aGeneration.
+     *
+     * Returns whether aPath is now covered by the set.
+     */
+    bool MergeOverlapped(const AttributePathParams & aPath, uint64_t aGeneration)
+    {
+        const uint8_t pathShape = ShapeOf(aPath);
+        for (uint8_t shape = 0; shape < kShapeCount; shape++)
+        {
+            if (mShapeCounts[shape] == 0 || (shape & pathShape) != pathShape)
+            {
+                continue;
+            }
+            const size_t position = Lookup(ApplyShape(KeyOf(aPath), shape));
+            if (position == kIndexSize)
+            {
+                continue;
+            }
+            AttributePathParamsWithGeneration & entry = mEntries[SlotOf(mIndex[position])];
+            if (!entry.IsAttributePathSupersetOf(aPath))
+            {
+                // Same attribute, different list index: keep the whole attribute.
+                entry.mListIndex = kInvalidListIndex;
+            }
+            entry.mGeneration = aGeneration;
+            return true;
+        }
+
+        // Only a path with a wildcard endpoint, cluster or attribute can cover paths with a different key.
+        VerifyOrReturnValue(pathShape != 0, false);
+
+        size_t replacedSlot = kCapacity;
+        for (size_t slot = 0; slot < kCapacity; slot++)
+        {
+            if (!IsAllocated(slot) || !aPath.IsAttributePathSupersetOf(mEntries[slot]))
+            {
+                continue;
+            }
+            if (replacedSlot == kCapacity)
+            {
+                Rekey(slot, aPath);
+                mEntries[slot].mGeneration = aGeneration;
+                replacedSlot               = slot;
+            }
+            else
+            {
+                Release(slot);
+            }
+        }
+        return replacedSlot != kCapacity;
+    }
+
+    /**
+     * Mark aPath dirty at aGeneration, coalescing existing paths if the set is full.
+     */
+    CHIP_ERROR Insert(const AttributePathParams & aPath, uint64_t aGeneration)
+    {
+        VerifyOrReturnError(aGeneration != 0, CHIP_ERROR_INVALID_ARGUMENT);
+        VerifyOrReturnError(!MergeOverlapped(aPath, aGeneration), CHIP_NO_ERROR);
+
+        if (Exhausted() && !Coalesce(CoalesceLevel::kCluster) && !Coalesce(CoalesceLevel::kEndpoint))
+        {
+            ChipLogDetail(DataManagement, "Global dirty set pool exhausted, merge all paths.");
+            ReleaseAll();
+            Allocate(AttributePathParams(), aGeneration);
+        }
+
+        VerifyOrReturnError(!MergeOverlapped(aPath, aGeneration), CHIP_NO_ERROR);
+        ChipLogDetail(DataManagement, "Cannot merge the new path into any existing path, create one.");
+
+        // This should not fail, the path should be merged into the wildcard path at least.
+        VerifyOrReturnError(Allocate(aPath, aGeneration), CHIP_ERROR_NO_MEMORY);
+        return CHIP_NO_ERROR;
+    }
+
+    /**
+     * Returns whether a path of the set covering aPath was marked dirty after aGeneration.
+     */
+    bool IsDirtySince(const ConcreteAttributePath & aPath, uint64_t aGeneration) const
+    {
+        const Key key{ aPath.mEndpointId, aPath.mClusterId, aPath.mAttributeId };
+        for (uint8_t shape = 0; shape < kShapeCount; shape++)
+        {
+            if (mShapeCounts[shape] == 0)
+            {
+                continue;
+            }
+            const size_t position = Lookup(ApplyShape(key, shape));
+            if (position != kIndexSize && mEntries[SlotOf(mIndex[position])].mGeneration > aGeneration)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Calls aFunction with a const reference to each path of the set, in no particular order.
+     */
+    template <typename Function>
+    Loop ForEachPath(Function && aFunction) const
+    {
+        for (size_t slot = 0; slot < kCapacity; slot++)
+        {
+            if (IsAllocated(slot) && aFunction(mEntries[slot]) == Loop::Break)
+            {
+                return Loop::Break;
+            }
+        }
+        return Loop::Finish;
+    }
+
+private:
+    static_assert(kCapacity > 0 && kCapacity < 0x8000, "The dirty set index stores slot numbers on 15 bits");
+
+    // Bits of the shape of a path: which of its endpoint, cluster and attribute are wildcards.
+    static constexpr uint8_t kWildcardEndpoint  = 0x1;
+    static constexpr uint8_t kWildcardCluster   = 0x2;
+    static constexpr uint8_t kWildcardAttribute = 0x4;
+    static constexpr uint8_t kShapeCount        = 8;
+
+    // Index values are slot + 1, 0 marks an empty bucket. While coalescing, the index also holds aliases: entries keyed by the
+    // wildcard path a dirty path would be coalesced into, pointing at the first dirty path seen for that key.
+    static constexpr uint16_t kEmptyIndexValue = 0;
+    static constexpr uint16_t kAliasFlag       = 0x8000;
+
+    static constexpr size_t IndexSizeFor(size_t capacity)
+    {
+        // Room for every path and one alias per path at a load factor of at most 1/2.
+        size_t size = 1;
+        while (size < 4 * capacity)
+        {
+            size <<= 1;
+        }
+        return size;
+    }
+    static constexpr size_t kIndexSize = IndexSizeFor(kCapacity);
+    static constexpr size_t kIndexMask = kIndexSize - 1;
+
+    enum class CoalesceLevel : uint8_t
+    {
+        kNone,
+        kCluster,
+        kEndpoint,
+    };
+
+    struct Key
+    {
+        EndpointId mEndpointId;
+        ClusterId mClusterId;
+        AttributeId mAttributeId;
+
+        bool operator==(const Key & aOther) const
+        {
+            return mEndpointId == aOther.mEndpointId && mClusterId == aOther.mClusterId && mAttributeId == aOther.mAttributeId;
+        }
+    };
+
+    static Key KeyOf(const AttributePathParams & aPath) { return Key{ aPath.mEndpointId, aPath.mClusterId, aPath.mAttributeId }; }
+
+    static uint8_t ShapeOf(const AttributePathParams & aPath)
+    {
+        return static_cast<uint8_t>((aPath.HasWildcardEndpointId() ? kWildcardEndpoint : 0) |
+                                    (aPath.HasWildcardClusterId() ? kWildcardCluster : 0) |
+                                    (aPath.HasWildcardAttributeId() ? kWildcardAttribute : 0));
+    }
+
+    static Key ApplyShape(Key aKey, uint8_t aShape)
+    {
+        if (aShape & kWildcardEndpoint)
+        {
+            aKey.mEndpointId = kInvalidEndpointId;
+        }
+        if (aShape & kWildcardCluster)
+        {
+            aKey.mClusterId = kInvalidClusterId;
+        }
+        if (aShape & kWildcardAttribute)
+        {
+            aKey.mAttributeId = kInvalidAttributeId;
+        }
+        return aKey;
+    }
+
+    static size_t Hash(const Key & aKey)
+    {
+        uint64_t hash = ((static_cast<uint64_t>(aKey.mClusterId) << 32) | aKey.mAttributeId) * 0x9E37'79B9'7F4A'7C15ull;
+        hash ^= (hash >> 29) + static_cast<uint64_t>(aKey.mEndpointId) * 0xC2B2'AE3D'27D4'EB4Full;
+        return static_cast<size_t>(hash ^ (hash >> 32)) & kIndexMask;
+    }
+
+    static size_t SlotOf(uint16_t aIndexValue) { return static_cast<size_t>((aIndexValue & ~kAliasFlag) - 1); }
+
+    bool IsAllocated(size_t aSlot) const { return mEntries[aSlot].mGeneration != 0; }
+
+    // Whether aPath would be coalesced into a wider path at aLevel, and the key of that wider path.
+    static bool IsCoalesceCandidate(const AttributePathParams & aPath, CoalesceLevel aLevel)
+    {
+        if (aLevel == CoalesceLevel::kCluster)
+        {
+            return !aPath.HasWildcardClusterId() && !aPath.HasWildcardAttributeId();
+        }
+        return !aPath.HasWildcardEndpointId() && !(aPath.HasWildcardClusterId() && aPath.HasWildcardAttributeId());
+    }
+
+    static Key CoalescedKey(Key aKey, CoalesceLevel aLevel)
+    {
+        aKey.mAttributeId = kInvalidAttributeId;
+        if (aLevel == CoalesceLevel::kEndpoint)
+        {
+            aKey.mClusterId = kInvalidClusterId;
+        }
+        return aKey;
+    }
+
+    Key KeyOfIndexValue(uint16_t aIndexValue) const
+    {
+        const Key key = KeyOf(mEntries[SlotOf(aIndexValue)]);
+        return (aIndexValue & kAliasFlag) ? CoalescedKey(key, mCoalesceLevel) : key;
+    }
+
+    // Returns the index position holding aKey, or kIndexSize if there is none.
+    size_t Lookup(const Key & aKey) const
+    {
+        for (size_t position = Hash(aKey);; position = (position + 1) & kIndexMask)
+        {
+            const uint16_t value = mIndex[position];
+            if (value == kEmptyIndexValue)
+            {
+                return kIndexSize;
+            }
+            if (KeyOfIndexValue(value) == aKey)
+            {
+                return position;
+            }
+        }
+    }
+
+    void IndexInsert(const Key & aKey, uint16_t aIndexValue)
+    {
+        size_t position = Hash(aKey);
+        while (mIndex[position] != kEmptyIndexValue)
+        {
+            position = (position + 1) & kIndexMask;
+        }
+        mIndex[position] = aIndexValue;
+    }
+
+    // Backward-shift deletion, so that lookups never need tombstones.
+    void IndexRemoveAt(size_t aPosition)
+    {
+        size_t hole     = aPosition;
+        size_t position = (aPosition + 1) & kIndexMask;
+        while (mIndex[position] != kEmptyIndexValue)
+        {
+            // Move the value into the hole unless the hole lies before its home bucket.
+            const size_t home = Hash(KeyOfIndexValue(mIndex[position]));
+            if (((position - home) & kIndexMask) >= ((position - hole) & kIndexMask))
+            {
+                mIndex[hole] = mIndex[position];
+                hole         = position;
+            }
+            position = (position + 1) & kIndexMask;
+        }
+        mIndex[hole] = kEmptyIndexValue;
+    }
+
+    bool Allocate(const AttributePathParams & aPath, uint64_t aGeneration)
+    {
+        VerifyOrReturnValue(mFreeHead < kCapacity, false);
+
+        const size_t slot = mFreeHead;
+        mFreeHead         = mEntries[slot].mListIndex;
+
+        mEntries[slot]             = aPath;
+        mEntries[slot].mGeneration = aGeneration;
+        IndexInsert(KeyOf(aPath), static_cast<uint16_t>(slot + 1));
+        mShapeCounts[ShapeOf(aPath)]++;
+        mAllocated++;
+        return true;
+    }
+
+    void Release(size_t aSlot)
+    {
+        AttributePathParamsWithGeneration & entry = mEntries[aSlot];
+
+        IndexRemoveAt(Lookup(KeyOf(entry)));
+        mShapeCounts[ShapeOf(entry)]--;
+        mAllocated--;
+
+        // Free slots are chained through their list index.
+        entry.mGeneration = 0;
+        entry.mListIndex  = static_cast<ListIndex>(mFreeHead);
+        mFreeHead         = aSlot;
+    }
+
+    // Changes the path held by aSlot. The caller guarantees no other slot holds the key of aPath.
+    void Rekey(size_t aSlot, const AttributePathParams & aPath)
+    {
+        AttributePathParamsWithGeneration & entry = mEntries[aSlot];
+
+        IndexRemoveAt(Lookup(KeyOf(entry)));
+        mShapeCounts[ShapeOf(entry)]--;
+
+        entry.mEndpointId  = aPath.mEndpointId;
+        entry.mClusterId   = aPath.mClusterId;
+        entry.mAttributeId = aPath.mAttributeId;
+        entry.mListIndex   = aPath.mListIndex;
+
+        IndexInsert(KeyOf(entry), static_cast<uint16_t>(aSlot + 1));
+        mShapeCounts[ShapeOf(entry)]++;
+    }
+
+    /**
+     * Merges the dirty paths sharing the same cluster (kCluster) or endpoint (kEndpoint) into a single wildcard path, leaving
+     * groups of a single path untouched. Runs in O(kCapacity).
+     *
+     * Returns whether any path was released.
+     */
+    bool Coalesce(CoalesceLevel aLevel)
+    {
+        bool released  = false;
+        mCoalesceLevel = aLevel;
+
+        for (size_t slot = 0; slot < kCapacity; slot++)
+        {
+            if (!IsAllocated(slot) || !IsCoalesceCandidate(mEntries[slot], aLevel))
+            {
+                continue;
+            }
+
+            const Key coalescedKey = CoalescedKey(KeyOf(mEntries[slot]), aLevel);
+            size_t position        = Lookup(coalescedKey);
+            if (position == kIndexSize)
+            {
+                // First path of its group: remember it in case another one shows up.
+                IndexInsert(coalescedKey, static_cast<uint16_t>((slot + 1) | kAliasFlag));
+                continue;
+            }
+
+            const size_t leaderSlot = SlotOf(mIndex[position]);
+            if (mIndex[position] & kAliasFlag)
+            {
+                // Second path of its group: widen the first one in place, its alias becomes its index entry.
+                AttributePathParamsWithGeneration & leader = mEntries[leaderSlot];
+                IndexRemoveAt(Lookup(KeyOf(leader)));
+                mShapeCounts[ShapeOf(leader)]--;
+                leader.SetWildcardAttributeId();
+                if (aLevel == CoalesceLevel::kEndpoint)
+                {
+                    leader.SetWildcardClusterId();
+                }
+                mShapeCounts[ShapeOf(leader)]++;
+
+                position = Lookup(coalescedKey);
+                mIndex[position] = static_cast<uint16_t>(mIndex[position] & ~kAliasFlag);
+            }
+
+            if (mEntries[slot].mGeneration > mEntries[leaderSlot].mGeneration)
+            {
+                mEntries[leaderSlot].mGeneration = mEntries[slot].mGeneration;
+            }
+            Release(slot);
+            released = true;
+        }
+
+        // Drop the aliases of the groups that only had one path.
+        for (size_t slot = 0; slot < kCapacity; slot++)
+        {
+            if (!IsAllocated(slot) || !IsCoalesceCandidate(mEntries[slot], aLevel))
+            {
+                continue;
+            }
+            const size_t position = Lookup(CoalescedKey(KeyOf(mEntries[slot]), aLevel));
+            if (position != kIndexSize && mIndex[position] == static_cast<uint16_t>((slot + 1) | kAliasFlag))
+            {
+                IndexRemoveAt(position);
+            }
+        }
+
+        mCoalesceLevel = CoalesceLevel::kNone;
+        return released;
+    }
+
+    AttributePathParamsWithGeneration mEntries[kCapacity];
+    uint16_t mIndex[kIndexSize];
+    uint16_t mShapeCounts[kShapeCount];
+    size_t mFreeHead             = 0;
+    size_t mAllocated            = 0;
+    CoalesceLevel mCoalesceLevel = CoalesceLevel::kNone;
+};
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
@@ -105,9 +105,114 @@ std::optional<Status> ValidateAttributeIsReadable(DataModel::Provider * dataMode
     return std::nullopt;
 }
 
+DataModel::ActionReturnStatus ReadAttributeValue(DataModel::Provider * dataModel,
+                                                 const DataModel::ReadAttributeRequest & readRequest,
+                                                 AttributeValueEncoder & encoder)
+{
+    if (IsSupportedGlobalAttributeNotInMetadata(readRequest.path.mAttributeId))
+    {
+        // Global attributes are NOT directly handled by data model providers, instead
+        // they are routed through metadata.
+        return ReadGlobalAttributeFromMetadata(dataModel, readRequest.path, encoder);
+    }
+    return dataModel->ReadAttribute(readRequest, encoder);
+}
+
+/// Encodes the AttributeReportIBs of a read as an anonymous array into `buffer`.
+///
+/// On success, `fragment` is set to the encoded array.
+DataModel::ActionReturnStatus EncodeReportFragment(DataModel::Provider * dataModel,
+                                                   const DataModel::ReadAttributeRequest & readRequest, DataVersion version,
+                                                   MutableByteSpan buffer, ByteSpan & fragment)
+{
+    TLV::TLVWriter writer;
+    AttributeReportIBs::Builder builder;
+
+    writer.Init(buffer);
+    ReturnErrorOnFailure(builder.Init(&writer));
+
+    AttributeValueEncoder encoder(builder, *readRequest.subjectDescriptor, readRequest.path, version,
+                                  readRequest.readFlags.Has(ReadFlags::kFabricFiltered));
+    DataModel::ActionReturnStatus status = ReadAttributeValue(dataModel, readRequest, encoder);
+    VerifyOrReturnValue(status.IsSuccess(), status);
+
+    ReturnErrorOnFailure(builder.EndOfAttributeReportIBs());
+    ReturnErrorOnFailure(writer.Finalize());
+
+    fragment = ByteSpan(buffer.data(), writer.GetLengthWritten());
+    return CHIP_NO_ERROR;
+}
+
+/// Copies the AttributeReportIBs of a fragment encoded by EncodeReportFragment.
+CHIP_ERROR CopyReportFragment(ByteSpan fragment, TLV::TLVWriter & writer)
+{
+    TLV::TLVReader reader;
+    TLV::TLVType outerType;
+
+    reader.Init(fragment);
+    ReturnErrorOnFailure(reader.Next(TLV::kTLVType_Array, TLV::AnonymousTag()));
+    ReturnErrorOnFailure(reader.EnterContainer(outerType));
+
+    CHIP_ERROR err;
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        ReturnErrorOnFailure(writer.CopyElement(TLV::AnonymousTag(), reader));
+    }
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+    return CHIP_NO_ERROR;
+}
+
+/// Reads an attribute through the report cache: the AttributeReportIBs already encoded for another read handler are copied,
+/// otherwise they get encoded into the cache first.
+///
+/// Returns std::nullopt, without writing anything, if the cache cannot serve this read. The attribute should then be read
+/// directly, which also takes care of splitting lists across chunks.
+std::optional<DataModel::ActionReturnStatus> ReadThroughReportCache(ReportCache * cache, DataModel::Provider * dataModel,
+                                                                    const DataModel::ReadAttributeRequest & readRequest,
+                                                                    DataVersion version,
+                                                                    AttributeReportIBs::Builder & reportBuilder,
+                                                                    const AttributeEncodeState * encoderState)
+{
+    VerifyOrReturnValue(ReportCache::IsEnabled() && cache != nullptr, std::nullopt);
+    // Only whole attribute values are cached, not the remaining items of a list split across chunks.
+    VerifyOrReturnValue(encoderState == nullptr || encoderState->CurrentEncodingListIndex() == kInvalidListIndex, std::nullopt);
+
+    const ReportCache::Key key{ readRequest.path, version, readRequest.subjectDescriptor->fabricIndex,
+                                readRequest.readFlags.Has(ReadFlags::kFabricFiltered) };
+
+    ByteSpan fragment;
+    const ReportCache::State state = cache->Find(key, fragment);
+    VerifyOrReturnValue(state != ReportCache::State::kUncacheable, std::nullopt);
+
+    if (state == ReportCache::State::kMissing)
+    {
+        DataModel::ActionReturnStatus status = EncodeReportFragment(dataModel, readRequest, version, cache->FreeSpace(), fragment);
+        if (status.IsOutOfSpaceEncodingResponse())
+        {
+            // Too large for the cache, do not try again for the next read handlers.
+            cache->MarkUncacheable(key);
+            return std::nullopt;
+        }
+        // Failures are not cached: they are reported like they would be for a direct read.
+        VerifyOrReturnValue(status.IsSuccess(), status);
+        cache->Store(key, fragment.size());
+    }
+
+    TLV::TLVWriter checkpoint;
+    reportBuilder.Checkpoint(checkpoint);
+    if (CopyReportFragment(fragment, *reportBuilder.GetWriter()) != CHIP_NO_ERROR)
+    {
+        // Out of space in this report. A direct read may still fit part of a list.
+        reportBuilder.Rollback(checkpoint);
+        return std::nullopt;
+    }
+    return DataModel::ActionReturnStatus(CHIP_NO_ERROR);
+}
+
 DataModel::ActionReturnStatus RetrieveClusterData(DataModel::Provider * dataModel, const SubjectDescriptor & subjectDescriptor,
                                                   BitFlags<ReadFlags> flags, AttributeReportIBs::Builder & reportBuilder,
-                                                  const ConcreteReadAttributePath & path, AttributeEncodeState * encoderState)
+                                                  const ConcreteReadAttributePath & path, AttributeEncodeState * encoderState,
+                                                  ReportCache * reportCache)
 {
     ChipLogDetail(DataManagement, "<RE:Run> Cluster %" PRIx32 ", Attribute %" PRIx32 " is dirty", path.mClusterId,
                   path.mAttributeId);
@@ -169,15 +274,14 @@ DataModel::ActionReturnStatus RetrieveClusterData(DataModel::Provider * dataMode
     {
         status = *required_privilege_status;
     }
-    else if (IsSupportedGlobalAttributeNotInMetadata(readRequest.path.mAttributeId))
+    else if (auto cached_status = ReadThroughReportCache(reportCache, dataModel, readRequest, version, reportBuilder, encoderState);
+             cached_status.has_value())
     {
-        // Global attributes are NOT directly handled by data model providers, instead
-        // they are routed through metadata.
-        status = ReadGlobalAttributeFromMetadata(dataModel, readRequest.path, attributeValueEncoder);
+        status = *cached_status;
     }
     else
     {
-        status = dataModel->ReadAttribute(readRequest, attributeValueEncoder);
+        status = ReadAttributeValue(dataModel, readRequest, attributeValueEncoder);
     }
 
     if (status.IsSuccess())
@@ -403,21 +507,10 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Bu
         {
             if (!apReadHandler->IsPriming())
             {
-                bool concretePathDirty = false;
-                // TODO: Optimize this implementation by making the iterator only emit intersected paths.
-                mGlobalDirtySet.ForEachActiveObject([&](auto * dirtyPath) {
-                    if (dirtyPath->IsAttributePathSupersetOf(readPath))
-                    {
-                        // We don't need to worry about paths that were already marked dirty before the last time this read handler
-                        // started a report that it completed: those paths already got reported.
-                        if (dirtyPath->mGeneration > apReadHandler->mPreviousReportsBeginGeneration)
-                        {
-                            concretePathDirty = true;
-                            return Loop::Break;
-                        }
-                    }
-                    return Loop::Continue;
-                });
+                // We don't need to worry about paths that were already marked dirty before the last time this read handler
+                // started a report that it completed: those paths already got reported.
+                const bool concretePathDirty =
+                    mGlobalDirtySet.IsDirtySince(readPath, apReadHandler->mPreviousReportsBeginGeneration);
 
                 if (!concretePathDirty)
                 {
@@ -453,7 +546,7 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Bu
             flags.Set(ReadFlags::kAllowsLargePayload, apReadHandler->AllowsLargePayload());
             DataModel::ActionReturnStatus status =
                 RetrieveClusterData(mpImEngine->GetDataModelProvider(), apReadHandler->GetSubjectDescriptor(), flags,
-                                    attributeReportIBs, pathForRetrieval, &encodeState);
+                                    attributeReportIBs, pathForRetrieval, &encodeState, &mReportCache);
             if (status.IsError())
             {
                 // Operation error set, since this will affect early return or override on status encoding
@@ -907,6 +1000,8 @@ void Engine::Run()
 {
     uint32_t numReadHandled = 0;
 
+    mReportCache.Clear();
+
     // We may be deallocating read handlers as we go.  Track how many we had
     // initially, so we make sure to go through all of them.
     size_t initialAllocated = mpImEngine->mReadHandlers.Allocated();
@@ -965,144 +1060,15 @@ void Engine::Run()
     }
 }
 
-bool Engine::MergeOverlappedAttributePath(const AttributePathParams & aAttributePath)
-{
-    return Loop::Break == mGlobalDirtySet.ForEachActiveObject([&](auto * path) {
-        if (path->IsAttributePathSupersetOf(aAttributePath))
-        {
-            path->mGeneration = GetDirtySetGeneration();
-            return Loop::Break;
-        }
-        if (aAttributePath.IsAttributePathSupersetOf(*path))
-        {
-            // TODO: the wildcard input path may be superset of next paths in globalDirtySet, it is fine at this moment, since
-            // when building report, it would use the first path of globalDirtySet to compare against interested paths read clients
-            // want.
-            // It is better to eliminate the duplicate wildcard paths in follow-up
-            path->mGeneration  = GetDirtySetGeneration();
-            path->mEndpointId  = aAttributePath.mEndpointId;
-            path->mClusterId   = aAttributePath.mClusterId;
-            path->mListIndex   = aAttributePath.mListIndex;
-            path->mAttributeId = aAttributePath.mAttributeId;
-            return Loop::Break;
-        }
-        return Loop::Continue;
-    });
-}
-
-bool Engine::ClearTombPaths()
-{
-    bool pathReleased = false;
-    mGlobalDirtySet.ForEachActiveObject([&](auto * path) {
-        if (path->mGeneration == 0)
-        {
-            mGlobalDirtySet.ReleaseObject(path);
-            pathReleased = true;
-        }
-        return Loop::Continue;
-    });
-    return pathReleased;
-}
-
-bool Engine::MergeDirtyPathsUnderSameCluster()
-{
-    mGlobalDirtySet.ForEachActiveObject([&](auto * outerPath) {
-        if (outerPath->HasWildcardClusterId() || outerPath->mGeneration == 0)
-        {
-            return Loop::Continue;
-        }
-        mGlobalDirtySet.ForEachActiveObject([&](auto * innerPath) {
-            if (innerPath == outerPath)
-            {
-                return Loop::Continue;
-            }
-            // We don't support paths with a wildcard endpoint + a concrete cluster in global dirty set, so we do a simple == check
-            // here.
-            if (innerPath->mEndpointId != outerPath->mEndpointId || innerPath->mClusterId != outerPath->mClusterId)
-            {
-                return Loop::Continue;
-            }
-            if (innerPath->mGeneration > outerPath->mGeneration)
-            {
-                outerPath->mGeneration = innerPath->mGeneration;
-            }
-            outerPath->SetWildcardAttributeId();
-
-            // The object pool does not allow us to release objects in a nested iteration, mark the path as a tomb by setting its
-            // generation to 0 and then clear it later.
-            innerPath->mGeneration = 0;
-            return Loop::Continue;
-        });
-        return Loop::Continue;
-    });
-
-    return ClearTombPaths();
-}
-
-bool Engine::MergeDirtyPathsUnderSameEndpoint()
-{
-    mGlobalDirtySet.ForEachActiveObject([&](auto * outerPath) {
-        if (outerPath->HasWildcardEndpointId() || outerPath->mGeneration == 0)
-        {
-            return Loop::Continue;
-        }
-        mGlobalDirtySet.ForEachActiveObject([&](auto * innerPath) {
-            if (innerPath == outerPath)
-            {
-                return Loop::Continue;
-            }
-            if (innerPath->mEndpointId != outerPath->mEndpointId)
-            {
-                return Loop::Continue;
-            }
-            if (innerPath->mGeneration > outerPath->mGeneration)
-            {
-                outerPath->mGeneration = innerPath->mGeneration;
-            }
-            outerPath->SetWildcardClusterId();
-            outerPath->SetWildcardAttributeId();
-
-            // The object pool does not allow us to release objects in a nested iteration, mark the path as a tomb by setting its
-            // generation to 0 and then clear it later.
-            innerPath->mGeneration = 0;
-            return Loop::Continue;
-        });
-        return Loop::Continue;
-    });
-    return ClearTombPaths();
-}
-
 CHIP_ERROR Engine::InsertPathIntoDirtySet(const AttributePathParams & aAttributePath)
 {
-    VerifyOrReturnError(!MergeOverlappedAttributePath(aAttributePath), CHIP_NO_ERROR);
-
-    if (mGlobalDirtySet.Exhausted() && !MergeDirtyPathsUnderSameCluster() && !MergeDirtyPathsUnderSameEndpoint())
-    {
-        ChipLogDetail(DataManagement, "Global dirty set pool exhausted, merge all paths.");
-        mGlobalDirtySet.ReleaseAll();
-        auto object         = mGlobalDirtySet.CreateObject();
-        object->mGeneration = GetDirtySetGeneration();
-    }
-
-    VerifyOrReturnError(!MergeOverlappedAttributePath(aAttributePath), CHIP_NO_ERROR);
-    ChipLogDetail(DataManagement, "Cannot merge the new path into any existing path, create one.");
-
-    auto object = mGlobalDirtySet.CreateObject();
-    if (object == nullptr)
-    {
-        // This should not happen, this path should be merged into the wildcard endpoint at least.
-        ChipLogError(DataManagement, "mGlobalDirtySet pool full, cannot handle more entries!");
-        return CHIP_ERROR_NO_MEMORY;
-    }
-    *object             = aAttributePath;
-    object->mGeneration = GetDirtySetGeneration();
-
-    return CHIP_NO_ERROR;
+    return mGlobalDirtySet.Insert(aAttributePath, GetDirtySetGeneration());
 }
 
 CHIP_ERROR Engine::SetDirty(const AttributePathParams & aAttributePath)
 {
     BumpDirtySetGeneration();
+    mReportCache.Invalidate(aAttributePath);
 
     bool intersectsInterestPath     = false;
     DataModel::Provider * dataModel = mpImEngine->GetDataModelProvider();
@@ -29,6 +29,8 @@
 #include <app/MessageDef/ReportDataMessage.h>
 #include <app/ReadHandler.h>
 #include <app/data-model-provider/ProviderChangeListener.h>
+#include <app/reporting/DirtyPathSet.h>
+#include <app/reporting/ReportFragmentCache.h>
 #include <app/util/basic-types.h>
 #include <lib/core/CHIPCore.h>
 #include <lib/support/CodeUtils.h>
@@ -46,6 +48,10 @@ class InteractionModelEngine;
 class TestReadInteraction;
 
 namespace reporting {
+
+/// Attribute reports shared between the read handlers serviced by the Engine, see ReportFragmentCache.
+using ReportCache = ReportFragmentCache<CHIP_IM_SERVER_REPORT_CACHE_SIZE, CHIP_IM_SERVER_REPORT_CACHE_MAX_ENTRIES>;
+
 /*
  *  @class Engine
  *
@@ -143,13 +149,6 @@ private:
 
     bool IsRunScheduled() const { return mRunScheduled; }
 
-    struct AttributePathParamsWithGeneration : public AttributePathParams
-    {
-        AttributePathParamsWithGeneration() {}
-        AttributePathParamsWithGeneration(const AttributePathParams aPath) : AttributePathParams(aPath) {}
-        uint64_t mGeneration = 0;
-    };
-
     /**
      * Build Single Report Data including attribute changes and event data stream, and send out
      *
@@ -206,30 +205,10 @@ private:
      *
      * Return whether one of our paths is now a superset of the provided path.
      */
-    bool MergeOverlappedAttributePath(const AttributePathParams & aAttributePath);
-
-    /**
-     * If we are running out of ObjectPool for the global dirty set, we will try to merge the existing items by clusters.
-     *
-     * Returns whether we have released any paths.
-     */
-    bool MergeDirtyPathsUnderSameCluster();
-
-    /**
-     * If we are running out of ObjectPool for the global dirty set and we cannot find a slot after merging the existing items by
-     * clusters, we will try to merge the existing items by endpoints.
-     *
-     * Returns whether we have released any paths.
-     */
-    bool MergeDirtyPathsUnderSameEndpoint();
-
-    /**
-     * During the iterating of the paths, releasing the object in the inner loop will cause undefined behavior of the ObjectPool, so
-     * we replace the items to be cleared by a tomb first, then clear all the tombs after the iteration.
-     *
-     * Returns whether we have released any paths.
-     */
-    bool ClearTombPaths();
+    bool MergeOverlappedAttributePath(const AttributePathParams & aAttributePath)
+    {
+        return mGlobalDirtySet.MergeOverlapped(aAttributePath, GetDirtySetGeneration());
+    }
 
     CHIP_ERROR InsertPathIntoDirtySet(const AttributePathParams & aAttributePath);
 
@@ -260,15 +239,12 @@ private:
     ReadHandler * mRunningReadHandler = nullptr;
 
     /**
-     *  mGlobalDirtySet is used to track the set of attribute/event paths marked dirty for reporting purposes.
+     *  mGlobalDirtySet is used to track the set of attribute paths marked dirty for reporting purposes.
      *
+     *  It is hashed by path so that checking whether a concrete path is dirty does not depend on the number of dirty paths,
+     *  and coalesces paths by cluster, then by endpoint, when it runs out of room.
      */
-#if CONFIG_BUILD_FOR_HOST_UNIT_TEST
-    // For unit tests, always use inline allocation for code coverage.
-    ObjectPool<AttributePathParamsWithGeneration, CHIP_IM_SERVER_MAX_NUM_DIRTY_SET, ObjectPoolMem::kInline> mGlobalDirtySet;
-#else
-    ObjectPool<AttributePathParamsWithGeneration, CHIP_IM_SERVER_MAX_NUM_DIRTY_SET> mGlobalDirtySet;
-#endif
+    DirtyPathSet<CHIP_IM_SERVER_MAX_NUM_DIRTY_SET> mGlobalDirtySet;
 
     /**
      * A generation counter for the dirty attrbute set.
@@ -284,6 +260,14 @@ private:
      */
     uint64_t mDirtyGeneration = 1;
 
+    /**
+     * Attribute reports encoded during the current run, for the other read handlers reporting the same attributes.
+     *
+     * The cache only lives for the duration of a single Run: some attribute values change without being marked dirty, and
+     * these must be read again by later reports.
+     */
+    ReportCache mReportCache;
+
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
     uint32_t mReservedSize          = 0;
     uint32_t mMaxAttributesPerChunk = UINT32_MAX;
@@ -0,0 +1,227 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/AttributePathParams.h>
+#include <app/ConcreteAttributePath.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/Span.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+/**
+ * Encoded attribute reports, shared between the read handlers serviced by the reporting engine.
+ *
+ * When several subscribers are interested in the same attributes (e.g. identical controllers subscribing to every bridged
+ * endpoint), each report would otherwise read and encode the same attribute values once per subscriber. Once a handler has
+ * passed the access checks for a path, it can instead copy the AttributeReportIBs encoded for another handler, provided that
+ * encoding yields the same bytes for both: same concrete path, same data version, same accessing fabric (fabric-sensitive data
+ * depends on it) and same fabric filtering.
+ *
+ * Fragments are appended to a fixed-size buffer. Once the buffer or the entry table is full, further reads bypass the cache
+ * until it gets cleared. Fragments that do not fit are remembered as uncacheable, so that they are only tried once.
+ */
+template <size_t kBufferSize, size_t kMaxEntries>
+class ReportFragmentCache
+{
+public:
+    struct Key
+    {
+        ConcreteAttributePath mPath;
+        DataVersion mDataVersion;
+        FabricIndex mAccessingFabricIndex;
+        bool mFabricFiltered;
+
+        bool operator==(const Key & aOther) const
+        {
+            return mPath == aOther.mPath && mDataVersion == aOther.mDataVersion &&
+                mAccessingFabricIndex == aOther.mAccessingFabricIndex && mFabricFiltered == aOther.mFabricFiltered;
+        }
+    };
+
+    enum class State : uint8_t
+    {
+        kMissing,
+        kCached,
+        kUncacheable,
+    };
+
+    static constexpr bool IsEnabled() { return kBufferSize > 0 && kMaxEntries > 0; }
+
+    ReportFragmentCache() { Clear(); }
+
+    ReportFragmentCache(const ReportFragmentCache &)             = delete;
+    ReportFragmentCache & operator=(const ReportFragmentCache &) = delete;
+
+    void Clear()
+    {
+        for (auto & value : mIndex)
+        {
+            value = kEmptyIndexValue;
+        }
+        mEntryCount = 0;
+        mUsed       = 0;
+    }
+
+    /**
+     * Looks aKey up. aFragment is set to the cached fragment when kCached is returned.
+     *
+     * Keys that cannot be stored anymore (the cache is full) are reported as kUncacheable.
+     */
+    State Find(const Key & aKey, ByteSpan & aFragment) const
+    {
+        const size_t position = Lookup(aKey);
+        if (position == kIndexSize)
+        {
+            return (mEntryCount < kMaxEntries && mUsed < kBufferSize) ? State::kMissing : State::kUncacheable;
+        }
+
+        const Entry & entry = mEntries[mIndex[position] - 1];
+        if (entry.mState == State::kCached)
+        {
+            aFragment = ByteSpan(mBuffer + entry.mOffset, entry.mLength);
+        }
+        return entry.mState;
+    }
+
+    /**
+     * Space where the fragment of a missing key can be encoded before calling Store.
+     */
+    MutableByteSpan FreeSpace() { return MutableByteSpan(mBuffer + mUsed, kBufferSize - mUsed); }
+
+    /**
+     * Records the first aLength bytes of FreeSpace() as the fragment of aKey, which must be missing.
+     */
+    void Store(const Key & aKey, size_t aLength)
+    {
+        VerifyOrReturn(aLength <= kBufferSize - mUsed);
+        VerifyOrReturn(Insert(aKey, State::kCached, mUsed, aLength));
+        mUsed += aLength;
+    }
+
+    /**
+     * Records that aKey, which must be missing, should bypass the cache.
+     */
+    void MarkUncacheable(const Key & aKey) { Insert(aKey, State::kUncacheable, 0, 0); }
+
+    /**
+     * Prevents the fragments of the paths covered by aPath from being used again.
+     *
+     * Data versions normally change along with attribute values, but attributes may be marked dirty without a version change.
+     */
+    void Invalidate(const AttributePathParams & aPath)
+    {
+        for (size_t i = 0; i < mEntryCount; i++)
+        {
+            if (aPath.IsAttributePathSupersetOf(mEntries[i].mKey.mPath))
+            {
+                mEntries[i].mState = State::kUncacheable;
+            }
+        }
+    }
+
+private:
+    static_assert(kMaxEntries < UINT16_MAX, "The index stores entry numbers on 16 bits");
+    static_assert(kBufferSize <= UINT32_MAX, "Fragment offsets are stored on 32 bits");
+
+    struct Entry
+    {
+        Key mKey;
+        uint32_t mOffset;
+        uint32_t mLength;
+        State mState;
+    };
+
+    // Index values are entry + 1, 0 marks an empty bucket. Entries are never removed before Clear.
+    static constexpr uint16_t kEmptyIndexValue = 0;
+
+    static constexpr size_t IndexSizeFor(size_t maxEntries)
+    {
+        // Load factor of at most 1/2.
+        size_t size = 1;
+        while (size < 2 * maxEntries)
+        {
+            size <<= 1;
+        }
+        return size;
+    }
+    static constexpr size_t kIndexSize = IndexSizeFor(kMaxEntries);
+    static constexpr size_t kIndexMask = kIndexSize - 1;
+
+    static size_t Hash(const Key & aKey)
+    {
+        uint64_t hash = ((static_cast<uint64_t>(aKey.mPath.mClusterId) << 32) | aKey.mPath.mAttributeId) * 0x9E37'79B9'7F4A'7C15ull;
+        hash ^= (hash >> 29) + static_cast<uint64_t>(aKey.mPath.mEndpointId) * 0xC2B2'AE3D'27D4'EB4Full;
+        hash ^= (static_cast<uint64_t>(aKey.mDataVersion) << 8) | aKey.mAccessingFabricIndex;
+        return static_cast<size_t>(hash ^ (hash >> 32)) & kIndexMask;
+    }
+
+    // Returns the index position holding aKey, or kIndexSize if there is none.
+    size_t Lookup(const Key & aKey) const
+    {
+        VerifyOrReturnValue(IsEnabled(), kIndexSize);
+        for (size_t position = Hash(aKey);; position = (position + 1) & kIndexMask)
+        {
+            const uint16_t value = mIndex[position];
+            if (value == kEmptyIndexValue)
+            {
+                return kIndexSize;
+            }
+            if (mEntries[value - 1].mKey == aKey)
+            {
+                return position;
+            }
+        }
+    }
+
+    bool Insert(const Key & aKey, State aState, size_t aOffset, size_t aLength)
+    {
+        VerifyOrReturnValue(mEntryCount < kMaxEntries, false);
+
+        Entry & entry = mEntries[mEntryCount];
+        entry.mKey    = aKey;
+        entry.mOffset = static_cast<uint32_t>(aOffset);
+        entry.mLength = static_cast<uint32_t>(aLength);
+        entry.mState  = aState;
+        mEntryCount++;
+
+        size_t position = Hash(aKey);
+        while (mIndex[position] != kEmptyIndexValue)
+        {
+            position = (position + 1) & kIndexMask;
+        }
+        mIndex[position] = static_cast<uint16_t>(mEntryCount);
+        return true;
+    }
+
+    Entry mEntries[kMaxEntries > 0 ? kMaxEntries : 1];
+    uint16_t mIndex[kIndexSize];
+    uint8_t mBuffer[kBufferSize > 0 ? kBufferSize : 1];
+    size_t mEntryCount = 0;
+    size_t mUsed       = 0;
+};
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
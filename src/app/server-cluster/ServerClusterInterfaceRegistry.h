@@ -205,8 +205,14 @@ public:
 
     ServerClusterInstances AllServerClusterInstances();
 
+    /// Changes every time a registration is added or removed.
+    ///
+    /// Allows callers that cache data derived from the set of registered clusters to detect that it is stale.
+    uint32_t RegistrationGeneration() const { return mRegistrationGeneration; }
+
 protected:
     ServerClusterRegistration * mRegistrations = nullptr;
+    uint32_t mRegistrationGeneration           = 0;
 
     // A one-element cache to speed up finding a cluster within an endpoint.
     // The endpointId specifies which endpoint the cache belongs to.
@@ -23,6 +23,8 @@
 #include <app/ConcreteAttributePath.h>
 #include <app/EventManagement.h>
 #include <app/util/mock/Constants.h>
+#include <app/util/mock/Functions.h>
+#include <app/util/mock/MockNodeConfig.h>
 #include <data-model-providers/codegen/Instance.h>
 #include <lib/core/CHIPCore.h>
 #include <lib/core/StringBuilderAdapters.h>
@@ -519,4 +521,59 @@ TEST_F(TestAttributePathExpandIterator, TestMultipleClusInfo)
     }
 }
 
+TEST_F(TestAttributePathExpandIterator, TestStructureChangeDuringExpansion)
+{
+    using namespace Clusters::Globals::Attributes;
+
+    // clang-format off
+    static const MockNodeConfig changedConfig({
+        MockEndpointConfig(kMockEndpoint1, {
+            MockClusterConfig(MockClusterId(1), {
+                ClusterRevision::Id, FeatureMap::Id,
+            }),
+        }),
+        MockEndpointConfig(kMockEndpoint3, {
+            MockClusterConfig(MockClusterId(1), {
+                ClusterRevision::Id, FeatureMap::Id, MockAttributeId(5),
+            }),
+        }),
+    });
+    // clang-format on
+
+    SingleLinkedListNode<app::AttributePathParams> clusInfo;
+    app::ConcreteAttributePath path;
+
+    auto position = AttributePathExpandIterator::Position::StartIterating(&clusInfo);
+    app::AttributePathExpandIterator iter(CodegenDataModelProviderInstance(&gStorageDelegate), position);
+
+    ASSERT_TRUE(iter.Next(path));
+    EXPECT_EQ(path, P(kMockEndpoint1, MockClusterId(1), ClusterRevision::Id));
+    ASSERT_TRUE(iter.Next(path));
+    EXPECT_EQ(path, P(kMockEndpoint1, MockClusterId(1), FeatureMap::Id));
+
+    // endpoint 2 goes away and endpoint 3 changes while the same iterator is still in use
+    chip::Test::SetMockNodeConfig(changedConfig);
+
+    P paths[] = {
+        { kMockEndpoint1, MockClusterId(1), GeneratedCommandList::Id },
+        { kMockEndpoint1, MockClusterId(1), AcceptedCommandList::Id },
+        { kMockEndpoint1, MockClusterId(1), AttributeList::Id },
+        { kMockEndpoint3, MockClusterId(1), ClusterRevision::Id },
+        { kMockEndpoint3, MockClusterId(1), FeatureMap::Id },
+        { kMockEndpoint3, MockClusterId(1), MockAttributeId(5) },
+        { kMockEndpoint3, MockClusterId(1), GeneratedCommandList::Id },
+        { kMockEndpoint3, MockClusterId(1), AcceptedCommandList::Id },
+        { kMockEndpoint3, MockClusterId(1), AttributeList::Id },
+    };
+
+    for (const auto & expected : paths)
+    {
+        ASSERT_TRUE(iter.Next(path));
+        EXPECT_EQ(path, expected);
+    }
+    EXPECT_FALSE(iter.Next(path));
+
+    chip::Test::ResetMockNodeConfig();
+}
+
 } // namespace
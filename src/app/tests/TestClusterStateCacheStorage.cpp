@@ -0,0 +1,205 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/ClusterStateCacheStorage.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+
+#include <pw_unit_test/framework.h>
+
+#include <cstring>
+#include <vector>
+
+namespace {
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::ClusterStateCacheStorage;
+
+class TestClusterStateCacheStorage : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { Platform::MemoryShutdown(); }
+};
+
+template <typename NodeState>
+std::vector<ConcreteAttributePath> AllAttributes(const NodeState & state)
+{
+    std::vector<ConcreteAttributePath> paths;
+    CHIP_ERROR err = state.ForEachCluster([&](EndpointId endpointId, ClusterId clusterId, const ClusterVersions &) {
+        return state.ForEachAttribute(endpointId, clusterId, [&](AttributeId attributeId, const uint32_t &) {
+            paths.push_back(ConcreteAttributePath(endpointId, clusterId, attributeId));
+            return CHIP_NO_ERROR;
+        });
+    });
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+    return paths;
+}
+
+TEST_F(TestClusterStateCacheStorage, TestFlatNodeState)
+{
+    FlatNodeState<uint32_t> state;
+
+    // Out of order insertions still iterate in path order.
+    state.SetAttribute(ConcreteAttributePath(2, 1, 1), 21);
+    state.SetAttribute(ConcreteAttributePath(1, 2, 2), 122);
+    state.SetAttribute(ConcreteAttributePath(1, 2, 1), 121);
+    state.SetAttribute(ConcreteAttributePath(1, 1, 1), 111);
+    state.SetAttribute(ConcreteAttributePath(1, 2, 1), 1210);
+
+    const std::vector<ConcreteAttributePath> expected = { ConcreteAttributePath(1, 1, 1), ConcreteAttributePath(1, 2, 1),
+                                                          ConcreteAttributePath(1, 2, 2), ConcreteAttributePath(2, 1, 1) };
+    EXPECT_EQ(AllAttributes(state), expected);
+
+    ASSERT_NE(state.FindAttribute(ConcreteAttributePath(1, 2, 1)), nullptr);
+    EXPECT_EQ(*state.FindAttribute(ConcreteAttributePath(1, 2, 1)), 1210u);
+    EXPECT_EQ(state.FindAttribute(ConcreteAttributePath(1, 2, 3)), nullptr);
+
+    EXPECT_TRUE(state.HasEndpoint(1));
+    EXPECT_FALSE(state.HasEndpoint(3));
+
+    state.GetOrCreateCluster(1, 2).mCommittedDataVersion.SetValue(7);
+    ASSERT_NE(state.FindCluster(1, 2), nullptr);
+    EXPECT_EQ(state.FindCluster(1, 2)->mCommittedDataVersion, MakeOptional<DataVersion>(7));
+
+    size_t clusterCount = 0;
+    CHIP_ERROR err      = state.ForEachCluster(1, [&](EndpointId endpointId, ClusterId, const ClusterVersions &) {
+        EXPECT_EQ(endpointId, 1);
+        clusterCount++;
+        return CHIP_NO_ERROR;
+    });
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+    EXPECT_EQ(clusterCount, 2u);
+
+    state.EraseAttribute(ConcreteAttributePath(1, 2, 2));
+    EXPECT_EQ(state.FindAttribute(ConcreteAttributePath(1, 2, 2)), nullptr);
+    EXPECT_NE(state.FindCluster(1, 2), nullptr);
+
+    state.EraseCluster(ConcreteClusterPath(1, 2));
+    EXPECT_EQ(state.FindCluster(1, 2), nullptr);
+    EXPECT_EQ(state.FindAttribute(ConcreteAttributePath(1, 2, 1)), nullptr);
+    EXPECT_TRUE(state.HasEndpoint(1));
+
+    state.EraseEndpoint(1);
+    EXPECT_FALSE(state.HasEndpoint(1));
+    EXPECT_EQ(AllAttributes(state), std::vector<ConcreteAttributePath>{ ConcreteAttributePath(2, 1, 1) });
+}
+
+// Applies the same random operations to both storage modes and checks that they always agree.
+TEST_F(TestClusterStateCacheStorage, TestFlatMatchesTree)
+{
+    TreeNodeState<uint32_t> tree;
+    FlatNodeState<uint32_t> flat;
+
+    uint32_t seed = 0x0bad'cafe;
+    auto random   = [&seed](uint32_t range) {
+        seed = seed * 1664525u + 1013904223u;
+        return (seed >> 8) % range;
+    };
+
+    for (uint32_t i = 0; i < 5000; i++)
+    {
+        const ConcreteAttributePath path(static_cast<EndpointId>(random(4)), static_cast<ClusterId>(random(6)),
+                                         static_cast<AttributeId>(random(8)));
+        switch (random(16))
+        {
+        case 0:
+            tree.EraseEndpoint(path.mEndpointId);
+            flat.EraseEndpoint(path.mEndpointId);
+            break;
+        case 1:
+            tree.EraseCluster(path);
+            flat.EraseCluster(path);
+            break;
+        case 2:
+        case 3:
+            tree.EraseAttribute(path);
+            flat.EraseAttribute(path);
+            break;
+        case 4:
+            tree.GetOrCreateCluster(path.mEndpointId, path.mClusterId).mPendingDataVersion.SetValue(i);
+            flat.GetOrCreateCluster(path.mEndpointId, path.mClusterId).mPendingDataVersion.SetValue(i);
+            break;
+        default:
+            tree.SetAttribute(path, uint32_t(i));
+            flat.SetAttribute(path, uint32_t(i));
+            break;
+        }
+
+        ASSERT_EQ(AllAttributes(tree), AllAttributes(flat));
+        ASSERT_EQ(tree.HasEndpoint(path.mEndpointId), flat.HasEndpoint(path.mEndpointId));
+
+        const auto * treeVersions = tree.FindCluster(path.mEndpointId, path.mClusterId);
+        const auto * flatVersions = flat.FindCluster(path.mEndpointId, path.mClusterId);
+        ASSERT_EQ(treeVersions == nullptr, flatVersions == nullptr);
+        if (treeVersions != nullptr)
+        {
+            ASSERT_EQ(treeVersions->mPendingDataVersion, flatVersions->mPendingDataVersion);
+        }
+
+        const auto * treeState = tree.FindAttribute(path);
+        const auto * flatState = flat.FindAttribute(path);
+        ASSERT_EQ(treeState == nullptr, flatState == nullptr);
+        if (treeState != nullptr)
+        {
+            ASSERT_EQ(*treeState, *flatState);
+        }
+    }
+}
+
+TEST_F(TestClusterStateCacheStorage, TestArenaAllocator)
+{
+    using Buffer = ArenaAttributeDataAllocator::Buffer;
+
+    std::vector<Buffer> buffers;
+    {
+        ArenaAttributeDataAllocator allocator;
+
+        // Enough small values to span several blocks, plus some that get a block of their own.
+        for (size_t i = 0; i < 200; i++)
+        {
+            const size_t size = (i % 50 == 0) ? ArenaAttributeDataAllocator::kBlockSize * 2 : 1 + i % 64;
+
+            Buffer buffer;
+            ASSERT_EQ(allocator.Allocate(size, buffer), CHIP_NO_ERROR);
+            ASSERT_NE(buffer.Get(), nullptr);
+            ASSERT_EQ(buffer.AllocatedSize(), size);
+            memset(buffer.Get(), static_cast<int>(i), size);
+            buffers.push_back(std::move(buffer));
+        }
+
+        // Drop every other value; the rest must be unaffected.
+        for (size_t i = 0; i < buffers.size(); i += 2)
+        {
+            buffers[i] = Buffer();
+            EXPECT_EQ(buffers[i].Get(), nullptr);
+            EXPECT_EQ(buffers[i].AllocatedSize(), 0u);
+        }
+    }
+
+    // Values outlive the allocator they came from.
+    for (size_t i = 1; i < buffers.size(); i += 2)
+    {
+        for (size_t j = 0; j < buffers[i].AllocatedSize(); j++)
+        {
+            ASSERT_EQ(buffers[i].Get()[j], static_cast<uint8_t>(i));
+        }
+    }
+}
+
+} // namespace
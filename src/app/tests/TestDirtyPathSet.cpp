@@ -0,0 +1,225 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/AttributePathParams.h>
+#include <app/ConcreteAttributePath.h>
+#include <app/reporting/DirtyPathSet.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/Iterators.h>
+
+#include <pw_unit_test/framework.h>
+
+namespace {
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::reporting;
+
+constexpr size_t kSmallCapacity = 4;
+
+template <size_t kCapacity>
+bool Contains(const DirtyPathSet<kCapacity> & set, const AttributePathParams & expected)
+{
+    return set.ForEachPath([&](const AttributePathParamsWithGeneration & path) {
+        return static_cast<const AttributePathParams &>(path) == expected ? Loop::Break : Loop::Continue;
+    }) == Loop::Break;
+}
+
+TEST(TestDirtyPathSet, TestConcretePaths)
+{
+    DirtyPathSet<kSmallCapacity> set;
+
+    EXPECT_EQ(set.Insert(AttributePathParams(1, 2, 3), 10), CHIP_NO_ERROR);
+    EXPECT_EQ(set.Insert(AttributePathParams(1, 2, 4), 11), CHIP_NO_ERROR);
+    EXPECT_EQ(set.Allocated(), 2u);
+
+    EXPECT_TRUE(set.IsDirtySince(ConcreteAttributePath(1, 2, 3), 9));
+    EXPECT_FALSE(set.IsDirtySince(ConcreteAttributePath(1, 2, 3), 10));
+    EXPECT_TRUE(set.IsDirtySince(ConcreteAttributePath(1, 2, 4), 10));
+    EXPECT_FALSE(set.IsDirtySince(ConcreteAttributePath(1, 2, 5), 0));
+    EXPECT_FALSE(set.IsDirtySince(ConcreteAttributePath(2, 2, 3), 0));
+
+    // Marking a path dirty again only bumps its generation.
+    EXPECT_EQ(set.Insert(AttributePathParams(1, 2, 3), 12), CHIP_NO_ERROR);
+    EXPECT_EQ(set.Allocated(), 2u);
+    EXPECT_TRUE(set.IsDirtySince(ConcreteAttributePath(1, 2, 3), 11));
+
+    // Insertion rejects the generation reserved for free slots.
+    EXPECT_EQ(set.Insert(AttributePathParams(1, 2, 6), 0), CHIP_ERROR_INVALID_ARGUMENT);
+
+    set.ReleaseAll();
+    EXPECT_EQ(set.Allocated(), 0u);
+    EXPECT_FALSE(set.IsDirtySince(ConcreteAttributePath(1, 2, 3), 0));
+}
+
+TEST(TestDirtyPathSet, TestListIndex)
+{
+    DirtyPathSet<kSmallCapacity> set;
+
+    EXPECT_EQ(set.Insert(AttributePathParams(1, 2, 3, 4), 1), CHIP_NO_ERROR);
+    EXPECT_TRUE(Contains(set, AttributePathParams(1, 2, 3, 4)));
+    EXPECT_TRUE(set.IsDirtySince(ConcreteAttributePath(1, 2, 3), 0));
+
+    // Same list index: nothing changes.
+    EXPECT_EQ(set.Insert(AttributePathParams(1, 2, 3, 4), 2), CHIP_NO_ERROR);
+    EXPECT_TRUE(Contains(set, AttributePathParams(1, 2, 3, 4)));
+
+    // Another list index of the same attribute: the whole attribute is dirty.
+    EXPECT_EQ(set.Insert(AttributePathParams(1, 2, 3, 5), 3), CHIP_NO_ERROR);
+    EXPECT_EQ(set.Allocated(), 1u);
+    EXPECT_TRUE(Contains(set, AttributePathParams(1, 2, 3)));
+}
+
+TEST(TestDirtyPathSet, TestWildcardPaths)
+{
+    DirtyPathSet<kSmallCapacity> set;
+
+    EXPECT_EQ(set.Insert(AttributePathParams(1, 2, 3), 1), CHIP_NO_ERROR);
+    EXPECT_EQ(set.Insert(AttributePathParams(1, 2, 4), 2), CHIP_NO_ERROR);
+    EXPECT_EQ(set.Insert(AttributePathParams(1, 5, 3), 3), CHIP_NO_ERROR);
+
+    // A wildcard path covered by nothing, but covering two paths, replaces both of them.
+    EXPECT_EQ(set.Insert(AttributePathParams(EndpointId(1), ClusterId(2)), 4), CHIP_NO_ERROR);
+    EXPECT_EQ(set.Allocated(), 2u);
+    EXPECT_TRUE(Contains(set, AttributePathParams(EndpointId(1), ClusterId(2))));
+    EXPECT_TRUE(Contains(set, AttributePathParams(1, 5, 3)));
+    EXPECT_TRUE(set.IsDirtySince(ConcreteAttributePath(1, 2, 100), 3));
+    EXPECT_FALSE(set.IsDirtySince(ConcreteAttributePath(1, 5, 100), 0));
+
+    // A concrete path covered by a wildcard path bumps the wildcard path.
+    EXPECT_EQ(set.Insert(AttributePathParams(1, 2, 7), 5), CHIP_NO_ERROR);
+    EXPECT_EQ(set.Allocated(), 2u);
+    EXPECT_TRUE(set.IsDirtySince(ConcreteAttributePath(1, 2, 3), 4));
+
+    // Wildcard endpoint with a concrete cluster.
+    EXPECT_EQ(set.Insert(AttributePathParams(ClusterId(9), AttributeId(1)), 6), CHIP_NO_ERROR);
+    EXPECT_TRUE(set.IsDirtySince(ConcreteAttributePath(42, 9, 1), 5));
+    EXPECT_FALSE(set.IsDirtySince(ConcreteAttributePath(42, 9, 2), 0));
+
+    EXPECT_EQ(set.Insert(AttributePathParams(), 7), CHIP_NO_ERROR);
+    EXPECT_EQ(set.Allocated(), 1u);
+    EXPECT_TRUE(set.IsDirtySince(ConcreteAttributePath(42, 42, 42), 6));
+}
+
+TEST(TestDirtyPathSet, TestCoalesceByCluster)
+{
+    DirtyPathSet<kSmallCapacity> set;
+
+    EXPECT_EQ(set.Insert(AttributePathParams(1, 1, 1), 1), CHIP_NO_ERROR);
+    EXPECT_EQ(set.Insert(AttributePathParams(1, 1, 2), 4), CHIP_NO_ERROR);
+    EXPECT_EQ(set.Insert(AttributePathParams(1, 2, 1), 2), CHIP_NO_ERROR);
+    EXPECT_EQ(set.Insert(AttributePathParams(2, 1, 1), 3), CHIP_NO_ERROR);
+    EXPECT_TRUE(set.Exhausted());
+
+    // Only the cluster with more than one dirty attribute is coalesced, keeping the newest generation.
+    EXPECT_EQ(set.Insert(AttributePathParams(3, 1, 1), 5), CHIP_NO_ERROR);
+    EXPECT_EQ(set.Allocated(), 4u);
+    EXPECT_TRUE(Contains(set, AttributePathParams(EndpointId(1), ClusterId(1))));
+    EXPECT_TRUE(Contains(set, AttributePathParams(1, 2, 1)));
+    EXPECT_TRUE(Contains(set, AttributePathParams(2, 1, 1)));
+    EXPECT_TRUE(Contains(set, AttributePathParams(3, 1, 1)));
+    EXPECT_TRUE(set.IsDirtySince(ConcreteAttributePath(1, 1, 1), 3));
+    EXPECT_FALSE(set.IsDirtySince(ConcreteAttributePath(1, 2, 2), 0));
+}
+
+TEST(TestDirtyPathSet, TestCoalesceByEndpoint)
+{
+    DirtyPathSet<kSmallCapacity> set;
+
+    EXPECT_EQ(set.Insert(AttributePathParams(1, 1, 1), 1), CHIP_NO_ERROR);
+    EXPECT_EQ(set.Insert(AttributePathParams(1, 2, 1), 2), CHIP_NO_ERROR);
+    EXPECT_EQ(set.Insert(AttributePathParams(EndpointId(1), ClusterId(3)), 3), CHIP_NO_ERROR);
+    EXPECT_EQ(set.Insert(AttributePathParams(2, 1, 1), 4), CHIP_NO_ERROR);
+
+    EXPECT_EQ(set.Insert(AttributePathParams(3, 1, 1), 5), CHIP_NO_ERROR);
+    EXPECT_EQ(set.Allocated(), 3u);
+    EXPECT_TRUE(Contains(set, AttributePathParams(1)));
+    EXPECT_TRUE(Contains(set, AttributePathParams(2, 1, 1)));
+    EXPECT_TRUE(Contains(set, AttributePathParams(3, 1, 1)));
+    EXPECT_TRUE(set.IsDirtySince(ConcreteAttributePath(1, 7, 7), 2));
+    EXPECT_FALSE(set.IsDirtySince(ConcreteAttributePath(1, 7, 7), 3));
+}
+
+TEST(TestDirtyPathSet, TestCoalesceEverything)
+{
+    DirtyPathSet<kSmallCapacity> set;
+
+    for (EndpointId endpoint = 1; endpoint <= kSmallCapacity; endpoint++)
+    {
+        EXPECT_EQ(set.Insert(AttributePathParams(endpoint, 1, 1), endpoint), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(set.Insert(AttributePathParams(kSmallCapacity + 1, 1, 1), 10), CHIP_NO_ERROR);
+    EXPECT_EQ(set.Allocated(), 1u);
+    EXPECT_TRUE(Contains(set, AttributePathParams()));
+    EXPECT_TRUE(set.IsDirtySince(ConcreteAttributePath(1, 1, 1), 9));
+}
+
+// Compares IsDirtySince against a linear scan of the set while paths churn through a set that keeps coalescing, which
+// exercises deletions from the hash index.
+TEST(TestDirtyPathSet, TestMatchesLinearScan)
+{
+    constexpr size_t kCapacity = 64;
+    DirtyPathSet<kCapacity> set;
+
+    uint32_t seed = 0x1234'5678;
+    auto random   = [&seed](uint32_t range) {
+        seed = seed * 1664525u + 1013904223u;
+        return (seed >> 8) % range;
+    };
+
+    for (uint64_t generation = 1; generation <= 5000; generation++)
+    {
+        AttributePathParams path(static_cast<EndpointId>(random(8)), static_cast<ClusterId>(random(8)),
+                                 static_cast<AttributeId>(random(16)));
+        // Occasionally mark a whole cluster or endpoint dirty.
+        switch (random(32))
+        {
+        case 0:
+            path.SetWildcardAttributeId();
+            break;
+        case 1:
+            path.SetWildcardClusterId();
+            path.SetWildcardAttributeId();
+            break;
+        default:
+            break;
+        }
+        ASSERT_EQ(set.Insert(path, generation), CHIP_NO_ERROR);
+        ASSERT_LE(set.Allocated(), kCapacity);
+
+        if (random(16) == 0)
+        {
+            set.ReleaseAll();
+        }
+
+        const ConcreteAttributePath probe(static_cast<EndpointId>(random(8)), static_cast<ClusterId>(random(8)),
+                                          static_cast<AttributeId>(random(16)));
+        const uint64_t since = generation - random(64) % generation;
+
+        bool expected = false;
+        size_t count  = 0;
+        set.ForEachPath([&](const AttributePathParamsWithGeneration & dirtyPath) {
+            expected = expected || (dirtyPath.IsAttributePathSupersetOf(probe) && dirtyPath.mGeneration > since);
+            count++;
+            return Loop::Continue;
+        });
+        ASSERT_EQ(set.IsDirtySince(probe, since), expected);
+        ASSERT_EQ(count, set.Allocated());
+    }
+}
+
+} // namespace
@@ -21,6 +21,7 @@
 #include <app/EventLoggingTypes.h>
 #include <app/EventManagement.h>
 #include <app/InteractionModelEngine.h>
+#include <app/MessageDef/EventReportIB.h>
 #include <app/tests/AppTestContext.h>
 #include <data-model-providers/codegen/Instance.h>
 #include <lib/core/CHIPCore.h>
@@ -158,6 +159,137 @@ static void CheckLogReadOut(chip::app::EventManagement & alogMgmt, chip::EventNu
     EXPECT_SUCCESS(chip::TLV::Debug::Dump(reader, SimpleDumpWriter));
 }
 
+/// Reads the numbers of the events reported by the reader, in order.
+static void ReadEventNumbers(chip::TLV::TLVReader & aReader, chip::EventNumber * aNumbers, size_t aMaxCount, size_t & aCount)
+{
+    aCount = 0;
+    CHIP_ERROR err;
+    while ((err = aReader.Next()) == CHIP_NO_ERROR)
+    {
+        chip::app::EventReportIB::Parser eventReport;
+        chip::app::EventDataIB::Parser eventData;
+        ASSERT_LT(aCount, aMaxCount);
+        ASSERT_EQ(eventReport.Init(aReader), CHIP_NO_ERROR);
+        ASSERT_EQ(eventReport.GetEventData(&eventData), CHIP_NO_ERROR);
+        ASSERT_EQ(eventData.GetEventNumber(&aNumbers[aCount]), CHIP_NO_ERROR);
+        aCount++;
+    }
+    EXPECT_EQ(err, CHIP_END_OF_TLV);
+}
+
+/// Checks that fetching the events numbered startingEventNumber or higher returns the same events, in the same order, as
+/// reading through all of the event buffers would, both when the report fits at once and when it is fetched a few events at
+/// a time; and that the following report resumes right after the last logged event.
+static void CheckFetchEventsSince(chip::app::EventManagement & aLogMgmt, chip::EventNumber startingEventNumber,
+                                  chip::EventNumber lastEventNumber)
+{
+    constexpr size_t kMaxEvents = 16;
+    chip::SingleLinkedListNode<chip::app::EventPathParams> wildcardPath;
+    uint8_t backingStore[1024];
+
+    chip::EventNumber storedNumbers[kMaxEvents];
+    size_t storedCount = 0;
+    {
+        chip::TLV::TLVReader reader;
+        chip::app::CircularEventBufferWrapper bufWrapper;
+        ASSERT_EQ(aLogMgmt.GetEventReader(reader, chip::app::PriorityLevel::Critical, &bufWrapper), CHIP_NO_ERROR);
+        ReadEventNumbers(reader, storedNumbers, kMaxEvents, storedCount);
+    }
+
+    chip::EventNumber expectedNumbers[kMaxEvents];
+    size_t expectedCount = 0;
+    for (size_t i = 0; i < storedCount; i++)
+    {
+        if (storedNumbers[i] >= startingEventNumber)
+        {
+            expectedNumbers[expectedCount++] = storedNumbers[i];
+        }
+    }
+
+    // Small enough that a report holds fewer events than an event buffer, so that fetching resumes within buffers.
+    const uint32_t chunkSizes[] = { sizeof(backingStore), sizeof(gDebugEventBuffer) * 2 / 3 };
+    for (uint32_t chunkSize : chunkSizes)
+    {
+        chip::EventNumber fetchedNumbers[kMaxEvents];
+        size_t fetchedCount        = 0;
+        chip::EventNumber eventMin = startingEventNumber;
+        CHIP_ERROR err             = CHIP_ERROR_BUFFER_TOO_SMALL;
+
+        for (size_t report = 0; report <= kMaxEvents && err == CHIP_ERROR_BUFFER_TOO_SMALL; report++)
+        {
+            chip::TLV::TLVWriter writer;
+            chip::TLV::TLVReader reader;
+            size_t eventCount = 0;
+            size_t readCount  = 0;
+
+            writer.Init(backingStore, chunkSize);
+            err = aLogMgmt.FetchEventsSince(writer, &wildcardPath, eventMin, eventCount, chip::Access::SubjectDescriptor{});
+            EXPECT_TRUE(err == CHIP_NO_ERROR || err == CHIP_END_OF_TLV || err == CHIP_ERROR_BUFFER_TOO_SMALL);
+
+            reader.Init(backingStore, writer.GetLengthWritten());
+            ReadEventNumbers(reader, &fetchedNumbers[fetchedCount], kMaxEvents - fetchedCount, readCount);
+            EXPECT_EQ(readCount, eventCount);
+            fetchedCount += readCount;
+        }
+
+        EXPECT_EQ(eventMin, lastEventNumber + 1);
+        ASSERT_EQ(fetchedCount, expectedCount);
+        for (size_t i = 0; i < expectedCount; i++)
+        {
+            EXPECT_EQ(fetchedNumbers[i], expectedNumbers[i]);
+        }
+    }
+}
+
+/// Checks that the event index of the buffer lets readers start right at the first event numbered eventMin or higher, for
+/// every eventMin up to one past the last event held in the buffer.
+static void CheckEventIndex(chip::app::CircularEventBuffer & aBuffer)
+{
+    constexpr size_t kMaxEvents = 16;
+    chip::EventNumber numbers[kMaxEvents];
+    uint32_t offsets[kMaxEvents];
+    size_t count    = 0;
+    uint32_t offset = 0;
+
+    chip::TLV::CircularTLVReader reader;
+    reader.Init(aBuffer);
+    while (reader.Next() == CHIP_NO_ERROR)
+    {
+        chip::app::EventReportIB::Parser eventReport;
+        chip::app::EventDataIB::Parser eventData;
+        ASSERT_LT(count, kMaxEvents);
+        ASSERT_EQ(eventReport.Init(reader), CHIP_NO_ERROR);
+        ASSERT_EQ(eventReport.GetEventData(&eventData), CHIP_NO_ERROR);
+        ASSERT_EQ(eventData.GetEventNumber(&numbers[count]), CHIP_NO_ERROR);
+        offsets[count++] = offset;
+
+        ASSERT_EQ(reader.Skip(), CHIP_NO_ERROR);
+        offset = reader.GetLengthRead();
+    }
+    ASSERT_GT(count, 0u);
+
+    for (chip::EventNumber eventMin = 0; eventMin <= numbers[count - 1] + 1; eventMin++)
+    {
+        size_t first = 0;
+        while (first < count && numbers[first] < eventMin)
+        {
+            first++;
+        }
+
+        EXPECT_EQ(aBuffer.FindEventsSince(eventMin, offset), first < count);
+        if (first < count)
+        {
+            // Starting early only costs parsing time, but the index covers every event the buffer holds unless it is
+            // configured to be smaller than that.
+            EXPECT_LE(offset, offsets[first]);
+            if (count <= CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE)
+            {
+                EXPECT_EQ(offset, offsets[first]);
+            }
+        }
+    }
+}
+
 class TestEventGenerator : public chip::app::EventLoggingDelegate
 {
 public:
@@ -288,4 +420,93 @@ TEST_F(TestEventLogging, TestCheckLogEventWithDiscardLowEvent)
     CheckLogState(logMgmt, 3, chip::app::PriorityLevel::Debug);
 }
 
+TEST_F(TestEventLogging, TestFetchEventsSinceWithWrappedIndex)
+{
+    chip::EventNumber eid;
+    chip::app::EventOptions options;
+    options.mPath     = { kTestEndpointId1, kLivenessClusterId, kLivenessChangeEvent };
+    options.mPriority = chip::app::PriorityLevel::Debug;
+    TestEventGenerator testEventGenerator;
+    testEventGenerator.SetStatus(0);
+
+    chip::app::EventManagement & logMgmt = chip::app::EventManagement::GetInstance();
+
+    // Log enough events for the index of the debug buffer to wrap around more than once.
+    for (size_t i = 0; i < 2 * CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE + 1; i++)
+    {
+        EXPECT_EQ(logMgmt.LogEvent(&testEventGenerator, options, eid), CHIP_NO_ERROR);
+    }
+    CheckLogState(logMgmt, 3, chip::app::PriorityLevel::Debug);
+    CheckEventIndex(gCircularEventBuffer[0]);
+
+    for (chip::EventNumber eventMin = 0; eventMin <= eid + 1; eventMin++)
+    {
+        CheckFetchEventsSince(logMgmt, eventMin, eid);
+    }
+}
+
+TEST_F(TestEventLogging, TestFetchEventsSinceEvictedEvent)
+{
+    chip::EventNumber eid[6];
+    chip::app::EventOptions options;
+    options.mPath     = { kTestEndpointId1, kLivenessClusterId, kLivenessChangeEvent };
+    options.mPriority = chip::app::PriorityLevel::Debug;
+    TestEventGenerator testEventGenerator;
+    testEventGenerator.SetStatus(0);
+
+    chip::app::EventManagement & logMgmt = chip::app::EventManagement::GetInstance();
+
+    // The debug buffer holds the last 3 events, while its index (of the default size) still has entries for the 3 evicted ones.
+    for (auto & number : eid)
+    {
+        EXPECT_EQ(logMgmt.LogEvent(&testEventGenerator, options, number), CHIP_NO_ERROR);
+    }
+    CheckLogState(logMgmt, 3, chip::app::PriorityLevel::Debug);
+    CheckEventIndex(gCircularEventBuffer[0]);
+
+    // Fetching from an evicted event resumes at the oldest event still stored.
+    chip::SingleLinkedListNode<chip::app::EventPathParams> wildcardPath;
+    CheckLogReadOut(logMgmt, eid[1], 3, &wildcardPath);
+    CheckLogReadOut(logMgmt, eid[3], 3, &wildcardPath);
+    CheckLogReadOut(logMgmt, eid[4], 2, &wildcardPath);
+
+    for (chip::EventNumber eventMin = 0; eventMin <= eid[5] + 1; eventMin++)
+    {
+        CheckFetchEventsSince(logMgmt, eventMin, eid[5]);
+    }
+}
+
+TEST_F(TestEventLogging, TestFetchEventsSinceWithPromotedEvents)
+{
+    chip::EventNumber eid;
+    chip::app::EventOptions options;
+    options.mPath = { kTestEndpointId1, kLivenessClusterId, kLivenessChangeEvent };
+    TestEventGenerator testEventGenerator;
+    testEventGenerator.SetStatus(0);
+
+    chip::app::EventManagement & logMgmt = chip::app::EventManagement::GetInstance();
+
+    // Events are logged to the debug buffer, and the more important ones are copied up to the info and critical buffers
+    // as they get evicted, so every buffer ends up holding events that were appended to it by promotion.
+    const chip::app::PriorityLevel priorities[] = { chip::app::PriorityLevel::Critical, chip::app::PriorityLevel::Info,
+                                                    chip::app::PriorityLevel::Debug };
+    for (size_t i = 0; i < 3 * CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE; i++)
+    {
+        options.mPriority = priorities[i % MATTER_ARRAY_SIZE(priorities)];
+        EXPECT_EQ(logMgmt.LogEvent(&testEventGenerator, options, eid), CHIP_NO_ERROR);
+    }
+    CheckLogState(logMgmt, 3, chip::app::PriorityLevel::Debug);
+    CheckLogState(logMgmt, 6, chip::app::PriorityLevel::Info);
+    CheckLogState(logMgmt, 9, chip::app::PriorityLevel::Critical);
+    for (auto & buffer : gCircularEventBuffer)
+    {
+        CheckEventIndex(buffer);
+    }
+
+    for (chip::EventNumber eventMin = 0; eventMin <= eid + 1; eventMin++)
+    {
+        CheckFetchEventsSince(logMgmt, eventMin, eid);
+    }
+}
+
 } // namespace
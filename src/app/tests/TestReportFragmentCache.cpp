@@ -0,0 +1,154 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/AttributePathParams.h>
+#include <app/ConcreteAttributePath.h>
+#include <app/reporting/ReportFragmentCache.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/Span.h>
+
+#include <pw_unit_test/framework.h>
+
+#include <string.h>
+
+namespace {
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::reporting;
+
+using Cache = ReportFragmentCache<16, 4>;
+using State = Cache::State;
+
+constexpr EndpointId kEndpointId = 1;
+constexpr ClusterId kClusterId   = 2;
+
+Cache::Key MakeKey(AttributeId attributeId, DataVersion dataVersion = 1, FabricIndex fabricIndex = 1, bool fabricFiltered = true)
+{
+    return Cache::Key{ ConcreteAttributePath(kEndpointId, kClusterId, attributeId), dataVersion, fabricIndex, fabricFiltered };
+}
+
+// Stores `data` the way the reporting engine does: encoded into the free space first.
+void Store(Cache & cache, const Cache::Key & key, const char * data)
+{
+    MutableByteSpan space = cache.FreeSpace();
+    ASSERT_GE(space.size(), strlen(data));
+    memcpy(space.data(), data, strlen(data));
+    cache.Store(key, strlen(data));
+}
+
+bool HasFragment(const Cache & cache, const Cache::Key & key, const char * expected)
+{
+    ByteSpan fragment;
+    return cache.Find(key, fragment) == State::kCached &&
+        fragment.data_equal(ByteSpan(reinterpret_cast<const uint8_t *>(expected), strlen(expected)));
+}
+
+TEST(TestReportFragmentCache, TestStoreAndFind)
+{
+    Cache cache;
+    ByteSpan fragment;
+
+    EXPECT_EQ(cache.Find(MakeKey(1), fragment), State::kMissing);
+
+    Store(cache, MakeKey(1), "abc");
+    Store(cache, MakeKey(2), "defg");
+
+    EXPECT_TRUE(HasFragment(cache, MakeKey(1), "abc"));
+    EXPECT_TRUE(HasFragment(cache, MakeKey(2), "defg"));
+
+    // Any difference in the key is a different fragment.
+    EXPECT_EQ(cache.Find(MakeKey(1, 2), fragment), State::kMissing);
+    EXPECT_EQ(cache.Find(MakeKey(1, 1, 2), fragment), State::kMissing);
+    EXPECT_EQ(cache.Find(MakeKey(1, 1, 1, false), fragment), State::kMissing);
+    EXPECT_EQ(cache.Find(Cache::Key{ ConcreteAttributePath(2, kClusterId, 1), 1, 1, true }, fragment), State::kMissing);
+
+    cache.Clear();
+    EXPECT_EQ(cache.Find(MakeKey(1), fragment), State::kMissing);
+    EXPECT_EQ(cache.Find(MakeKey(2), fragment), State::kMissing);
+}
+
+TEST(TestReportFragmentCache, TestUncacheable)
+{
+    Cache cache;
+    ByteSpan fragment;
+
+    cache.MarkUncacheable(MakeKey(1));
+    EXPECT_EQ(cache.Find(MakeKey(1), fragment), State::kUncacheable);
+    EXPECT_EQ(cache.Find(MakeKey(2), fragment), State::kMissing);
+}
+
+TEST(TestReportFragmentCache, TestFull)
+{
+    Cache cache;
+    ByteSpan fragment;
+
+    // Out of buffer space.
+    Store(cache, MakeKey(1), "0123456789abcdef");
+    EXPECT_TRUE(HasFragment(cache, MakeKey(1), "0123456789abcdef"));
+    EXPECT_EQ(cache.FreeSpace().size(), 0u);
+    EXPECT_EQ(cache.Find(MakeKey(2), fragment), State::kUncacheable);
+
+    // Out of entries.
+    cache.Clear();
+    for (AttributeId id = 1; id <= 4; id++)
+    {
+        Store(cache, MakeKey(id), "a");
+    }
+    EXPECT_EQ(cache.Find(MakeKey(5), fragment), State::kUncacheable);
+    for (AttributeId id = 1; id <= 4; id++)
+    {
+        EXPECT_TRUE(HasFragment(cache, MakeKey(id), "a"));
+    }
+}
+
+TEST(TestReportFragmentCache, TestInvalidate)
+{
+    Cache cache;
+    ByteSpan fragment;
+
+    Store(cache, MakeKey(1), "a");
+    Store(cache, MakeKey(2), "b");
+    Store(cache, MakeKey(3), "c");
+
+    cache.Invalidate(AttributePathParams(kEndpointId, kClusterId, 2));
+    EXPECT_TRUE(HasFragment(cache, MakeKey(1), "a"));
+    EXPECT_EQ(cache.Find(MakeKey(2), fragment), State::kUncacheable);
+    EXPECT_TRUE(HasFragment(cache, MakeKey(3), "c"));
+
+    cache.Invalidate(AttributePathParams(3, kClusterId, 1));
+    EXPECT_TRUE(HasFragment(cache, MakeKey(1), "a"));
+
+    // Wildcards invalidate every path they cover.
+    cache.Invalidate(AttributePathParams(kEndpointId, kClusterId));
+    EXPECT_EQ(cache.Find(MakeKey(1), fragment), State::kUncacheable);
+    EXPECT_EQ(cache.Find(MakeKey(3), fragment), State::kUncacheable);
+}
+
+TEST(TestReportFragmentCache, TestDisabled)
+{
+    using DisabledCache = ReportFragmentCache<0, 0>;
+
+    DisabledCache cache;
+    ByteSpan fragment;
+
+    EXPECT_FALSE(cache.IsEnabled());
+    EXPECT_EQ(cache.Find(DisabledCache::Key{ ConcreteAttributePath(kEndpointId, kClusterId, 1), 1, 1, true }, fragment),
+              DisabledCache::State::kUncacheable);
+}
+
+} // namespace
@@ -98,6 +98,7 @@ public:
     void TestBuildAndSendSingleReportData();
     void TestMergeOverlappedAttributePath();
     void TestMergeAttributePathWhenDirtySetPoolExhausted();
+    void TestReportCacheSharedBetweenReadHandlers();
 
 private:
     chip::app::DataModel::Provider * mOldProvider = nullptr;
@@ -131,23 +132,58 @@ public:
     }
 };
 
+class ReadCountingDataModel : public TestImCustomDataModel
+{
+public:
+    DataModel::ActionReturnStatus ReadAttribute(const DataModel::ReadAttributeRequest & request,
+                                                AttributeValueEncoder & encoder) override
+    {
+        mReadCount++;
+        return TestImCustomDataModel::ReadAttribute(request, encoder);
+    }
+
+    uint32_t mReadCount = 0;
+};
+
+System::PacketBufferHandle BuildReadRequest(AttributeId attributeId)
+{
+    System::PacketBufferTLVWriter writer;
+    System::PacketBufferHandle readRequestbuf = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize);
+    ReadRequestMessage::Builder readRequestBuilder;
+
+    writer.Init(std::move(readRequestbuf));
+    EXPECT_EQ(readRequestBuilder.Init(&writer), CHIP_NO_ERROR);
+    AttributePathIBs::Builder & attributePathListBuilder = readRequestBuilder.CreateAttributeRequests();
+    AttributePathIB::Builder & attributePathBuilder      = attributePathListBuilder.CreatePath();
+    EXPECT_SUCCESS(attributePathBuilder.Node(1)
+                       .Endpoint(kTestEndpointId)
+                       .Cluster(kTestClusterId)
+                       .Attribute(attributeId)
+                       .EndOfAttributePathIB());
+    EXPECT_SUCCESS(attributePathListBuilder.EndOfAttributePathIBs());
+    EXPECT_SUCCESS(readRequestBuilder.IsFabricFiltered(false).EndOfReadRequestMessage());
+    EXPECT_EQ(writer.Finalize(&readRequestbuf), CHIP_NO_ERROR);
+
+    return readRequestbuf;
+}
+
 template <typename... Args>
 bool TestReportingEngine::VerifyDirtySetContent(const Args &... args)
 {
     const int size                        = sizeof...(args);
     ExpectedDirtySetContent content[size] = { ExpectedDirtySetContent(args)... };
 
-    if (InteractionModelEngine::GetInstance()->GetReportingEngine().mGlobalDirtySet.ForEachActiveObject([&](auto * path) {
+    if (InteractionModelEngine::GetInstance()->GetReportingEngine().mGlobalDirtySet.ForEachPath([&](const auto & path) {
             for (int i = 0; i < size; i++)
             {
-                if (static_cast<AttributePathParams>(content[i]) == static_cast<AttributePathParams>(*path))
+                if (static_cast<AttributePathParams>(content[i]) == static_cast<AttributePathParams>(path))
                 {
                     content[i].verified = true;
                     return Loop::Continue;
                 }
             }
             ChipLogDetail(DataManagement, "Dirty path Endpoint %x Cluster %" PRIx32 ", Attribute %" PRIx32 " is not expected",
-                          path->mEndpointId, path->mClusterId, path->mAttributeId);
+                          path.mEndpointId, path.mClusterId, path.mAttributeId);
             return Loop::Break;
         }) == Loop::Break)
     {
@@ -169,11 +205,9 @@ bool TestReportingEngine::VerifyDirtySetContent(const Args &... args)
 
 bool TestReportingEngine::InsertToDirtySet(const AttributePathParams & aPath)
 {
-    auto path = InteractionModelEngine::GetInstance()->GetReportingEngine().mGlobalDirtySet.CreateObject();
-    VerifyOrReturnError(path != nullptr, false);
-    *path             = aPath;
-    path->mGeneration = InteractionModelEngine::GetInstance()->GetReportingEngine().GetDirtySetGeneration();
-    return true;
+    auto & engine = InteractionModelEngine::GetInstance()->GetReportingEngine();
+    VerifyOrReturnError(!engine.mGlobalDirtySet.Exhausted(), false);
+    return engine.mGlobalDirtySet.Insert(aPath, engine.GetDirtySetGeneration()) == CHIP_NO_ERROR;
 }
 
 TEST_F_FROM_FIXTURE(TestReportingEngine, TestBuildAndSendSingleReportData)
@@ -232,10 +266,7 @@ TEST_F_FROM_FIXTURE(TestReportingEngine, TestMergeOverlappedAttributePath)
                                                           app::reporting::GetDefaultReportScheduler()),
               CHIP_NO_ERROR);
 
-    AttributePathParams * clusterInfo = InteractionModelEngine::GetInstance()->GetReportingEngine().mGlobalDirtySet.CreateObject();
-    clusterInfo->mEndpointId          = 1;
-    clusterInfo->mClusterId           = 1;
-    clusterInfo->mAttributeId         = 1;
+    EXPECT_TRUE(InsertToDirtySet(AttributePathParams(1, 1, 1)));
 
     {
         AttributePathParams testClusterInfo;
@@ -266,7 +297,7 @@ TEST_F_FROM_FIXTURE(TestReportingEngine, TestMergeOverlappedAttributePath)
         testClusterInfo.mClusterId   = kInvalidClusterId;
         testClusterInfo.mAttributeId = kInvalidAttributeId;
         EXPECT_TRUE(InteractionModelEngine::GetInstance()->GetReportingEngine().MergeOverlappedAttributePath(testClusterInfo));
-        EXPECT_TRUE(clusterInfo->mClusterId == kInvalidClusterId && clusterInfo->mAttributeId == kInvalidAttributeId);
+        EXPECT_TRUE(VerifyDirtySetContent(testClusterInfo));
     }
 
     {
@@ -275,8 +306,7 @@ TEST_F_FROM_FIXTURE(TestReportingEngine, TestMergeOverlappedAttributePath)
         testClusterInfo.mClusterId   = kInvalidClusterId;
         testClusterInfo.mAttributeId = kInvalidAttributeId;
         EXPECT_TRUE(InteractionModelEngine::GetInstance()->GetReportingEngine().MergeOverlappedAttributePath(testClusterInfo));
-        EXPECT_TRUE(clusterInfo->mEndpointId == kInvalidEndpointId && clusterInfo->mClusterId == kInvalidClusterId &&
-                    clusterInfo->mAttributeId == kInvalidAttributeId);
+        EXPECT_TRUE(VerifyDirtySetContent(AttributePathParams()));
     }
     InteractionModelEngine::GetInstance()->GetReportingEngine().Shutdown();
 }
@@ -359,6 +389,51 @@ TEST_F_FROM_FIXTURE(TestReportingEngine, TestMergeAttributePathWhenDirtySetPoolE
     InteractionModelEngine::GetInstance()->GetReportingEngine().Shutdown();
 }
 
+TEST_F_FROM_FIXTURE(TestReportingEngine, TestReportCacheSharedBetweenReadHandlers)
+{
+    ReadCountingDataModel dataModel;
+    DummyDelegate dummy;
+    TestExchangeDelegate delegate;
+
+    EXPECT_EQ(InteractionModelEngine::GetInstance()->Init(&GetExchangeManager(), &GetFabricTable(),
+                                                          app::reporting::GetDefaultReportScheduler()),
+              CHIP_NO_ERROR);
+    DataModel::Provider * oldProvider = InteractionModelEngine::GetInstance()->SetDataModelProvider(&dataModel);
+
+    Engine & engine = InteractionModelEngine::GetInstance()->GetReportingEngine();
+    engine.mReportCache.Clear();
+
+    // Engine::Run clears the cache, so the handlers are serviced before processing any I/O.
+    {
+        app::ReadHandler readHandler1(dummy, NewExchangeToAlice(&delegate), chip::app::ReadHandler::InteractionType::Read,
+                                      app::reporting::GetDefaultReportScheduler());
+        app::ReadHandler readHandler2(dummy, NewExchangeToAlice(&delegate), chip::app::ReadHandler::InteractionType::Read,
+                                      app::reporting::GetDefaultReportScheduler());
+        readHandler1.OnInitialRequest(BuildReadRequest(kTestFieldId1));
+        readHandler2.OnInitialRequest(BuildReadRequest(kTestFieldId1));
+
+        EXPECT_EQ(engine.BuildAndSendSingleReportData(&readHandler1), CHIP_NO_ERROR);
+        EXPECT_EQ(dataModel.mReadCount, 1u);
+
+        // The same attribute for the same accessing fabric is copied from the report of the first handler.
+        EXPECT_EQ(engine.BuildAndSendSingleReportData(&readHandler2), CHIP_NO_ERROR);
+        EXPECT_EQ(dataModel.mReadCount, ReportCache::IsEnabled() ? 1u : 2u);
+
+        // Marking the attribute dirty forces a new read.
+        EXPECT_EQ(engine.SetDirty(AttributePathParams(kTestEndpointId, kTestClusterId, kTestFieldId1)), CHIP_NO_ERROR);
+        app::ReadHandler readHandler3(dummy, NewExchangeToAlice(&delegate), chip::app::ReadHandler::InteractionType::Read,
+                                      app::reporting::GetDefaultReportScheduler());
+        readHandler3.OnInitialRequest(BuildReadRequest(kTestFieldId1));
+        EXPECT_EQ(engine.BuildAndSendSingleReportData(&readHandler3), CHIP_NO_ERROR);
+        EXPECT_EQ(dataModel.mReadCount, ReportCache::IsEnabled() ? 2u : 3u);
+    }
+    DrainAndServiceIO();
+
+    engine.mReportCache.Clear();
+    InteractionModelEngine::GetInstance()->SetDataModelProvider(oldProvider);
+    engine.Shutdown();
+}
+
 } // namespace reporting
 } // namespace app
 } // namespace chip
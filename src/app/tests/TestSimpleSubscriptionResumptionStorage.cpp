@@ -405,3 +405,81 @@ TEST_F(TestSimpleSubscriptionResumptionStorage, TestSubscriptionStateJunkData)
     EXPECT_EQ(iterator->Count(), 0u);
     iterator->Release();
 }
+
+TEST_F(TestSimpleSubscriptionResumptionStorage, TestSubscriptionIndex)
+{
+    chip::TestPersistentStorageDelegate storage;
+    SimpleSubscriptionResumptionStorageTest subscriptionStorage;
+    EXPECT_SUCCESS(subscriptionStorage.Init(&storage));
+
+    const std::string indexKey = chip::DefaultStorageKeyAllocator::SubscriptionResumptionIndex().KeyName();
+
+    // Subscriptions written directly at a given index, as done before the index existed or by an interrupted save
+    auto writeSubscription = [&](uint16_t subscriptionIndex, chip::app::SubscriptionResumptionStorage::SubscriptionInfo & info) {
+        chip::Platform::ScopedMemoryBuffer<uint8_t> backingBuffer;
+        backingBuffer.Calloc(subscriptionStorage.TestMaxSubscriptionSize());
+        ASSERT_NE(backingBuffer.Get(), nullptr);
+        chip::TLV::ScopedBufferTLVWriter writer(std::move(backingBuffer), subscriptionStorage.TestMaxSubscriptionSize());
+        EXPECT_EQ(subscriptionStorage.TestSave(writer, info), CHIP_NO_ERROR);
+        const auto len = writer.GetLengthWritten();
+        EXPECT_SUCCESS(writer.Finalize(backingBuffer));
+        EXPECT_EQ(storage.SyncSetKeyValue(chip::DefaultStorageKeyAllocator::SubscriptionResumption(subscriptionIndex).KeyName(),
+                                          backingBuffer.Get(), static_cast<uint16_t>(len)),
+                  CHIP_NO_ERROR);
+    };
+
+    chip::app::SubscriptionResumptionStorage::SubscriptionInfo subscriptionInfo1 = {
+        .mNodeId         = 6661,
+        .mFabricIndex    = 46,
+        .mSubscriptionId = 1,
+    };
+    chip::app::SubscriptionResumptionStorage::SubscriptionInfo subscriptionInfo2 = {
+        .mNodeId         = 6662,
+        .mFabricIndex    = 46,
+        .mSubscriptionId = 2,
+    };
+    chip::app::SubscriptionResumptionStorage::SubscriptionInfo subscriptionInfo3 = {
+        .mNodeId         = 6663,
+        .mFabricIndex    = 46,
+        .mSubscriptionId = 3,
+    };
+
+    // Without an index, the first save indexes the subscriptions already in storage
+    writeSubscription(1, subscriptionInfo1);
+    EXPECT_FALSE(storage.HasKey(indexKey));
+    EXPECT_SUCCESS(subscriptionStorage.Save(subscriptionInfo2));
+    EXPECT_TRUE(storage.HasKey(indexKey));
+
+    // Saving a subscription again replaces it
+    EXPECT_SUCCESS(subscriptionStorage.Save(subscriptionInfo1));
+
+    // Entries missing from the index are ignored
+    writeSubscription(2, subscriptionInfo3);
+
+    auto * iterator = subscriptionStorage.IterateSubscriptions();
+    EXPECT_EQ(iterator->Count(), 2u);
+    TestSubscriptionInfo subscriptionInfo;
+    EXPECT_TRUE(iterator->Next(subscriptionInfo));
+    EXPECT_EQ(subscriptionInfo, subscriptionInfo2);
+    EXPECT_TRUE(iterator->Next(subscriptionInfo));
+    EXPECT_EQ(subscriptionInfo, subscriptionInfo1);
+    EXPECT_FALSE(iterator->Next(subscriptionInfo));
+    iterator->Release();
+
+    // ...and their storage is reused by the next save
+    EXPECT_SUCCESS(subscriptionStorage.Save(subscriptionInfo3));
+    EXPECT_EQ(subscriptionStorage.Delete(subscriptionInfo3.mNodeId, subscriptionInfo3.mFabricIndex, 4),
+              CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+
+    iterator = subscriptionStorage.IterateSubscriptions();
+    EXPECT_EQ(iterator->Count(), 3u);
+    iterator->Release();
+
+    // The index is removed along with the last subscription
+    EXPECT_SUCCESS(
+        subscriptionStorage.Delete(subscriptionInfo1.mNodeId, subscriptionInfo1.mFabricIndex, subscriptionInfo1.mSubscriptionId));
+    EXPECT_TRUE(storage.HasKey(indexKey));
+    EXPECT_SUCCESS(subscriptionStorage.DeleteAll(subscriptionInfo1.mFabricIndex));
+    EXPECT_FALSE(storage.HasKey(indexKey));
+    EXPECT_EQ(storage.GetNumKeys(), 0u);
+}
@@ -0,0 +1,150 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "Benchmark.h"
+#include "SyntheticDataModelProvider.h"
+
+#include <app/AttributePathExpandIterator.h>
+#include <app/AttributePathParams.h>
+#include <app/ConcreteAttributePath.h>
+#include <lib/core/CHIPCore.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/LinkedList.h>
+
+#include <pw_unit_test/framework.h>
+
+#include <string>
+
+namespace {
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::Benchmarks;
+
+struct TreeShape
+{
+    const char * name;
+    uint16_t endpoints;
+    uint16_t clustersPerEndpoint;
+    uint16_t attributesPerCluster;
+};
+
+constexpr TreeShape kTreeShapes[] = {
+    { "Small", 4, 8, 8 },
+    { "Large", 64, 16, 16 },
+};
+
+// Reporting engine chunks: a report is built from a fresh iterator created from a saved position.
+constexpr size_t kPathsPerChunk = 32;
+
+class AttributePathExpandIteratorBenchmarks : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { Platform::MemoryShutdown(); }
+
+protected:
+    // Expands `path` once and returns the number of paths produced.
+    static size_t Expand(DataModel::Provider & provider, SingleLinkedListNode<AttributePathParams> & path)
+    {
+        size_t count  = 0;
+        auto position = AttributePathExpandIterator::Position::StartIterating(&path);
+        ConcreteAttributePath outputPath;
+        for (AttributePathExpandIterator iterator(&provider, position); iterator.Next(outputPath);)
+        {
+            count++;
+        }
+        return count;
+    }
+
+    // Expands `path` in chunks of kPathsPerChunk, re-creating the iterator from the saved position
+    // for every chunk, the way ReadHandler/Engine resume an interrupted report.
+    static size_t ExpandInChunks(DataModel::Provider & provider, SingleLinkedListNode<AttributePathParams> & path)
+    {
+        size_t count  = 0;
+        auto position = AttributePathExpandIterator::Position::StartIterating(&path);
+        ConcreteAttributePath outputPath;
+        while (true)
+        {
+            AttributePathExpandIterator iterator(&provider, position);
+            size_t chunk = 0;
+            while (chunk < kPathsPerChunk && iterator.Next(outputPath))
+            {
+                chunk++;
+            }
+            count += chunk;
+            if (chunk < kPathsPerChunk)
+            {
+                return count;
+            }
+        }
+    }
+
+    template <typename ExpandFunction>
+    static void RunExpansion(const std::string & name, DataModel::Provider & provider, const AttributePathParams & params,
+                             size_t expectedCount, ExpandFunction expand)
+    {
+        SingleLinkedListNode<AttributePathParams> path;
+        path.mValue = params;
+        ASSERT_EQ(expand(provider, path), expectedCount);
+
+        Benchmarks::Run(name, [&](State & state) {
+            while (state.KeepRunning())
+            {
+                if (expand(provider, path) != expectedCount)
+                {
+                    state.SkipWithError("Unexpected number of expanded paths");
+                    break;
+                }
+            }
+            state.SetItemsProcessed(state.GetIterations() * expectedCount);
+        });
+    }
+};
+
+TEST_F(AttributePathExpandIteratorBenchmarks, Wildcard)
+{
+    for (const TreeShape & shape : kTreeShapes)
+    {
+        SyntheticDataModelProvider provider(shape.endpoints, shape.clustersPerEndpoint, shape.attributesPerCluster);
+        const std::string prefix = std::string("AttributePathExpandIterator/") + shape.name;
+
+        RunExpansion(prefix + "/Wildcard", provider, AttributePathParams(), provider.AttributePathCount(), Expand);
+        RunExpansion(prefix + "/WildcardChunked", provider, AttributePathParams(), provider.AttributePathCount(),
+                     ExpandInChunks);
+    }
+}
+
+TEST_F(AttributePathExpandIteratorBenchmarks, PartialWildcard)
+{
+    for (const TreeShape & shape : kTreeShapes)
+    {
+        SyntheticDataModelProvider provider(shape.endpoints, shape.clustersPerEndpoint, shape.attributesPerCluster);
+        const std::string prefix      = std::string("AttributePathExpandIterator/") + shape.name;
+        const EndpointId lastEndpoint = shape.endpoints;
+        const ClusterId lastCluster   = SyntheticDataModelProvider::kFirstClusterId + shape.clustersPerEndpoint - 1;
+        const size_t attributeCount   = provider.AttributePathCount() / shape.endpoints / shape.clustersPerEndpoint;
+
+        // Same attribute of one cluster on every endpoint: exercises cluster lookup per endpoint.
+        RunExpansion(prefix + "/AnyEndpoint", provider, AttributePathParams(lastCluster, AttributeId(0)), shape.endpoints, Expand);
+
+        // All attributes of the last cluster on the last endpoint: exercises endpoint and cluster lookup.
+        RunExpansion(prefix + "/AnyAttribute", provider, AttributePathParams(lastEndpoint, lastCluster), attributeCount, Expand);
+    }
+}
+
+} // namespace
@@ -0,0 +1,204 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "Benchmark.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <vector>
+
+namespace chip {
+namespace Benchmarks {
+namespace {
+
+struct Result
+{
+    std::string name;
+    uint64_t iterations;
+    uint64_t realTimeNs;
+    uint64_t cpuTimeNs;
+    uint64_t itemsProcessed;
+    uint64_t bytesProcessed;
+    const char * errorMessage;
+
+    double RealTimePerIteration() const { return PerIteration(realTimeNs); }
+    double CpuTimePerIteration() const { return PerIteration(cpuTimeNs); }
+    double PerIteration(uint64_t total) const
+    {
+        return iterations != 0 ? static_cast<double>(total) / static_cast<double>(iterations) : 0;
+    }
+    double PerSecond(uint64_t count) const
+    {
+        return realTimeNs != 0 ? static_cast<double>(count) * 1e9 / static_cast<double>(realTimeNs) : 0;
+    }
+};
+
+std::vector<Result> & Results()
+{
+    static std::vector<Result> sResults;
+    return sResults;
+}
+
+void WriteJsonString(FILE * out, const char * str)
+{
+    fputc('"', out);
+    for (; *str != '\0'; str++)
+    {
+        const unsigned char c = static_cast<unsigned char>(*str);
+        if (c == '"' || c == '\\')
+        {
+            fprintf(out, "\\%c", c);
+        }
+        else if (c < 0x20)
+        {
+            fprintf(out, "\\u%04x", c);
+        }
+        else
+        {
+            fputc(c, out);
+        }
+    }
+    fputc('"', out);
+}
+
+} // namespace
+
+Options & GetOptions()
+{
+    static Options sOptions;
+    return sOptions;
+}
+
+namespace Internal {
+
+bool ShouldRun(const std::string & name)
+{
+    const char * filter = GetOptions().filter;
+    return filter == nullptr || name.find(filter) != std::string::npos;
+}
+
+uint64_t NextIterationCount(const State & state)
+{
+    const Options & options   = GetOptions();
+    const uint64_t minTimeNs  = static_cast<uint64_t>(options.minTimeMs) * 1000000u;
+    const uint64_t iterations = state.GetIterations();
+    const uint64_t elapsedNs  = state.GetRealTimeNs();
+
+    if (state.GetErrorMessage() != nullptr || iterations == 0 || elapsedNs >= minTimeNs || iterations >= options.maxIterations)
+    {
+        return 0;
+    }
+
+    // Aim 40% past the minimum time so that the next attempt is likely to be the last one, but
+    // never grow by more than 10x at once: the first, very short runs are too noisy to extrapolate from.
+    uint64_t next = iterations * 10;
+    if (elapsedNs > 0)
+    {
+        const double estimate =
+            static_cast<double>(iterations) * 1.4 * static_cast<double>(minTimeNs) / static_cast<double>(elapsedNs);
+        next = std::min(next, static_cast<uint64_t>(estimate));
+    }
+    return std::min(std::max(next, iterations + 1), options.maxIterations);
+}
+
+void RecordResult(const std::string & name, const State & state)
+{
+    Results().push_back(Result{ name, state.GetIterations(), state.GetRealTimeNs(), state.GetCpuTimeNs(), state.GetItemsProcessed(),
+                                state.GetBytesProcessed(), state.GetErrorMessage() });
+}
+
+} // namespace Internal
+
+void PrintSummary(FILE * out)
+{
+    fprintf(out, "%-56s %14s %14s %12s %14s\n", "Benchmark", "Time (ns)", "CPU (ns)", "Iterations", "Throughput");
+    for (const auto & result : Results())
+    {
+        if (result.errorMessage != nullptr)
+        {
+            fprintf(out, "%-56s ERROR: %s\n", result.name.c_str(), result.errorMessage);
+            continue;
+        }
+
+        fprintf(out, "%-56s %14.1f %14.1f %12" PRIu64, result.name.c_str(), result.RealTimePerIteration(),
+                result.CpuTimePerIteration(), result.iterations);
+        if (result.bytesProcessed != 0)
+        {
+            fprintf(out, " %10.2f MiB/s", result.PerSecond(result.bytesProcessed) / (1024 * 1024));
+        }
+        if (result.itemsProcessed != 0)
+        {
+            fprintf(out, " %12.0f items/s", result.PerSecond(result.itemsProcessed));
+        }
+        fputc('\n', out);
+    }
+}
+
+bool WriteJson(FILE * out, const char * executableName)
+{
+    char date[32] = "";
+    time_t now    = time(nullptr);
+    struct tm localTime;
+    if (localtime_r(&now, &localTime) != nullptr)
+    {
+        strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S%z", &localTime);
+    }
+
+    fprintf(out, "{\n  \"context\": {\n    \"date\": ");
+    WriteJsonString(out, date);
+    fprintf(out, ",\n    \"executable\": ");
+    WriteJsonString(out, executableName);
+    fprintf(out, ",\n    \"min_time_ms\": %" PRIu32 "\n  },\n  \"benchmarks\": [", GetOptions().minTimeMs);
+
+    bool first = true;
+    for (const auto & result : Results())
+    {
+        fprintf(out, "%s\n    {\n      \"name\": ", first ? "" : ",");
+        WriteJsonString(out, result.name.c_str());
+        fprintf(out, ",\n      \"run_name\": ");
+        WriteJsonString(out, result.name.c_str());
+        fprintf(out, ",\n      \"run_type\": \"iteration\",\n      \"iterations\": %" PRIu64, result.iterations);
+        if (result.errorMessage != nullptr)
+        {
+            fprintf(out, ",\n      \"error_occurred\": true,\n      \"error_message\": ");
+            WriteJsonString(out, result.errorMessage);
+        }
+        fprintf(out, ",\n      \"real_time\": %.3f,\n      \"cpu_time\": %.3f,\n      \"time_unit\": \"ns\"",
+                result.RealTimePerIteration(), result.CpuTimePerIteration());
+        if (result.bytesProcessed != 0)
+        {
+            fprintf(out, ",\n      \"bytes_per_second\": %.3f", result.PerSecond(result.bytesProcessed));
+        }
+        if (result.itemsProcessed != 0)
+        {
+            fprintf(out, ",\n      \"items_per_second\": %.3f", result.PerSecond(result.itemsProcessed));
+        }
+        fprintf(out, "\n    }");
+        first = false;
+    }
+    fprintf(out, "\n  ]\n}\n");
+
+    return !ferror(out);
+}
+
+bool HasErrors()
+{
+    return std::any_of(Results().begin(), Results().end(), [](const Result & result) { return result.errorMessage != nullptr; });
+}
+
+} // namespace Benchmarks
+} // namespace chip
@@ -0,0 +1,202 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      A small timing harness for the chip-benchmarks executable.
+ *
+ *      Benchmarks are written as regular unit test cases so that they can reuse the
+ *      existing test fixtures (AppContext, MessagingContext, ...) for setting up the
+ *      stack. Inside a test case, Benchmarks::Run() times a body with an increasing
+ *      number of iterations until the configured minimum run time is reached, and
+ *      records the result. Results are printed as a summary and can be written as
+ *      JSON using the same layout as Google Benchmark, so existing comparison tooling
+ *      can be used to track regressions between builds.
+ *
+ *      Example:
+ *
+ *          TEST_F(MyFixture, Encode)
+ *          {
+ *              Benchmarks::Run("Foo/Encode", [&](Benchmarks::State & state) {
+ *                  while (state.KeepRunning())
+ *                  {
+ *                      EncodeSomething();
+ *                  }
+ *                  state.SetBytesProcessed(state.GetIterations() * kEncodedSize);
+ *              });
+ *          }
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <ctime>
+#include <string>
+#include <utility>
+
+namespace chip {
+namespace Benchmarks {
+
+struct Options
+{
+    // Only benchmarks whose name contains this substring are run. nullptr runs everything.
+    const char * filter = nullptr;
+
+    // Minimum wall-clock time a benchmark has to run for its result to be recorded.
+    uint32_t minTimeMs = 500;
+
+    // Upper bound on the number of iterations of a single benchmark run.
+    uint64_t maxIterations = 1000000000;
+};
+
+Options & GetOptions();
+
+/**
+ * Per-run state handed to a benchmark body.
+ *
+ * The body must call KeepRunning() in a loop; timing starts on the first call and stops
+ * when it returns false. Work that should not be measured can be bracketed by
+ * PauseTiming()/ResumeTiming().
+ */
+class State
+{
+public:
+    explicit State(uint64_t maxIterations) : mMaxIterations(maxIterations) {}
+
+    bool KeepRunning()
+    {
+        if (mIterations < mMaxIterations && mErrorMessage == nullptr)
+        {
+            if (mIterations == 0)
+            {
+                ResumeTiming();
+            }
+            mIterations++;
+            return true;
+        }
+        if (mTiming)
+        {
+            PauseTiming();
+        }
+        return false;
+    }
+
+    void PauseTiming()
+    {
+        mRealTime += std::chrono::steady_clock::now() - mRealStart;
+        mCpuTime += std::clock() - mCpuStart;
+        mTiming = false;
+    }
+
+    void ResumeTiming()
+    {
+        mTiming    = true;
+        mCpuStart  = std::clock();
+        mRealStart = std::chrono::steady_clock::now();
+    }
+
+    /**
+     * Abort the benchmark and report it as failed. KeepRunning() returns false afterwards.
+     */
+    void SkipWithError(const char * message) { mErrorMessage = message; }
+
+    void SetItemsProcessed(uint64_t items) { mItemsProcessed = items; }
+    void SetBytesProcessed(uint64_t bytes) { mBytesProcessed = bytes; }
+
+    uint64_t GetIterations() const { return mIterations; }
+    uint64_t GetRealTimeNs() const { return static_cast<uint64_t>(std::chrono::nanoseconds(mRealTime).count()); }
+    uint64_t GetCpuTimeNs() const { return static_cast<uint64_t>(static_cast<double>(mCpuTime) * 1e9 / CLOCKS_PER_SEC); }
+    uint64_t GetItemsProcessed() const { return mItemsProcessed; }
+    uint64_t GetBytesProcessed() const { return mBytesProcessed; }
+    const char * GetErrorMessage() const { return mErrorMessage; }
+
+private:
+    const uint64_t mMaxIterations;
+    uint64_t mIterations       = 0;
+    uint64_t mItemsProcessed   = 0;
+    uint64_t mBytesProcessed   = 0;
+    const char * mErrorMessage = nullptr;
+
+    bool mTiming = false;
+    std::chrono::steady_clock::time_point mRealStart;
+    std::chrono::steady_clock::duration mRealTime = std::chrono::steady_clock::duration::zero();
+    std::clock_t mCpuStart                        = 0;
+    std::clock_t mCpuTime                         = 0;
+};
+
+namespace Internal {
+
+bool ShouldRun(const std::string & name);
+
+// Returns the number of iterations for the next attempt, or 0 once `state` ran long enough to be recorded.
+uint64_t NextIterationCount(const State & state);
+
+void RecordResult(const std::string & name, const State & state);
+
+} // namespace Internal
+
+/**
+ * Run `body` (a callable taking `State &`) as the benchmark `name` and record its result.
+ *
+ * The body may be invoked several times with increasing iteration counts, so any setup it
+ * performs before its KeepRunning() loop must be repeatable.
+ */
+template <typename Body>
+void Run(const std::string & name, Body && body)
+{
+    if (!Internal::ShouldRun(name))
+    {
+        return;
+    }
+
+    uint64_t iterations = 1;
+    while (true)
+    {
+        State state(iterations);
+        body(state);
+
+        iterations = Internal::NextIterationCount(state);
+        if (iterations == 0)
+        {
+            Internal::RecordResult(name, state);
+            return;
+        }
+    }
+}
+
+/**
+ * Print a human readable table of all recorded results.
+ */
+void PrintSummary(FILE * out);
+
+/**
+ * Write all recorded results as JSON, in the layout produced by Google Benchmark's
+ * `--benchmark_format=json`.
+ *
+ * @return true if the results were written successfully.
+ */
+bool WriteJson(FILE * out, const char * executableName);
+
+/**
+ * Returns true if any recorded benchmark reported an error.
+ */
+bool HasErrors();
+
+} // namespace Benchmarks
+} // namespace chip
@@ -0,0 +1,130 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Entry point of the chip-benchmarks executable.
+ *
+ *      Usage: chip-benchmarks [--benchmark_filter=<substring>] [--benchmark_min_time_ms=<ms>]
+ *                             [--benchmark_out=<file.json>]
+ */
+
+#include "Benchmark.h"
+
+#include <lib/core/CHIPConfig.h>
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+
+#include <pw_unit_test/framework.h>
+
+#if !CHIP_CONFIG_TEST_GOOGLETEST
+#include <lib/support/UnitTest.h>
+#endif
+
+namespace {
+
+constexpr char kFilterArg[]  = "--benchmark_filter=";
+constexpr char kMinTimeArg[] = "--benchmark_min_time_ms=";
+constexpr char kOutArg[]     = "--benchmark_out=";
+
+void PrintUsage(const char * program)
+{
+    fprintf(stderr,
+            "Usage: %s [options]\n"
+            "  %s<substring>  only run benchmarks whose name contains <substring>\n"
+            "  %s<ms>    minimum run time of each benchmark (default: %u)\n"
+            "  %s<file>           write results to <file> as JSON\n",
+            program, kFilterArg, kMinTimeArg, static_cast<unsigned>(chip::Benchmarks::Options().minTimeMs), kOutArg);
+}
+
+bool HasPrefix(const char * arg, const char * prefix)
+{
+    return strncmp(arg, prefix, strlen(prefix)) == 0;
+}
+
+} // namespace
+
+int main(int argc, char * argv[])
+{
+    chip::Benchmarks::Options & options = chip::Benchmarks::GetOptions();
+    const char * outputPath             = nullptr;
+
+#if CHIP_CONFIG_TEST_GOOGLETEST
+    // Lets GoogleTest consume its own flags (e.g. --gtest_filter) before ours are parsed.
+    testing::InitGoogleTest(&argc, argv);
+#endif
+
+    for (int i = 1; i < argc; i++)
+    {
+        const char * arg = argv[i];
+        if (HasPrefix(arg, kFilterArg))
+        {
+            options.filter = arg + strlen(kFilterArg);
+        }
+        else if (HasPrefix(arg, kMinTimeArg))
+        {
+            char * end         = nullptr;
+            errno              = 0;
+            unsigned long time = strtoul(arg + strlen(kMinTimeArg), &end, 10);
+            if (errno != 0 || end == nullptr || *end != '\0' || time > UINT32_MAX)
+            {
+                PrintUsage(argv[0]);
+                return EXIT_FAILURE;
+            }
+            options.minTimeMs = static_cast<uint32_t>(time);
+        }
+        else if (HasPrefix(arg, kOutArg))
+        {
+            outputPath = arg + strlen(kOutArg);
+        }
+        else
+        {
+            PrintUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+#if CHIP_CONFIG_TEST_GOOGLETEST
+    int status = RUN_ALL_TESTS();
+#else
+    int status = chip::test::RunAllTests();
+#endif
+
+    chip::Benchmarks::PrintSummary(stdout);
+
+    if (outputPath != nullptr)
+    {
+        FILE * out = fopen(outputPath, "w");
+        if (out == nullptr)
+        {
+            fprintf(stderr, "Failed to open %s: %s\n", outputPath, strerror(errno));
+            return EXIT_FAILURE;
+        }
+
+        bool written = chip::Benchmarks::WriteJson(out, argv[0]);
+        written      = (fclose(out) == 0) && written;
+        if (!written)
+        {
+            fprintf(stderr, "Failed to write %s\n", outputPath);
+            return EXIT_FAILURE;
+        }
+    }
+
+    return (status == 0 && !chip::Benchmarks::HasErrors()) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
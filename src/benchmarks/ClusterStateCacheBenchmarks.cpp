@@ -0,0 +1,173 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "Benchmark.h"
+
+#include <app/ClusterStateCacheStorage.h>
+#include <lib/core/CHIPCore.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+
+#include <pw_unit_test/framework.h>
+
+#include <cstring>
+
+namespace {
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::ClusterStateCacheStorage;
+using namespace chip::Benchmarks;
+
+// Roughly what a wildcard subscription to a bridge-like node looks like: a handful of endpoints, each with a few
+// clusters carrying a few dozen small attributes.
+constexpr EndpointId kEndpointCount   = 8;
+constexpr ClusterId kClusterCount     = 12;
+constexpr AttributeId kAttributeCount = 24;
+constexpr size_t kAttributeCountTotal = kEndpointCount * kClusterCount * kAttributeCount;
+constexpr size_t kValueSize           = 12;
+
+struct TreeStorage
+{
+    using Allocator = HeapAttributeDataAllocator;
+    using NodeState = TreeNodeState<Allocator::Buffer>;
+};
+
+struct FlatStorage
+{
+    using Allocator = ArenaAttributeDataAllocator;
+    using NodeState = FlatNodeState<Allocator::Buffer>;
+};
+
+template <typename Storage>
+CHIP_ERROR Populate(typename Storage::Allocator & allocator, typename Storage::NodeState & nodeState)
+{
+    for (EndpointId endpointId = 0; endpointId < kEndpointCount; endpointId++)
+    {
+        for (ClusterId clusterId = 0; clusterId < kClusterCount; clusterId++)
+        {
+            nodeState.GetOrCreateCluster(endpointId, clusterId).mCommittedDataVersion.SetValue(clusterId);
+            for (AttributeId attributeId = 0; attributeId < kAttributeCount; attributeId++)
+            {
+                typename Storage::Allocator::Buffer buffer;
+                ReturnErrorOnFailure(allocator.Allocate(kValueSize, buffer));
+                memset(buffer.Get(), static_cast<int>(attributeId), kValueSize);
+                nodeState.SetAttribute(ConcreteAttributePath(endpointId, clusterId, attributeId), std::move(buffer));
+            }
+        }
+    }
+    return CHIP_NO_ERROR;
+}
+
+template <typename Storage>
+void RunPopulate(const char * name)
+{
+    Benchmarks::Run(name, [](State & state) {
+        while (state.KeepRunning())
+        {
+            typename Storage::Allocator allocator;
+            typename Storage::NodeState nodeState;
+            if (Populate<Storage>(allocator, nodeState) != CHIP_NO_ERROR)
+            {
+                state.SkipWithError("Populating the cache failed");
+                break;
+            }
+        }
+        state.SetItemsProcessed(state.GetIterations() * kAttributeCountTotal);
+    });
+}
+
+template <typename Storage>
+void RunLookup(const char * name)
+{
+    typename Storage::Allocator allocator;
+    typename Storage::NodeState nodeState;
+    ASSERT_EQ(Populate<Storage>(allocator, nodeState), CHIP_NO_ERROR);
+
+    Benchmarks::Run(name, [&](State & state) {
+        uint32_t checksum = 0;
+        uint32_t index    = 0;
+        while (state.KeepRunning())
+        {
+            // Stride through the node so consecutive lookups do not hit the same cache lines.
+            index = (index + 7919) % static_cast<uint32_t>(kAttributeCountTotal);
+            const ConcreteAttributePath path(static_cast<EndpointId>(index / (kClusterCount * kAttributeCount)),
+                                             static_cast<ClusterId>((index / kAttributeCount) % kClusterCount),
+                                             static_cast<AttributeId>(index % kAttributeCount));
+            const auto * value = nodeState.FindAttribute(path);
+            checksum += (value != nullptr) ? value->Get()[0] : 0;
+        }
+        // Keep the looked up values observable so the loop is not optimized away.
+        EXPECT_NE(checksum, 0u);
+        state.SetItemsProcessed(state.GetIterations());
+    });
+}
+
+template <typename Storage>
+void RunIterate(const char * name)
+{
+    typename Storage::Allocator allocator;
+    typename Storage::NodeState nodeState;
+    ASSERT_EQ(Populate<Storage>(allocator, nodeState), CHIP_NO_ERROR);
+
+    Benchmarks::Run(name, [&](State & state) {
+        size_t total = 0;
+        while (state.KeepRunning())
+        {
+            CHIP_ERROR err = nodeState.ForEachCluster([&](EndpointId endpointId, ClusterId clusterId, const ClusterVersions &) {
+                return nodeState.ForEachAttribute(endpointId, clusterId, [&](AttributeId, const auto & value) {
+                    total += value.AllocatedSize();
+                    return CHIP_NO_ERROR;
+                });
+            });
+            if (err != CHIP_NO_ERROR)
+            {
+                state.SkipWithError("Iterating the cache failed");
+                break;
+            }
+        }
+        EXPECT_EQ(total, state.GetIterations() * kAttributeCountTotal * kValueSize);
+        state.SetItemsProcessed(state.GetIterations() * kAttributeCountTotal);
+    });
+}
+
+class ClusterStateCacheBenchmarks : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { Platform::MemoryShutdown(); }
+};
+
+TEST_F(ClusterStateCacheBenchmarks, Populate)
+{
+    RunPopulate<TreeStorage>("ClusterStateCache/Populate/Tree");
+    RunPopulate<FlatStorage>("ClusterStateCache/Populate/Flat");
+}
+
+TEST_F(ClusterStateCacheBenchmarks, Lookup)
+{
+    RunLookup<TreeStorage>("ClusterStateCache/Lookup/Tree");
+    RunLookup<FlatStorage>("ClusterStateCache/Lookup/Flat");
+}
+
+TEST_F(ClusterStateCacheBenchmarks, Iterate)
+{
+    RunIterate<TreeStorage>("ClusterStateCache/Iterate/Tree");
+    RunIterate<FlatStorage>("ClusterStateCache/Iterate/Flat");
+}
+
+} // namespace
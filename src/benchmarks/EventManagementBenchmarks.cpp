@@ -0,0 +1,192 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "Benchmark.h"
+#include "SyntheticDataModelProvider.h"
+
+#include <access/SubjectDescriptor.h>
+#include <app/EventLoggingDelegate.h>
+#include <app/EventLoggingTypes.h>
+#include <app/EventManagement.h>
+#include <app/EventPathParams.h>
+#include <app/InteractionModelEngine.h>
+#include <app/MessageDef/EventDataIB.h>
+#include <app/tests/AppTestContext.h>
+#include <lib/core/CHIPCore.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/core/TLV.h>
+#include <lib/support/CHIPCounter.h>
+#include <lib/support/LinkedList.h>
+
+#include <pw_unit_test/framework.h>
+
+#include <string>
+
+namespace {
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::Benchmarks;
+
+constexpr uint16_t kEndpointCount = 4;
+constexpr EventId kTestEventId    = 1;
+constexpr TLV::Tag kEventValueTag = TLV::ContextTag(1);
+constexpr size_t kFetchBufferSize = 32 * 1024;
+constexpr size_t kPrefilledEvents = 2000;
+
+uint8_t gDebugEventBuffer[4096];
+uint8_t gInfoEventBuffer[4096];
+uint8_t gCritEventBuffer[4096];
+CircularEventBuffer gCircularEventBuffer[3];
+uint8_t gFetchBuffer[kFetchBufferSize];
+
+class BenchmarkEventGenerator : public EventLoggingDelegate
+{
+public:
+    CHIP_ERROR WriteEvent(TLV::TLVWriter & aWriter) override
+    {
+        TLV::TLVType dataContainerType;
+        ReturnErrorOnFailure(aWriter.StartContainer(TLV::ContextTag(to_underlying(EventDataIB::Tag::kData)),
+                                                    TLV::kTLVType_Structure, dataContainerType));
+        ReturnErrorOnFailure(aWriter.Put(kEventValueTag, mValue++));
+        return aWriter.EndContainer(dataContainerType);
+    }
+
+private:
+    uint32_t mValue = 0;
+};
+
+class EventManagementBenchmarks : public chip::Test::AppContext
+{
+public:
+    void SetUp() override
+    {
+        const LogStorageResources logStorageResources[] = {
+            { &gDebugEventBuffer[0], sizeof(gDebugEventBuffer), PriorityLevel::Debug },
+            { &gInfoEventBuffer[0], sizeof(gInfoEventBuffer), PriorityLevel::Info },
+            { &gCritEventBuffer[0], sizeof(gCritEventBuffer), PriorityLevel::Critical },
+        };
+
+        AppContext::SetUp();
+        mOldProvider = InteractionModelEngine::GetInstance()->SetDataModelProvider(&mProvider);
+        ASSERT_EQ(mEventCounter.Init(0), CHIP_NO_ERROR);
+        EventManagement::CreateEventManagement(&GetExchangeManager(), MATTER_ARRAY_SIZE(logStorageResources), gCircularEventBuffer,
+                                               logStorageResources, &mEventCounter);
+    }
+
+    void TearDown() override
+    {
+        EventManagement::DestroyEventManagement();
+        InteractionModelEngine::GetInstance()->SetDataModelProvider(mOldProvider);
+        AppContext::TearDown();
+    }
+
+protected:
+    // Events are spread round-robin over the endpoints of the synthetic node.
+    CHIP_ERROR LogEvent(EventNumber & eventNumber)
+    {
+        const EndpointId endpointId = static_cast<EndpointId>(1 + mLoggedEvents++ % kEndpointCount);
+
+        EventOptions options;
+        options.mPath     = { endpointId, SyntheticDataModelProvider::kFirstClusterId, kTestEventId };
+        options.mPriority = PriorityLevel::Info;
+        return EventManagement::GetInstance().LogEvent(&mGenerator, options, eventNumber);
+    }
+
+    // Encodes every event matching `path` with an event number of at least `startEventNumber`,
+    // and returns the number of events encoded.
+    static size_t FetchEvents(const EventPathParams & path, EventNumber startEventNumber, CHIP_ERROR & err)
+    {
+        SingleLinkedListNode<EventPathParams> pathList;
+        pathList.mValue = path;
+
+        TLV::TLVWriter writer;
+        writer.Init(gFetchBuffer);
+        size_t eventCount = 0;
+        err               = EventManagement::GetInstance().FetchEventsSince(writer, &pathList, startEventNumber, eventCount,
+                                                                            Access::SubjectDescriptor{});
+        if (err == CHIP_END_OF_TLV)
+        {
+            err = CHIP_NO_ERROR;
+        }
+        return eventCount;
+    }
+
+    void RunFetchBenchmark(const std::string & name, const EventPathParams & path, EventNumber startEventNumber)
+    {
+        CHIP_ERROR err             = CHIP_NO_ERROR;
+        const size_t expectedCount = FetchEvents(path, startEventNumber, err);
+        ASSERT_EQ(err, CHIP_NO_ERROR);
+        ASSERT_GT(expectedCount, 0u);
+
+        Benchmarks::Run(name, [&](State & state) {
+            while (state.KeepRunning())
+            {
+                if (FetchEvents(path, startEventNumber, err) != expectedCount || err != CHIP_NO_ERROR)
+                {
+                    state.SkipWithError("Unexpected FetchEventsSince result");
+                    break;
+                }
+            }
+            state.SetItemsProcessed(state.GetIterations() * expectedCount);
+        });
+    }
+
+    SyntheticDataModelProvider mProvider{ kEndpointCount, 1, 1 };
+    DataModel::Provider * mOldProvider = nullptr;
+    MonotonicallyIncreasingCounter<EventNumber> mEventCounter;
+    BenchmarkEventGenerator mGenerator;
+    size_t mLoggedEvents = 0;
+};
+
+// Buffers are small enough that the steady state includes evicting the oldest events.
+TEST_F(EventManagementBenchmarks, LogEvent)
+{
+    Benchmarks::Run("EventManagement/LogEvent", [&](State & state) {
+        EventNumber eventNumber;
+        while (state.KeepRunning())
+        {
+            if (LogEvent(eventNumber) != CHIP_NO_ERROR)
+            {
+                state.SkipWithError("LogEvent failed");
+                break;
+            }
+        }
+        state.SetItemsProcessed(state.GetIterations());
+    });
+}
+
+TEST_F(EventManagementBenchmarks, FetchEventsSince)
+{
+    EventNumber lastEventNumber = 0;
+    for (size_t i = 0; i < kPrefilledEvents; i++)
+    {
+        ASSERT_EQ(LogEvent(lastEventNumber), CHIP_NO_ERROR);
+    }
+
+    const EventPathParams wildcard;
+    const EventPathParams singleEndpoint(kEndpointCount, SyntheticDataModelProvider::kFirstClusterId, kTestEventId);
+
+    // A new subscription, or a read without an event number filter: everything still in the log.
+    RunFetchBenchmark("EventManagement/FetchEventsSince/All", wildcard, 0);
+    RunFetchBenchmark("EventManagement/FetchEventsSince/AllSingleEndpoint", singleEndpoint, 0);
+
+    // A subscription that is already up to date apart from the last event.
+    RunFetchBenchmark("EventManagement/FetchEventsSince/Latest", wildcard, lastEventNumber);
+}
+
+} // namespace
@@ -0,0 +1,136 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "Benchmark.h"
+#include "SyntheticDataModelProvider.h"
+
+#include <app/AttributePathParams.h>
+#include <app/InteractionModelEngine.h>
+#include <app/ReadClient.h>
+#include <app/ReadPrepareParams.h>
+#include <app/tests/AppTestContext.h>
+#include <lib/core/CHIPCore.h>
+#include <lib/core/StringBuilderAdapters.h>
+
+#include <pw_unit_test/framework.h>
+
+#include <string>
+
+namespace {
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::Benchmarks;
+
+// A node large enough that a wildcard read spans many report chunks.
+constexpr uint16_t kEndpointCount        = 64;
+constexpr uint16_t kClustersPerEndpoint  = 16;
+constexpr uint16_t kAttributesPerCluster = 16;
+
+class CountingReadCallback : public ReadClient::Callback
+{
+public:
+    void Reset()
+    {
+        mAttributeCount = 0;
+        mError          = CHIP_NO_ERROR;
+        mDone           = false;
+    }
+
+    void OnAttributeData(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData, const StatusIB & aStatus) override
+    {
+        if (apData != nullptr && aStatus.IsSuccess())
+        {
+            mAttributeCount++;
+        }
+    }
+    void OnError(CHIP_ERROR aError) override { mError = aError; }
+    void OnDone(ReadClient * apReadClient) override { mDone = true; }
+
+    size_t mAttributeCount = 0;
+    CHIP_ERROR mError      = CHIP_NO_ERROR;
+    bool mDone             = false;
+};
+
+class ReportingEngineBenchmarks : public chip::Test::AppContext
+{
+public:
+    void SetUp() override
+    {
+        chip::Test::AppContext::SetUp();
+        mOldProvider = InteractionModelEngine::GetInstance()->SetDataModelProvider(&mProvider);
+    }
+
+    void TearDown() override
+    {
+        InteractionModelEngine::GetInstance()->SetDataModelProvider(mOldProvider);
+        chip::Test::AppContext::TearDown();
+    }
+
+protected:
+    // Each iteration performs a complete read interaction for `path` over the loopback transport:
+    // the request is processed by the InteractionModelEngine and the Reporting::Engine generates
+    // every report chunk, each of which is acknowledged by the client before the next one is built.
+    void RunReadBenchmark(const std::string & name, AttributePathParams path, size_t expectedAttributeCount)
+    {
+        CountingReadCallback callback;
+
+        Benchmarks::Run(name, [&](State & state) {
+            while (state.KeepRunning())
+            {
+                callback.Reset();
+
+                ReadClient readClient(InteractionModelEngine::GetInstance(), &GetExchangeManager(), callback,
+                                      ReadClient::InteractionType::Read);
+                ReadPrepareParams readPrepareParams(GetSessionBobToAlice());
+                readPrepareParams.mpAttributePathParamsList    = &path;
+                readPrepareParams.mAttributePathParamsListSize = 1;
+
+                if (readClient.SendRequest(readPrepareParams) != CHIP_NO_ERROR)
+                {
+                    state.SkipWithError("Failed to send the read request");
+                    break;
+                }
+                DrainAndServiceIO();
+
+                if (!callback.mDone || callback.mError != CHIP_NO_ERROR || callback.mAttributeCount != expectedAttributeCount)
+                {
+                    state.SkipWithError("Read did not complete with the expected attributes");
+                    break;
+                }
+            }
+            state.SetItemsProcessed(state.GetIterations() * expectedAttributeCount);
+        });
+    }
+
+    SyntheticDataModelProvider mProvider{ kEndpointCount, kClustersPerEndpoint, kAttributesPerCluster };
+    DataModel::Provider * mOldProvider = nullptr;
+};
+
+TEST_F(ReportingEngineBenchmarks, ReadSingleCluster)
+{
+    const size_t attributesPerCluster = mProvider.AttributePathCount() / kEndpointCount / kClustersPerEndpoint;
+    RunReadBenchmark("ReportingEngine/Read/SingleCluster",
+                     AttributePathParams(kEndpointCount, SyntheticDataModelProvider::kFirstClusterId), attributesPerCluster);
+}
+
+TEST_F(ReportingEngineBenchmarks, ReadWildcard)
+{
+    RunReadBenchmark("ReportingEngine/Read/Wildcard", AttributePathParams(), mProvider.AttributePathCount());
+}
+
+} // namespace
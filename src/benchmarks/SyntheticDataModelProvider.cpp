@@ -0,0 +1,150 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "SyntheticDataModelProvider.h"
+
+#include <access/Privilege.h>
+#include <app/AttributeValueEncoder.h>
+#include <app/GlobalAttributes.h>
+#include <clusters/shared/GlobalIds.h>
+#include <lib/support/CodeUtils.h>
+
+namespace chip {
+namespace Benchmarks {
+
+using namespace chip::app;
+using namespace chip::app::DataModel;
+using Protocols::InteractionModel::Status;
+
+namespace {
+
+constexpr DataVersion kDataVersion = 1;
+
+constexpr AttributeEntry MakeReadOnlyAttribute(AttributeId attributeId)
+{
+    return AttributeEntry(attributeId, BitMask<AttributeQualityFlags>(), Access::Privilege::kView, std::nullopt);
+}
+
+} // namespace
+
+SyntheticDataModelProvider::SyntheticDataModelProvider(uint16_t endpointCount, uint16_t clustersPerEndpoint,
+                                                       uint16_t attributesPerCluster) :
+    mEndpointCount(endpointCount), mClustersPerEndpoint(clustersPerEndpoint), mAttributesPerCluster(attributesPerCluster)
+{
+    // Cluster IDs are allocated from the manufacturer-specific range, which has room for 0x3FF clusters.
+    VerifyOrDie(clustersPerEndpoint < 0x3FF);
+    VerifyOrDie(endpointCount < kInvalidEndpointId);
+}
+
+CHIP_ERROR SyntheticDataModelProvider::Endpoints(ReadOnlyBufferBuilder<EndpointEntry> & builder)
+{
+    ReturnErrorOnFailure(builder.EnsureAppendCapacity(mEndpointCount));
+    for (uint16_t i = 1; i <= mEndpointCount; i++)
+    {
+        ReturnErrorOnFailure(builder.Append({ .id                 = static_cast<EndpointId>(i),
+                                              .parentId           = kInvalidEndpointId,
+                                              .compositionPattern = EndpointCompositionPattern::kFullFamily }));
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR SyntheticDataModelProvider::DeviceTypes(EndpointId endpointId, ReadOnlyBufferBuilder<DeviceTypeEntry> & builder)
+{
+    VerifyOrReturnError(IsValidEndpoint(endpointId), CHIP_IM_GLOBAL_STATUS(UnsupportedEndpoint));
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR SyntheticDataModelProvider::ClientClusters(EndpointId endpointId, ReadOnlyBufferBuilder<ClusterId> & builder)
+{
+    VerifyOrReturnError(IsValidEndpoint(endpointId), CHIP_IM_GLOBAL_STATUS(UnsupportedEndpoint));
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR SyntheticDataModelProvider::ServerClusters(EndpointId endpointId, ReadOnlyBufferBuilder<ServerClusterEntry> & builder)
+{
+    VerifyOrReturnError(IsValidEndpoint(endpointId), CHIP_IM_GLOBAL_STATUS(UnsupportedEndpoint));
+
+    ReturnErrorOnFailure(builder.EnsureAppendCapacity(mClustersPerEndpoint));
+    for (uint16_t i = 0; i < mClustersPerEndpoint; i++)
+    {
+        ReturnErrorOnFailure(builder.Append({ .clusterId = kFirstClusterId + i, .dataVersion = kDataVersion, .flags = {} }));
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR SyntheticDataModelProvider::Attributes(const ConcreteClusterPath & path, ReadOnlyBufferBuilder<AttributeEntry> & builder)
+{
+    VerifyOrReturnError(IsValidEndpoint(path.mEndpointId), CHIP_IM_GLOBAL_STATUS(UnsupportedEndpoint));
+    VerifyOrReturnError(IsValidCluster(path), CHIP_IM_GLOBAL_STATUS(UnsupportedCluster));
+
+    ReturnErrorOnFailure(builder.EnsureAppendCapacity(mAttributesPerCluster + kGlobalAttributeCount));
+    for (uint16_t i = 0; i < mAttributesPerCluster; i++)
+    {
+        ReturnErrorOnFailure(builder.Append(MakeReadOnlyAttribute(i)));
+    }
+    ReturnErrorOnFailure(builder.Append(MakeReadOnlyAttribute(Clusters::Globals::Attributes::FeatureMap::Id)));
+    ReturnErrorOnFailure(builder.Append(MakeReadOnlyAttribute(Clusters::Globals::Attributes::ClusterRevision::Id)));
+
+    // Values of these are produced by the reporting engine from the metadata above.
+    for (auto & attributeId : GlobalAttributesNotInMetadata)
+    {
+        ReturnErrorOnFailure(builder.Append(
+            AttributeEntry(attributeId, AttributeQualityFlags::kListAttribute, Access::Privilege::kView, std::nullopt)));
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR SyntheticDataModelProvider::GeneratedCommands(const ConcreteClusterPath & path,
+                                                         ReadOnlyBufferBuilder<CommandId> & builder)
+{
+    VerifyOrReturnError(IsValidCluster(path), CHIP_IM_GLOBAL_STATUS(UnsupportedCluster));
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR SyntheticDataModelProvider::AcceptedCommands(const ConcreteClusterPath & path,
+                                                        ReadOnlyBufferBuilder<AcceptedCommandEntry> & builder)
+{
+    VerifyOrReturnError(IsValidCluster(path), CHIP_IM_GLOBAL_STATUS(UnsupportedCluster));
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR SyntheticDataModelProvider::EventInfo(const ConcreteEventPath & path, EventEntry & eventInfo)
+{
+    VerifyOrReturnError(IsValidCluster(path), CHIP_IM_GLOBAL_STATUS(UnsupportedCluster));
+    eventInfo.readPrivilege = Access::Privilege::kView;
+    return CHIP_NO_ERROR;
+}
+
+ActionReturnStatus SyntheticDataModelProvider::ReadAttribute(const ReadAttributeRequest & request, AttributeValueEncoder & encoder)
+{
+    VerifyOrReturnError(IsValidEndpoint(request.path.mEndpointId), Status::UnsupportedEndpoint);
+    VerifyOrReturnError(IsValidCluster(request.path), Status::UnsupportedCluster);
+
+    switch (request.path.mAttributeId)
+    {
+    case Clusters::Globals::Attributes::FeatureMap::Id:
+        return encoder.Encode<uint32_t>(0);
+    case Clusters::Globals::Attributes::ClusterRevision::Id:
+        return encoder.Encode<uint16_t>(1);
+    default:
+        VerifyOrReturnError(request.path.mAttributeId < mAttributesPerCluster, Status::UnsupportedAttribute);
+        return encoder.Encode<uint32_t>(request.path.mAttributeId);
+    }
+}
+
+} // namespace Benchmarks
+} // namespace chip
@@ -0,0 +1,80 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/server-cluster/testing/EmptyProvider.h>
+#include <lib/core/DataModelTypes.h>
+
+namespace chip {
+namespace Benchmarks {
+
+/**
+ * A data model provider describing a regular, arbitrarily large node: endpoints 1..N, each
+ * exposing the same set of manufacturer-specific server clusters, each of which has a
+ * configurable number of readable attributes plus the global attributes.
+ *
+ * Attribute values are synthesized on read, so the cost of a read is dominated by the
+ * interaction model code paths rather than by storage. Any event ID on a valid cluster
+ * path is readable with View privilege.
+ */
+class SyntheticDataModelProvider : public Test::EmptyProvider
+{
+public:
+    static constexpr ClusterId kFirstClusterId = 0xFFF1'FC00;
+
+    SyntheticDataModelProvider(uint16_t endpointCount, uint16_t clustersPerEndpoint, uint16_t attributesPerCluster);
+
+    /// Total number of concrete attribute paths a wildcard read of the whole node expands to.
+    size_t AttributePathCount() const
+    {
+        return static_cast<size_t>(mEndpointCount) * mClustersPerEndpoint * (mAttributesPerCluster + kGlobalAttributeCount);
+    }
+
+    CHIP_ERROR Endpoints(ReadOnlyBufferBuilder<app::DataModel::EndpointEntry> & builder) override;
+    CHIP_ERROR DeviceTypes(EndpointId endpointId, ReadOnlyBufferBuilder<app::DataModel::DeviceTypeEntry> & builder) override;
+    CHIP_ERROR ClientClusters(EndpointId endpointId, ReadOnlyBufferBuilder<ClusterId> & builder) override;
+    CHIP_ERROR ServerClusters(EndpointId endpointId, ReadOnlyBufferBuilder<app::DataModel::ServerClusterEntry> & builder) override;
+    CHIP_ERROR Attributes(const app::ConcreteClusterPath & path,
+                          ReadOnlyBufferBuilder<app::DataModel::AttributeEntry> & builder) override;
+    CHIP_ERROR GeneratedCommands(const app::ConcreteClusterPath & path, ReadOnlyBufferBuilder<CommandId> & builder) override;
+    CHIP_ERROR AcceptedCommands(const app::ConcreteClusterPath & path,
+                                ReadOnlyBufferBuilder<app::DataModel::AcceptedCommandEntry> & builder) override;
+
+    CHIP_ERROR EventInfo(const app::ConcreteEventPath & path, app::DataModel::EventEntry & eventInfo) override;
+
+    ActionReturnStatus ReadAttribute(const app::DataModel::ReadAttributeRequest & request,
+                                     app::AttributeValueEncoder & encoder) override;
+
+private:
+    // FeatureMap, ClusterRevision and the GlobalAttributesNotInMetadata lists.
+    static constexpr uint16_t kGlobalAttributeCount = 5;
+
+    bool IsValidEndpoint(EndpointId endpointId) const { return endpointId >= 1 && endpointId <= mEndpointCount; }
+    bool IsValidCluster(const app::ConcreteClusterPath & path) const
+    {
+        return IsValidEndpoint(path.mEndpointId) && path.mClusterId >= kFirstClusterId &&
+            path.mClusterId - kFirstClusterId < mClustersPerEndpoint;
+    }
+
+    const uint16_t mEndpointCount;
+    const uint16_t mClustersPerEndpoint;
+    const uint16_t mAttributesPerCluster;
+};
+
+} // namespace Benchmarks
+} // namespace chip
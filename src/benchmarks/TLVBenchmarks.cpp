@@ -0,0 +1,161 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "Benchmark.h"
+
+#include <lib/core/CHIPCore.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/core/TLV.h>
+#include <lib/support/CodeUtils.h>
+
+#include <pw_unit_test/framework.h>
+
+namespace {
+
+using namespace chip;
+using namespace chip::Benchmarks;
+
+// Shape of the payload loosely follows a list of attribute reports: a list of structures
+// mixing small integers, a boolean, a short string and a byte string.
+constexpr size_t kRecordCount        = 32;
+constexpr char kLabel[]              = "benchmark-label";
+constexpr uint8_t kOpaqueData[16]    = { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+                                         0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f };
+constexpr size_t kEncodeBufferLength = 2048;
+
+CHIP_ERROR EncodeRecords(TLV::TLVWriter & writer)
+{
+    TLV::TLVType outerList;
+    ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Array, outerList));
+    for (uint32_t i = 0; i < kRecordCount; i++)
+    {
+        TLV::TLVType record;
+        ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, record));
+        ReturnErrorOnFailure(writer.Put(TLV::ContextTag(0), static_cast<uint16_t>(i)));
+        ReturnErrorOnFailure(writer.Put(TLV::ContextTag(1), static_cast<uint32_t>(0xFFF1'FC00 + i)));
+        ReturnErrorOnFailure(writer.Put(TLV::ContextTag(2), static_cast<uint64_t>(i) << 40));
+        ReturnErrorOnFailure(writer.PutBoolean(TLV::ContextTag(3), (i & 1) != 0));
+        ReturnErrorOnFailure(writer.PutString(TLV::ContextTag(4), kLabel));
+        ReturnErrorOnFailure(writer.Put(TLV::ContextTag(5), ByteSpan(kOpaqueData)));
+        ReturnErrorOnFailure(writer.EndContainer(record));
+    }
+    return writer.EndContainer(outerList);
+}
+
+CHIP_ERROR DecodeRecords(TLV::TLVReader & reader, uint32_t & checksum)
+{
+    ReturnErrorOnFailure(reader.Next(TLV::kTLVType_Array, TLV::AnonymousTag()));
+
+    TLV::TLVType outerList;
+    ReturnErrorOnFailure(reader.EnterContainer(outerList));
+    CHIP_ERROR err;
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        TLV::TLVType record;
+        ReturnErrorOnFailure(reader.EnterContainer(record));
+        while ((err = reader.Next()) == CHIP_NO_ERROR)
+        {
+            switch (reader.GetType())
+            {
+            case TLV::kTLVType_UnsignedInteger: {
+                uint64_t value;
+                ReturnErrorOnFailure(reader.Get(value));
+                checksum += static_cast<uint32_t>(value);
+                break;
+            }
+            case TLV::kTLVType_Boolean: {
+                bool value;
+                ReturnErrorOnFailure(reader.Get(value));
+                checksum += value ? 1 : 0;
+                break;
+            }
+            case TLV::kTLVType_UTF8String:
+            case TLV::kTLVType_ByteString: {
+                ByteSpan value;
+                ReturnErrorOnFailure(reader.Get(value));
+                checksum += static_cast<uint32_t>(value.size());
+                break;
+            }
+            default:
+                return CHIP_ERROR_WRONG_TLV_TYPE;
+            }
+        }
+        VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+        ReturnErrorOnFailure(reader.ExitContainer(record));
+    }
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+    return reader.ExitContainer(outerList);
+}
+
+class TLVBenchmarks : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { Platform::MemoryShutdown(); }
+};
+
+TEST_F(TLVBenchmarks, Encode)
+{
+    uint8_t buffer[kEncodeBufferLength];
+
+    Benchmarks::Run("TLV/Encode", [&](State & state) {
+        uint32_t encodedLength = 0;
+        while (state.KeepRunning())
+        {
+            TLV::TLVWriter writer;
+            writer.Init(buffer);
+            if (EncodeRecords(writer) != CHIP_NO_ERROR || writer.Finalize() != CHIP_NO_ERROR)
+            {
+                state.SkipWithError("TLV encoding failed");
+                break;
+            }
+            encodedLength = writer.GetLengthWritten();
+        }
+        state.SetItemsProcessed(state.GetIterations() * kRecordCount);
+        state.SetBytesProcessed(state.GetIterations() * encodedLength);
+    });
+}
+
+TEST_F(TLVBenchmarks, Decode)
+{
+    uint8_t buffer[kEncodeBufferLength];
+    TLV::TLVWriter writer;
+    writer.Init(buffer);
+    ASSERT_EQ(EncodeRecords(writer), CHIP_NO_ERROR);
+    ASSERT_EQ(writer.Finalize(), CHIP_NO_ERROR);
+    const uint32_t encodedLength = writer.GetLengthWritten();
+
+    Benchmarks::Run("TLV/Decode", [&](State & state) {
+        uint32_t checksum = 0;
+        while (state.KeepRunning())
+        {
+            TLV::TLVReader reader;
+            reader.Init(buffer, encodedLength);
+            if (DecodeRecords(reader, checksum) != CHIP_NO_ERROR)
+            {
+                state.SkipWithError("TLV decoding failed");
+                break;
+            }
+        }
+        // Keep the decoded values observable so the loop is not optimized away.
+        EXPECT_NE(checksum, 0u);
+        state.SetItemsProcessed(state.GetIterations() * kRecordCount);
+        state.SetBytesProcessed(state.GetIterations() * encodedLength);
+    });
+}
+
+} // namespace
@@ -394,13 +394,65 @@ CHIP_ERROR FabricTable::VerifyCredentials(FabricIndex fabricIndex, ByteSpan noc,
     uint8_t rootCertBuf[kMaxCHIPCertLength];
     MutableByteSpan rootCertSpan{ rootCertBuf };
     ReturnErrorOnFailure(FetchRootCert(fabricIndex, rootCertSpan));
-    return VerifyCredentials(noc, icac, rootCertSpan, context, outCompressedFabricId, outFabricId, outNodeId, outNocPubkey,
-                             outRootPublicKey);
+
+    VerifiedCertChain chain;
+    if (!mVerifiedCertChainCache.Find(noc, icac, rootCertSpan, context, chain))
+    {
+        ReturnErrorOnFailure(VerifyCredentials(noc, icac, rootCertSpan, context, chain));
+        mVerifiedCertChainCache.Store(noc, icac, rootCertSpan, context, chain);
+    }
+
+    outCompressedFabricId = chain.compressedFabricId;
+    outFabricId           = chain.fabricId;
+    outNodeId             = chain.nodeId;
+    outNocPubkey          = chain.nocPublicKey;
+    if (outRootPublicKey != nullptr)
+    {
+        *outRootPublicKey = chain.rootPublicKey;
+    }
+    return CHIP_NO_ERROR;
+}
+
+bool FabricTable::FindVerifiedCredentials(ByteSpan noc, ByteSpan icac, ByteSpan rcac, const ValidationContext & context,
+                                          VerifiedCertChain & outChain) const
+{
+    assertChipStackLockedByCurrentThread();
+    return mVerifiedCertChainCache.Find(noc, icac, rcac, context, outChain);
+}
+
+void FabricTable::CacheVerifiedCredentials(FabricIndex fabricIndex, ByteSpan noc, ByteSpan icac, ByteSpan rcac,
+                                           const ValidationContext & context, const VerifiedCertChain & chain) const
+{
+    assertChipStackLockedByCurrentThread();
+
+    // The trusted roots may have changed while the credentials were being verified.
+    uint8_t rootCertBuf[kMaxCHIPCertLength];
+    MutableByteSpan rootCertSpan{ rootCertBuf };
+    VerifyOrReturn(FetchRootCert(fabricIndex, rootCertSpan) == CHIP_NO_ERROR && rootCertSpan.data_equal(rcac));
+
+    mVerifiedCertChainCache.Store(noc, icac, rcac, context, chain);
 }
 
 CHIP_ERROR FabricTable::VerifyCredentials(ByteSpan noc, ByteSpan icac, ByteSpan rcac, ValidationContext & context,
                                           CompressedFabricId & outCompressedFabricId, FabricId & outFabricId, NodeId & outNodeId,
                                           Crypto::P256PublicKey & outNocPubkey, Crypto::P256PublicKey * outRootPublicKey)
+{
+    VerifiedCertChain chain;
+    ReturnErrorOnFailure(VerifyCredentials(noc, icac, rcac, context, chain));
+
+    outCompressedFabricId = chain.compressedFabricId;
+    outFabricId           = chain.fabricId;
+    outNodeId             = chain.nodeId;
+    outNocPubkey          = chain.nocPublicKey;
+    if (outRootPublicKey != nullptr)
+    {
+        *outRootPublicKey = chain.rootPublicKey;
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR FabricTable::VerifyCredentials(ByteSpan noc, ByteSpan icac, ByteSpan rcac, ValidationContext & context,
+                                          VerifiedCertChain & outChain)
 {
     // TODO - Optimize credentials verification logic
     //        The certificate chain construction and verification is a compute and memory intensive operation.
@@ -428,7 +480,7 @@ CHIP_ERROR FabricTable::VerifyCredentials(ByteSpan noc, ByteSpan icac, ByteSpan
     // It confirms that the certs link correctly (noc -> icac -> rcac), and have been correctly signed.
     ReturnErrorOnFailure(certificates.FindValidCert(nocSubjectDN, nocSubjectKeyId, context, &resultCert));
 
-    ReturnErrorOnFailure(ExtractNodeIdFabricIdFromOpCert(certificates.GetLastCert()[0], &outNodeId, &outFabricId));
+    ReturnErrorOnFailure(ExtractNodeIdFabricIdFromOpCert(certificates.GetLastCert()[0], &outChain.nodeId, &outChain.fabricId));
 
     CHIP_ERROR err;
     FabricId icacFabricId = kUndefinedFabricId;
@@ -437,7 +489,7 @@ CHIP_ERROR FabricTable::VerifyCredentials(ByteSpan noc, ByteSpan icac, ByteSpan
         err = ExtractFabricIdFromCert(certificates.GetCertSet()[1], &icacFabricId);
         if (err == CHIP_NO_ERROR)
         {
-            VerifyOrReturnError(icacFabricId == outFabricId, CHIP_ERROR_FABRIC_MISMATCH_ON_ICA);
+            VerifyOrReturnError(icacFabricId == outChain.fabricId, CHIP_ERROR_FABRIC_MISMATCH_ON_ICA);
         }
         // FabricId is optional field in ICAC and "not found" code is not treated as error.
         else if (err != CHIP_ERROR_NOT_FOUND)
@@ -450,7 +502,7 @@ CHIP_ERROR FabricTable::VerifyCredentials(ByteSpan noc, ByteSpan icac, ByteSpan
     err                   = ExtractFabricIdFromCert(certificates.GetCertSet()[0], &rcacFabricId);
     if (err == CHIP_NO_ERROR)
     {
-        VerifyOrReturnError(rcacFabricId == outFabricId, CHIP_ERROR_WRONG_CERT_DN);
+        VerifyOrReturnError(rcacFabricId == outChain.fabricId, CHIP_ERROR_WRONG_CERT_DN);
     }
     // FabricId is optional field in RCAC and "not found" code is not treated as error.
     else if (err != CHIP_ERROR_NOT_FOUND)
@@ -464,20 +516,29 @@ CHIP_ERROR FabricTable::VerifyCredentials(ByteSpan noc, ByteSpan icac, ByteSpan
         MutableByteSpan compressedFabricIdSpan(compressedFabricIdBuf);
         P256PublicKey rootPubkey(certificates.GetCertSet()[0].mPublicKey);
 
-        ReturnErrorOnFailure(GenerateCompressedFabricId(rootPubkey, outFabricId, compressedFabricIdSpan));
+        ReturnErrorOnFailure(GenerateCompressedFabricId(rootPubkey, outChain.fabricId, compressedFabricIdSpan));
 
         // Decode compressed fabric ID accounting for endianness, as GenerateCompressedFabricId()
         // returns a binary buffer and is agnostic of usage of the output as an integer type.
-        outCompressedFabricId = Encoding::BigEndian::Get64(compressedFabricIdBuf);
+        outChain.compressedFabricId = Encoding::BigEndian::Get64(compressedFabricIdBuf);
+        outChain.rootPublicKey      = rootPubkey;
+    }
+
+    outChain.nocPublicKey = certificates.GetLastCert()->mPublicKey;
 
-        if (outRootPublicKey != nullptr)
+    // FindValidCert() checked each certificate against the effective time: the chain is valid when all of them are.
+    outChain.notBefore = 0;
+    outChain.notAfter  = kNullCertTime;
+    for (uint8_t i = 0; i < certificates.GetCertCount(); i++)
+    {
+        const ChipCertificateData & cert = certificates.GetCertSet()[i];
+        outChain.notBefore               = std::max(outChain.notBefore, cert.mNotBeforeTime);
+        if (cert.mNotAfterTime != kNullCertTime && (outChain.notAfter == kNullCertTime || cert.mNotAfterTime < outChain.notAfter))
         {
-            *outRootPublicKey = rootPubkey;
+            outChain.notAfter = cert.mNotAfterTime;
         }
     }
 
-    outNocPubkey = certificates.GetLastCert()->mPublicKey;
-
     return CHIP_NO_ERROR;
 }
 
@@ -954,6 +1015,8 @@ CHIP_ERROR FabricTable::Delete(FabricIndex fabricIndex)
     VerifyOrReturnError(mStorage != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(IsValidFabricIndex(fabricIndex), CHIP_ERROR_INVALID_ARGUMENT);
 
+    mVerifiedCertChainCache.Clear();
+
     {
         FabricTable::Delegate * delegate = mDelegateListRoot;
         while (delegate)
@@ -1080,6 +1143,8 @@ CHIP_ERROR FabricTable::Init(const FabricTable::InitParams & initParams)
     mOperationalKeystore = initParams.operationalKeystore;
     mOpCertStore         = initParams.opCertStore;
 
+    mVerifiedCertChainCache.Clear();
+
     ChipLogDetail(FabricProvisioning, "Initializing FabricTable from persistent storage");
 
     // Load the current fabrics from the storage.
@@ -1641,6 +1706,7 @@ CHIP_ERROR FabricTable::AddNewPendingTrustedRootCert(const ByteSpan & rcac)
 
     VerifyOrReturnError(IsValidFabricIndex(fabricIndexToUse), CHIP_ERROR_INVALID_FABRIC_INDEX);
     VerifyOrReturnError(SetPendingDataFabricIndex(fabricIndexToUse), CHIP_ERROR_INCORRECT_STATE);
+    mVerifiedCertChainCache.Clear();
     ReturnErrorOnFailure(mOpCertStore->AddNewTrustedRootCertForFabric(fabricIndexToUse, rcac));
 
     mStateFlags.Set(StateFlags::kIsPendingFabricDataPresent);
@@ -1854,6 +1920,8 @@ CHIP_ERROR FabricTable::CommitPendingFabricData()
 {
     VerifyOrReturnError((mStorage != nullptr) && (mOpCertStore != nullptr), CHIP_ERROR_INCORRECT_STATE);
 
+    mVerifiedCertChainCache.Clear();
+
     bool haveNewTrustedRoot      = mStateFlags.Has(StateFlags::kIsTrustedRootPending);
     bool isAdding                = mStateFlags.Has(StateFlags::kIsAddPending);
     bool isUpdating              = mStateFlags.Has(StateFlags::kIsUpdatePending);
@@ -2080,6 +2148,8 @@ CHIP_ERROR FabricTable::CommitPendingFabricData()
 void FabricTable::RevertPendingFabricData()
 {
     MATTER_TRACE_SCOPE("RevertPendingFabricData", "Fabric");
+    mVerifiedCertChainCache.Clear();
+
     // Will clear pending UpdateNoc/AddNOC
     RevertPendingOpCertsExceptRoot();
 
@@ -29,6 +29,7 @@
 #include <credentials/CertificateValidityPolicy.h>
 #include <credentials/LastKnownGoodTime.h>
 #include <credentials/OperationalCertificateStore.h>
+#include <credentials/VerifiedCertChainCache.h>
 #include <crypto/CHIPCryptoPAL.h>
 #include <crypto/OperationalKeystore.h>
 #include <lib/core/CHIPEncoding.h>
@@ -1008,6 +1009,7 @@ public:
     void RevertPendingOpCertsExceptRoot();
 
     // Verifies credentials, using the root certificate of the provided fabric index.
+    // Chains verified with the default certificate validity policy are remembered, see FindVerifiedCredentials().
     CHIP_ERROR VerifyCredentials(FabricIndex fabricIndex, ByteSpan noc, ByteSpan icac, Credentials::ValidationContext & context,
                                  CompressedFabricId & outCompressedFabricId, FabricId & outFabricId, NodeId & outNodeId,
                                  Crypto::P256PublicKey & outNocPubkey, Crypto::P256PublicKey * outRootPublicKey = nullptr) const;
@@ -1016,6 +1018,29 @@ public:
     static CHIP_ERROR VerifyCredentials(ByteSpan noc, ByteSpan icac, ByteSpan rcac, Credentials::ValidationContext & context,
                                         CompressedFabricId & outCompressedFabricId, FabricId & outFabricId, NodeId & outNodeId,
                                         Crypto::P256PublicKey & outNocPubkey, Crypto::P256PublicKey * outRootPublicKey = nullptr);
+    static CHIP_ERROR VerifyCredentials(ByteSpan noc, ByteSpan icac, ByteSpan rcac, Credentials::ValidationContext & context,
+                                        Credentials::VerifiedCertChain & outChain);
+
+    /**
+     * @brief Look up credentials already verified against the provided root certificate with an equivalent validation context.
+     *
+     * Cached chains are forgotten whenever fabrics or trusted roots change, and are only reported while the effective time of
+     * `context` is within their validity period.
+     *
+     * @retval true if `outChain` holds the outcome of the verification, false if the credentials must be verified.
+     */
+    bool FindVerifiedCredentials(ByteSpan noc, ByteSpan icac, ByteSpan rcac, const Credentials::ValidationContext & context,
+                                 Credentials::VerifiedCertChain & outChain) const;
+
+    /**
+     * @brief Remember credentials successfully verified outside of the fabric table (e.g. on a background thread) by the
+     *        static VerifyCredentials().
+     *
+     * Nothing is cached unless `rcac` is still the root certificate of the provided fabric index.
+     */
+    void CacheVerifiedCredentials(FabricIndex fabricIndex, ByteSpan noc, ByteSpan icac, ByteSpan rcac,
+                                  const Credentials::ValidationContext & context,
+                                  const Credentials::VerifiedCertChain & chain) const;
     /**
      * @brief Enables FabricInfo instances to collide and reference the same logical fabric (i.e Root Public Key + FabricId).
      *
@@ -1298,6 +1323,9 @@ private:
 
     LastKnownGoodTime mLastKnownGoodTime;
 
+    // Verification outcomes are not part of the fabric table state: they may be cached by the const VerifyCredentials().
+    mutable Credentials::VerifiedCertChainCache<CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE> mVerifiedCertChainCache;
+
     // We may not have an mNextAvailableFabricIndex if our table is as large as
     // it can go and is full.
     Optional<FabricIndex> mNextAvailableFabricIndex;
@@ -24,6 +24,8 @@
 #include <lib/support/Pool.h>
 #include <stdlib.h>
 
+#include <algorithm>
+
 namespace chip {
 namespace Credentials {
 
@@ -832,12 +834,14 @@ void GroupDataProviderImpl::Finish()
     mKeySetIterators.ReleaseAll();
     mGroupSessionsIterator.ReleaseAll();
     mGroupKeyContexPool.ReleaseAll();
+    InvalidateGroupSessionIndex();
 }
 
 void GroupDataProviderImpl::SetStorageDelegate(PersistentStorageDelegate * storage)
 {
     VerifyOrDie(storage != nullptr);
     mStorage = storage;
+    InvalidateGroupSessionIndex();
 }
 
 //
@@ -1349,6 +1353,7 @@ CHIP_ERROR GroupDataProviderImpl::RemoveEndpoints(chip::FabricIndex fabric_index
 CHIP_ERROR GroupDataProviderImpl::SetGroupKeyAt(chip::FabricIndex fabric_index, size_t index, const GroupKey & in_map)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionIndex();
 
     FabricData fabric(fabric_index);
     KeyMapData map(fabric_index);
@@ -1415,6 +1420,7 @@ CHIP_ERROR GroupDataProviderImpl::GetGroupKeyAt(chip::FabricIndex fabric_index,
 CHIP_ERROR GroupDataProviderImpl::RemoveGroupKeyAt(chip::FabricIndex fabric_index, size_t index)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionIndex();
 
     FabricData fabric(fabric_index);
     KeyMapData map;
@@ -1447,6 +1453,7 @@ CHIP_ERROR GroupDataProviderImpl::RemoveGroupKeyAt(chip::FabricIndex fabric_inde
 CHIP_ERROR GroupDataProviderImpl::RemoveGroupKeys(chip::FabricIndex fabric_index)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionIndex();
 
     FabricData fabric(fabric_index);
     VerifyOrReturnError(CHIP_NO_ERROR == fabric.Load(mStorage), CHIP_ERROR_INVALID_FABRIC_INDEX);
@@ -1523,6 +1530,7 @@ CHIP_ERROR GroupDataProviderImpl::SetKeySet(chip::FabricIndex fabric_index, cons
                                             const KeySet & in_keyset)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionIndex();
 
     FabricData fabric(fabric_index);
     KeySetData keyset;
@@ -1594,6 +1602,7 @@ CHIP_ERROR GroupDataProviderImpl::GetKeySet(chip::FabricIndex fabric_index, uint
 CHIP_ERROR GroupDataProviderImpl::RemoveKeySet(chip::FabricIndex fabric_index, uint16_t target_id)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionIndex();
 
     FabricData fabric(fabric_index);
     KeySetData keyset;
@@ -1695,6 +1704,8 @@ void GroupDataProviderImpl::KeySetIteratorImpl::Release()
 
 CHIP_ERROR GroupDataProviderImpl::RemoveFabric(chip::FabricIndex fabric_index)
 {
+    InvalidateGroupSessionIndex();
+
     FabricData fabric(fabric_index);
 
     // Fabric data defaults to zero, so if not entry is found, no mappings, or keys are removed
@@ -1806,36 +1817,152 @@ void GroupDataProviderImpl::GroupKeyContext::Release()
     mProvider.mGroupKeyContexPool.ReleaseObject(this);
 }
 
-CHIP_ERROR GroupDataProviderImpl::GroupKeyContext::MessageEncrypt(const ByteSpan & plaintext, const ByteSpan & aad,
-                                                                  const ByteSpan & nonce, MutableByteSpan & mic,
-                                                                  MutableByteSpan & ciphertext) const
+CHIP_ERROR GroupDataProviderImpl::OperationalKeyContext::MessageEncrypt(const ByteSpan & plaintext, const ByteSpan & aad,
+                                                                        const ByteSpan & nonce, MutableByteSpan & mic,
+                                                                        MutableByteSpan & ciphertext) const
 {
     uint8_t * output = ciphertext.data();
     return Crypto::AES_CCM_encrypt(plaintext.data(), plaintext.size(), aad.data(), aad.size(), mEncryptionKey, nonce.data(),
                                    nonce.size(), output, mic.data(), mic.size());
 }
 
-CHIP_ERROR GroupDataProviderImpl::GroupKeyContext::MessageDecrypt(const ByteSpan & ciphertext, const ByteSpan & aad,
-                                                                  const ByteSpan & nonce, const ByteSpan & mic,
-                                                                  MutableByteSpan & plaintext) const
+CHIP_ERROR GroupDataProviderImpl::OperationalKeyContext::MessageDecrypt(const ByteSpan & ciphertext, const ByteSpan & aad,
+                                                                        const ByteSpan & nonce, const ByteSpan & mic,
+                                                                        MutableByteSpan & plaintext) const
 {
     uint8_t * output = plaintext.data();
     return Crypto::AES_CCM_decrypt(ciphertext.data(), ciphertext.size(), aad.data(), aad.size(), mic.data(), mic.size(),
                                    mEncryptionKey, nonce.data(), nonce.size(), output);
 }
 
-CHIP_ERROR GroupDataProviderImpl::GroupKeyContext::PrivacyEncrypt(const ByteSpan & input, const ByteSpan & nonce,
-                                                                  MutableByteSpan & output) const
+CHIP_ERROR GroupDataProviderImpl::OperationalKeyContext::PrivacyEncrypt(const ByteSpan & input, const ByteSpan & nonce,
+                                                                        MutableByteSpan & output) const
 {
     return Crypto::AES_CTR_crypt(input.data(), input.size(), mPrivacyKey, nonce.data(), nonce.size(), output.data());
 }
 
-CHIP_ERROR GroupDataProviderImpl::GroupKeyContext::PrivacyDecrypt(const ByteSpan & input, const ByteSpan & nonce,
-                                                                  MutableByteSpan & output) const
+CHIP_ERROR GroupDataProviderImpl::OperationalKeyContext::PrivacyDecrypt(const ByteSpan & input, const ByteSpan & nonce,
+                                                                        MutableByteSpan & output) const
 {
     return Crypto::AES_CTR_crypt(input.data(), input.size(), mPrivacyKey, nonce.data(), nonce.size(), output.data());
 }
 
+#if CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE > 0
+
+void GroupDataProviderImpl::InvalidateGroupSessionIndex()
+{
+    for (uint16_t i = 0; i < mGroupSessionIndexCount; i++)
+    {
+        mGroupSessionIndex[i].DestroyKeys(*mSessionKeystore);
+    }
+    mGroupSessionIndexCount      = 0;
+    mGroupSessionIndexGroupCount = 0;
+    mGroupSessionIndexLoaded     = false;
+    mGroupSessionIndexOverflow   = false;
+    // Iterators positioned in the previous index must not resume in the new one
+    mGroupSessionIndexVersion++;
+}
+
+/**
+ * Gives up on the index until the next change to the keys, leaving lookups to storage.
+ *
+ * @return false, for LoadGroupSessionIndex to return.
+ */
+bool GroupDataProviderImpl::AbandonGroupSessionIndex()
+{
+    InvalidateGroupSessionIndex();
+    mGroupSessionIndexLoaded   = true;
+    mGroupSessionIndexOverflow = true;
+    return false;
+}
+
+/**
+ * Builds the group session index from storage, if needed.
+ *
+ * Each key set is read and its keys created once, however many groups it is mapped to. As with the storage-backed
+ * GroupSessionIterator, a group-key map entry that cannot be read ends the walk, and the index then holds the sessions
+ * found before it. Entries mapping a group to a missing key set are skipped.
+ *
+ * @return true if the index holds every group operational key, false if lookups must go to storage.
+ */
+bool GroupDataProviderImpl::LoadGroupSessionIndex()
+{
+    VerifyOrReturnValue(!mGroupSessionIndexLoaded, !mGroupSessionIndexOverflow);
+    InvalidateGroupSessionIndex();
+    mGroupSessionIndexLoaded = true;
+    VerifyOrReturnValue(mSessionKeystore != nullptr, AbandonGroupSessionIndex());
+
+    FabricList fabric_list;
+    VerifyOrReturnValue(CHIP_NO_ERROR == fabric_list.Load(mStorage), true);
+
+    FabricData fabric(fabric_list.first_entry);
+    bool complete = true;
+    for (size_t i = 0; complete && i < fabric_list.entry_count; i++, fabric.fabric_index = fabric.next)
+    {
+        if (CHIP_NO_ERROR != fabric.Load(mStorage))
+        {
+            break;
+        }
+
+        // Gather the fabric's group-key map, with the groups of each key set next to each other
+        GroupSessionIndexGroup * groups = &mGroupSessionIndexGroups[mGroupSessionIndexGroupCount];
+        uint16_t group_count            = 0;
+        KeyMapData mapping(fabric.fabric_index, fabric.first_map);
+        for (uint16_t j = 0; j < fabric.map_count; ++j, mapping.id = mapping.next)
+        {
+            if (CHIP_NO_ERROR != mapping.Load(mStorage))
+            {
+                complete = false;
+                break;
+            }
+            VerifyOrReturnValue(mGroupSessionIndexGroupCount + group_count < kGroupSessionIndexGroupsMax,
+                                AbandonGroupSessionIndex());
+            groups[group_count].keyset_id = mapping.keyset_id;
+            groups[group_count].group_id  = mapping.group_id;
+            group_count++;
+        }
+        std::stable_sort(groups, groups + group_count, [](const GroupSessionIndexGroup & a, const GroupSessionIndexGroup & b) {
+            return a.keyset_id < b.keyset_id;
+        });
+
+        // Index the keys of each key set once, along with the groups it is mapped to
+        for (uint16_t first = 0, end = 0; first < group_count; first = end)
+        {
+            while (end < group_count && groups[end].keyset_id == groups[first].keyset_id)
+            {
+                end++;
+            }
+
+            KeySetData keyset;
+            if (!keyset.Find(mStorage, fabric, groups[first].keyset_id))
+            {
+                continue;
+            }
+
+            for (uint16_t k = 0; k < keyset.keys_count && k < KeySet::kEpochKeysMax; ++k)
+            {
+                VerifyOrReturnValue(mGroupSessionIndexCount < CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE, AbandonGroupSessionIndex());
+
+                // Counted before its keys are created, so that they are destroyed along with the others on failure
+                GroupSessionIndexEntry & entry                    = mGroupSessionIndex[mGroupSessionIndexCount++];
+                const Crypto::GroupOperationalCredentials & creds = keyset.operational_keys[k];
+                VerifyOrReturnValue(CHIP_NO_ERROR ==
+                                        entry.CreateKeys(*mSessionKeystore, creds.encryption_key, creds.hash, creds.privacy_key),
+                                    AbandonGroupSessionIndex());
+                entry.fabric_index = fabric.fabric_index;
+                entry.policy       = keyset.policy;
+                entry.first_group  = static_cast<uint16_t>(mGroupSessionIndexGroupCount + first);
+                entry.group_count  = static_cast<uint16_t>(end - first);
+            }
+        }
+        mGroupSessionIndexGroupCount = static_cast<uint16_t>(mGroupSessionIndexGroupCount + group_count);
+    }
+
+    return true;
+}
+
+#endif // CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE > 0
+
 GroupDataProviderImpl::GroupSessionIterator * GroupDataProviderImpl::IterateGroupSessions(uint16_t session_id)
 {
     VerifyOrReturnError(IsInitialized(), nullptr);
@@ -1845,6 +1972,15 @@ GroupDataProviderImpl::GroupSessionIterator * GroupDataProviderImpl::IterateGrou
 GroupDataProviderImpl::GroupSessionIteratorImpl::GroupSessionIteratorImpl(GroupDataProviderImpl & provider, uint16_t session_id) :
     mProvider(provider), mSessionId(session_id), mGroupKeyContext(provider)
 {
+#if CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE > 0
+    if (provider.LoadGroupSessionIndex())
+    {
+        mUseIndex     = true;
+        mIndexVersion = provider.mGroupSessionIndexVersion;
+        return;
+    }
+#endif
+
     FabricList fabric_list;
     ReturnOnFailure(fabric_list.Load(provider.mStorage));
     mFirstFabric = fabric_list.first_entry;
@@ -1857,6 +1993,23 @@ GroupDataProviderImpl::GroupSessionIteratorImpl::GroupSessionIteratorImpl(GroupD
 
 size_t GroupDataProviderImpl::GroupSessionIteratorImpl::Count()
 {
+#if CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE > 0
+    if (mUseIndex)
+    {
+        VerifyOrReturnValue(mIndexVersion == mProvider.mGroupSessionIndexVersion, 0);
+        size_t count = 0;
+        for (uint16_t i = 0; i < mProvider.mGroupSessionIndexCount; i++)
+        {
+            GroupSessionIndexEntry & entry = mProvider.mGroupSessionIndex[i];
+            if (entry.GetKeyHash() == mSessionId)
+            {
+                count += entry.group_count;
+            }
+        }
+        return count;
+    }
+#endif
+
     FabricData fabric(mFirstFabric);
     size_t count = 0;
 
@@ -1898,6 +2051,28 @@ size_t GroupDataProviderImpl::GroupSessionIteratorImpl::Count()
 
 bool GroupDataProviderImpl::GroupSessionIteratorImpl::Next(GroupSession & output)
 {
+#if CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE > 0
+    if (mUseIndex)
+    {
+        // The keys may have changed since the iterator was created
+        VerifyOrReturnValue(mIndexVersion == mProvider.mGroupSessionIndexVersion, false);
+
+        for (; mIndexPosition < mProvider.mGroupSessionIndexCount; mIndexPosition++, mIndexGroup = 0)
+        {
+            GroupSessionIndexEntry & entry = mProvider.mGroupSessionIndex[mIndexPosition];
+            if (entry.GetKeyHash() == mSessionId && mIndexGroup < entry.group_count)
+            {
+                output.fabric_index    = entry.fabric_index;
+                output.group_id        = mProvider.mGroupSessionIndexGroups[entry.first_group + mIndexGroup++].group_id;
+                output.security_policy = entry.policy;
+                output.keyContext      = &entry;
+                return true;
+            }
+        }
+        return false;
+    }
+#endif
+
     while (mFabricCount < mFabricTotal)
     {
         FabricData fabric(mFabric);
@@ -43,7 +43,12 @@ public:
      */
     void SetStorageDelegate(PersistentStorageDelegate * storage);
 
-    void SetSessionKeystore(Crypto::SessionKeystore * keystore) { mSessionKeystore = keystore; }
+    void SetSessionKeystore(Crypto::SessionKeystore * keystore)
+    {
+        // The index holds keys created by the previous keystore
+        InvalidateGroupSessionIndex();
+        mSessionKeystore = keystore;
+    }
     Crypto::SessionKeystore * GetSessionKeystore() const { return mSessionKeystore; }
 
     CHIP_ERROR Init() override;
@@ -151,7 +156,43 @@ protected:
         bool mFirstEndpoint   = true;
     };
 
-    class GroupKeyContext : public Crypto::SymmetricKeyContext
+    /**
+     * Key context over the key handles of a group operational key. Derived classes decide how the handles are
+     * created and who releases them.
+     */
+    class OperationalKeyContext : public Crypto::SymmetricKeyContext
+    {
+    public:
+        uint16_t GetKeyHash() override { return mKeyHash; }
+
+        CHIP_ERROR MessageEncrypt(const ByteSpan & plaintext, const ByteSpan & aad, const ByteSpan & nonce, MutableByteSpan & mic,
+                                  MutableByteSpan & ciphertext) const override;
+        CHIP_ERROR MessageDecrypt(const ByteSpan & ciphertext, const ByteSpan & aad, const ByteSpan & nonce, const ByteSpan & mic,
+                                  MutableByteSpan & plaintext) const override;
+        CHIP_ERROR PrivacyEncrypt(const ByteSpan & input, const ByteSpan & nonce, MutableByteSpan & output) const override;
+        CHIP_ERROR PrivacyDecrypt(const ByteSpan & input, const ByteSpan & nonce, MutableByteSpan & output) const override;
+
+    protected:
+        CHIP_ERROR CreateKeys(Crypto::SessionKeystore & keystore, const Crypto::Symmetric128BitsKeyByteArray & encryptionKey,
+                              uint16_t hash, const Crypto::Symmetric128BitsKeyByteArray & privacyKey)
+        {
+            mKeyHash = hash;
+            ReturnErrorOnFailure(keystore.CreateKey(encryptionKey, mEncryptionKey));
+            return keystore.CreateKey(privacyKey, mPrivacyKey);
+        }
+
+        void DestroyKeys(Crypto::SessionKeystore & keystore)
+        {
+            keystore.DestroyKey(mEncryptionKey);
+            keystore.DestroyKey(mPrivacyKey);
+        }
+
+        uint16_t mKeyHash = 0;
+        Crypto::Aes128KeyHandle mEncryptionKey;
+        Crypto::Aes128KeyHandle mPrivacyKey;
+    };
+
+    class GroupKeyContext : public OperationalKeyContext
     {
     public:
         GroupKeyContext(GroupDataProviderImpl & provider) : mProvider(provider) {}
@@ -168,41 +209,20 @@ protected:
                               const Crypto::Symmetric128BitsKeyByteArray & privacyKey)
         {
             ReleaseKeys();
-            mKeyHash = hash;
             // TODO: Load group keys to the session keystore upon loading from persistent storage
             //
             // Group keys should be transformed into a key handle as soon as possible or even
             // the key storage should be taken over by SessionKeystore interface, but this looks
             // like more work, so let's use the transitional code below for now.
-
-            Crypto::SessionKeystore * keystore = mProvider.GetSessionKeystore();
-            ReturnErrorOnFailure(keystore->CreateKey(encryptionKey, mEncryptionKey));
-            return keystore->CreateKey(privacyKey, mPrivacyKey);
+            return CreateKeys(*mProvider.GetSessionKeystore(), encryptionKey, hash, privacyKey);
         }
 
-        void ReleaseKeys()
-        {
-            Crypto::SessionKeystore * keystore = mProvider.GetSessionKeystore();
-            keystore->DestroyKey(mEncryptionKey);
-            keystore->DestroyKey(mPrivacyKey);
-        }
-
-        uint16_t GetKeyHash() override { return mKeyHash; }
-
-        CHIP_ERROR MessageEncrypt(const ByteSpan & plaintext, const ByteSpan & aad, const ByteSpan & nonce, MutableByteSpan & mic,
-                                  MutableByteSpan & ciphertext) const override;
-        CHIP_ERROR MessageDecrypt(const ByteSpan & ciphertext, const ByteSpan & aad, const ByteSpan & nonce, const ByteSpan & mic,
-                                  MutableByteSpan & plaintext) const override;
-        CHIP_ERROR PrivacyEncrypt(const ByteSpan & input, const ByteSpan & nonce, MutableByteSpan & output) const override;
-        CHIP_ERROR PrivacyDecrypt(const ByteSpan & input, const ByteSpan & nonce, MutableByteSpan & output) const override;
+        void ReleaseKeys() { DestroyKeys(*mProvider.GetSessionKeystore()); }
 
         void Release() override;
 
     protected:
         GroupDataProviderImpl & mProvider;
-        uint16_t mKeyHash = 0;
-        Crypto::Aes128KeyHandle mEncryptionKey;
-        Crypto::Aes128KeyHandle mPrivacyKey;
     };
 
     class KeySetIteratorImpl : public KeySetIterator
@@ -242,7 +262,54 @@ protected:
         uint16_t mKeyCount       = 0;
         bool mFirstMap           = true;
         GroupKeyContext mGroupKeyContext;
+#if CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE > 0
+        // Position in the provider's group session index, used while the index is current.
+        bool mUseIndex          = false;
+        uint16_t mIndexPosition = 0;
+        uint16_t mIndexGroup    = 0;
+        uint32_t mIndexVersion  = 0;
+#endif
     };
+
+#if CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE > 0
+    /**
+     * Index of the group operational keys installed on all fabrics, so that resolving the candidate keys of an
+     * incoming group message does not require reading and deriving every key set from storage. There is one entry
+     * per epoch key of each key set mapped to a group, holding the key handles that the sessions found through it
+     * use, and listing the groups the key set is mapped to. Rebuilt on demand after any change to the key sets or
+     * group-key map.
+     */
+    class GroupSessionIndexEntry : public OperationalKeyContext
+    {
+    public:
+        using OperationalKeyContext::CreateKeys;
+        using OperationalKeyContext::DestroyKeys;
+
+        // The index owns the keys; the sessions it yields only borrow them.
+        void Release() override {}
+
+        FabricIndex fabric_index = kUndefinedFabricIndex;
+        SecurityPolicy policy    = SecurityPolicy::kCacheAndSync;
+        uint16_t first_group     = 0; // First of the key set's groups in mGroupSessionIndexGroups
+        uint16_t group_count     = 0;
+    };
+
+    // A group-key map entry. The entries of a fabric are kept together and ordered by key set.
+    struct GroupSessionIndexGroup
+    {
+        KeysetId keyset_id = 0;
+        GroupId group_id   = kUndefinedGroupId;
+    };
+
+    static constexpr size_t kGroupSessionIndexGroupsMax = CHIP_CONFIG_MAX_FABRICS * CHIP_CONFIG_MAX_GROUPS_PER_FABRIC;
+
+    bool LoadGroupSessionIndex();
+    bool AbandonGroupSessionIndex();
+    void InvalidateGroupSessionIndex();
+#else
+    void InvalidateGroupSessionIndex() {}
+#endif
+
     bool IsInitialized() { return (mStorage != nullptr); }
     CHIP_ERROR RemoveEndpoints(FabricIndex fabric_index, GroupId group_id);
 
@@ -254,6 +321,16 @@ protected:
     ObjectPool<KeySetIteratorImpl, kIteratorsMax> mKeySetIterators;
     ObjectPool<GroupSessionIteratorImpl, kIteratorsMax> mGroupSessionsIterator;
     ObjectPool<GroupKeyContext, kIteratorsMax> mGroupKeyContexPool;
+#if CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE > 0
+    GroupSessionIndexEntry mGroupSessionIndex[CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE];
+    GroupSessionIndexGroup mGroupSessionIndexGroups[kGroupSessionIndexGroupsMax];
+    uint16_t mGroupSessionIndexCount      = 0;
+    uint16_t mGroupSessionIndexGroupCount = 0;
+    uint32_t mGroupSessionIndexVersion    = 0;
+    bool mGroupSessionIndexLoaded         = false;
+    // Set when the installed keys did not fit in the index, in which case lookups go to storage.
+    bool mGroupSessionIndexOverflow = false;
+#endif
 };
 
 } // namespace Credentials
@@ -0,0 +1,220 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <credentials/CHIPCert.h>
+#include <credentials/CHIPCertificateSet.h>
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/core/CHIPEncoding.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/core/NodeId.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/SafeInt.h>
+#include <lib/support/Span.h>
+#include <lib/support/TypeTraits.h>
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+namespace chip {
+namespace Credentials {
+
+/**
+ * Outcome of the successful validation of an operational certificate chain (NOC, optional ICAC and RCAC).
+ */
+struct VerifiedCertChain
+{
+    CompressedFabricId compressedFabricId = 0;
+    FabricId fabricId                     = kUndefinedFabricId;
+    NodeId nodeId                         = kUndefinedNodeId;
+    Crypto::P256PublicKey nocPublicKey;
+    Crypto::P256PublicKey rootPublicKey;
+
+    // Intersection of the validity periods of the certificates of the chain, in CHIP epoch seconds.
+    // A notAfter of kNullCertTime means that none of the certificates expires.
+    uint32_t notBefore = 0;
+    uint32_t notAfter  = kNullCertTime;
+};
+
+/**
+ * Least recently used operational certificate chains that passed validation.
+ *
+ * Validating a chain decodes every certificate and verifies the signature of each of them, which dominates the cost of CASE
+ * establishment on constrained devices. Peers re-establishing sessions (e.g. a controller reconnecting to all its devices after
+ * a restart) present the same chains over and over, so the outcome of the validation can be reused.
+ *
+ * Chains are identified by the SHA-256 digest of their certificates and of the usages, purposes and type required by the
+ * validation context. Only contexts relying on the default certificate validity policy are cached, as a custom policy must
+ * see the decoded certificates. The default policy only rejects certificates which are not valid at the current time, so
+ * cached chains are checked against their validity period on every lookup instead.
+ *
+ * The cache holds no other trust decision: it must be cleared whenever the set of trusted roots changes.
+ */
+template <size_t kMaxEntries>
+class VerifiedCertChainCache
+{
+public:
+    static constexpr bool IsEnabled() { return kMaxEntries > 0; }
+
+    static bool IsCacheable(const ValidationContext & context) { return IsEnabled() && context.mValidityPolicy == nullptr; }
+
+    VerifiedCertChainCache() { Clear(); }
+
+    VerifiedCertChainCache(const VerifiedCertChainCache &)             = delete;
+    VerifiedCertChainCache & operator=(const VerifiedCertChainCache &) = delete;
+
+    void Clear()
+    {
+        for (auto & entry : mEntries)
+        {
+            entry.mLastUsed = kUnusedEntry;
+        }
+        mUseCounter = 0;
+    }
+
+    /**
+     * Looks up a chain validated for the given context which is still valid at the effective time of the context.
+     *
+     * @return true if outChain was filled from the cache, false if the chain must be validated.
+     */
+    bool Find(const ByteSpan & noc, const ByteSpan & icac, const ByteSpan & rcac, const ValidationContext & context,
+              VerifiedCertChain & outChain)
+    {
+        VerifyOrReturnValue(IsCacheable(context), false);
+
+        uint8_t digest[Crypto::kSHA256_Hash_Length];
+        VerifyOrReturnValue(ComputeDigest(noc, icac, rcac, context, digest) == CHIP_NO_ERROR, false);
+
+        Entry * entry = Lookup(digest);
+        VerifyOrReturnValue(entry != nullptr && IsValidAt(entry->mChain, context), false);
+
+        entry->mLastUsed = NextUse();
+        outChain         = entry->mChain;
+        return true;
+    }
+
+    /**
+     * Records a chain which was successfully validated for the given context, evicting the least recently used one if needed.
+     */
+    void Store(const ByteSpan & noc, const ByteSpan & icac, const ByteSpan & rcac, const ValidationContext & context,
+               const VerifiedCertChain & chain)
+    {
+        VerifyOrReturn(IsCacheable(context));
+
+        uint8_t digest[Crypto::kSHA256_Hash_Length];
+        VerifyOrReturn(ComputeDigest(noc, icac, rcac, context, digest) == CHIP_NO_ERROR);
+
+        Entry * entry = Lookup(digest);
+        if (entry == nullptr)
+        {
+            entry = &mEntries[0];
+            for (auto & candidate : mEntries)
+            {
+                if (candidate.mLastUsed < entry->mLastUsed)
+                {
+                    entry = &candidate;
+                }
+            }
+            memcpy(entry->mDigest, digest, sizeof(digest));
+        }
+
+        entry->mChain    = chain;
+        entry->mLastUsed = NextUse();
+    }
+
+private:
+    struct Entry
+    {
+        uint8_t mDigest[Crypto::kSHA256_Hash_Length];
+        VerifiedCertChain mChain;
+        uint32_t mLastUsed;
+    };
+
+    static constexpr uint32_t kUnusedEntry = 0;
+
+    static CHIP_ERROR ComputeDigest(const ByteSpan & noc, const ByteSpan & icac, const ByteSpan & rcac,
+                                    const ValidationContext & context, uint8_t (&outDigest)[Crypto::kSHA256_Hash_Length])
+    {
+        Crypto::Hash_SHA256_stream hash;
+        ReturnErrorOnFailure(hash.Begin());
+
+        // Certificates are length-prefixed so that bytes cannot move from one to the other.
+        for (const ByteSpan & cert : { noc, icac, rcac })
+        {
+            VerifyOrReturnError(CanCastTo<uint16_t>(cert.size()), CHIP_ERROR_INVALID_ARGUMENT);
+            uint8_t length[sizeof(uint16_t)];
+            Encoding::LittleEndian::Put16(length, static_cast<uint16_t>(cert.size()));
+            ReturnErrorOnFailure(hash.AddData(ByteSpan(length)));
+            ReturnErrorOnFailure(hash.AddData(cert));
+        }
+
+        uint8_t requirements[sizeof(uint16_t) + 2 * sizeof(uint8_t)];
+        Encoding::LittleEndian::Put16(requirements, context.mRequiredKeyUsages.Raw());
+        requirements[2] = context.mRequiredKeyPurposes.Raw();
+        requirements[3] = to_underlying(context.mRequiredCertType);
+        ReturnErrorOnFailure(hash.AddData(ByteSpan(requirements)));
+
+        MutableByteSpan digestSpan(outDigest);
+        return hash.Finish(digestSpan);
+    }
+
+    // Mirrors the default certificate validity policy: only certificates known not to be valid at the current time are rejected.
+    static bool IsValidAt(const VerifiedCertChain & chain, const ValidationContext & context)
+    {
+        VerifyOrReturnValue(context.mEffectiveTime.Is<CurrentChipEpochTime>(), true);
+
+        const uint32_t now = context.mEffectiveTime.Get<CurrentChipEpochTime>().count();
+        return now >= chain.notBefore && (chain.notAfter == kNullCertTime || now <= chain.notAfter);
+    }
+
+    Entry * Lookup(const uint8_t (&digest)[Crypto::kSHA256_Hash_Length])
+    {
+        for (auto & entry : mEntries)
+        {
+            if (entry.mLastUsed != kUnusedEntry && memcmp(entry.mDigest, digest, sizeof(digest)) == 0)
+            {
+                return &entry;
+            }
+        }
+        return nullptr;
+    }
+
+    uint32_t NextUse()
+    {
+        if (mUseCounter == UINT32_MAX)
+        {
+            // Restart the ordering rather than wrapping around, losing at worst the recency of the current entries.
+            for (auto & entry : mEntries)
+            {
+                if (entry.mLastUsed != kUnusedEntry)
+                {
+                    entry.mLastUsed = 1;
+                }
+            }
+            mUseCounter = 1;
+        }
+        return ++mUseCounter;
+    }
+
+    Entry mEntries[kMaxEntries > 0 ? kMaxEntries : 1];
+    uint32_t mUseCounter;
+};
+
+} // namespace Credentials
+} // namespace chip
@@ -2489,6 +2489,97 @@ TEST_F(TestFabricTable, TestFabricLookup)
     }
 }
 
+TEST_F(TestFabricTable, TestVerifiedCredentialsCache)
+{
+    chip::TestPersistentStorageDelegate testStorage;
+    ScopedFabricTable fabricTableHolder;
+    EXPECT_EQ(fabricTableHolder.Init(&testStorage), CHIP_NO_ERROR);
+    FabricTable & fabricTable = fabricTableHolder.GetFabricTable();
+    EXPECT_EQ(LoadTestFabric_Node01_01(fabricTable, /* doCommit = */ true), CHIP_NO_ERROR);
+
+    ByteSpan rcac(TestCerts::sTestCert_Root01_Chip);
+    ByteSpan icac(TestCerts::sTestCert_ICA01_Chip);
+    ByteSpan noc(TestCerts::sTestCert_Node01_01_Chip);
+
+    // Pick an effective time within the validity period of the whole chain.
+    ChipCertificateData nocData;
+    EXPECT_EQ(DecodeChipCert(noc, nocData), CHIP_NO_ERROR);
+    const uint32_t validTime = nocData.mNotBeforeTime + 1;
+
+    ValidationContext context;
+    context.Reset();
+    context.mRequiredKeyUsages.Set(KeyUsageFlags::kDigitalSignature);
+    context.mRequiredKeyPurposes.Set(KeyPurposeFlags::kServerAuth);
+    context.SetEffectiveTime<CurrentChipEpochTime>(System::Clock::Seconds32(validTime));
+
+    VerifiedCertChain chain;
+    EXPECT_FALSE(fabricTable.FindVerifiedCredentials(noc, icac, rcac, context, chain));
+
+    CompressedFabricId compressedFabricId;
+    FabricId fabricId;
+    NodeId nodeId;
+    Crypto::P256PublicKey nocPubkey;
+    Crypto::P256PublicKey rootPubkey;
+    EXPECT_EQ(fabricTable.VerifyCredentials(1, noc, icac, context, compressedFabricId, fabricId, nodeId, nocPubkey, &rootPubkey),
+              CHIP_NO_ERROR);
+
+    // The outcome of the verification is remembered.
+    ASSERT_TRUE(fabricTable.FindVerifiedCredentials(noc, icac, rcac, context, chain));
+    EXPECT_EQ(chain.compressedFabricId, compressedFabricId);
+    EXPECT_EQ(chain.fabricId, fabricId);
+    EXPECT_EQ(chain.nodeId, nodeId);
+    EXPECT_TRUE(chain.nocPublicKey.Matches(nocPubkey));
+    EXPECT_TRUE(chain.rootPublicKey.Matches(rootPubkey));
+
+    // ... but only for the same certificates and requirements.
+    EXPECT_FALSE(fabricTable.FindVerifiedCredentials(noc, ByteSpan(), rcac, context, chain));
+    {
+        ValidationContext otherContext = context;
+        otherContext.mRequiredKeyPurposes.Set(KeyPurposeFlags::kClientAuth);
+        EXPECT_FALSE(fabricTable.FindVerifiedCredentials(noc, icac, rcac, otherContext, chain));
+    }
+
+    // Custom validity policies always get to see the certificates.
+    {
+        IgnoreCertificateValidityPeriodPolicy policy;
+        ValidationContext otherContext = context;
+        otherContext.mValidityPolicy   = &policy;
+        EXPECT_FALSE(fabricTable.FindVerifiedCredentials(noc, icac, rcac, otherContext, chain));
+    }
+
+    // Cached chains are checked against the effective time, which only fails when the current time is known.
+    {
+        ValidationContext otherContext = context;
+        otherContext.SetEffectiveTime<CurrentChipEpochTime>(System::Clock::Seconds32(nocData.mNotBeforeTime - 1));
+        EXPECT_FALSE(fabricTable.FindVerifiedCredentials(noc, icac, rcac, otherContext, chain));
+        EXPECT_EQ(
+            fabricTable.VerifyCredentials(1, noc, icac, otherContext, compressedFabricId, fabricId, nodeId, nocPubkey, &rootPubkey),
+            CHIP_ERROR_CERT_NOT_VALID_YET);
+
+        otherContext.SetEffectiveTime<LastKnownGoodChipEpochTime>(System::Clock::Seconds32(nocData.mNotBeforeTime - 1));
+        EXPECT_TRUE(fabricTable.FindVerifiedCredentials(noc, icac, rcac, otherContext, chain));
+    }
+
+    // Credentials verified elsewhere are only remembered while their root is trusted.
+    ByteSpan otherRcac(TestCerts::sTestCert_Root02_Chip);
+    ByteSpan otherIcac(TestCerts::sTestCert_ICA02_Chip);
+    ByteSpan otherNoc(TestCerts::sTestCert_Node02_01_Chip);
+    ValidationContext otherContext = context;
+    VerifiedCertChain otherChain;
+    EXPECT_EQ(FabricTable::VerifyCredentials(otherNoc, otherIcac, otherRcac, otherContext, otherChain), CHIP_NO_ERROR);
+    fabricTable.CacheVerifiedCredentials(1, otherNoc, otherIcac, otherRcac, context, otherChain);
+    EXPECT_FALSE(fabricTable.FindVerifiedCredentials(otherNoc, otherIcac, otherRcac, context, chain));
+
+    // Any change to the fabrics forgets about every verified chain.
+    EXPECT_EQ(LoadTestFabric_Node02_01(fabricTable, /* doCommit = */ true), CHIP_NO_ERROR);
+    EXPECT_FALSE(fabricTable.FindVerifiedCredentials(noc, icac, rcac, context, chain));
+
+    fabricTable.CacheVerifiedCredentials(2, otherNoc, otherIcac, otherRcac, context, otherChain);
+    EXPECT_TRUE(fabricTable.FindVerifiedCredentials(otherNoc, otherIcac, otherRcac, context, chain));
+    EXPECT_EQ(fabricTable.Delete(1), CHIP_NO_ERROR);
+    EXPECT_FALSE(fabricTable.FindVerifiedCredentials(otherNoc, otherIcac, otherRcac, context, chain));
+}
+
 TEST_F(TestFabricTable, ShouldFailSetFabricIndexWithInvalidIndex)
 {
     chip::TestPersistentStorageDelegate testStorage;
@@ -1223,6 +1223,122 @@ TEST_F(TestGroupDataProvider, TestGroupDecryption)
     it->Release();
 }
 
+std::set<std::pair<FabricIndex, GroupId>> GetGroupSessions(GroupDataProvider * provider, uint16_t session_id)
+{
+    std::set<std::pair<FabricIndex, GroupId>> sessions;
+    GroupSession session;
+    auto it = provider->IterateGroupSessions(session_id);
+    if (it == nullptr)
+    {
+        return sessions;
+    }
+    size_t total = it->Count();
+    size_t count = 0;
+    while (it->Next(session))
+    {
+        EXPECT_NE(session.keyContext, nullptr);
+        sessions.emplace(session.fabric_index, session.group_id);
+        count++;
+    }
+    EXPECT_EQ(count, total);
+    it->Release();
+    return sessions;
+}
+
+uint16_t GetGroupSessionId(GroupDataProvider * provider, FabricIndex fabric_index, GroupId group_id)
+{
+    Crypto::SymmetricKeyContext * key_context = provider->GetKeyContext(fabric_index, group_id);
+    if (key_context == nullptr)
+    {
+        ADD_FAILURE();
+        return 0;
+    }
+    uint16_t session_id = key_context->GetKeyHash();
+    key_context->Release();
+    return session_id;
+}
+
+TEST_F(TestGroupDataProvider, TestGroupSessionsFollowKeyChanges)
+{
+    using Sessions = std::set<std::pair<FabricIndex, GroupId>>;
+
+    GroupDataProvider * provider = GetGroupDataProvider();
+    ASSERT_TRUE(provider);
+
+    // Reset test
+    ResetProvider(provider);
+
+    EXPECT_EQ(provider->SetKeySet(kFabric1, kCompressedFabricId1, kKeySet2), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->SetKeySet(kFabric2, kCompressedFabricId2, kKeySet2), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->SetGroupKeyAt(kFabric1, 0, kGroup1Keyset2), CHIP_NO_ERROR);
+
+    uint16_t session_id = GetGroupSessionId(provider, kFabric1, kGroup1);
+    EXPECT_EQ(GetGroupSessions(provider, session_id), (Sessions{ { kFabric1, kGroup1 } }));
+
+    // New mappings are visible to subsequent lookups
+    EXPECT_EQ(provider->SetGroupKeyAt(kFabric1, 1, kGroup2Keyset2), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->SetGroupKeyAt(kFabric2, 0, kGroup3Keyset2), CHIP_NO_ERROR);
+    uint16_t other_session_id = GetGroupSessionId(provider, kFabric2, kGroup3);
+    EXPECT_EQ(GetGroupSessions(provider, session_id), (Sessions{ { kFabric1, kGroup1 }, { kFabric1, kGroup2 } }));
+    EXPECT_EQ(GetGroupSessions(provider, other_session_id), (Sessions{ { kFabric2, kGroup3 } }));
+
+    // And so are removed ones
+    EXPECT_EQ(provider->RemoveGroupKeyAt(kFabric1, 0), CHIP_NO_ERROR);
+    EXPECT_EQ(GetGroupSessions(provider, session_id), (Sessions{ { kFabric1, kGroup2 } }));
+
+    // Replacing the keys of a key set retires its previous session IDs
+    KeySet new_keys    = kKeySet3;
+    new_keys.keyset_id = kKeysetId2;
+    EXPECT_EQ(provider->SetKeySet(kFabric1, kCompressedFabricId1, new_keys), CHIP_NO_ERROR);
+    uint16_t new_session_id = GetGroupSessionId(provider, kFabric1, kGroup2);
+    EXPECT_NE(new_session_id, session_id);
+    EXPECT_EQ(GetGroupSessions(provider, session_id), Sessions{});
+    EXPECT_EQ(GetGroupSessions(provider, new_session_id), (Sessions{ { kFabric1, kGroup2 } }));
+    EXPECT_EQ(GetGroupSessions(provider, other_session_id), (Sessions{ { kFabric2, kGroup3 } }));
+
+    // Removing a fabric removes its sessions
+    EXPECT_EQ(provider->RemoveFabric(kFabric2), CHIP_NO_ERROR);
+    EXPECT_EQ(GetGroupSessions(provider, other_session_id), Sessions{});
+    EXPECT_EQ(GetGroupSessions(provider, new_session_id), (Sessions{ { kFabric1, kGroup2 } }));
+}
+
+TEST_F(TestGroupDataProvider, TestGroupSessionsShareKeySet)
+{
+    using Sessions = std::set<std::pair<FabricIndex, GroupId>>;
+
+    GroupDataProvider * provider = GetGroupDataProvider();
+    ASSERT_TRUE(provider);
+
+    // Reset test
+    ResetProvider(provider);
+
+    // Both fabrics get the same keys, so that a session matches every group of both of them
+    EXPECT_EQ(provider->SetKeySet(kFabric1, kCompressedFabricId1, kKeySet2), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->SetKeySet(kFabric2, kCompressedFabricId1, kKeySet2), CHIP_NO_ERROR);
+
+    const GroupId groups[] = { kGroup1, kGroup2, kGroup3, kGroup4, kGroup5 };
+    static_assert(MATTER_ARRAY_SIZE(groups) == kMaxGroupsPerFabric);
+    Sessions expected;
+    for (size_t i = 0; i < MATTER_ARRAY_SIZE(groups); i++)
+    {
+        EXPECT_EQ(provider->SetGroupKeyAt(kFabric1, i, GroupKey(groups[i], kKeysetId2)), CHIP_NO_ERROR);
+        EXPECT_EQ(provider->SetGroupKeyAt(kFabric2, i, GroupKey(groups[i], kKeysetId2)), CHIP_NO_ERROR);
+        expected.emplace(kFabric1, groups[i]);
+        expected.emplace(kFabric2, groups[i]);
+    }
+
+    uint16_t session_id = GetGroupSessionId(provider, kFabric1, kGroup1);
+    EXPECT_EQ(session_id, GetGroupSessionId(provider, kFabric2, kGroup5));
+    EXPECT_EQ(GetGroupSessions(provider, session_id), expected);
+
+    // Remapping a group to another key set leaves the other groups in the session
+    EXPECT_EQ(provider->SetKeySet(kFabric1, kCompressedFabricId1, kKeySet3), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->SetGroupKeyAt(kFabric1, 2, GroupKey(kGroup3, kKeysetId3)), CHIP_NO_ERROR);
+    expected.erase({ kFabric1, kGroup3 });
+    EXPECT_EQ(GetGroupSessions(provider, session_id), expected);
+    EXPECT_EQ(GetGroupSessions(provider, GetGroupSessionId(provider, kFabric1, kGroup3)), (Sessions{ { kFabric1, kGroup3 } }));
+}
+
 } // namespace TestGroups
 } // namespace app
 } // namespace chip
@@ -709,11 +709,23 @@ private:
 
 using Symmetric128BitsKeyByteArray = uint8_t[CHIP_CRYPTO_SYMMETRIC_KEY_LENGTH_BYTES];
 
+#if CHIP_CRYPTO_OPENSSL || CHIP_CRYPTO_BORINGSSL
+// The OpenSSL CryptoPAL keeps a pointer to the cipher contexts prepared for a key after the key material.
+inline constexpr size_t kSymmetric128BitsKeyHandleContextSize = CHIP_CRYPTO_SYMMETRIC_KEY_LENGTH_BYTES + sizeof(void *);
+#else
+inline constexpr size_t kSymmetric128BitsKeyHandleContextSize = CHIP_CRYPTO_SYMMETRIC_KEY_LENGTH_BYTES;
+#endif // CHIP_CRYPTO_OPENSSL || CHIP_CRYPTO_BORINGSSL
+
 /**
  * @brief Platform-specific 128-bit symmetric key handle
  */
-class Symmetric128BitsKeyHandle : public SymmetricKeyHandle<CHIP_CRYPTO_SYMMETRIC_KEY_LENGTH_BYTES>
+class Symmetric128BitsKeyHandle : public SymmetricKeyHandle<kSymmetric128BitsKeyHandleContextSize>
 {
+#if CHIP_CRYPTO_OPENSSL || CHIP_CRYPTO_BORINGSSL
+public:
+    // Frees the cipher contexts the handle owns, if any (see AttachAesCcmContexts).
+    ~Symmetric128BitsKeyHandle();
+#endif // CHIP_CRYPTO_OPENSSL || CHIP_CRYPTO_BORINGSSL
 };
 
 /**
@@ -31,6 +31,7 @@
 
 #include <openssl/bn.h>
 #include <openssl/conf.h>
+#include <openssl/crypto.h>
 #include <openssl/ec.h>
 #include <openssl/ecdsa.h>
 #include <openssl/err.h>
@@ -49,11 +50,13 @@
 #include <lib/support/BufferWriter.h>
 #include <lib/support/BytesToHex.h>
 #include <lib/support/CHIPArgParser.hpp>
+#include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/SafeInt.h>
 #include <lib/support/SafePointerCast.h>
 #include <lib/support/logging/CHIPLogging.h>
 
+#include <atomic>
 #include <string.h>
 
 namespace chip {
@@ -139,19 +142,205 @@ static int _compareDaysAndSeconds(const int days, const int seconds)
     return 0;
 }
 
+namespace {
+
+#if CHIP_CRYPTO_BORINGSSL
+using AesCcmCipherContext = EVP_AEAD_CTX;
+#else
+using AesCcmCipherContext = EVP_CIPHER_CTX;
+#endif // CHIP_CRYPTO_BORINGSSL
+
+void FreeAesCcmContext(AesCcmCipherContext * context)
+{
+#if CHIP_CRYPTO_BORINGSSL
+    EVP_AEAD_CTX_free(context);
+#else
+    EVP_CIPHER_CTX_free(context);
+#endif // CHIP_CRYPTO_BORINGSSL
+}
+
+/**
+ * Allocate a cipher context and expand the key into it. Per-message state (nonce, tag) is
+ * supplied later, so the same context can process any number of messages in one direction.
+ */
+AesCcmCipherContext * NewAesCcmContext(const Aes128KeyHandle & key, size_t nonce_length, size_t tag_length, bool encrypt)
+{
+#if CHIP_CRYPTO_BORINGSSL
+    (void) nonce_length;
+    (void) encrypt;
+    return EVP_AEAD_CTX_new(EVP_aead_aes_128_ccm_matter(), key.As<Symmetric128BitsKeyByteArray>(),
+                            sizeof(Symmetric128BitsKeyByteArray), tag_length);
+#else
+    EVP_CIPHER_CTX * context = EVP_CIPHER_CTX_new();
+    VerifyOrReturnValue(context != nullptr, nullptr);
+
+    // CCM fixes the nonce and tag lengths, as well as the direction-specific block routines, when the
+    // key is set, so they must be configured first. Casts are safe because callers check the lengths
+    // with CanCastTo and against the supported tag sizes.
+    static_assert(kAES_CCM128_Key_Length == sizeof(Symmetric128BitsKeyByteArray), "Unexpected key length");
+    const int enc = encrypt ? 1 : 0;
+    if (EVP_CipherInit_ex(context, EVP_aes_128_ccm(), nullptr, nullptr, nullptr, enc) != 1 ||
+        EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_IVLEN, static_cast<int>(nonce_length), nullptr) != 1 ||
+        EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_TAG, static_cast<int>(tag_length), nullptr) != 1 ||
+        EVP_CipherInit_ex(context, nullptr, nullptr, key.As<Symmetric128BitsKeyByteArray>(), nullptr, enc) != 1)
+    {
+        EVP_CIPHER_CTX_free(context);
+        return nullptr;
+    }
+
+    return context;
+#endif // CHIP_CRYPTO_BORINGSSL
+}
+
+/**
+ * AES-CCM cipher contexts prepared for a key, one per direction, so that consecutive messages encrypted or decrypted with
+ * the key skip context allocation and key setup.
+ *
+ * Each context is validated against a copy of the key material and the lengths it was prepared with, so material written
+ * into the handle in place is noticed. A context is used by one caller at a time: a caller that finds it busy falls back to
+ * a one-shot context.
+ */
+struct AesCcmKeyContexts
+{
+    struct Slot
+    {
+        std::atomic<bool> mInUse{ false };
+        AesCcmCipherContext * mContext   = nullptr;
+        Symmetric128BitsKeyByteArray mKey = {};
+        size_t mNonceLength               = 0;
+        size_t mTagLength                 = 0;
+
+        void Clear()
+        {
+            if (mContext != nullptr)
+            {
+                FreeAesCcmContext(mContext);
+                mContext = nullptr;
+            }
+            ClearSecretData(mKey);
+            mNonceLength = 0;
+            mTagLength   = 0;
+        }
+    };
+
+    Slot mEncrypt;
+    Slot mDecrypt;
+};
+
+// For OpenSSL, the key handle stores a pointer to the contexts prepared for the key after the key material.
+struct RawSymmetric128BitsKey
+{
+    Symmetric128BitsKeyByteArray mMaterial;
+    AesCcmKeyContexts * mCcmContexts;
+};
+
+/**
+ * Scoped access to a prepared AES-CCM context: the context attached to the key when available, otherwise a context
+ * that lives for the duration of a single operation.
+ */
+class ScopedAesCcmContext
+{
+public:
+    ~ScopedAesCcmContext()
+    {
+        if (mSlot != nullptr)
+        {
+            if (mDiscard)
+            {
+                mSlot->Clear();
+            }
+            mSlot->mInUse.store(false, std::memory_order_release);
+            return;
+        }
+        if (mContext != nullptr)
+        {
+            FreeAesCcmContext(mContext);
+        }
+    }
+
+    CHIP_ERROR Init(const Aes128KeyHandle & key, size_t nonce_length, size_t tag_length, bool encrypt)
+    {
+        const RawSymmetric128BitsKey & rawKey = key.As<RawSymmetric128BitsKey>();
+        if (rawKey.mCcmContexts != nullptr)
+        {
+            AesCcmKeyContexts::Slot & slot = encrypt ? rawKey.mCcmContexts->mEncrypt : rawKey.mCcmContexts->mDecrypt;
+            if (!slot.mInUse.exchange(true, std::memory_order_acquire))
+            {
+                if (slot.mContext == nullptr || slot.mNonceLength != nonce_length || slot.mTagLength != tag_length ||
+                    CRYPTO_memcmp(slot.mKey, rawKey.mMaterial, sizeof(slot.mKey)) != 0)
+                {
+                    slot.Clear();
+                    slot.mContext = NewAesCcmContext(key, nonce_length, tag_length, encrypt);
+                    if (slot.mContext == nullptr)
+                    {
+                        slot.mInUse.store(false, std::memory_order_release);
+                        return CHIP_ERROR_NO_MEMORY;
+                    }
+                    memcpy(slot.mKey, rawKey.mMaterial, sizeof(slot.mKey));
+                    slot.mNonceLength = nonce_length;
+                    slot.mTagLength   = tag_length;
+                }
+
+                mSlot    = &slot;
+                mContext = slot.mContext;
+                return CHIP_NO_ERROR;
+            }
+        }
+
+        mContext = NewAesCcmContext(key, nonce_length, tag_length, encrypt);
+        return (mContext != nullptr) ? CHIP_NO_ERROR : CHIP_ERROR_NO_MEMORY;
+    }
+
+    AesCcmCipherContext * Get() const { return mContext; }
+
+    // Do not keep the context for later operations, e.g. because a failed operation left it in an unknown state.
+    void Discard() { mDiscard = true; }
+
+private:
+    AesCcmCipherContext * mContext  = nullptr;
+    AesCcmKeyContexts::Slot * mSlot = nullptr;
+    bool mDiscard                   = false;
+};
+
+} // namespace
+
+void AttachAesCcmContexts(Aes128KeyHandle & key)
+{
+    RawSymmetric128BitsKey & rawKey = key.AsMutable<RawSymmetric128BitsKey>();
+    if (rawKey.mCcmContexts == nullptr)
+    {
+        // Without contexts, every operation prepares its own.
+        rawKey.mCcmContexts = Platform::New<AesCcmKeyContexts>();
+    }
+}
+
+void ReleaseAesCcmContexts(Symmetric128BitsKeyHandle & key)
+{
+    RawSymmetric128BitsKey & rawKey = key.AsMutable<RawSymmetric128BitsKey>();
+    if (rawKey.mCcmContexts != nullptr)
+    {
+        rawKey.mCcmContexts->mEncrypt.Clear();
+        rawKey.mCcmContexts->mDecrypt.Clear();
+        Platform::Delete(rawKey.mCcmContexts);
+        rawKey.mCcmContexts = nullptr;
+    }
+}
+
+Symmetric128BitsKeyHandle::~Symmetric128BitsKeyHandle()
+{
+    ReleaseAesCcmContexts(*this);
+}
+
 CHIP_ERROR AES_CCM_encrypt(const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad, size_t aad_length,
                            const Aes128KeyHandle & key, const uint8_t * nonce, size_t nonce_length, uint8_t * ciphertext,
                            uint8_t * tag, size_t tag_length)
 {
+    ScopedAesCcmContext context;
 #if CHIP_CRYPTO_BORINGSSL
-    EVP_AEAD_CTX * context = nullptr;
     size_t written_tag_len = 0;
-    const EVP_AEAD * aead  = nullptr;
 #else
-    EVP_CIPHER_CTX * context = nullptr;
     int bytesWritten         = 0;
     size_t ciphertext_length = 0;
-    const EVP_CIPHER * type  = nullptr;
 #endif
     CHIP_ERROR error = CHIP_NO_ERROR;
     int result       = 1;
@@ -194,81 +383,56 @@ CHIP_ERROR AES_CCM_encrypt(const uint8_t * plaintext, size_t plaintext_length, c
                             error = CHIP_ERROR_INVALID_ARGUMENT);
 #endif // CHIP_CRYPTO_BORINGSSL
 
-#if CHIP_CRYPTO_BORINGSSL
-    aead = EVP_aead_aes_128_ccm_matter();
-
-    context = EVP_AEAD_CTX_new(aead, key.As<Symmetric128BitsKeyByteArray>(), sizeof(Symmetric128BitsKeyByteArray), tag_length);
-    VerifyOrExit(context != nullptr, error = CHIP_ERROR_NO_MEMORY);
+    // Get a context with the key already expanded, either from the cache or freshly prepared.
+    SuccessOrExit(error = context.Init(key, nonce_length, tag_length, true));
 
-    result = EVP_AEAD_CTX_seal_scatter(context, ciphertext, tag, &written_tag_len, tag_length, nonce, nonce_length, plaintext,
-                                       plaintext_length, nullptr, 0, aad, aad_length);
+#if CHIP_CRYPTO_BORINGSSL
+    result = EVP_AEAD_CTX_seal_scatter(context.Get(), ciphertext, tag, &written_tag_len, tag_length, nonce, nonce_length,
+                                       plaintext, plaintext_length, nullptr, 0, aad, aad_length);
     VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
     VerifyOrExit(written_tag_len == tag_length, error = CHIP_ERROR_INTERNAL);
 #else
-
-    type = EVP_aes_128_ccm();
-
-    context = EVP_CIPHER_CTX_new();
-    VerifyOrExit(context != nullptr, error = CHIP_ERROR_NO_MEMORY);
-
-    // Pass in cipher
-    result = EVP_EncryptInit_ex(context, type, nullptr, nullptr, nullptr);
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
-
-    // Pass in nonce length.  Cast is safe because we checked with CanCastTo.
-    result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_IVLEN, static_cast<int>(nonce_length), nullptr);
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
-
-    // Pass in tag length. Cast is safe because we checked against CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES.
-    result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_TAG, static_cast<int>(tag_length), nullptr);
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
-
-    // Pass in key + nonce
-    static_assert(kAES_CCM128_Key_Length == sizeof(Symmetric128BitsKeyByteArray), "Unexpected key length");
-    result = EVP_EncryptInit_ex(context, nullptr, nullptr, key.As<Symmetric128BitsKeyByteArray>(), Uint8::to_const_uchar(nonce));
+    // Pass in nonce, keeping the key schedule set up with the context
+    result = EVP_CipherInit_ex(context.Get(), nullptr, nullptr, nullptr, Uint8::to_const_uchar(nonce), 1);
     VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
 
     // Pass in plain text length
     VerifyOrExit(CanCastTo<int>(plaintext_length), error = CHIP_ERROR_INVALID_ARGUMENT);
-    result = EVP_EncryptUpdate(context, nullptr, &bytesWritten, nullptr, static_cast<int>(plaintext_length));
+    result = EVP_EncryptUpdate(context.Get(), nullptr, &bytesWritten, nullptr, static_cast<int>(plaintext_length));
     VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
 
     // Pass in AAD
     if (aad_length > 0 && aad != nullptr)
     {
         VerifyOrExit(CanCastTo<int>(aad_length), error = CHIP_ERROR_INVALID_ARGUMENT);
-        result = EVP_EncryptUpdate(context, nullptr, &bytesWritten, Uint8::to_const_uchar(aad), static_cast<int>(aad_length));
+        result =
+            EVP_EncryptUpdate(context.Get(), nullptr, &bytesWritten, Uint8::to_const_uchar(aad), static_cast<int>(aad_length));
         VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
     }
 
     // Encrypt
     VerifyOrExit(CanCastTo<int>(plaintext_length), error = CHIP_ERROR_INVALID_ARGUMENT);
-    result = EVP_EncryptUpdate(context, Uint8::to_uchar(ciphertext), &bytesWritten, Uint8::to_const_uchar(plaintext),
-                                          static_cast<int>(plaintext_length));
+    result = EVP_EncryptUpdate(context.Get(), Uint8::to_uchar(ciphertext), &bytesWritten, Uint8::to_const_uchar(plaintext),
+                               static_cast<int>(plaintext_length));
     VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
     VerifyOrExit((ciphertext_was_null && bytesWritten == 0) || (bytesWritten >= 0), error = CHIP_ERROR_INTERNAL);
     ciphertext_length = static_cast<unsigned int>(bytesWritten);
 
     // Finalize encryption
-    result = EVP_EncryptFinal_ex(context, ciphertext + ciphertext_length, &bytesWritten);
+    result = EVP_EncryptFinal_ex(context.Get(), ciphertext + ciphertext_length, &bytesWritten);
     VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
     VerifyOrExit(bytesWritten >= 0 && bytesWritten <= static_cast<int>(plaintext_length), error = CHIP_ERROR_INTERNAL);
 
     // Get tag
     VerifyOrExit(CanCastTo<int>(tag_length), error = CHIP_ERROR_INVALID_ARGUMENT);
-    result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_GET_TAG, static_cast<int>(tag_length), Uint8::to_uchar(tag));
+    result = EVP_CIPHER_CTX_ctrl(context.Get(), EVP_CTRL_CCM_GET_TAG, static_cast<int>(tag_length), Uint8::to_uchar(tag));
     VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
 #endif // CHIP_CRYPTO_BORINGSSL
 
 exit:
-    if (context != nullptr)
+    if (error != CHIP_NO_ERROR)
     {
-#if CHIP_CRYPTO_BORINGSSL
-        EVP_AEAD_CTX_free(context);
-#else
-        EVP_CIPHER_CTX_free(context);
-#endif // CHIP_CRYPTO_BORINGSSL
-        context = nullptr;
+        context.Discard();
     }
 
     return error;
@@ -278,15 +442,10 @@ CHIP_ERROR AES_CCM_decrypt(const uint8_t * ciphertext, size_t ciphertext_length,
                            const uint8_t * tag, size_t tag_length, const Aes128KeyHandle & key, const uint8_t * nonce,
                            size_t nonce_length, uint8_t * plaintext)
 {
-#if CHIP_CRYPTO_BORINGSSL
-    EVP_AEAD_CTX * context = nullptr;
-    const EVP_AEAD * aead  = nullptr;
-#else
-
-    EVP_CIPHER_CTX * context = nullptr;
-    int bytesOutput          = 0;
-    const EVP_CIPHER * type  = nullptr;
-#endif // CHIP_CRYPTO_BORINGSSL
+    ScopedAesCcmContext context;
+#if !CHIP_CRYPTO_BORINGSSL
+    int bytesOutput = 0;
+#endif // !CHIP_CRYPTO_BORINGSSL
     CHIP_ERROR error = CHIP_NO_ERROR;
     int result       = 1;
 
@@ -325,47 +484,31 @@ CHIP_ERROR AES_CCM_decrypt(const uint8_t * ciphertext, size_t ciphertext_length,
 #endif // CHIP_CRYPTO_BORINGSSL
     VerifyOrExit(nonce != nullptr, error = CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrExit(nonce_length > 0, error = CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrExit(CanCastTo<int>(nonce_length), error = CHIP_ERROR_INVALID_ARGUMENT);
 
-#if CHIP_CRYPTO_BORINGSSL
-    aead = EVP_aead_aes_128_ccm_matter();
-
-    context = EVP_AEAD_CTX_new(aead, key.As<Symmetric128BitsKeyByteArray>(), sizeof(Symmetric128BitsKeyByteArray), tag_length);
-    VerifyOrExit(context != nullptr, error = CHIP_ERROR_NO_MEMORY);
+    // Get a context with the key already expanded, either from the cache or freshly prepared.
+    SuccessOrExit(error = context.Init(key, nonce_length, tag_length, false));
 
-    result = EVP_AEAD_CTX_open_gather(context, plaintext, nonce, nonce_length, ciphertext, ciphertext_length, tag, tag_length, aad,
-                                      aad_length);
+#if CHIP_CRYPTO_BORINGSSL
+    result = EVP_AEAD_CTX_open_gather(context.Get(), plaintext, nonce, nonce_length, ciphertext, ciphertext_length, tag,
+                                      tag_length, aad, aad_length);
     VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
 #else
-    type = EVP_aes_128_ccm();
-
-    context = EVP_CIPHER_CTX_new();
-    VerifyOrExit(context != nullptr, error = CHIP_ERROR_NO_MEMORY);
-
-    // Pass in cipher
-    result = EVP_DecryptInit_ex(context, type, nullptr, nullptr, nullptr);
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
-
-    // Pass in nonce length
-    VerifyOrExit(CanCastTo<int>(nonce_length), error = CHIP_ERROR_INVALID_ARGUMENT);
-    result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_IVLEN, static_cast<int>(nonce_length), nullptr);
+    // Pass in nonce, keeping the key schedule set up with the context
+    result = EVP_CipherInit_ex(context.Get(), nullptr, nullptr, nullptr, Uint8::to_const_uchar(nonce), 0);
     VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
 
     // Pass in expected tag
     // Removing "const" from |tag| here should hopefully be safe as
     // we're writing the tag, not reading.
     VerifyOrExit(CanCastTo<int>(tag_length), error = CHIP_ERROR_INVALID_ARGUMENT);
-    result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_TAG, static_cast<int>(tag_length),
-                                            const_cast<void *>(static_cast<const void *>(tag)));
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
-
-    // Pass in key + nonce
-    static_assert(kAES_CCM128_Key_Length == sizeof(Symmetric128BitsKeyByteArray), "Unexpected key length");
-    result = EVP_DecryptInit_ex(context, nullptr, nullptr, key.As<Symmetric128BitsKeyByteArray>(), Uint8::to_const_uchar(nonce));
+    result = EVP_CIPHER_CTX_ctrl(context.Get(), EVP_CTRL_CCM_SET_TAG, static_cast<int>(tag_length),
+                                 const_cast<void *>(static_cast<const void *>(tag)));
     VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
 
     // Pass in cipher text length
     VerifyOrExit(CanCastTo<int>(ciphertext_length), error = CHIP_ERROR_INVALID_ARGUMENT);
-    result = EVP_DecryptUpdate(context, nullptr, &bytesOutput, nullptr, static_cast<int>(ciphertext_length));
+    result = EVP_DecryptUpdate(context.Get(), nullptr, &bytesOutput, nullptr, static_cast<int>(ciphertext_length));
     VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
     VerifyOrExit(bytesOutput <= static_cast<int>(ciphertext_length), error = CHIP_ERROR_INTERNAL);
 
@@ -373,15 +516,16 @@ CHIP_ERROR AES_CCM_decrypt(const uint8_t * ciphertext, size_t ciphertext_length,
     if (aad_length > 0 && aad != nullptr)
     {
         VerifyOrExit(CanCastTo<int>(aad_length), error = CHIP_ERROR_INVALID_ARGUMENT);
-        result = EVP_DecryptUpdate(context, nullptr, &bytesOutput, Uint8::to_const_uchar(aad), static_cast<int>(aad_length));
+        result =
+            EVP_DecryptUpdate(context.Get(), nullptr, &bytesOutput, Uint8::to_const_uchar(aad), static_cast<int>(aad_length));
         VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
         VerifyOrExit(bytesOutput <= static_cast<int>(aad_length), error = CHIP_ERROR_INTERNAL);
     }
 
     // Pass in ciphertext. We wont get anything if validation fails.
     VerifyOrExit(CanCastTo<int>(ciphertext_length), error = CHIP_ERROR_INVALID_ARGUMENT);
-    result = EVP_DecryptUpdate(context, Uint8::to_uchar(plaintext), &bytesOutput, Uint8::to_const_uchar(ciphertext),
-                                          static_cast<int>(ciphertext_length));
+    result = EVP_DecryptUpdate(context.Get(), Uint8::to_uchar(plaintext), &bytesOutput, Uint8::to_const_uchar(ciphertext),
+                               static_cast<int>(ciphertext_length));
     if (plaintext_was_null)
     {
         VerifyOrExit(bytesOutput <= static_cast<int>(sizeof(placeholder_plaintext)), error = CHIP_ERROR_INTERNAL);
@@ -390,15 +534,9 @@ CHIP_ERROR AES_CCM_decrypt(const uint8_t * ciphertext, size_t ciphertext_length,
 #endif // CHIP_CRYPTO_BORINGSSL
 
 exit:
-    if (context != nullptr)
+    if (error != CHIP_NO_ERROR)
     {
-#if CHIP_CRYPTO_BORINGSSL
-        EVP_AEAD_CTX_free(context);
-#else
-        EVP_CIPHER_CTX_free(context);
-#endif // CHIP_CRYPTO_BORINGSSL
-
-        context = nullptr;
+        context.Discard();
     }
 
     return error;
@@ -60,5 +60,19 @@ ECName MapECName(SupportedECPKeyTypes keyType);
  **/
 CHIP_ERROR P256PublicKeyFromECKey(EC_KEY * ec_key, P256PublicKey & pubkey);
 
+/**
+ * @brief Attach AES-CCM cipher contexts to a key handle holding raw key material
+ *
+ * The contexts are prepared on first use, and reused by the following messages encrypted or decrypted with the key. The
+ * handle owns them: they are freed by ReleaseAesCcmContexts, or at the latest when the handle is destroyed. Handles whose
+ * key material is copied in place, without going through a session keystore, use a context per operation.
+ **/
+void AttachAesCcmContexts(Aes128KeyHandle & key);
+
+/**
+ * @brief Release the AES-CCM cipher contexts attached to a key handle, if any, along with the copy of the key they hold
+ **/
+void ReleaseAesCcmContexts(Symmetric128BitsKeyHandle & key);
+
 } // namespace Crypto
 } // namespace chip
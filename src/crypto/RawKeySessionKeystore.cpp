@@ -17,6 +17,9 @@
 
 #include <crypto/RawKeySessionKeystore.h>
 
+#if CHIP_CRYPTO_OPENSSL || CHIP_CRYPTO_BORINGSSL
+#include <crypto/CHIPCryptoPALOpenSSL.h>
+#endif // CHIP_CRYPTO_OPENSSL || CHIP_CRYPTO_BORINGSSL
 #include <lib/support/BufferReader.h>
 
 #include <cstdint>
@@ -36,9 +39,24 @@ struct RawHkdfKeyHandle
     uint8_t size;
 };
 
+namespace {
+
+// Keys used for message encryption keep their cipher contexts between messages when the CryptoPAL supports it.
+void AttachCipherContexts(Aes128KeyHandle & key)
+{
+#if CHIP_CRYPTO_OPENSSL || CHIP_CRYPTO_BORINGSSL
+    AttachAesCcmContexts(key);
+#else
+    (void) key;
+#endif // CHIP_CRYPTO_OPENSSL || CHIP_CRYPTO_BORINGSSL
+}
+
+} // namespace
+
 CHIP_ERROR RawKeySessionKeystore::CreateKey(const Symmetric128BitsKeyByteArray & keyMaterial, Aes128KeyHandle & key)
 {
     memcpy(key.AsMutable<Symmetric128BitsKeyByteArray>(), keyMaterial, sizeof(Symmetric128BitsKeyByteArray));
+    AttachCipherContexts(key);
     return CHIP_NO_ERROR;
 }
 
@@ -64,8 +82,11 @@ CHIP_ERROR RawKeySessionKeystore::DeriveKey(const P256ECDHDerivedSecret & secret
 {
     HKDF_sha hkdf;
 
-    return hkdf.HKDF_SHA256(secret.ConstBytes(), secret.Length(), salt.data(), salt.size(), info.data(), info.size(),
-                            key.AsMutable<Symmetric128BitsKeyByteArray>(), sizeof(Symmetric128BitsKeyByteArray));
+    ReturnErrorOnFailure(hkdf.HKDF_SHA256(secret.ConstBytes(), secret.Length(), salt.data(), salt.size(), info.data(),
+                                          info.size(), key.AsMutable<Symmetric128BitsKeyByteArray>(),
+                                          sizeof(Symmetric128BitsKeyByteArray)));
+    AttachCipherContexts(key);
+    return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR RawKeySessionKeystore::DeriveSessionKeys(const ByteSpan & secret, const ByteSpan & salt, const ByteSpan & info,
@@ -80,10 +101,14 @@ CHIP_ERROR RawKeySessionKeystore::DeriveSessionKeys(const ByteSpan & secret, con
 
     Encoding::LittleEndian::Reader reader(keyMaterial, sizeof(keyMaterial));
 
-    return reader.ReadBytes(i2rKey.AsMutable<Symmetric128BitsKeyByteArray>(), sizeof(Symmetric128BitsKeyByteArray))
-        .ReadBytes(r2iKey.AsMutable<Symmetric128BitsKeyByteArray>(), sizeof(Symmetric128BitsKeyByteArray))
-        .ReadBytes(attestationChallenge.Bytes(), AttestationChallenge::Capacity())
-        .StatusCode();
+    ReturnErrorOnFailure(reader.ReadBytes(i2rKey.AsMutable<Symmetric128BitsKeyByteArray>(), sizeof(Symmetric128BitsKeyByteArray))
+                             .ReadBytes(r2iKey.AsMutable<Symmetric128BitsKeyByteArray>(), sizeof(Symmetric128BitsKeyByteArray))
+                             .ReadBytes(attestationChallenge.Bytes(), AttestationChallenge::Capacity())
+                             .StatusCode());
+
+    AttachCipherContexts(i2rKey);
+    AttachCipherContexts(r2iKey);
+    return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR RawKeySessionKeystore::DeriveSessionKeys(const HkdfKeyHandle & hkdfKey, const ByteSpan & salt, const ByteSpan & info,
@@ -95,6 +120,10 @@ CHIP_ERROR RawKeySessionKeystore::DeriveSessionKeys(const HkdfKeyHandle & hkdfKe
 
 void RawKeySessionKeystore::DestroyKey(Symmetric128BitsKeyHandle & key)
 {
+#if CHIP_CRYPTO_OPENSSL || CHIP_CRYPTO_BORINGSSL
+    // Wipe the cipher contexts prepared for this key along with its material.
+    ReleaseAesCcmContexts(key);
+#endif // CHIP_CRYPTO_OPENSSL || CHIP_CRYPTO_BORINGSSL
     ClearSecretData(key.AsMutable<Symmetric128BitsKeyByteArray>());
 }
 
@@ -432,6 +432,63 @@ TEST_F(TestChipCryptoPAL, TestAES_CCM_128DecryptTestVectors)
     EXPECT_GT(numOfTestsRan, 0);
 }
 
+// Testing that a single key handle can be reused across messages, re-keyed in place and
+// recover from a failed operation, as secure sessions do.
+TEST_F(TestChipCryptoPAL, TestAES_CCM_128ReusedKeyHandle)
+{
+    HeapChecker heapChecker;
+    int numOfTestVectors = MATTER_ARRAY_SIZE(ccm_128_test_vectors);
+    int numOfTestsRan    = 0;
+
+    DefaultSessionKeystore keystore;
+    Aes128KeyHandle key;
+
+    for (int vectorIndex = 0; vectorIndex < numOfTestVectors; vectorIndex++)
+    {
+        const ccm_128_test_vector * vector = ccm_128_test_vectors[vectorIndex];
+        if (vector->result != CHIP_NO_ERROR || vector->key_len != sizeof(Symmetric128BitsKeyByteArray) || vector->pt_len == 0)
+        {
+            continue;
+        }
+        numOfTestsRan++;
+
+        Symmetric128BitsKeyByteArray keyMaterial;
+        memcpy(&keyMaterial, vector->key, vector->key_len);
+        EXPECT_EQ(keystore.CreateKey(keyMaterial, key), CHIP_NO_ERROR);
+
+        chip::Platform::ScopedMemoryBuffer<uint8_t> out_ct;
+        chip::Platform::ScopedMemoryBuffer<uint8_t> out_pt;
+        chip::Platform::ScopedMemoryBuffer<uint8_t> out_tag;
+        out_ct.Alloc(vector->ct_len);
+        out_pt.Alloc(vector->pt_len);
+        out_tag.Alloc(vector->tag_len);
+        EXPECT_TRUE(out_ct && out_pt && out_tag);
+
+        for (int round = 0; round < 2; round++)
+        {
+            CHIP_ERROR err = AES_CCM_encrypt(vector->pt, vector->pt_len, vector->aad, vector->aad_len, key, vector->nonce,
+                                             vector->nonce_len, out_ct.Get(), out_tag.Get(), vector->tag_len);
+            EXPECT_EQ(err, CHIP_NO_ERROR);
+            EXPECT_EQ(memcmp(out_ct.Get(), vector->ct, vector->ct_len), 0);
+            EXPECT_EQ(memcmp(out_tag.Get(), vector->tag, vector->tag_len), 0);
+
+            // A tampered tag must be rejected without affecting later operations with the same key.
+            out_tag[0] = static_cast<uint8_t>(out_tag[0] ^ 0x01);
+            err        = AES_CCM_decrypt(vector->ct, vector->ct_len, vector->aad, vector->aad_len, out_tag.Get(), vector->tag_len,
+                                         key, vector->nonce, vector->nonce_len, out_pt.Get());
+            EXPECT_NE(err, CHIP_NO_ERROR);
+
+            err = AES_CCM_decrypt(vector->ct, vector->ct_len, vector->aad, vector->aad_len, vector->tag, vector->tag_len, key,
+                                  vector->nonce, vector->nonce_len, out_pt.Get());
+            EXPECT_EQ(err, CHIP_NO_ERROR);
+            EXPECT_EQ(memcmp(out_pt.Get(), vector->pt, vector->pt_len), 0);
+        }
+    }
+
+    keystore.DestroyKey(key);
+    EXPECT_GT(numOfTestsRan, 0);
+}
+
 // Testing in-place encryption: same buffer for plaintext input and ciphertext output
 // This pattern is more widely used in the Matter Stack
 TEST_F(TestChipCryptoPAL, TestAES_CCM_128InPlaceEncryption)
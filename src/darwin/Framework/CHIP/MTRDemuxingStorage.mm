@@ -153,8 +153,8 @@ static bool IsMemoryOnlyGlobalKey(NSString * key)
 
     // We do not expect to see the "g/im/ec" event number counter key.
 
-    // We do not expect to see the "g/su/*" and "g/sum" keys for server-side
-    // subscription resumption storage.
+    // We do not expect to see the "g/su/*", "g/sum" and "g/sui" keys for
+    // server-side subscription resumption storage.
 
     // We do not expect to see the "g/scc/*" scenes keys.
 
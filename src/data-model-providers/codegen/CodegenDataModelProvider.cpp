@@ -129,7 +129,9 @@ CHIP_ERROR CodegenDataModelProvider::Shutdown()
 {
     Reset();
     mContext.reset();
+    mChangeListener.SetUpstream(nullptr);
     mRegistry.ClearContext();
+    mMetadataSnapshot.Clear();
     return DataModel::Provider::Shutdown();
 }
 
@@ -139,7 +141,12 @@ CHIP_ERROR CodegenDataModelProvider::Startup(DataModel::InteractionModelContext
     VerifyOrReturnError(mPersistentStorageDelegate != nullptr, CHIP_ERROR_INCORRECT_STATE);
     ReturnErrorOnFailure(DataModel::Provider::Startup(context));
 
-    mContext.emplace(context);
+    mChangeListener.SetUpstream(&context.dataModelChangeListener);
+    mContext.emplace(DataModel::InteractionModelContext{
+        .eventsGenerator         = context.eventsGenerator,
+        .dataModelChangeListener = mChangeListener,
+        .actionContext           = context.actionContext,
+    });
 
     // Ember NVM requires have a data model provider. attempt to create one if one is not available
     //
@@ -434,6 +441,40 @@ const EmberAfCluster * CodegenDataModelProvider::FindServerCluster(const Concret
     return cluster;
 }
 
+const DataModel::MetadataSnapshot * CodegenDataModelProvider::GetMetadataSnapshot()
+{
+    if (mMetadataSnapshotDirty || (mMetadataSnapshotEmberGeneration != emberAfMetadataStructureGeneration()) ||
+        (mMetadataSnapshotRegistryGeneration != mRegistry.RegistrationGeneration()))
+    {
+        mMetadataSnapshotDirty              = false;
+        mMetadataSnapshotEmberGeneration    = emberAfMetadataStructureGeneration();
+        mMetadataSnapshotRegistryGeneration = mRegistry.RegistrationGeneration();
+
+        CHIP_ERROR err = mMetadataSnapshot.Build(*this);
+        if (err != CHIP_NO_ERROR)
+        {
+            // Callers fall back to querying the structure directly. Try again on the next call.
+            ChipLogError(DataManagement, "Failed to build metadata snapshot: %" CHIP_ERROR_FORMAT, err.Format());
+            mMetadataSnapshotDirty = true;
+            return nullptr;
+        }
+    }
+
+    return &mMetadataSnapshot;
+}
+
+void CodegenDataModelProvider::MetadataChangeListener::MarkDirty(const AttributePathParams & path)
+{
+    if (path.HasWildcardClusterId() || path.HasWildcardAttributeId() ||
+        (path.mAttributeId == Clusters::Globals::Attributes::AttributeList::Id))
+    {
+        mProvider.mMetadataSnapshotDirty = true;
+    }
+
+    VerifyOrReturn(mUpstream != nullptr);
+    mUpstream->MarkDirty(path);
+}
+
 CHIP_ERROR CodegenDataModelProvider::AcceptedCommands(const ConcreteClusterPath & path,
                                                       ReadOnlyBufferBuilder<DataModel::AcceptedCommandEntry> & builder)
 {
@@ -22,6 +22,7 @@
 #include <app/ConcreteAttributePath.h>
 #include <app/ConcreteCommandPath.h>
 #include <app/data-model-provider/ActionReturnStatus.h>
+#include <app/data-model-provider/MetadataSnapshot.h>
 #include <app/data-model-provider/MetadataTypes.h>
 #include <app/server-cluster/SingleEndpointServerClusterRegistry.h>
 #include <app/util/af-types.h>
@@ -51,7 +52,11 @@ public:
 
     /// clears out internal caching. Especially useful in unit tests,
     /// where path caching does not really apply (the same path may result in different outcomes)
-    void Reset() { mPreviouslyFoundCluster = std::nullopt; }
+    void Reset()
+    {
+        mPreviouslyFoundCluster = std::nullopt;
+        mMetadataSnapshotDirty  = true;
+    }
 
     void SetPersistentStorageDelegate(PersistentStorageDelegate * delegate) { mPersistentStorageDelegate = delegate; }
     PersistentStorageDelegate * GetPersistentStorageDelegate() { return mPersistentStorageDelegate; }
@@ -88,6 +93,8 @@ public:
 
     void Temporary_ReportAttributeChanged(const AttributePathParams & path) override;
 
+    const DataModel::MetadataSnapshot * GetMetadataSnapshot() override;
+
 protected:
     // Temporary hack for a test: Initializes the data model for testing purposes only.
     // This method serves as a placeholder and should NOT be used outside of specific tests.
@@ -95,9 +102,37 @@ protected:
     virtual void InitDataModelForTesting();
 
 private:
+    /// Forwards change notifications to the listener given at startup.
+    ///
+    /// Notifications covering a whole endpoint or cluster, or an AttributeList, may come with a change in
+    /// structure, so they also invalidate the metadata snapshot.
+    class MetadataChangeListener : public DataModel::ProviderChangeListener
+    {
+    public:
+        MetadataChangeListener(CodegenDataModelProvider & provider) : mProvider(provider) {}
+
+        void SetUpstream(DataModel::ProviderChangeListener * upstream) { mUpstream = upstream; }
+
+        void MarkDirty(const AttributePathParams & path) override;
+
+    private:
+        CodegenDataModelProvider & mProvider;
+        DataModel::ProviderChangeListener * mUpstream = nullptr;
+    };
+
     // Context is available after startup and cleared in shutdown.
     // This has a value for as long as we assume the context is valid.
+    //
+    // Its change listener is mChangeListener, which forwards to the listener of the context given at startup.
     std::optional<DataModel::InteractionModelContext> mContext;
+    MetadataChangeListener mChangeListener{ *this };
+
+    // Endpoint/cluster/attribute structure used for wildcard expansion. Rebuilt on demand when
+    // marked dirty or when the ember structure or the registered clusters have changed.
+    DataModel::MetadataSnapshot mMetadataSnapshot;
+    bool mMetadataSnapshotDirty                  = true;
+    unsigned mMetadataSnapshotEmberGeneration    = 0;
+    uint32_t mMetadataSnapshotRegistryGeneration = 0;
 
     // Iteration is often done in a tight loop going through all values.
     // To avoid N^2 iterations, cache a hint of where something is positioned
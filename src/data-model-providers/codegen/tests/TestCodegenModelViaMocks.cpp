@@ -37,6 +37,7 @@
 #include <app/GlobalAttributes.h>
 #include <app/MessageDef/ReportDataMessage.h>
 #include <app/data-model-provider/MetadataLookup.h>
+#include <app/data-model-provider/MetadataSnapshot.h>
 #include <app/data-model-provider/MetadataTypes.h>
 #include <app/data-model-provider/OperationTypes.h>
 #include <app/data-model-provider/StringBuilderAdapters.h>
@@ -73,6 +74,7 @@
 #include <lib/support/tests/ExtraPwTestMacros.h>
 #include <protocols/interaction_model/StatusCode.h>
 
+#include <algorithm>
 #include <optional>
 #include <vector>
 
@@ -2897,6 +2899,64 @@ TEST_F(TestCodegenModelViaMocks, ServerClusterInterfacesRegistration)
     EXPECT_SUCCESS(model.Registry().Unregister(&fakeClusterServer));
 }
 
+/// Compares entries by value (data_equal compares memory, including padding)
+template <typename T>
+bool SameEntries(Span<const T> a, Span<const T> b)
+{
+    return std::equal(a.begin(), a.end(), b.begin(), b.end());
+}
+
+TEST_F(TestCodegenModelViaMocks, MetadataSnapshotFollowsStructureChanges)
+{
+    TestServerClusterContext testContext;
+
+    UseMockNodeConfig config(gTestNodeConfig);
+    CodegenDataModelProviderWithContext model;
+
+    model.SetPersistentStorageDelegate(&testContext.StorageDelegate());
+    ASSERT_EQ(model.Startup(testContext.ImContext()), CHIP_NO_ERROR);
+
+    const ConcreteClusterPath kTestClusterPath(kMockEndpoint1, MockClusterId(2));
+
+    const DataModel::MetadataSnapshot * snapshot = model.GetMetadataSnapshot();
+    ASSERT_NE(snapshot, nullptr);
+    EXPECT_TRUE(SameEntries(snapshot->Endpoints(), model.EndpointsIgnoreError()));
+    EXPECT_TRUE(SameEntries(snapshot->Attributes(kTestClusterPath), model.AttributesIgnoreError(kTestClusterPath)));
+    EXPECT_EQ(snapshot->ServerClusters(kMockEndpoint1).size(), model.ServerClustersIgnoreError(kMockEndpoint1).size());
+    EXPECT_TRUE(snapshot->ServerClusters(kInvalidEndpointId).empty());
+
+    // no structure change: the snapshot is re-used as-is
+    uint32_t generation = snapshot->Generation();
+    model.Temporary_ReportAttributeChanged({ kTestClusterPath.mEndpointId, kTestClusterPath.mClusterId, MockAttributeId(1) });
+    ASSERT_EQ(model.GetMetadataSnapshot(), snapshot);
+    EXPECT_EQ(snapshot->Generation(), generation);
+
+    // registering a cluster replaces the ember attributes of that path
+    FakeDefaultServerCluster fakeClusterServer(kTestClusterPath);
+    ServerClusterRegistration registration(fakeClusterServer);
+    ASSERT_EQ(model.Registry().Register(registration), CHIP_NO_ERROR);
+
+    ASSERT_EQ(model.GetMetadataSnapshot(), snapshot);
+    EXPECT_NE(snapshot->Generation(), generation);
+    EXPECT_TRUE(SameEntries(snapshot->Attributes(kTestClusterPath), model.AttributesIgnoreError(kTestClusterPath)));
+    EXPECT_TRUE(snapshot->FindAttribute({ kTestClusterPath.mEndpointId, kTestClusterPath.mClusterId, kAttributeIdReadOnly }));
+
+    // attribute list changes are structure changes, and are still reported to the interaction model
+    generation = snapshot->Generation();
+    testContext.ChangeListener().DirtyList().clear();
+    model.Temporary_ReportAttributeChanged(
+        { kTestClusterPath.mEndpointId, kTestClusterPath.mClusterId, Clusters::Globals::Attributes::AttributeList::Id });
+    ASSERT_EQ(model.GetMetadataSnapshot(), snapshot);
+    EXPECT_NE(snapshot->Generation(), generation);
+    EXPECT_EQ(testContext.ChangeListener().DirtyList().size(), 1u);
+
+    generation = snapshot->Generation();
+    EXPECT_SUCCESS(model.Registry().Unregister(&fakeClusterServer));
+    ASSERT_EQ(model.GetMetadataSnapshot(), snapshot);
+    EXPECT_NE(snapshot->Generation(), generation);
+    EXPECT_FALSE(snapshot->FindAttribute({ kTestClusterPath.mEndpointId, kTestClusterPath.mClusterId, kAttributeIdReadOnly }));
+}
+
 TEST_F(TestCodegenModelViaMocks, EventInfo)
 {
     // Test that we format the event info correctly
@@ -40,6 +40,7 @@
 #include <fcntl.h>
 #include <poll.h>
 #include <sched.h>
+#include <string.h>
 #include <unistd.h>
 
 namespace chip {
@@ -384,6 +385,145 @@ exit:
 #endif // CHIP_SYSTEM_CONFIG_USE_LIBEV
 }
 
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+
+template <class ImplClass>
+CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_PostBackgroundEvent(const ChipDeviceEvent * event)
+{
+    VerifyOrReturnError(event->Type == DeviceEventType::kCallWorkFunct || event->Type == DeviceEventType::kNoOp,
+                        CHIP_ERROR_INVALID_ARGUMENT);
+
+    pthread_mutex_lock(&mBackgroundEventLock);
+
+    if (!mShouldRunBackgroundEventLoop)
+    {
+        pthread_mutex_unlock(&mBackgroundEventLock);
+
+        // Use foreground event loop for background events until the background threads are started
+        return _PostEvent(event);
+    }
+
+    if (mBackgroundEventQueue.size() >= CHIP_DEVICE_CONFIG_BG_MAX_EVENT_QUEUE_SIZE)
+    {
+        pthread_mutex_unlock(&mBackgroundEventLock);
+        ChipLogError(DeviceLayer, "Failed to post event to CHIP background event queue");
+        return CHIP_ERROR_NO_MEMORY;
+    }
+
+    mBackgroundEventQueue.push(*event);
+    pthread_cond_signal(&mBackgroundEventCond);
+
+    pthread_mutex_unlock(&mBackgroundEventLock);
+    return CHIP_NO_ERROR;
+}
+
+template <class ImplClass>
+void GenericPlatformManagerImpl_POSIX<ImplClass>::_RunBackgroundEventLoop()
+{
+    pthread_mutex_lock(&mBackgroundEventLock);
+
+    //
+    // Several threads may run this loop at the same time. Events still queued when the loop is stopped are processed
+    // before returning, as they may hold resources that are only released by their handlers. The loop is started by
+    // _StartBackgroundEventLoopTask, so a thread which only gets here once the loop is stopped returns right away.
+    //
+    while (mShouldRunBackgroundEventLoop || !mBackgroundEventQueue.empty())
+    {
+        if (mBackgroundEventQueue.empty())
+        {
+            pthread_cond_wait(&mBackgroundEventCond, &mBackgroundEventLock);
+            continue;
+        }
+
+        const ChipDeviceEvent event = mBackgroundEventQueue.front();
+        mBackgroundEventQueue.pop();
+
+        pthread_mutex_unlock(&mBackgroundEventLock);
+        Impl()->DispatchEvent(&event);
+        pthread_mutex_lock(&mBackgroundEventLock);
+    }
+
+    pthread_mutex_unlock(&mBackgroundEventLock);
+}
+
+template <class ImplClass>
+void * GenericPlatformManagerImpl_POSIX<ImplClass>::BackgroundEventLoopTaskMain(void * arg)
+{
+    ChipLogDetail(DeviceLayer, "CHIP background task running");
+    static_cast<GenericPlatformManagerImpl_POSIX<ImplClass> *>(arg)->Impl()->RunBackgroundEventLoop();
+    return nullptr;
+}
+
+template <class ImplClass>
+CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_StartBackgroundEventLoopTask()
+{
+    int err = 0;
+
+    pthread_mutex_lock(&mBackgroundEventLock);
+
+    VerifyOrExit(mBackgroundTaskCount == 0, err = EALREADY);
+
+    // Accept background events right away, so that none of them go to the foreground event loop while the threads start.
+    mShouldRunBackgroundEventLoop = true;
+
+    for (; mBackgroundTaskCount < CHIP_DEVICE_CONFIG_BG_TASK_COUNT; mBackgroundTaskCount++)
+    {
+        err = pthread_create(&mBackgroundTasks[mBackgroundTaskCount], nullptr, BackgroundEventLoopTaskMain, this);
+        if (err != 0)
+        {
+            ChipLogError(DeviceLayer, "Failed to start CHIP background task: %s", strerror(err));
+            break;
+        }
+    }
+
+    // A single thread is enough to process the queue, if fewer than requested could be started.
+    if (mBackgroundTaskCount > 0)
+    {
+        err = 0;
+    }
+    else
+    {
+        mShouldRunBackgroundEventLoop = false;
+    }
+
+exit:
+    pthread_mutex_unlock(&mBackgroundEventLock);
+    return CHIP_ERROR_POSIX(err);
+}
+
+template <class ImplClass>
+CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_StopBackgroundEventLoopTask()
+{
+    pthread_mutex_lock(&mBackgroundEventLock);
+
+    mShouldRunBackgroundEventLoop = false;
+    pthread_cond_broadcast(&mBackgroundEventCond);
+
+    size_t taskCount     = mBackgroundTaskCount;
+    mBackgroundTaskCount = 0;
+
+    pthread_mutex_unlock(&mBackgroundEventLock);
+
+    //
+    // Wait for the threads we have created to drain the queue and terminate, unless we are running on one of them.
+    //
+    for (size_t i = 0; i < taskCount; i++)
+    {
+        if (pthread_equal(pthread_self(), mBackgroundTasks[i]))
+        {
+            pthread_detach(mBackgroundTasks[i]);
+            continue;
+        }
+
+        int err = pthread_join(mBackgroundTasks[i], nullptr);
+        VerifyOrReturnError(err == 0, CHIP_ERROR_POSIX(err));
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+#endif // CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+
 template <class ImplClass>
 void GenericPlatformManagerImpl_POSIX<ImplClass>::_Shutdown()
 {
@@ -394,6 +534,10 @@ void GenericPlatformManagerImpl_POSIX<ImplClass>::_Shutdown()
     //
     VerifyOrDie(mState.load(std::memory_order_relaxed) == State::kStopped);
 
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+    TEMPORARY_RETURN_IGNORED _StopBackgroundEventLoopTask();
+#endif
+
 #if !CHIP_SYSTEM_CONFIG_USE_LIBEV
     pthread_mutex_destroy(&mStateLock);
     pthread_cond_destroy(&mEventQueueStoppedCond);
@@ -295,4 +295,44 @@
 #define INET_CONFIG_UDP_SOCKET_MREQN 0
 #endif
 
+/**
+ *  @def HAVE_RECVMMSG
+ *
+ *  @brief
+ *    Should be set to 1 if recvmmsg() is available, so that socket-based
+ *    UDP endpoints can read several datagrams with a single system call.
+ */
+#ifndef HAVE_RECVMMSG
+#define HAVE_RECVMMSG 0
+#endif
+
+/**
+ *  @def HAVE_SENDMMSG
+ *
+ *  @brief
+ *    Should be set to 1 if sendmmsg() is available, so that socket-based
+ *    UDP endpoints can send several datagrams with a single system call.
+ */
+#ifndef HAVE_SENDMMSG
+#define HAVE_SENDMMSG 0
+#endif
+
+/**
+ *  @def INET_CONFIG_UDP_MAX_BATCH_SIZE
+ *
+ *  @brief
+ *    The largest number of datagrams a UDP endpoint moves in a single
+ *    system call when receiving or sending in batches.
+ *
+ *  @details
+ *    Each endpoint that enables batched receive (see
+ *    UDPEndPoint::SetReceiveBatchSize) keeps up to this many packet buffers
+ *    allocated to receive into. Where HAVE_SENDMMSG is set, the UDP
+ *    transport also queues up to this many outgoing messages per pass of
+ *    the event loop before sending them together.
+ */
+#ifndef INET_CONFIG_UDP_MAX_BATCH_SIZE
+#define INET_CONFIG_UDP_MAX_BATCH_SIZE 8
+#endif
+
 // clang-format on
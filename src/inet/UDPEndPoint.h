@@ -230,6 +230,36 @@ public:
      */
     CHIP_ERROR SendMsg(const IPPacketInfo * pktInfo, chip::System::PacketBufferHandle && msg);
 
+    /**
+     * Send several UDP messages.
+     *
+     *  Sends each message in \c msgs to the destination given in the matching entry of \c pktInfos, as if by calling
+     *  \c SendMsg for each of them in turn and stopping at the first failure. Platforms that support it hand the whole
+     *  batch to the network stack at once, which is considerably cheaper than sending the messages one by one.
+     *
+     *  The handles of the messages that were sent are released, and those after the first failure are left untouched.
+     *
+     * @param[in]     pktInfos    Source and destination information, one entry per message.
+     * @param[in,out] msgs        Packet buffers containing the UDP messages.
+     * @param[in]     count       Number of entries in \c pktInfos and \c msgs.
+     * @param[out]    sentCount   Number of messages that were sent; equal to \c count on success.
+     *
+     * @retval  CHIP_NO_ERROR   Success: all the messages are queued for transmit.
+     * @retval  other           Any error \c SendMsg may return, for the first message that could not be sent.
+     */
+    CHIP_ERROR SendMsgs(const IPPacketInfo * pktInfos, chip::System::PacketBufferHandle * msgs, size_t count, size_t & sentCount);
+
+    /**
+     * Set how many datagrams the endpoint may read from the network stack at once.
+     *
+     *  Endpoints that expect bursts of traffic can use this to reduce the number of system calls made per datagram.
+     *  Received messages are still delivered to \c OnMessageReceived one at a time. The size is capped at
+     *  \c INET_CONFIG_UDP_MAX_BATCH_SIZE, and is only a hint: platforms that cannot receive in batches ignore it.
+     *
+     * @param[in]   batchSize   The largest number of datagrams to read at once; 1 disables batching.
+     */
+    virtual void SetReceiveBatchSize(uint8_t batchSize) { (void) batchSize; }
+
     /**
      * Close the endpoint.
      *
@@ -296,6 +326,14 @@ protected:
     virtual CHIP_ERROR SendMsgImpl(const IPPacketInfo * pktInfo, chip::System::PacketBufferHandle && msg)                     = 0;
     virtual void CloseImpl()                                                                                                  = 0;
 
+    /**
+     * Send several messages, stopping at the first failure; \c sentCount starts at 0.
+     *
+     *  The default implementation calls \c SendMsgImpl for each message.
+     */
+    virtual CHIP_ERROR SendMsgsImpl(const IPPacketInfo * pktInfos, chip::System::PacketBufferHandle * msgs, size_t count,
+                                    size_t & sentCount);
+
     /**
      * Close the endpoint and recycle its memory.
      *
@@ -43,7 +43,9 @@
 #include "ZephyrSocket.h" // nogncheck
 #endif
 
+#include <algorithm>
 #include <cerrno>
+#include <cstring>
 #include <unistd.h>
 #include <utility>
 
@@ -277,39 +279,53 @@ CHIP_ERROR UDPEndPointImplSockets::ListenImpl()
     return layer->RequestCallbackOnPendingRead(mWatch);
 }
 
-CHIP_ERROR UDPEndPointImplSockets::SendMsgImpl(const IPPacketInfo * aPktInfo, System::PacketBufferHandle && msg)
+static_assert(INET_CONFIG_UDP_MAX_BATCH_SIZE >= 1 && INET_CONFIG_UDP_MAX_BATCH_SIZE <= UINT8_MAX,
+              "INET_CONFIG_UDP_MAX_BATCH_SIZE must be between 1 and 255");
+
+#if HAVE_RECVMMSG
+void UDPEndPointImplSockets::SetReceiveBatchSize(uint8_t batchSize)
 {
-    // Ensure packet buffer is not null
-    VerifyOrReturnError(!msg.IsNull(), CHIP_ERROR_INVALID_ARGUMENT);
+    // Buffers beyond the new size are freed on the next read, as they may hold messages still being delivered.
+    mReceiveBatchSize = std::clamp<uint8_t>(batchSize, 1, INET_CONFIG_UDP_MAX_BATCH_SIZE);
+}
+#endif // HAVE_RECVMMSG
 
-    // Make sure we have the appropriate type of socket based on the
-    // destination address.
-    ReturnErrorOnFailure(GetSocket(aPktInfo->DestAddress.Type()));
+// Storage for everything the header of a sent or received message points to.
+struct UDPEndPointImplSockets::MsgHeader
+{
+    MsgHeader()
+    {
+        memset(&mHeader, 0, sizeof(mHeader));
+        memset(&mPeerSockAddr, 0, sizeof(mPeerSockAddr));
+        mHeader.msg_name    = &mPeerSockAddr;
+        mHeader.msg_namelen = sizeof(mPeerSockAddr);
+        mHeader.msg_iov     = &mIOV;
+        mHeader.msg_iovlen  = 1;
+    }
+    MsgHeader(const MsgHeader &)             = delete;
+    MsgHeader & operator=(const MsgHeader &) = delete;
+
+    struct msghdr mHeader;
+    struct iovec mIOV;
+    SockAddr mPeerSockAddr;
+    uint8_t mControlData[256];
+};
 
+CHIP_ERROR UDPEndPointImplSockets::PrepareSendMsg(const IPPacketInfo * aPktInfo, const System::PacketBufferHandle & msg,
+                                                  MsgHeader & aMsgHeader)
+{
     // Ensure the destination address type is compatible with the endpoint address type.
     VerifyOrReturnError(mAddrType == aPktInfo->DestAddress.Type(), CHIP_ERROR_INVALID_ARGUMENT);
 
     // For now the entire message must fit within a single buffer.
     VerifyOrReturnError(!msg->HasChainedBuffer(), CHIP_ERROR_MESSAGE_TOO_LONG);
 
-    struct iovec msgIOV;
-    msgIOV.iov_base = msg->Start();
-    msgIOV.iov_len  = msg->DataLength();
-
-#if defined(IP_PKTINFO) || defined(IPV6_PKTINFO)
-    uint8_t controlData[256];
-    memset(controlData, 0, sizeof(controlData));
-#endif // defined(IP_PKTINFO) || defined(IPV6_PKTINFO)
-
-    struct msghdr msgHeader;
-    memset(&msgHeader, 0, sizeof(msgHeader));
-    msgHeader.msg_iov    = &msgIOV;
-    msgHeader.msg_iovlen = 1;
+    struct msghdr & msgHeader = aMsgHeader.mHeader;
+    aMsgHeader.mIOV.iov_base  = msg->Start();
+    aMsgHeader.mIOV.iov_len   = msg->DataLength();
 
     // Construct a sockaddr_in/sockaddr_in6 structure containing the destination information.
-    SockAddr peerSockAddr;
-    memset(&peerSockAddr, 0, sizeof(peerSockAddr));
-    msgHeader.msg_name = &peerSockAddr;
+    SockAddr & peerSockAddr = aMsgHeader.mPeerSockAddr;
     if (mAddrType == IPAddressType::kIPv6)
     {
         peerSockAddr.in6.sin6_family     = AF_INET6;
@@ -350,8 +366,9 @@ CHIP_ERROR UDPEndPointImplSockets::SendMsgImpl(const IPPacketInfo * aPktInfo, Sy
     if (intf.IsPresent() || aPktInfo->SrcAddress.Type() != IPAddressType::kAny)
     {
 #if defined(IP_PKTINFO) || defined(IPV6_PKTINFO)
-        msgHeader.msg_control    = controlData;
-        msgHeader.msg_controllen = sizeof(controlData);
+        memset(aMsgHeader.mControlData, 0, sizeof(aMsgHeader.mControlData));
+        msgHeader.msg_control    = aMsgHeader.mControlData;
+        msgHeader.msg_controllen = sizeof(aMsgHeader.mControlData);
 
         struct cmsghdr * controlHdr      = CMSG_FIRSTHDR(&msgHeader);
         InterfaceId::PlatformType intfId = intf.GetPlatformInterface();
@@ -409,9 +426,24 @@ CHIP_ERROR UDPEndPointImplSockets::SendMsgImpl(const IPPacketInfo * aPktInfo, Sy
     }
 #endif // INET_CONFIG_UDP_SOCKET_PKTINFO
 
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR UDPEndPointImplSockets::SendMsgImpl(const IPPacketInfo * aPktInfo, System::PacketBufferHandle && msg)
+{
+    // Ensure packet buffer is not null
+    VerifyOrReturnError(!msg.IsNull(), CHIP_ERROR_INVALID_ARGUMENT);
+
+    // Make sure we have the appropriate type of socket based on the
+    // destination address.
+    ReturnErrorOnFailure(GetSocket(aPktInfo->DestAddress.Type()));
+
+    MsgHeader msgHeader;
+    ReturnErrorOnFailure(PrepareSendMsg(aPktInfo, msg, msgHeader));
+
     // Send IP packet.
     // NOLINTNEXTLINE(clang-analyzer-unix.StdCLibraryFunctions): GetSocket calls ensure mSocket is valid
-    const ssize_t lenSent = sendmsg(mSocket, &msgHeader, 0);
+    const ssize_t lenSent = sendmsg(mSocket, &msgHeader.mHeader, 0);
     if (lenSent == -1)
     {
         return CHIP_ERROR_POSIX(errno);
@@ -426,6 +458,60 @@ CHIP_ERROR UDPEndPointImplSockets::SendMsgImpl(const IPPacketInfo * aPktInfo, Sy
     return CHIP_NO_ERROR;
 }
 
+#if HAVE_SENDMMSG
+CHIP_ERROR UDPEndPointImplSockets::SendMsgsImpl(const IPPacketInfo * aPktInfos, System::PacketBufferHandle * msgs, size_t count,
+                                                size_t & sentCount)
+{
+    MsgHeader msgHeaders[INET_CONFIG_UDP_MAX_BATCH_SIZE];
+    struct mmsghdr batch[INET_CONFIG_UDP_MAX_BATCH_SIZE];
+
+    while (sentCount < count)
+    {
+        // Prepare as many of the remaining messages as fit in one batch. A message that cannot be sent ends the batch, so
+        // that the messages before it still go out and its error is reported once they have.
+        CHIP_ERROR err    = CHIP_NO_ERROR;
+        size_t batchCount = 0;
+        for (; batchCount < MATTER_ARRAY_SIZE(batch) && sentCount + batchCount < count; batchCount++)
+        {
+            const IPPacketInfo & pktInfo           = aPktInfos[sentCount + batchCount];
+            const System::PacketBufferHandle & msg = msgs[sentCount + batchCount];
+
+            err = msg.IsNull() ? CHIP_ERROR_INVALID_ARGUMENT : GetSocket(pktInfo.DestAddress.Type());
+            if (err == CHIP_NO_ERROR)
+            {
+                err = PrepareSendMsg(&pktInfo, msg, msgHeaders[batchCount]);
+            }
+            if (err != CHIP_NO_ERROR)
+            {
+                break;
+            }
+
+            batch[batchCount].msg_hdr = msgHeaders[batchCount].mHeader;
+            batch[batchCount].msg_len = 0;
+        }
+        VerifyOrReturnError(batchCount > 0, err);
+
+        // sendmmsg only fails if it cannot send the first message of the batch. When it stops short of the end, the
+        // remaining messages go into the next batch, which either sends them or reports why they could not be sent.
+        // NOLINTNEXTLINE(clang-analyzer-unix.StdCLibraryFunctions): GetSocket calls ensure mSocket is valid
+        const int sent = sendmmsg(mSocket, batch, static_cast<unsigned int>(batchCount), 0);
+        if (sent == -1)
+        {
+            return CHIP_ERROR_POSIX(errno);
+        }
+        VerifyOrReturnError(sent > 0, CHIP_ERROR_INCORRECT_STATE);
+
+        for (int i = 0; i < sent; i++, sentCount++)
+        {
+            VerifyOrReturnError(batch[i].msg_len == msgs[sentCount]->DataLength(), CHIP_ERROR_OUTBOUND_MESSAGE_TOO_BIG);
+            msgs[sentCount] = nullptr;
+        }
+    }
+
+    return CHIP_NO_ERROR;
+}
+#endif // HAVE_SENDMMSG
+
 void UDPEndPointImplSockets::CloseImpl()
 {
     if (mSocket != kInvalidSocketFd)
@@ -434,6 +520,13 @@ void UDPEndPointImplSockets::CloseImpl()
         close(mSocket);
         mSocket = kInvalidSocketFd;
     }
+
+#if HAVE_RECVMMSG
+    for (auto & buffer : mReceiveBuffers)
+    {
+        buffer = nullptr;
+    }
+#endif // HAVE_RECVMMSG
 }
 
 CHIP_ERROR UDPEndPointImplSockets::GetSocket(IPAddressType addressType)
@@ -574,124 +667,167 @@ void UDPEndPointImplSockets::HandlePendingIO(System::SocketEvents events)
 
     // Prevent the endpoint from being freed while in the middle of a callback.
     UDPEndPointHandle ref(this);
-    CHIP_ERROR lStatus = CHIP_NO_ERROR;
-    IPPacketInfo lPacketInfo;
-    System::PacketBufferHandle lBuffer;
 
-    lPacketInfo.Clear();
-    lPacketInfo.DestPort  = mBoundPort;
-    lPacketInfo.Interface = mBoundIntfId;
+#if HAVE_RECVMMSG
+    // Also drain what is left of the receive buffers after batching was turned off.
+    if (mReceiveBatchSize > 1 || !mReceiveBuffers[0].IsNull())
+    {
+        ReceiveMsgs();
+        return;
+    }
+#endif // HAVE_RECVMMSG
 
-    lBuffer = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSizeWithoutReserve, 0);
+    IPPacketInfo lPacketInfo;
+    System::PacketBufferHandle lBuffer = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSizeWithoutReserve, 0);
+    VerifyOrReturn(!lBuffer.IsNull(), ReportReceiveError(CHIP_ERROR_NO_MEMORY));
 
-    if (!lBuffer.IsNull())
-    {
-        struct iovec msgIOV;
-        SockAddr lPeerSockAddr;
-        uint8_t controlData[256];
-        struct msghdr msgHeader;
+    MsgHeader msgHeader;
+    PrepareReceiveMsg(lBuffer, msgHeader);
 
-        msgIOV.iov_base = lBuffer->Start();
-        msgIOV.iov_len  = lBuffer->AvailableDataLength();
+    ssize_t rcvLen = recvmsg(mSocket, &msgHeader.mHeader, MSG_DONTWAIT);
+    VerifyOrReturn(rcvLen != -1, ReportReceiveError(CHIP_ERROR_POSIX(errno)));
 
-        memset(&lPeerSockAddr, 0, sizeof(lPeerSockAddr));
+    CHIP_ERROR lStatus = ParseReceivedMsg(msgHeader.mHeader, static_cast<size_t>(rcvLen), lBuffer, lPacketInfo);
+    VerifyOrReturn(lStatus == CHIP_NO_ERROR, ReportReceiveError(lStatus));
 
-        memset(&msgHeader, 0, sizeof(msgHeader));
+    lBuffer.RightSize();
+    OnMessageReceived(this, std::move(lBuffer), &lPacketInfo);
+}
 
-        msgHeader.msg_name       = &lPeerSockAddr;
-        msgHeader.msg_namelen    = sizeof(lPeerSockAddr);
-        msgHeader.msg_iov        = &msgIOV;
-        msgHeader.msg_iovlen     = 1;
-        msgHeader.msg_control    = controlData;
-        msgHeader.msg_controllen = sizeof(controlData);
+#if HAVE_RECVMMSG
+void UDPEndPointImplSockets::ReceiveMsgs()
+{
+    MsgHeader msgHeaders[INET_CONFIG_UDP_MAX_BATCH_SIZE];
+    struct mmsghdr batch[INET_CONFIG_UDP_MAX_BATCH_SIZE];
 
-        ssize_t rcvLen = recvmsg(mSocket, &msgHeader, MSG_DONTWAIT);
+    for (size_t i = mReceiveBatchSize; i < MATTER_ARRAY_SIZE(mReceiveBuffers); i++)
+    {
+        mReceiveBuffers[i] = nullptr;
+    }
 
-        if (rcvLen == -1)
+    // Replace the buffers that were handed out by the previous batch. When memory is short, receive into those
+    // that could be allocated.
+    size_t batchCount = 0;
+    for (; batchCount < mReceiveBatchSize; batchCount++)
+    {
+        System::PacketBufferHandle & buffer = mReceiveBuffers[batchCount];
+        if (buffer.IsNull())
         {
-            lStatus = CHIP_ERROR_POSIX(errno);
+            buffer = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSizeWithoutReserve, 0);
+            if (buffer.IsNull())
+            {
+                break;
+            }
         }
-        else if (lBuffer->AvailableDataLength() < static_cast<size_t>(rcvLen))
+        PrepareReceiveMsg(buffer, msgHeaders[batchCount]);
+        batch[batchCount].msg_hdr = msgHeaders[batchCount].mHeader;
+        batch[batchCount].msg_len = 0;
+    }
+    VerifyOrReturn(batchCount > 0, ReportReceiveError(CHIP_ERROR_NO_MEMORY));
+
+    const int received = recvmmsg(mSocket, batch, static_cast<unsigned int>(batchCount), MSG_DONTWAIT, nullptr);
+    VerifyOrReturn(received != -1, ReportReceiveError(CHIP_ERROR_POSIX(errno)));
+
+    for (int i = 0; i < received; i++)
+    {
+        // A callback may have closed the endpoint, which also frees the buffers holding the rest of the batch.
+        VerifyOrReturn(mState == State::kListening && OnMessageReceived != nullptr);
+
+        IPPacketInfo packetInfo;
+        System::PacketBufferHandle buffer = std::move(mReceiveBuffers[i]);
+        CHIP_ERROR status                 = ParseReceivedMsg(batch[i].msg_hdr, batch[i].msg_len, buffer, packetInfo);
+        if (status != CHIP_NO_ERROR)
         {
-            lStatus = CHIP_ERROR_INBOUND_MESSAGE_TOO_BIG;
+            ReportReceiveError(status);
+            continue;
         }
-        else
-        {
-            lBuffer->SetDataLength(static_cast<uint16_t>(rcvLen));
 
-            if (lPeerSockAddr.any.sa_family == AF_INET6)
-            {
-                lPacketInfo.SrcAddress = IPAddress(lPeerSockAddr.in6.sin6_addr);
-                lPacketInfo.SrcPort    = ntohs(lPeerSockAddr.in6.sin6_port);
-            }
+        buffer.RightSize();
+        OnMessageReceived(this, std::move(buffer), &packetInfo);
+    }
+}
+#endif // HAVE_RECVMMSG
+
+void UDPEndPointImplSockets::PrepareReceiveMsg(const System::PacketBufferHandle & aBuffer, MsgHeader & aMsgHeader)
+{
+    aMsgHeader.mIOV.iov_base = aBuffer->Start();
+    aMsgHeader.mIOV.iov_len  = aBuffer->AvailableDataLength();
+
+    aMsgHeader.mHeader.msg_namelen    = sizeof(aMsgHeader.mPeerSockAddr);
+    aMsgHeader.mHeader.msg_control    = aMsgHeader.mControlData;
+    aMsgHeader.mHeader.msg_controllen = sizeof(aMsgHeader.mControlData);
+}
+
+CHIP_ERROR UDPEndPointImplSockets::ParseReceivedMsg(struct msghdr & aMsgHeader, size_t aLength, System::PacketBufferHandle & aBuffer,
+                                                    IPPacketInfo & aPacketInfo)
+{
+    aPacketInfo.Clear();
+    aPacketInfo.DestPort  = mBoundPort;
+    aPacketInfo.Interface = mBoundIntfId;
+
+    VerifyOrReturnError(aLength <= aBuffer->AvailableDataLength(), CHIP_ERROR_INBOUND_MESSAGE_TOO_BIG);
+    aBuffer->SetDataLength(static_cast<uint16_t>(aLength));
+
+    const SockAddr & peerSockAddr = *static_cast<const SockAddr *>(aMsgHeader.msg_name);
+    if (peerSockAddr.any.sa_family == AF_INET6)
+    {
+        aPacketInfo.SrcAddress = IPAddress(peerSockAddr.in6.sin6_addr);
+        aPacketInfo.SrcPort    = ntohs(peerSockAddr.in6.sin6_port);
+    }
 #if INET_CONFIG_ENABLE_IPV4
-            else if (lPeerSockAddr.any.sa_family == AF_INET)
-            {
-                lPacketInfo.SrcAddress = IPAddress(lPeerSockAddr.in.sin_addr);
-                lPacketInfo.SrcPort    = ntohs(lPeerSockAddr.in.sin_port);
-            }
+    else if (peerSockAddr.any.sa_family == AF_INET)
+    {
+        aPacketInfo.SrcAddress = IPAddress(peerSockAddr.in.sin_addr);
+        aPacketInfo.SrcPort    = ntohs(peerSockAddr.in.sin_port);
+    }
 #endif // INET_CONFIG_ENABLE_IPV4
-            else
-            {
-                lStatus = CHIP_ERROR_INCORRECT_STATE;
-            }
-        }
+    else
+    {
+        return CHIP_ERROR_INCORRECT_STATE;
+    }
 
-        if (lStatus == CHIP_NO_ERROR)
-        {
-            for (struct cmsghdr * controlHdr = CMSG_FIRSTHDR(&msgHeader); controlHdr != nullptr;
-                 controlHdr                  = CMSG_NXTHDR(&msgHeader, controlHdr))
-            {
+    for (struct cmsghdr * controlHdr = CMSG_FIRSTHDR(&aMsgHeader); controlHdr != nullptr;
+         controlHdr                  = CMSG_NXTHDR(&aMsgHeader, controlHdr))
+    {
 #if INET_CONFIG_ENABLE_IPV4
 #ifdef IP_PKTINFO
-                if (controlHdr->cmsg_level == IPPROTO_IP && controlHdr->cmsg_type == IP_PKTINFO)
-                {
-                    auto * inPktInfo = reinterpret_cast<struct in_pktinfo *> CMSG_DATA(controlHdr);
-                    if (!CanCastTo<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex))
-                    {
-                        lStatus = CHIP_ERROR_INCORRECT_STATE;
-                        break;
-                    }
-                    lPacketInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex));
-                    lPacketInfo.DestAddress = IPAddress(inPktInfo->ipi_addr);
-                    continue;
-                }
+        if (controlHdr->cmsg_level == IPPROTO_IP && controlHdr->cmsg_type == IP_PKTINFO)
+        {
+            auto * inPktInfo = reinterpret_cast<struct in_pktinfo *> CMSG_DATA(controlHdr);
+            if (!CanCastTo<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex))
+            {
+                return CHIP_ERROR_INCORRECT_STATE;
+            }
+            aPacketInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex));
+            aPacketInfo.DestAddress = IPAddress(inPktInfo->ipi_addr);
+            continue;
+        }
 #endif // defined(IP_PKTINFO)
 #endif // INET_CONFIG_ENABLE_IPV4
 
 #ifdef IPV6_PKTINFO
-                if (controlHdr->cmsg_level == IPPROTO_IPV6 && controlHdr->cmsg_type == IPV6_PKTINFO)
-                {
-                    auto * in6PktInfo = reinterpret_cast<struct in6_pktinfo *> CMSG_DATA(controlHdr);
-                    if (!CanCastTo<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex))
-                    {
-                        lStatus = CHIP_ERROR_INCORRECT_STATE;
-                        break;
-                    }
-                    lPacketInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex));
-                    lPacketInfo.DestAddress = IPAddress(in6PktInfo->ipi6_addr);
-                    continue;
-                }
-#endif // defined(IPV6_PKTINFO)
+        if (controlHdr->cmsg_level == IPPROTO_IPV6 && controlHdr->cmsg_type == IPV6_PKTINFO)
+        {
+            auto * in6PktInfo = reinterpret_cast<struct in6_pktinfo *> CMSG_DATA(controlHdr);
+            if (!CanCastTo<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex))
+            {
+                return CHIP_ERROR_INCORRECT_STATE;
             }
+            aPacketInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex));
+            aPacketInfo.DestAddress = IPAddress(in6PktInfo->ipi6_addr);
+            continue;
         }
-    }
-    else
-    {
-        lStatus = CHIP_ERROR_NO_MEMORY;
+#endif // defined(IPV6_PKTINFO)
     }
 
-    if (lStatus == CHIP_NO_ERROR)
-    {
-        lBuffer.RightSize();
-        OnMessageReceived(this, std::move(lBuffer), &lPacketInfo);
-    }
-    else
+    return CHIP_NO_ERROR;
+}
+
+void UDPEndPointImplSockets::ReportReceiveError(CHIP_ERROR aError)
+{
+    if (OnReceiveError != nullptr && aError != CHIP_ERROR_POSIX(EAGAIN))
     {
-        if (OnReceiveError != nullptr && lStatus != CHIP_ERROR_POSIX(EAGAIN))
-        {
-            OnReceiveError(this, lStatus, nullptr);
-        }
+        OnReceiveError(this, aError, nullptr);
     }
 }
 
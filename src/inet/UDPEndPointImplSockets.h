@@ -40,6 +40,9 @@ public:
     CHIP_ERROR SetMulticastLoopback(IPVersion aIPVersion, bool aLoopback) override;
     InterfaceId GetBoundInterface() const override;
     uint16_t GetBoundPort() const override;
+#if HAVE_RECVMMSG
+    void SetReceiveBatchSize(uint8_t batchSize) override;
+#endif // HAVE_RECVMMSG
 
 private:
     // UDPEndPoint overrides.
@@ -51,15 +54,35 @@ private:
     CHIP_ERROR BindInterfaceImpl(IPAddressType addressType, InterfaceId interfaceId) override;
     CHIP_ERROR ListenImpl() override;
     CHIP_ERROR SendMsgImpl(const IPPacketInfo * pktInfo, chip::System::PacketBufferHandle && msg) override;
+#if HAVE_SENDMMSG
+    CHIP_ERROR SendMsgsImpl(const IPPacketInfo * pktInfos, chip::System::PacketBufferHandle * msgs, size_t count,
+                            size_t & sentCount) override;
+#endif // HAVE_SENDMMSG
     void CloseImpl() override;
 
+    struct MsgHeader;
+
     CHIP_ERROR GetSocket(IPAddressType addressType);
+    CHIP_ERROR PrepareSendMsg(const IPPacketInfo * pktInfo, const System::PacketBufferHandle & msg, MsgHeader & msgHeader);
     void HandlePendingIO(System::SocketEvents events);
     static void HandlePendingIO(System::SocketEvents events, intptr_t data);
+#if HAVE_RECVMMSG
+    void ReceiveMsgs();
+#endif // HAVE_RECVMMSG
+    void PrepareReceiveMsg(const System::PacketBufferHandle & buffer, MsgHeader & msgHeader);
+    CHIP_ERROR ParseReceivedMsg(struct msghdr & msgHeader, size_t length, System::PacketBufferHandle & buffer,
+                                IPPacketInfo & packetInfo);
+    void ReportReceiveError(CHIP_ERROR error);
 
     InterfaceId mBoundIntfId;
     uint16_t mBoundPort;
 
+#if HAVE_RECVMMSG
+    // Buffers that batched receives read into. Those handed out with a received message are replaced before the next read.
+    System::PacketBufferHandle mReceiveBuffers[INET_CONFIG_UDP_MAX_BATCH_SIZE];
+    uint8_t mReceiveBatchSize = 1;
+#endif // HAVE_RECVMMSG
+
 #if CHIP_SYSTEM_CONFIG_USE_PLATFORM_MULTICAST_API
 public:
     enum class MulticastOperation
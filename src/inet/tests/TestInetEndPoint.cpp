@@ -378,6 +378,73 @@ TEST_F(TestInetEndPoint, TestInetEndPointInternal)
 #endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
 }
 
+struct UDPBatchReceiveState
+{
+    uint8_t received = 0;
+    bool inOrder     = true;
+};
+
+void HandleBatchedUDPMessage(UDPEndPoint * endPoint, PacketBufferHandle && msg, const IPPacketInfo * pktInfo)
+{
+    auto * state = static_cast<UDPBatchReceiveState *>(endPoint->mAppState);
+    state->inOrder &= (msg->DataLength() == 1 && msg->Start()[0] == state->received);
+    state->received++;
+}
+
+// Test sending and receiving UDP messages in batches over the loopback interface.
+TEST_F(TestInetEndPoint, TestInetUDPBatches)
+{
+    constexpr uint8_t kMessageCount = 3 * INET_CONFIG_UDP_MAX_BATCH_SIZE + 1;
+
+    UDPEndPointHandle receiver;
+    UDPEndPointHandle sender;
+    UDPBatchReceiveState state;
+
+    ASSERT_EQ(gUDP.NewEndPoint(receiver), CHIP_NO_ERROR);
+    ASSERT_EQ(gUDP.NewEndPoint(sender), CHIP_NO_ERROR);
+    ASSERT_EQ(receiver->Bind(IPAddressType::kIPv6, IPAddress::Loopback(IPAddressType::kIPv6), 0), CHIP_NO_ERROR);
+    ASSERT_EQ(receiver->Listen(HandleBatchedUDPMessage, nullptr /*OnReceiveError*/, &state), CHIP_NO_ERROR);
+    receiver->SetReceiveBatchSize(INET_CONFIG_UDP_MAX_BATCH_SIZE);
+    ASSERT_EQ(sender->Bind(IPAddressType::kIPv6, IPAddress::Loopback(IPAddressType::kIPv6), 0), CHIP_NO_ERROR);
+
+    IPPacketInfo pktInfos[kMessageCount];
+    PacketBufferHandle msgs[kMessageCount];
+    for (uint8_t i = 0; i < kMessageCount; i++)
+    {
+        pktInfos[i].Clear();
+        pktInfos[i].DestAddress = IPAddress::Loopback(IPAddressType::kIPv6);
+        pktInfos[i].DestPort    = receiver->GetBoundPort();
+        msgs[i]                 = PacketBufferHandle::NewWithData(&i, sizeof(i));
+        ASSERT_FALSE(msgs[i].IsNull());
+    }
+
+    size_t sentCount = 0;
+    EXPECT_EQ(sender->SendMsgs(pktInfos, msgs, kMessageCount, sentCount), CHIP_NO_ERROR);
+    EXPECT_EQ(sentCount, kMessageCount);
+    for (const auto & msg : msgs)
+    {
+        EXPECT_TRUE(msg.IsNull());
+    }
+
+    for (int i = 0; i < 100 && state.received < kMessageCount; i++)
+    {
+        ServiceEvents(10);
+    }
+    EXPECT_EQ(state.received, kMessageCount);
+    EXPECT_TRUE(state.inOrder);
+
+    // Sending stops at the first message that cannot be sent, and leaves those after it untouched.
+    msgs[0] = PacketBufferHandle::NewWithData("a", 1);
+    msgs[2] = PacketBufferHandle::NewWithData("c", 1);
+    EXPECT_EQ(sender->SendMsgs(pktInfos, msgs, 3, sentCount), CHIP_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(sentCount, 1u);
+    EXPECT_TRUE(msgs[0].IsNull());
+    EXPECT_FALSE(msgs[2].IsNull());
+
+    receiver.Release();
+    sender.Release();
+}
+
 #if !CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
 // Test the Inet resource limitations.
 TEST_F(TestInetEndPoint, TestInetEndPointLimit)
@@ -35,6 +35,7 @@ void NodeLookupHandle::ResetForLookup(System::Clock::Timestamp now, const NodeLo
     mRequestStartTime = now;
     mRequest          = request;
     mResults          = NodeLookupResults();
+    mResultsComplete  = false;
 }
 
 void NodeLookupHandle::LookupResult(const ResolveResult & result)
@@ -66,7 +67,7 @@ System::Clock::Timeout NodeLookupHandle::NextEventTimeout(System::Clock::Timesta
 {
     const System::Clock::Timestamp elapsed = now - mRequestStartTime;
 
-    if (elapsed < mRequest.GetMinLookupTime())
+    if (elapsed < mRequest.GetMinLookupTime() && !mResultsComplete)
     {
         return mRequest.GetMinLookupTime() - elapsed;
     }
@@ -104,8 +105,9 @@ NodeLookupAction NodeLookupHandle::NextAction(System::Clock::Timestamp now)
     ChipLogProgress(Discovery, "Checking node lookup status for " ChipLogFormatPeerId " after %lu ms",
                     ChipLogValuePeerId(mRequest.GetPeerId()), static_cast<unsigned long>(elapsed.count()));
 
-    // We are still within the minimal search time. Wait for more results.
-    if (elapsed < mRequest.GetMinLookupTime())
+    // We are still within the minimal search time. Wait for more results, unless
+    // the results are already known to be complete.
+    if (elapsed < mRequest.GetMinLookupTime() && !mResultsComplete)
     {
         ChipLogProgress(Discovery, "Keeping DNSSD lookup active");
         return NodeLookupAction::KeepSearching();
@@ -331,6 +333,12 @@ void Resolver::OnOperationalNodeResolved(const Dnssd::ResolvedNodeData & nodeDat
             current->LookupResult(result);
         }
 
+        if (nodeData.fromCache)
+        {
+            // Cached data holds all the addresses of a previous resolution: no more are expected.
+            current->MarkResultsComplete();
+        }
+
         HandleAction(current);
     }
 
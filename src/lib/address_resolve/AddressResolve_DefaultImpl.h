@@ -136,6 +136,11 @@ public:
     /// Mark that a specific IP address has been found
     void LookupResult(const ResolveResult & result);
 
+    /// Mark that the results found so far are complete (e.g. they were answered
+    /// from previously received records), so that they can be used without
+    /// waiting for the minimal lookup time.
+    void MarkResultsComplete() { mResultsComplete = true; }
+
     /// Called after timeouts or after a series of IP addresses have been
     /// marked as found.
     ///
@@ -161,6 +166,7 @@ private:
     NodeLookupResults mResults;
     NodeLookupRequest mRequest; // active request to process
     System::Clock::Timestamp mRequestStartTime;
+    bool mResultsComplete = false;
 };
 
 class Resolver : public ::chip::AddressResolve::Resolver, public Dnssd::OperationalResolveDelegate
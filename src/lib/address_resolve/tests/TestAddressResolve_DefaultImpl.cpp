@@ -494,6 +494,43 @@ TEST(TestAddressResolveDefaultImpl, TestReturnsFoundResultAfterMinLookupTimeIsRe
     EXPECT_EQ(action.ResolveResult().address, lowResult.address);
 }
 
+TEST(TestAddressResolveDefaultImpl, TestReturnsCompleteResultBeforeMinLookupTimeIsReached)
+{
+    AddressResolve::NodeLookupHandle handle;
+
+    System::Clock::Internal::RAIIMockClock clock;
+
+    ResolveResult lowResult;
+    lowResult.address = GetAddressWithLowScore(static_cast<uint16_t>(1));
+
+    /// now = 0
+    auto now     = System::SystemClock().GetMonotonicTimestamp();
+    auto request = NodeLookupRequest(chip::PeerId(1, 2));
+
+    request.SetMinLookupTime(100_ms32);
+    request.SetMaxLookupTime(200_ms32);
+
+    handle.ResetForLookup(now, request);
+
+    // results answered from a cache are complete
+    handle.LookupResult(lowResult);
+    handle.MarkResultsComplete();
+
+    // timeout should be consumed now, even though the min lookup time is not yet reached
+    EXPECT_EQ(handle.NextEventTimeout(now), 0_ms64);
+
+    auto action = handle.NextAction(now);
+    // should inform success in searching
+    EXPECT_EQ(action.Type(), chip::AddressResolve::Impl::NodeLookupResult::kLookupSuccess);
+    // and return the result
+    EXPECT_EQ(action.ResolveResult().address, lowResult.address);
+
+    // a new lookup waits for the min lookup time again
+    handle.ResetForLookup(now, request);
+    handle.LookupResult(lowResult);
+    EXPECT_EQ(handle.NextAction(now).Type(), chip::AddressResolve::Impl::NodeLookupResult::kKeepSearching);
+}
+
 TEST(TestAddressResolveDefaultImpl, TestGivesUpAfterMaxLookupTimeIsReachedWithoutResults)
 {
     AddressResolve::NodeLookupHandle handle;
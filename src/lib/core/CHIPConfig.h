@@ -287,6 +287,22 @@
 #define CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS 16
 #endif // CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS
 
+/**
+ *  @def CHIP_CONFIG_EXCHANGE_LOOKUP_BUCKETS
+ *
+ *  @brief
+ *    Number of hash buckets used by the exchange manager to find the exchange
+ *    context a received message belongs to.
+ *
+ *    Each bucket is a pointer. Devices whose exchange contexts are heap
+ *    allocated and may greatly exceed CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS
+ *    (e.g. controllers) may want to increase this.
+ *
+ */
+#ifndef CHIP_CONFIG_EXCHANGE_LOOKUP_BUCKETS
+#define CHIP_CONFIG_EXCHANGE_LOOKUP_BUCKETS CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS
+#endif // CHIP_CONFIG_EXCHANGE_LOOKUP_BUCKETS
+
 /**
  *  @def CHIP_CONFIG_MCSP_RECEIVE_TABLE_SIZE
  *
@@ -792,6 +808,22 @@
 #define CHIP_CONFIG_MAX_FABRICS 16
 #endif // CHIP_CONFIG_MAX_FABRICS
 
+/**
+ *  @def CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE
+ *
+ *  @brief
+ *    Number of validated operational certificate chains remembered by the
+ *    fabric table, so that peers re-establishing CASE sessions do not have
+ *    their whole chain decoded and verified again.  Set to 0 to disable.
+ */
+#ifndef CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+#define CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE 8
+#else
+#define CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE 2
+#endif
+#endif // CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE
+
 /**
  * @def CHIP_CONFIG_SECURE_SESSION_POOL_SIZE
  *
@@ -899,6 +931,8 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
  *      * #CHIP_IM_MAX_REPORTS_IN_FLIGHT
  *      * #CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS
  *      * #CHIP_IM_SERVER_MAX_NUM_DIRTY_SET
+ *      * #CHIP_IM_SERVER_REPORT_CACHE_SIZE
+ *      * #CHIP_IM_SERVER_REPORT_CACHE_MAX_ENTRIES
  *      * #CHIP_IM_MAX_NUM_WRITE_HANDLER
  *      * #CHIP_IM_MAX_NUM_WRITE_CLIENT
  *      * #CHIP_IM_MAX_NUM_TIMED_HANDLER
@@ -971,11 +1005,39 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
  * @def CHIP_IM_SERVER_MAX_NUM_DIRTY_SET
  *
  * @brief Defines the maximum number of dirty set, limits the number of attributes being read or subscribed at the same time.
+ *
+ * Once the dirty set is full, dirty paths are coalesced into wildcard paths, which makes reports less precise. Lookups in the
+ * dirty set do not depend on its size, so devices with many frequently changing attributes (e.g. bridges) can raise this at
+ * the cost of about 32 bytes of RAM per entry. Host platforms (Linux, Darwin, Android, Tizen, webOS, NuttX) raise it in their
+ * CHIPPlatformConfig.h.
  */
 #ifndef CHIP_IM_SERVER_MAX_NUM_DIRTY_SET
 #define CHIP_IM_SERVER_MAX_NUM_DIRTY_SET 8
 #endif
 
+/**
+ * @def CHIP_IM_SERVER_REPORT_CACHE_SIZE
+ *
+ * @brief Size in bytes of the buffer holding encoded attribute reports shared between read handlers.
+ *
+ * Within a run of the reporting engine, read handlers reporting the same attribute (same data version, same accessing fabric
+ * and fabric filtering) copy the report encoded for the first of them instead of reading and encoding the attribute again.
+ * This mostly helps devices with many subscribers to the same attributes, e.g. bridges. Disabled (0) by default; host
+ * platforms enable it in their CHIPPlatformConfig.h.
+ */
+#ifndef CHIP_IM_SERVER_REPORT_CACHE_SIZE
+#define CHIP_IM_SERVER_REPORT_CACHE_SIZE 0
+#endif
+
+/**
+ * @def CHIP_IM_SERVER_REPORT_CACHE_MAX_ENTRIES
+ *
+ * @brief Maximum number of attribute reports held by the cache sized by #CHIP_IM_SERVER_REPORT_CACHE_SIZE.
+ */
+#ifndef CHIP_IM_SERVER_REPORT_CACHE_MAX_ENTRIES
+#define CHIP_IM_SERVER_REPORT_CACHE_MAX_ENTRIES 0
+#endif
+
 /**
  * @def CHIP_IM_MAX_NUM_WRITE_HANDLER
  *
@@ -1111,6 +1173,33 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_DEVICE_MAX_ACTIVE_DEVICES 4
 #endif
 
+/**
+ * @def CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES
+ *
+ * @brief Number of incoming CASE handshakes the CASE server can process
+ *        simultaneously. Sigma1 messages received while all of them are in
+ *        progress are answered with a busy status report.
+ *
+ *        The secure session backing the first handshake is reserved up front;
+ *        the others are allocated when their Sigma1 is received. Platforms
+ *        with the RAM for more handshakes raise this in their
+ *        CHIPPlatformConfig.h.
+ */
+#ifndef CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES
+#define CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES 1
+#endif // CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES
+
+/**
+ * @def CHIP_CONFIG_CASE_SERVER_MAX_HANDSHAKES_PER_PEER
+ *
+ * @brief Number of incoming CASE handshakes that can be in progress at the
+ *        same time from a single peer address, so that one peer cannot occupy
+ *        all the handshakes of CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES.
+ */
+#ifndef CHIP_CONFIG_CASE_SERVER_MAX_HANDSHAKES_PER_PEER
+#define CHIP_CONFIG_CASE_SERVER_MAX_HANDSHAKES_PER_PEER 1
+#endif
+
 /**
  * @def CHIP_CONFIG_MAX_GROUP_ENDPOINTS_PER_FABRIC
  *
@@ -1172,6 +1261,22 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_MAX_GROUP_CONCURRENT_ITERATORS 2
 #endif
 
+/**
+ * @def CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE
+ *
+ * @brief Defines the number of group operational keys that can be held in the RAM index used to
+ *        resolve the session ID of an incoming group message to its candidate keys.
+ *
+ * The index takes one entry, holding a pair of session keystore key handles, per epoch key of each
+ * key set mapped to a group, however many groups the key set is mapped to. The default covers the
+ * three epoch keys of every key set but the IPK on every fabric. When more keys are installed than
+ * fit in the index, or the keystore cannot create that many keys, the candidates are looked up from
+ * persistent storage instead. Setting this to 0 removes the index.
+ */
+#ifndef CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE
+#define CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE (CHIP_CONFIG_MAX_FABRICS * (CHIP_CONFIG_MAX_GROUP_KEYS_PER_FABRIC - 1) * 3)
+#endif
+
 /**
  * @def CHIP_CONFIG_MAX_GROUP_NAME_LENGTH
  *
@@ -1283,6 +1388,32 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
     "Please enable at least one of CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_FAST_COPY_SUPPORT or CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_FLEXIBLE_COPY_SUPPORT"
 #endif
 
+/**
+ * @def CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_INDEXED_CHECK
+ *
+ * Answer access control checks in the example access control implementation
+ * from an index of the entries, keyed by fabric, auth mode and subject,
+ * instead of walking every entry through the entry and iterator delegates.
+ *
+ * The index is rebuilt on the first check after the access control list
+ * changes. It needs storage for one key per subject of every entry.
+ */
+#ifndef CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_INDEXED_CHECK
+#define CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_INDEXED_CHECK 1
+#endif
+
+/**
+ * @def CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_CHECK_CACHE_SIZE
+ *
+ * Number of recent access control decisions remembered by the indexed check
+ * of the example access control implementation, keyed by subject descriptor,
+ * endpoint, cluster and privilege. Decisions are forgotten whenever the
+ * access control list changes. Set to 0 to disable.
+ */
+#ifndef CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_CHECK_CACHE_SIZE
+#define CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_CHECK_CACHE_SIZE 32
+#endif
+
 /**
  * @def CHIP_CONFIG_ACCESS_RESTRICTION_MAX_ENTRIES_PER_FABRIC
  *
@@ -1334,6 +1465,26 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_EVENT_LOGGING_BYTE_THRESHOLD 512
 #endif /* CHIP_CONFIG_EVENT_LOGGING_BYTE_THRESHOLD */
 
+/**
+ * @def CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE
+ *
+ * @brief The number of most recently logged events that each event logging
+ *   buffer keeps the position of.
+ *
+ * Subscriptions that are at most this many events behind can skip straight
+ * to the events they have not seen yet instead of parsing the whole buffer
+ * each time a report is generated.  Each entry takes 16 bytes of RAM per
+ * event logging buffer.
+ *
+ */
+#ifndef CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE
+#define CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE 8
+#endif /* CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE */
+
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE < 1
+#error "CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE must be at least 1"
+#endif
+
 /**
  * @def CHIP_CONFIG_ENABLE_SERVER_IM_EVENT
  *
@@ -1457,6 +1608,21 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_MINMDNS_MAX_PARALLEL_RESOLVES 2
 #endif // CHIP_CONFIG_MINMDNS_MAX_PARALLEL_RESOLVES
 
+/*
+ * @def CHIP_CONFIG_MINMDNS_RESOLVE_CACHE_SIZE
+ *
+ * @brief Determines the number of operational node resolutions that the minmdns
+ *        resolver keeps while the records they were built from are valid.
+ *
+ *        Cached resolutions (including the ones built from unsolicited
+ *        announcements) are used to answer operational resolves without waiting
+ *        for a query round trip. Controllers that connect to many nodes should
+ *        increase this value.
+ */
+#ifndef CHIP_CONFIG_MINMDNS_RESOLVE_CACHE_SIZE
+#define CHIP_CONFIG_MINMDNS_RESOLVE_CACHE_SIZE 4
+#endif // CHIP_CONFIG_MINMDNS_RESOLVE_CACHE_SIZE
+
 /**
  * def CHIP_CONFIG_MDNS_RESOLVE_LOOKUP_RESULTS
  *
@@ -129,6 +129,7 @@ CHIP_ERROR StoredServerName::Set(SerializedQNameIterator value)
         return CHIP_ERROR_NO_MEMORY;
     }
 
+    mHash = HashQName(Get());
     return CHIP_NO_ERROR;
 }
 
@@ -145,6 +146,8 @@ CHIP_ERROR IncrementalResolver::InitializeParsing(mdns::Minimal::SerializedQName
     ReturnErrorOnFailure(mRecordName.Set(name));
     ReturnErrorOnFailure(mTargetHostName.Set(srv.GetName()));
     mCommonResolutionData.port = srv.GetPort();
+    mTtlSeconds                = UINT32_MAX;
+    UpdateTtl(ttl);
 
     {
         // TODO: Chip code historically seems to assume that the host name is of the
@@ -248,7 +251,9 @@ CHIP_ERROR IncrementalResolver::OnRecord(Inet::InterfaceId interface, const Reso
             MATTER_TRACE_INSTANT("TXT not applicable", "Resolver");
             return CHIP_NO_ERROR;
         }
-        return OnTxtRecord(data, packetRange);
+        ReturnErrorOnFailure(OnTxtRecord(data, packetRange));
+        UpdateTtl(data.GetTtlSeconds());
+        return CHIP_NO_ERROR;
     case QType::A: {
         if (data.GetName() != mTargetHostName.Get())
         {
@@ -263,7 +268,9 @@ CHIP_ERROR IncrementalResolver::OnRecord(Inet::InterfaceId interface, const Reso
             return CHIP_ERROR_INVALID_ARGUMENT;
         }
 
-        return OnIpAddress(interface, addr);
+        ReturnErrorOnFailure(OnIpAddress(interface, addr));
+        UpdateTtl(data.GetTtlSeconds());
+        return CHIP_NO_ERROR;
 #else
 #if CHIP_MINMDNS_HIGH_VERBOSITY
         ChipLogProgress(Discovery, "Ignoring A record: IPv4 not supported");
@@ -285,7 +292,9 @@ CHIP_ERROR IncrementalResolver::OnRecord(Inet::InterfaceId interface, const Reso
             return CHIP_ERROR_INVALID_ARGUMENT;
         }
 
-        return OnIpAddress(interface, addr);
+        ReturnErrorOnFailure(OnIpAddress(interface, addr));
+        UpdateTtl(data.GetTtlSeconds());
+        return CHIP_NO_ERROR;
     }
     case QType::SRV: // SRV handled on creation, ignored for 'additional data'
     default:
@@ -296,6 +305,23 @@ CHIP_ERROR IncrementalResolver::OnRecord(Inet::InterfaceId interface, const Reso
     return CHIP_NO_ERROR;
 }
 
+bool IncrementalResolver::MayUseRecord(QType type, uint32_t nameHash) const
+{
+    VerifyOrReturnValue(IsActive(), false);
+
+    switch (type)
+    {
+    case QType::TXT:
+        return nameHash == mRecordName.GetHash();
+    case QType::A:
+    case QType::AAAA:
+        return nameHash == mTargetHostName.GetHash();
+    default:
+        // Other types not interesting during parsing
+        return false;
+    }
+}
+
 CHIP_ERROR IncrementalResolver::OnTxtRecord(const ResourceData & data, BytesRange packetRange)
 {
     {
@@ -318,6 +344,14 @@ CHIP_ERROR IncrementalResolver::OnTxtRecord(const ResourceData & data, BytesRang
     return CHIP_NO_ERROR;
 }
 
+void IncrementalResolver::UpdateTtl(uint64_t ttlSeconds)
+{
+    if (ttlSeconds < mTtlSeconds)
+    {
+        mTtlSeconds = static_cast<uint32_t>(ttlSeconds);
+    }
+}
+
 CHIP_ERROR IncrementalResolver::OnIpAddress(Inet::InterfaceId interface, const Inet::IPAddress & addr)
 {
     if (mCommonResolutionData.numIPs >= MATTER_ARRAY_SIZE(mCommonResolutionData.ipAddress))
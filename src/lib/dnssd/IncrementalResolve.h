@@ -37,7 +37,11 @@ class StoredServerName
 public:
     StoredServerName() {}
 
-    void Clear() { memset(mNameBuffer, 0, sizeof(mNameBuffer)); }
+    void Clear()
+    {
+        memset(mNameBuffer, 0, sizeof(mNameBuffer));
+        mHash = 0;
+    }
 
     /// Set the underlying value. Will return CHIP_ERROR_NO_MEMORY
     /// on insufficient storage space.
@@ -51,6 +55,9 @@ public:
     /// not called.
     mdns::Minimal::SerializedQNameIterator Get() const;
 
+    /// Return the `HashQName` of the underlying value.
+    uint32_t GetHash() const { return mHash; }
+
 private:
     // Try to have space for at least:
     //  L1234._sub._matterc._udp.local      => 30 chars
@@ -62,6 +69,7 @@ private:
     static constexpr size_t kMaxStoredNameLength = 64;
 
     uint8_t mNameBuffer[kMaxStoredNameLength] = {};
+    uint32_t mHash                            = 0;
 };
 
 /// Incrementally accumulates data from DNSSD packets. It is geared twoards
@@ -131,6 +139,13 @@ public:
     CHIP_ERROR OnRecord(Inet::InterfaceId interface, const mdns::Minimal::ResourceData & data,
                         mdns::Minimal::BytesRange packetRange);
 
+    /// Quickly checks whether a record of the given type, whose name has the
+    /// given `HashQName`, may be relevant to the current resolver.
+    ///
+    /// Records for which this returns false can be skipped without calling
+    /// `OnRecord`, which still compares names in full for the other ones.
+    bool MayUseRecord(mdns::Minimal::QType type, uint32_t nameHash) const;
+
     /// Return what additional data is required until the object can be extracted
     ///
     /// If `!GetREquiredInformation().HasAny()` the parsed information is ready
@@ -149,6 +164,13 @@ public:
     ///           as this object is valid and InitializeParsing is not called again.
     mdns::Minimal::SerializedQNameIterator GetRecordName() const { return mRecordName.Get(); }
 
+    /// Fetch the `HashQName` of the record name set by `InitializeParsing`.
+    uint32_t GetRecordNameHash() const { return mRecordName.GetHash(); }
+
+    /// Fetch the smallest TTL of the records parsed so far (i.e. how long the
+    /// parsed data remains valid).
+    uint32_t GetTtlSeconds() const { return mTtlSeconds; }
+
     /// Take the current value of the object and clear it once returned.
     ///
     /// Object must be in `IsActive()` for this to succeed.
@@ -178,6 +200,9 @@ private:
     /// Input data MUST have GetType() == QType::TXT
     CHIP_ERROR OnTxtRecord(const mdns::Minimal::ResourceData & data, mdns::Minimal::BytesRange packetRange);
 
+    /// Lowers the TTL of the parsed data to the TTL of a record that contributed to it.
+    void UpdateTtl(uint64_t ttlSeconds);
+
     /// Notify that a new IP address has been found.
     ///
     /// This is to be called on both A (if IPv4 support is enabled) and AAAA
@@ -191,6 +216,7 @@ private:
     StoredServerName mRecordName;     // Record name for what is parsed (SRV/PTR/TXT)
     StoredServerName mTargetHostName; // `Target` for the SRV record
     ServiceNameType mServiceNameType = ServiceNameType::kInvalid;
+    uint32_t mTtlSeconds             = 0;
     CommonResolutionData mCommonResolutionData;
     ParsedRecordSpecificData mSpecificResolutionData;
 };
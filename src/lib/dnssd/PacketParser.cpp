@@ -0,0 +1,328 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "PacketParser.h"
+
+#include <algorithm>
+
+#include <lib/dnssd/minimal_mdns/Logging.h>
+#include <lib/dnssd/minimal_mdns/RecordData.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/SafeInt.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <tracing/macros.h>
+
+// MDNS servers will receive all broadcast packets over the network.
+// Disable 'invalid packet' messages because the are expected and common
+// These logs are useful for debug only
+#undef MINMDNS_RESOLVER_OVERLY_VERBOSE
+
+namespace chip {
+namespace Dnssd {
+
+using namespace mdns::Minimal;
+
+void PacketParser::OnHeader(ConstHeaderRef & header)
+{
+    mIsResponse = header.GetFlags().IsResponse();
+
+#ifdef MINMDNS_RESOLVER_OVERLY_VERBOSE
+    if (header.GetFlags().IsTruncated())
+    {
+        // MinMdns does not cache data, so receiving piecewise data does not work
+        ChipLogError(Discovery, "Truncated responses not supported for address resolution");
+    }
+#endif
+}
+
+void PacketParser::OnQuery(const QueryData & data)
+{
+    // Ignore queries:
+    //   - unicast answers will include the corresponding query in the answer
+    //     packet, however that is not interesting for the resolver.
+}
+
+void PacketParser::OnResource(ResourceType type, const ResourceData & data)
+{
+    if (!mIsResponse)
+    {
+        return;
+    }
+
+    switch (mParsingState)
+    {
+    case RecordParsingState::kCollecting:
+        mdns::Minimal::Logging::LogReceivedResource(data);
+        CollectResource(data);
+        break;
+    case RecordParsingState::kSrvInitialization:
+        if (data.GetType() == QType::SRV)
+        {
+            ParseSRVResource(data, HashQName(data.GetName()));
+        }
+        break;
+    case RecordParsingState::kRecordParsing:
+        if (data.GetType() != QType::SRV)
+        {
+            ParseResource(data, HashQName(data.GetName()));
+
+            // Once an IP address is received, stop requesting it.
+            if (data.GetType() == QType::AAAA)
+            {
+                mActiveResolves.CompleteIpResolution(data.GetName());
+            }
+        }
+        break;
+    }
+}
+
+void PacketParser::CollectResource(const ResourceData & data)
+{
+    switch (data.GetType())
+    {
+    case QType::SRV:
+    case QType::TXT:
+    case QType::A:
+    case QType::AAAA:
+        break;
+    default:
+        // Other types are not used by resolvers
+        return;
+    }
+
+    if (mRecordCount >= MATTER_ARRAY_SIZE(mRecords))
+    {
+        mRecordsOverflowed = true;
+        return;
+    }
+
+    const size_t dataOffset = static_cast<size_t>(data.GetData().Start() - mPacketRange.Start());
+    if (!CanCastTo<uint16_t>(dataOffset) || !CanCastTo<uint16_t>(data.GetData().Size()))
+    {
+        return;
+    }
+
+    ParsedRecord & record = mRecords[mRecordCount];
+    if (!InternName(data.GetName(), record.nameIndex))
+    {
+        return;
+    }
+
+    record.type       = data.GetType();
+    record.klass      = data.GetClass();
+    record.ttlSeconds = static_cast<uint32_t>(std::min<uint64_t>(data.GetTtlSeconds(), UINT32_MAX));
+    record.dataOffset = static_cast<uint16_t>(dataOffset);
+    record.dataSize   = static_cast<uint16_t>(data.GetData().Size());
+    mRecordCount++;
+}
+
+bool PacketParser::InternName(const SerializedQNameIterator & name, uint8_t & index)
+{
+    // Names of records are usually compressed as a pointer to the first occurrence
+    // of the name within the packet: skip leading pointers, so that such names are
+    // recognized by their offset without going through their parts.
+    const uint8_t * start = mPacketRange.Start() + name.OffsetInCurrentValidData();
+    while (mPacketRange.Contains(start) && mPacketRange.Contains(start + 1) && ((*start & 0xC0) == 0xC0))
+    {
+        const uint8_t * target = mPacketRange.Start() + (((start[0] & 0x3F) << 8) | start[1]);
+        if (target >= start)
+        {
+            // Only backward pointers are valid
+            return false;
+        }
+        start = target;
+    }
+
+    const size_t offset = static_cast<size_t>(start - mPacketRange.Start());
+    VerifyOrReturnValue(CanCastTo<uint16_t>(offset), false);
+
+    for (size_t i = 0; i < mNameCount; i++)
+    {
+        if (mNames[i].offset == offset)
+        {
+            index = static_cast<uint8_t>(i);
+            return true;
+        }
+    }
+
+    const uint32_t hash = HashQName(name);
+    VerifyOrReturnValue(hash != 0, false);
+
+    for (size_t i = 0; i < mNameCount; i++)
+    {
+        if ((mNames[i].hash == hash) && (SerializedQNameIterator(mPacketRange, mPacketRange.Start() + mNames[i].offset) == name))
+        {
+            index = static_cast<uint8_t>(i);
+            return true;
+        }
+    }
+
+    VerifyOrReturnValue(mNameCount < MATTER_ARRAY_SIZE(mNames), false);
+
+    mNames[mNameCount].offset                = static_cast<uint16_t>(offset);
+    mNames[mNameCount].hash                  = hash;
+    mNames[mNameCount].ipResolutionCompleted = false;
+    index                                    = static_cast<uint8_t>(mNameCount++);
+    return true;
+}
+
+SerializedQNameIterator PacketParser::GetName(const ParsedRecord & record) const
+{
+    return SerializedQNameIterator(mPacketRange, mPacketRange.Start() + mNames[record.nameIndex].offset);
+}
+
+ResourceData PacketParser::GetResourceData(const ParsedRecord & record) const
+{
+    const uint8_t * data = mPacketRange.Start() + record.dataOffset;
+    return ResourceData(GetName(record), record.type, record.klass, record.ttlSeconds, BytesRange(data, data + record.dataSize));
+}
+
+void PacketParser::ParseResource(const ResourceData & data, uint32_t nameHash)
+{
+    for (auto & resolver : mResolvers)
+    {
+        if (resolver.MayUseRecord(data.GetType(), nameHash))
+        {
+            CHIP_ERROR err = resolver.OnRecord(mInterfaceId, data, mPacketRange);
+
+            //
+            // CHIP_ERROR_NO_MEMORY usually gets returned when we have no more memory available to hold the
+            // resolved data. This gets emitted fairly frequently in dense environments or when receiving records
+            // from devices with lots of interfaces. Consequently, don't log that unless we have DNS verbosity
+            // logging enabled.
+            //
+            if (err != CHIP_NO_ERROR)
+            {
+#if !CHIP_MINMDNS_HIGH_VERBOSITY
+                if (err != CHIP_ERROR_NO_MEMORY)
+#endif
+                    ChipLogError(Discovery, "DNSSD parse error: %" CHIP_ERROR_FORMAT, err.Format());
+            }
+        }
+    }
+}
+
+void PacketParser::ParseSRVResource(const ResourceData & data, uint32_t nameHash)
+{
+    SrvRecord srv;
+    if (!srv.Parse(data.GetData(), mPacketRange))
+    {
+        ChipLogError(Discovery, "Packet data reporter failed to parse SRV record");
+        return;
+    }
+
+    const SerializedQNameIterator name = data.GetName();
+
+    for (auto & resolver : mResolvers)
+    {
+        if (resolver.IsActive() && (resolver.GetRecordNameHash() == nameHash) && (resolver.GetRecordName() == name))
+        {
+            ChipLogDetail(Discovery, "SRV record already actively processed.");
+            return;
+        }
+    }
+
+    for (auto & resolver : mResolvers)
+    {
+        if (resolver.IsActive())
+        {
+            continue;
+        }
+
+        CHIP_ERROR err = resolver.InitializeParsing(name, data.GetTtlSeconds(), srv);
+        if (err != CHIP_NO_ERROR)
+        {
+            // Receiving records that we do not need to parse is normal:
+            // MinMDNS may receive all DNSSD packets on the network, only
+            // interested in a subset that is matter-specific
+#ifdef MINMDNS_RESOLVER_OVERLY_VERBOSE
+            ChipLogError(Discovery, "Could not start SRV record processing: %" CHIP_ERROR_FORMAT, err.Format());
+#endif
+        }
+
+        // Done finding an inactive resolver and attempting to use it.
+        return;
+    }
+
+#if CHIP_MINMDNS_HIGH_VERBOSITY
+    ChipLogError(Discovery, "Insufficient parsers to process all SRV entries.");
+#endif
+}
+
+void PacketParser::ParseResponse(Inet::InterfaceId interface, const BytesRange & packet)
+{
+    MATTER_TRACE_SCOPE("Parsing response records", "PacketParser");
+
+    mIsResponse        = false;
+    mParsingState      = RecordParsingState::kCollecting;
+    mPacketRange       = packet;
+    mInterfaceId       = interface;
+    mNameCount         = 0;
+    mRecordCount       = 0;
+    mRecordsOverflowed = false;
+
+    if (!ParsePacket(packet, this))
+    {
+        ChipLogError(Discovery, "DNSSD packet parsing failed");
+    }
+
+    if (mRecordsOverflowed)
+    {
+        // The table does not hold every record: go through the whole packet
+        // again, once for SRV records and once for the records they use.
+        ChipLogProgress(Discovery, "DNSSD packet holds more than %u usable records, parsing it in two passes",
+                        static_cast<unsigned>(kMaxParsedRecords));
+
+        mParsingState = RecordParsingState::kSrvInitialization;
+        ParsePacket(packet, this);
+
+        mParsingState = RecordParsingState::kRecordParsing;
+        ParsePacket(packet, this);
+        return;
+    }
+
+    // SRV records set up the resolvers that other records are fed to,
+    // regardless of their order within the packet.
+    for (size_t i = 0; i < mRecordCount; i++)
+    {
+        if (mRecords[i].type == QType::SRV)
+        {
+            ParseSRVResource(GetResourceData(mRecords[i]), mNames[mRecords[i].nameIndex].hash);
+        }
+    }
+
+    for (size_t i = 0; i < mRecordCount; i++)
+    {
+        ParsedRecord & record = mRecords[i];
+        if (record.type == QType::SRV)
+        {
+            continue;
+        }
+
+        ParseResource(GetResourceData(record), mNames[record.nameIndex].hash);
+
+        // Once an IP address is received, stop requesting it.
+        if (record.type == QType::AAAA && !mNames[record.nameIndex].ipResolutionCompleted)
+        {
+            mActiveResolves.CompleteIpResolution(GetName(record));
+            mNames[record.nameIndex].ipResolutionCompleted = true;
+        }
+    }
+}
+
+} // namespace Dnssd
+} // namespace chip
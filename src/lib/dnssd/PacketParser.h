@@ -0,0 +1,129 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <inet/InetInterface.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/dnssd/ActiveResolveAttempts.h>
+#include <lib/dnssd/IncrementalResolve.h>
+#include <lib/dnssd/minimal_mdns/Parser.h>
+#include <lib/dnssd/minimal_mdns/core/BytesRange.h>
+
+namespace chip {
+namespace Dnssd {
+
+/// Handles processing of minmdns packet data.
+///
+/// Every packet is parsed once: the records that resolvers may use are decoded
+/// into a compact table, in which records sharing a name refer to a single
+/// interned and hashed copy of that name. Records are then dispatched from the
+/// table, SRV records first, to the resolvers interested in their name hash.
+///
+/// Packets holding more usable records than the table fits are parsed again
+/// in two passes instead: one for SRV records, then one for all other records.
+///
+/// Can process multiple incremental resolves based on SRV data and allows
+/// retrieval of pending (e.g. to ask for AAAA) and complete data items.
+///
+class PacketParser : private mdns::Minimal::ParserDelegate
+{
+public:
+    PacketParser(mdns::Minimal::ActiveResolveAttempts & activeResolves) : mActiveResolves(activeResolves) {}
+
+    /// Goes through the records within a response packet: sets up data
+    /// resolution for its SRV records, then feeds the other records through
+    /// the initialized SRV record parsing.
+    void ParseResponse(Inet::InterfaceId interface, const mdns::Minimal::BytesRange & packet);
+
+    IncrementalResolver * ResolverBegin() { return mResolvers; }
+    IncrementalResolver * ResolverEnd() { return mResolvers + kMinMdnsNumParallelResolvers; }
+
+private:
+    // ParserDelegate implementation
+    void OnHeader(mdns::Minimal::ConstHeaderRef & header) override;
+    void OnQuery(const mdns::Minimal::QueryData & data) override;
+    void OnResource(mdns::Minimal::ResourceType type, const mdns::Minimal::ResourceData & data) override;
+
+    enum class RecordParsingState
+    {
+        kCollecting,        // records are gathered into mRecords
+        kSrvInitialization, // SRV records of an overflowing packet are parsed as they are read
+        kRecordParsing,     // non-SRV records of an overflowing packet are parsed as they are read
+    };
+
+    /// A name within the parsed packet, shared by all the records with the same name.
+    struct InternedName
+    {
+        uint16_t offset;            // where the name starts within the packet, past any leading compression pointers
+        uint32_t hash;              // HashQName of the name
+        bool ipResolutionCompleted; // whether active IP resolutions were notified of an IP address for this name
+    };
+
+    /// A record of a type that resolvers may use
+    struct ParsedRecord
+    {
+        mdns::Minimal::QType type;
+        mdns::Minimal::QClass klass;
+        uint8_t nameIndex; // index within mNames
+        uint32_t ttlSeconds;
+        uint16_t dataOffset;
+        uint16_t dataSize;
+    };
+
+    /// Adds the record to mRecords, flagging mRecordsOverflowed if it does not fit.
+    void CollectResource(const mdns::Minimal::ResourceData & data);
+
+    /// Finds the name within the already interned names, adding it if needed.
+    ///
+    /// Returns false if the name is invalid or the table of names is full.
+    bool InternName(const mdns::Minimal::SerializedQNameIterator & name, uint8_t & index);
+
+    mdns::Minimal::SerializedQNameIterator GetName(const ParsedRecord & record) const;
+    mdns::Minimal::ResourceData GetResourceData(const ParsedRecord & record) const;
+
+    /// Initializes a resolver with the given SRV content as long as
+    /// inactive resolvers exist.
+    void ParseSRVResource(const mdns::Minimal::ResourceData & data, uint32_t nameHash);
+
+    /// Forwards the resource to all active resolvers interested in its name.
+    void ParseResource(const mdns::Minimal::ResourceData & data, uint32_t nameHash);
+
+    static constexpr size_t kMinMdnsNumParallelResolvers = CHIP_CONFIG_MINMDNS_MAX_PARALLEL_RESOLVES;
+    static constexpr size_t kMaxParsedRecords            = 32;
+
+    // Individual parse set
+    bool mIsResponse                 = false;
+    RecordParsingState mParsingState = RecordParsingState::kCollecting;
+    Inet::InterfaceId mInterfaceId   = Inet::InterfaceId::Null();
+    mdns::Minimal::BytesRange mPacketRange;
+    InternedName mNames[kMaxParsedRecords];
+    ParsedRecord mRecords[kMaxParsedRecords];
+    size_t mNameCount       = 0;
+    size_t mRecordCount     = 0;
+    bool mRecordsOverflowed = false;
+
+    // resolvers kept between parse steps
+    mdns::Minimal::ActiveResolveAttempts & mActiveResolves;
+    IncrementalResolver mResolvers[kMinMdnsNumParallelResolvers];
+};
+
+} // namespace Dnssd
+} // namespace chip
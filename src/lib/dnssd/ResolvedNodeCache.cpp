@@ -0,0 +1,138 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "ResolvedNodeCache.h"
+
+#include <lib/support/CodeUtils.h>
+
+namespace chip {
+namespace Dnssd {
+
+void ResolvedNodeCache::Update(const ResolvedNodeData & data, uint32_t ttlSeconds)
+{
+    const PeerId & peerId = data.operationalData.peerId;
+
+    if (ttlSeconds == 0)
+    {
+        Remove(peerId);
+        return;
+    }
+
+    // Strategy when picking the entry to use:
+    //   1 the entry of the same node, if any
+    //   2 an unused entry, if any
+    //   3 otherwise the least recently used entry
+    Entry * entryToUse = nullptr;
+    for (auto & entry : mEntries)
+    {
+        if (entry.inUse && entry.data.operationalData.peerId == peerId)
+        {
+            entryToUse = &entry;
+            break;
+        }
+
+        if (entryToUse == nullptr || (entryToUse->inUse && (!entry.inUse || entry.lastUsedTime < entryToUse->lastUsedTime)))
+        {
+            entryToUse = &entry;
+        }
+    }
+
+    const System::Clock::Timestamp now = mClock->GetMonotonicTimestamp();
+    const System::Clock::Milliseconds64 ttl(static_cast<uint64_t>(ttlSeconds) * 1000);
+
+    entryToUse->data         = data;
+    entryToUse->expiryTime   = now + ttl;
+    entryToUse->lastUsedTime = now;
+    entryToUse->inUse        = true;
+}
+
+bool ResolvedNodeCache::Contains(const PeerId & peerId)
+{
+    return FindValid(peerId) != nullptr;
+}
+
+bool ResolvedNodeCache::Lookup(const PeerId & peerId, ResolvedNodeData & data)
+{
+    Entry * entry = FindValid(peerId);
+    VerifyOrReturnValue(entry != nullptr, false);
+
+    entry->lastUsedTime = mClock->GetMonotonicTimestamp();
+    data                = entry->data;
+    return true;
+}
+
+void ResolvedNodeCache::Remove(const PeerId & peerId)
+{
+    for (auto & entry : mEntries)
+    {
+        if (entry.inUse && entry.data.operationalData.peerId == peerId)
+        {
+            entry.inUse = false;
+        }
+    }
+}
+
+void ResolvedNodeCache::RemoveHost(const char * hostName, const Inet::IPAddress & address)
+{
+    for (auto & entry : mEntries)
+    {
+        const CommonResolutionData & resolution = entry.data.resolutionData;
+        bool matches                            = (hostName != nullptr && hostName[0] != '\0' && resolution.IsHost(hostName));
+
+        for (size_t i = 0; !matches && address != Inet::IPAddress::Any && i < resolution.numIPs; i++)
+        {
+            matches = (resolution.ipAddress[i] == address);
+        }
+
+        if (matches)
+        {
+            entry.inUse = false;
+        }
+    }
+}
+
+void ResolvedNodeCache::Clear()
+{
+    for (auto & entry : mEntries)
+    {
+        entry.inUse = false;
+    }
+}
+
+ResolvedNodeCache::Entry * ResolvedNodeCache::FindValid(const PeerId & peerId)
+{
+    for (auto & entry : mEntries)
+    {
+        if (!entry.inUse || entry.data.operationalData.peerId != peerId)
+        {
+            continue;
+        }
+
+        if (mClock->GetMonotonicTimestamp() >= entry.expiryTime)
+        {
+            entry.inUse = false;
+            return nullptr;
+        }
+
+        return &entry;
+    }
+
+    return nullptr;
+}
+
+} // namespace Dnssd
+} // namespace chip
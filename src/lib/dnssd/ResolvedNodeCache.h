@@ -0,0 +1,90 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/PeerId.h>
+#include <lib/dnssd/Types.h>
+#include <system/SystemClock.h>
+
+namespace chip {
+namespace Dnssd {
+
+/// Keeps operational node resolutions for as long as the records they were
+/// built from are valid.
+///
+/// A resolution is built from SRV, TXT and A/AAAA records and expires once the
+/// smallest TTL of these records elapses.
+///
+/// When full, adding a new node replaces the least recently used one.
+class ResolvedNodeCache
+{
+public:
+    static constexpr size_t kCacheSize = CHIP_CONFIG_MINMDNS_RESOLVE_CACHE_SIZE;
+    static_assert(kCacheSize > 0, "The resolve cache must hold at least one node");
+
+    ResolvedNodeCache(System::Clock::ClockBase * clock) : mClock(clock) {}
+
+    /// Stores the resolution of `data.operationalData.peerId`, replacing any
+    /// previous one, for the given number of seconds.
+    ///
+    /// A TTL of 0 (i.e. a goodbye announcement) removes the node instead.
+    void Update(const ResolvedNodeData & data, uint32_t ttlSeconds);
+
+    /// Returns true if a resolution of the given node exists and has not expired.
+    bool Contains(const PeerId & peerId);
+
+    /// Copies the resolution of the given node into `data`.
+    ///
+    /// Returns false (leaving `data` unchanged) if the node is not cached or
+    /// its resolution has expired.
+    bool Lookup(const PeerId & peerId, ResolvedNodeData & data);
+
+    void Remove(const PeerId & peerId);
+
+    /// Removes the resolutions of the nodes advertised by the given host, or
+    /// using the given address, e.g. because that address is no longer valid.
+    ///
+    /// Either argument may be empty (nullptr, respectively
+    /// IPAddress::Any) to only match on the other one.
+    void RemoveHost(const char * hostName, const Inet::IPAddress & address);
+
+    void Clear();
+
+private:
+    struct Entry
+    {
+        ResolvedNodeData data;
+        System::Clock::Timestamp expiryTime; // when the records are no longer valid
+        System::Clock::Timestamp lastUsedTime;
+        bool inUse = false;
+    };
+
+    /// Finds the entry of the given node, expiring it (and returning nullptr)
+    /// if its records are no longer valid.
+    Entry * FindValid(const PeerId & peerId);
+
+    System::Clock::ClockBase * mClock;
+    Entry mEntries[kCacheSize];
+};
+
+} // namespace Dnssd
+} // namespace chip
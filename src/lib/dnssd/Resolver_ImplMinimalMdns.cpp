@@ -17,10 +17,14 @@
 
 #include "Resolver.h"
 
+#include <algorithm>
+
 #include <lib/core/CHIPConfig.h>
 #include <lib/dnssd/ActiveResolveAttempts.h>
 #include <lib/dnssd/IncrementalResolve.h>
 #include <lib/dnssd/MinimalMdnsServer.h>
+#include <lib/dnssd/PacketParser.h>
+#include <lib/dnssd/ResolvedNodeCache.h>
 #include <lib/dnssd/ServiceNaming.h>
 #include <lib/dnssd/minimal_mdns/Logging.h>
 #include <lib/dnssd/minimal_mdns/Parser.h>
@@ -45,229 +49,11 @@ constexpr uint16_t kMdnsPort        = 5353;
 
 using namespace mdns::Minimal;
 
-/// Handles processing of minmdns packet data.
-///
-/// Can process multiple incremental resolves based on SRV data and allows
-/// retrieval of pending (e.g. to ask for AAAA) and complete data items.
-///
-class PacketParser : private ParserDelegate
-{
-public:
-    PacketParser(ActiveResolveAttempts & activeResolves) : mActiveResolves(activeResolves) {}
-
-    /// Goes through the given SRV records within a response packet
-    /// and sets up data resolution
-    void ParseSrvRecords(const BytesRange & packet);
-
-    /// Goes through non-SRV records and feeds them through the initialized
-    /// SRV record parsing.
-    ///
-    /// Must be called AFTER ParseSrvRecords has been called.
-    void ParseNonSrvRecords(Inet::InterfaceId interface, const BytesRange & packet);
-
-    IncrementalResolver * ResolverBegin() { return mResolvers; }
-    IncrementalResolver * ResolverEnd() { return mResolvers + kMinMdnsNumParallelResolvers; }
-
-private:
-    // ParserDelegate implementation
-    void OnHeader(ConstHeaderRef & header) override;
-    void OnQuery(const QueryData & data) override;
-    void OnResource(ResourceType type, const ResourceData & data) override;
-
-    /// Called IFF data is of SRV type and we are in SRV initialization state
-    ///
-    /// Initializes a resolver with the given SRV content as long as
-    /// inactive resolvers exist.
-    void ParseSRVResource(const ResourceData & data);
-
-    /// Called IFF parsing state is in RecordParsing
-    ///
-    /// Forwards the resource to all active resolvers.
-    void ParseResource(const ResourceData & data);
-
-    enum class RecordParsingState
-    {
-        kIdle,
-        kSrvInitialization,
-        kRecordParsing,
-    };
-
-    static constexpr size_t kMinMdnsNumParallelResolvers = CHIP_CONFIG_MINMDNS_MAX_PARALLEL_RESOLVES;
-
-    // Individual parse set
-    bool mIsResponse               = false;
-    Inet::InterfaceId mInterfaceId = Inet::InterfaceId::Null();
-    BytesRange mPacketRange;
-    RecordParsingState mParsingState = RecordParsingState::kIdle;
-
-    // resolvers kept between parse steps
-    ActiveResolveAttempts & mActiveResolves;
-    IncrementalResolver mResolvers[kMinMdnsNumParallelResolvers];
-};
-
-void PacketParser::OnHeader(ConstHeaderRef & header)
-{
-    mIsResponse = header.GetFlags().IsResponse();
-
-#ifdef MINMDNS_RESOLVER_OVERLY_VERBOSE
-    if (header.GetFlags().IsTruncated())
-    {
-        // MinMdns does not cache data, so receiving piecewise data does not work
-        ChipLogError(Discovery, "Truncated responses not supported for address resolution");
-    }
-#endif
-}
-
-void PacketParser::OnQuery(const QueryData & data)
-{
-    // Ignore queries:
-    //   - unicast answers will include the corresponding query in the answer
-    //     packet, however that is not interesting for the resolver.
-}
-
-void PacketParser::OnResource(ResourceType type, const ResourceData & data)
-{
-    if (!mIsResponse)
-    {
-        return;
-    }
-
-    switch (mParsingState)
-    {
-    case RecordParsingState::kSrvInitialization: {
-        if (data.GetType() != QType::SRV)
-        {
-            return;
-        }
-        mdns::Minimal::Logging::LogReceivedResource(data);
-        ParseSRVResource(data);
-        break;
-    }
-    case RecordParsingState::kRecordParsing:
-        if (data.GetType() != QType::SRV)
-        {
-            // SRV packets logged during 'SrvInitialization' phase
-            mdns::Minimal::Logging::LogReceivedResource(data);
-        }
-        ParseResource(data);
-        break;
-    case RecordParsingState::kIdle:
-        ChipLogError(Discovery, "Illegal state: received DNSSD resource while IDLE");
-        break;
-    }
-}
-
-void PacketParser::ParseResource(const ResourceData & data)
-{
-    for (auto & resolver : mResolvers)
-    {
-        if (resolver.IsActive())
-        {
-            CHIP_ERROR err = resolver.OnRecord(mInterfaceId, data, mPacketRange);
-
-            //
-            // CHIP_ERROR_NO_MEMORY usually gets returned when we have no more memory available to hold the
-            // resolved data. This gets emitted fairly frequently in dense environments or when receiving records
-            // from devices with lots of interfaces. Consequently, don't log that unless we have DNS verbosity
-            // logging enabled.
-            //
-            if (err != CHIP_NO_ERROR)
-            {
-#if !CHIP_MINMDNS_HIGH_VERBOSITY
-                if (err != CHIP_ERROR_NO_MEMORY)
-#endif
-                    ChipLogError(Discovery, "DNSSD parse error: %" CHIP_ERROR_FORMAT, err.Format());
-            }
-        }
-    }
-
-    // Once an IP address is received, stop requesting it.
-    if (data.GetType() == QType::AAAA)
-    {
-        mActiveResolves.CompleteIpResolution(data.GetName());
-    }
-}
-
-void PacketParser::ParseSRVResource(const ResourceData & data)
-{
-    SrvRecord srv;
-    if (!srv.Parse(data.GetData(), mPacketRange))
-    {
-        ChipLogError(Discovery, "Packet data reporter failed to parse SRV record");
-        return;
-    }
-
-    for (auto & resolver : mResolvers)
-    {
-        if (resolver.IsActive() && (resolver.GetRecordName() == data.GetName()))
-        {
-            ChipLogDetail(Discovery, "SRV record already actively processed.");
-            return;
-        }
-    }
-
-    for (auto & resolver : mResolvers)
-    {
-        if (resolver.IsActive())
-        {
-            continue;
-        }
-
-        CHIP_ERROR err = resolver.InitializeParsing(data.GetName(), data.GetTtlSeconds(), srv);
-        if (err != CHIP_NO_ERROR)
-        {
-            // Receiving records that we do not need to parse is normal:
-            // MinMDNS may receive all DNSSD packets on the network, only
-            // interested in a subset that is matter-specific
-#ifdef MINMDNS_RESOLVER_OVERLY_VERBOSE
-            ChipLogError(Discovery, "Could not start SRV record processing: %" CHIP_ERROR_FORMAT, err.Format());
-#endif
-        }
-
-        // Done finding an inactive resolver and attempting to use it.
-        return;
-    }
-
-#if CHIP_MINMDNS_HIGH_VERBOSITY
-    ChipLogError(Discovery, "Insufficient parsers to process all SRV entries.");
-#endif
-}
-
-void PacketParser::ParseSrvRecords(const BytesRange & packet)
-{
-    MATTER_TRACE_SCOPE("Searching SRV Records", "PacketParser");
-
-    mParsingState = RecordParsingState::kSrvInitialization;
-    mPacketRange  = packet;
-
-    if (!ParsePacket(packet, this))
-    {
-        ChipLogError(Discovery, "DNSSD packet parsing failed (for SRV records)");
-    }
-
-    mParsingState = RecordParsingState::kIdle;
-}
-
-void PacketParser::ParseNonSrvRecords(Inet::InterfaceId interface, const BytesRange & packet)
-{
-    MATTER_TRACE_SCOPE("Searching NON-SRV Records", "PacketParser");
-
-    mParsingState = RecordParsingState::kRecordParsing;
-    mPacketRange  = packet;
-    mInterfaceId  = interface;
-
-    if (!ParsePacket(packet, this))
-    {
-        ChipLogError(Discovery, "DNSSD packet parsing failed (for non-srv records)");
-    }
-
-    mParsingState = RecordParsingState::kIdle;
-}
-
 class MinMdnsResolver : public Resolver, public MdnsPacketDelegate
 {
 public:
-    MinMdnsResolver() : mActiveResolves(&chip::System::SystemClock()), mPacketParser(mActiveResolves)
+    MinMdnsResolver() :
+        mActiveResolves(&chip::System::SystemClock()), mPacketParser(mActiveResolves), mResolveCache(&chip::System::SystemClock())
     {
         GlobalMinimalMdnsServer::Instance().SetResponseDelegate(this);
     }
@@ -293,6 +79,11 @@ private:
     System::Layer * mSystemLayer                      = nullptr;
     ActiveResolveAttempts mActiveResolves;
     PacketParser mPacketParser;
+    ResolvedNodeCache mResolveCache;
+
+    // Resolves answered from mResolveCache, reported to the operational delegate once ResolveNodeId has returned
+    PeerId mCachedAnswers[ResolvedNodeCache::kCacheSize];
+    size_t mCachedAnswerCount = 0;
 
     void SetDiscoveryContext(DiscoveryContext * context);
     void ScheduleIpAddressResolve(SerializedQNameIterator hostName);
@@ -314,6 +105,15 @@ private:
 
     static void RetryCallback(System::Layer *, void * self);
 
+    /// Schedules reporting the cached resolution of the given node.
+    ///
+    /// If the answer cannot be scheduled, the node is only resolved over the
+    /// network.
+    void ScheduleCachedAnswer(const PeerId & peerId);
+    void ReportCachedAnswers();
+
+    static void CachedAnswersCallback(System::Layer *, void * self);
+
     CHIP_ERROR BrowseNodes(DiscoveryType type, DiscoveryFilter subtype);
     template <typename... Args>
     mdns::Minimal::FullQName CheckAndAllocateQName(Args &&... parts)
@@ -366,6 +166,12 @@ void MinMdnsResolver::AdvancePendingResolverStates()
             continue;
         }
 
+        if (resolver->IsActiveOperationalParse() && resolver->GetTtlSeconds() == 0)
+        {
+            // Goodbye announcement: previously received records are no longer valid
+            mResolveCache.Remove(resolver->OperationalParsePeerId());
+        }
+
         IncrementalResolver::RequiredInformationFlags missing = resolver->GetMissingRequiredInformation();
 
         if (missing.Has(IncrementalResolver::RequiredInformationBitFlags::kIpAddress))
@@ -451,7 +257,8 @@ void MinMdnsResolver::AdvancePendingResolverStates()
         {
             MATTER_TRACE_SCOPE("Active operational delegate call", "MinMdnsResolver");
             ResolvedNodeData nodeResolvedData;
-            CHIP_ERROR err = resolver->Take(nodeResolvedData);
+            const uint32_t ttlSeconds = resolver->GetTtlSeconds();
+            CHIP_ERROR err            = resolver->Take(nodeResolvedData);
 
             if (err != CHIP_NO_ERROR)
             {
@@ -459,6 +266,10 @@ void MinMdnsResolver::AdvancePendingResolverStates()
                 continue;
             }
 
+            // Cache all operational data, including unsolicited announcements, so that later
+            // resolves of the same node do not need to wait for a query round trip.
+            mResolveCache.Update(nodeResolvedData, ttlSeconds);
+
             if (mActiveResolves.HasBrowseFor(chip::Dnssd::DiscoveryType::kOperational))
             {
                 if (mDiscoveryContext != nullptr)
@@ -504,8 +315,7 @@ void MinMdnsResolver::OnMdnsPacketData(const BytesRange & data, const chip::Inet
     MATTER_TRACE_SCOPE("Received MDNS Packet", "MinMdnsResolver");
 
     // Fill up any relevant data
-    mPacketParser.ParseSrvRecords(data);
-    mPacketParser.ParseNonSrvRecords(info->Interface, data);
+    mPacketParser.ParseResponse(info->Interface, data);
 
     AdvancePendingResolverStates();
 
@@ -533,6 +343,9 @@ bool MinMdnsResolver::IsInitialized()
 
 void MinMdnsResolver::Shutdown()
 {
+    mResolveCache.Clear();
+    mCachedAnswerCount = 0;
+
     GlobalMinimalMdnsServer::Instance().ShutdownServer();
 }
 
@@ -744,7 +557,10 @@ CHIP_ERROR MinMdnsResolver::StopDiscovery(DiscoveryContext & context)
 
 CHIP_ERROR MinMdnsResolver::ReconfirmRecord(const char * hostname, Inet::IPAddress address, Inet::InterfaceId interfaceId)
 {
-    return CHIP_ERROR_NOT_IMPLEMENTED;
+    // Minimal mDNS does not keep the records themselves, only the resolutions built from them: forget these, so that
+    // the next resolve of the affected nodes waits for the network.
+    mResolveCache.RemoveHost(hostname, address);
+    return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR MinMdnsResolver::BrowseNodes(DiscoveryType type, DiscoveryFilter filter)
@@ -756,11 +572,67 @@ CHIP_ERROR MinMdnsResolver::BrowseNodes(DiscoveryType type, DiscoveryFilter filt
 
 CHIP_ERROR MinMdnsResolver::ResolveNodeId(const PeerId & peerId)
 {
+    if (mResolveCache.Contains(peerId))
+    {
+        // Answer right away from the cache, yet still query the network: the node may have changed address since it
+        // was cached, and the answer refreshes the cache for later resolves.
+        ScheduleCachedAnswer(peerId);
+    }
+
     mActiveResolves.MarkPending(peerId);
 
     return SendAllPendingQueries();
 }
 
+void MinMdnsResolver::ScheduleCachedAnswer(const PeerId & peerId)
+{
+    VerifyOrReturn(mSystemLayer != nullptr);
+
+    for (size_t i = 0; i < mCachedAnswerCount; i++)
+    {
+        if (mCachedAnswers[i] == peerId)
+        {
+            return;
+        }
+    }
+
+    VerifyOrReturn(mCachedAnswerCount < MATTER_ARRAY_SIZE(mCachedAnswers));
+
+    if (mCachedAnswerCount == 0)
+    {
+        VerifyOrReturn(mSystemLayer->ScheduleWork(&CachedAnswersCallback, this) == CHIP_NO_ERROR);
+    }
+
+    mCachedAnswers[mCachedAnswerCount++] = peerId;
+}
+
+void MinMdnsResolver::ReportCachedAnswers()
+{
+    MATTER_TRACE_SCOPE("Report cached answers", "MinMdnsResolver");
+
+    // Delegates may start new resolves: only report the answers scheduled so far.
+    PeerId answers[MATTER_ARRAY_SIZE(mCachedAnswers)];
+    const size_t answerCount = mCachedAnswerCount;
+    std::copy(mCachedAnswers, mCachedAnswers + answerCount, answers);
+    mCachedAnswerCount = 0;
+
+    for (size_t i = 0; i < answerCount; i++)
+    {
+        ResolvedNodeData nodeResolvedData;
+        if (!mResolveCache.Lookup(answers[i], nodeResolvedData))
+        {
+            // Removed (e.g. by a goodbye announcement) since the resolve started, which the network query answers instead
+            continue;
+        }
+
+        nodeResolvedData.fromCache = true;
+        if (mOperationalDelegate != nullptr)
+        {
+            mOperationalDelegate->OnOperationalNodeResolved(nodeResolvedData);
+        }
+    }
+}
+
 void MinMdnsResolver::NodeIdResolutionNoLongerNeeded(const PeerId & peerId)
 {
     mActiveResolves.NodeIdResolutionNoLongerNeeded(peerId);
@@ -788,6 +660,11 @@ void MinMdnsResolver::RetryCallback(System::Layer *, void * self)
     TEMPORARY_RETURN_IGNORED reinterpret_cast<MinMdnsResolver *>(self)->SendAllPendingQueries();
 }
 
+void MinMdnsResolver::CachedAnswersCallback(System::Layer *, void * self)
+{
+    reinterpret_cast<MinMdnsResolver *>(self)->ReportCachedAnswers();
+}
+
 MinMdnsResolver gResolver;
 
 } // namespace
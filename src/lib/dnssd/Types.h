@@ -315,6 +315,7 @@ struct ResolvedNodeData
 {
     CommonResolutionData resolutionData;
     OperationalNodeData operationalData;
+    bool fromCache = false; // answered from previously received records rather than a new response
 
     void LogNodeIdResolved() const
     {
@@ -80,6 +80,10 @@ public:
     ResourceData(const ResourceData &)             = default;
     ResourceData & operator=(const ResourceData &) = default;
 
+    ResourceData(const SerializedQNameIterator & name, QType type, QClass klass, uint64_t ttl, const BytesRange & data) :
+        mNameIterator(name), mType(type), mClass(klass), mTtl(ttl), mData(data)
+    {}
+
     QType GetType() const { return mType; }
     QClass GetClass() const { return mClass; }
     uint64_t GetTtlSeconds() const { return mTtl; }
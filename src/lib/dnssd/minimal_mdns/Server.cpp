@@ -214,6 +214,9 @@ CHIP_ERROR ServerBase::Listen(chip::Inet::EndPointManager<chip::Inet::UDPEndPoin
 
         ReturnErrorOnFailure(listenUdp->Listen(OnUdpPacketReceived, nullptr /*OnReceiveError*/, this));
 
+        // Multicast queries and announcements from every node on the link arrive here, often in bursts.
+        listenUdp->SetReceiveBatchSize(INET_CONFIG_UDP_MAX_BATCH_SIZE);
+
         CHIP_ERROR err = listenUdp->JoinMulticastGroup(interfaceId, BroadcastIpAddresses::Get(addressType));
 
         if (err != CHIP_NO_ERROR)
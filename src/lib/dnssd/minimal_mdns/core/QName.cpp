@@ -210,5 +210,26 @@ bool FullQName::operator==(const FullQName & other) const
     return true;
 }
 
+uint32_t HashQName(SerializedQNameIterator name)
+{
+    // FNV-1a over the lower case name parts, each followed by a NULL
+    // separator (which cannot be part of a QNamePart).
+    constexpr uint32_t kFnvOffsetBasis = 2166136261u;
+    constexpr uint32_t kFnvPrime       = 16777619u;
+
+    uint32_t hash = kFnvOffsetBasis;
+    while (name.Next())
+    {
+        for (const char * c = name.Value(); *c != '\0'; c++)
+        {
+            const uint8_t value = static_cast<uint8_t>((*c >= 'A' && *c <= 'Z') ? (*c - 'A' + 'a') : *c);
+            hash                = (hash ^ value) * kFnvPrime;
+        }
+        hash *= kFnvPrime;
+    }
+
+    return name.IsValid() ? hash : 0;
+}
+
 } // namespace Minimal
 } // namespace mdns
@@ -117,5 +117,12 @@ private:
     bool Next(bool followIndirectPointers);
 };
 
+/// Computes a hash of a serialized QNAME.
+///
+/// The hash does not depend on the case of the name parts nor on the way the
+/// name is encoded (i.e. on compression pointers): names that compare equal
+/// have the same hash. Invalid names hash to 0.
+uint32_t HashQName(SerializedQNameIterator name);
+
 } // namespace Minimal
 } // namespace mdns
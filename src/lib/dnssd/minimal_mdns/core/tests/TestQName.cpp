@@ -298,4 +298,27 @@ TEST(TestQName, SerializedCompare)
     EXPECT_NE(AsSerializedQName(kThisIs), thisIsATestPtr);
 }
 
+TEST(TestQName, Hash)
+{
+    static const uint8_t kThisIsATest1[]    = "\04this\02is\01a\04test\00";
+    static const uint8_t kThisIsATest2[]    = "\04ThIs\02is\01A\04tESt\00";
+    static const uint8_t kThisIsATest3[]    = "\04this\02isa\04test\00";
+    static const uint8_t kThisIsDifferent[] = "\04this\02is\09different\00";
+    static const uint8_t kInvalid[]         = "\04this\02is\01a\04tes";
+
+    // These items have back references and are "this.is.a.test"
+    static const uint8_t kPtrItems[] = "\03abc\02is\01a\04test\00\04this\xc0\04";
+    SerializedQNameIterator thisIsATestPtr(BytesRange(kPtrItems, kPtrItems + sizeof(kPtrItems)), kPtrItems + 15);
+
+    // Names comparing equal hash the same, regardless of case and encoding
+    EXPECT_EQ(HashQName(AsSerializedQName(kThisIsATest1)), HashQName(AsSerializedQName(kThisIsATest2)));
+    EXPECT_EQ(HashQName(AsSerializedQName(kThisIsATest1)), HashQName(thisIsATestPtr));
+
+    // Name parts are not just concatenated
+    EXPECT_NE(HashQName(AsSerializedQName(kThisIsATest1)), HashQName(AsSerializedQName(kThisIsATest3)));
+    EXPECT_NE(HashQName(AsSerializedQName(kThisIsATest1)), HashQName(AsSerializedQName(kThisIsDifferent)));
+
+    EXPECT_EQ(HashQName(AsSerializedQName(kInvalid)), 0u);
+}
+
 } // namespace
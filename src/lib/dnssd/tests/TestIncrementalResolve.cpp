@@ -114,6 +114,7 @@ TEST(TestIncrementalResolve, TestStoredServerName)
     // Data should be storable in server name
     EXPECT_EQ(name.Set(kTestOperationalName.Serialized()), CHIP_NO_ERROR);
     EXPECT_EQ(name.Get(), kTestOperationalName.Serialized());
+    EXPECT_EQ(name.GetHash(), HashQName(kTestOperationalName.Serialized()));
     EXPECT_NE(name.Get(), kTestCommissionerNode.Serialized());
     EXPECT_NE(name.Get(), kTestCommissionableNode.Serialized());
 
@@ -256,6 +257,14 @@ TEST(TestIncrementalResolve, TestParseOperational)
     EXPECT_TRUE(resolver.GetMissingRequiredInformation().HasOnly(IncrementalResolver::RequiredInformationBitFlags::kIpAddress));
     EXPECT_EQ(resolver.GetTargetHostName(), kTestHostName.Serialized());
 
+    // IP addresses are looked up by host name and TXT entries by record name
+    EXPECT_TRUE(resolver.MayUseRecord(QType::AAAA, HashQName(kTestHostName.Serialized())));
+    EXPECT_TRUE(resolver.MayUseRecord(QType::A, HashQName(kTestHostName.Serialized())));
+    EXPECT_FALSE(resolver.MayUseRecord(QType::AAAA, HashQName(kIrrelevantHostName.Serialized())));
+    EXPECT_TRUE(resolver.MayUseRecord(QType::TXT, HashQName(kTestOperationalName.Serialized())));
+    EXPECT_FALSE(resolver.MayUseRecord(QType::TXT, HashQName(kTestHostName.Serialized())));
+    EXPECT_FALSE(resolver.MayUseRecord(QType::PTR, HashQName(kTestOperationalName.Serialized())));
+
     // Send an IP for an irrelevant host name
     {
         Inet::IPAddress addr;
@@ -295,13 +304,15 @@ TEST(TestIncrementalResolve, TestParseOperational)
         CallOnRecord(resolver, TxtResourceRecord(kTestOperationalName.Full(), entries));
     }
 
-    // Resolver should have all data
+    // Resolver should have all data, valid for the smallest TTL of its records (the SRV one)
     EXPECT_FALSE(resolver.GetMissingRequiredInformation().HasAny());
+    EXPECT_EQ(resolver.GetTtlSeconds(), 1u);
 
     // At this point taking value should work. Once taken, the resolver is reset.
     ResolvedNodeData nodeData;
     EXPECT_EQ(resolver.Take(nodeData), CHIP_NO_ERROR);
     EXPECT_FALSE(resolver.IsActive());
+    EXPECT_FALSE(resolver.MayUseRecord(QType::AAAA, HashQName(kTestHostName.Serialized())));
 
     // validate data as it was passed in
     EXPECT_EQ(nodeData.operationalData.peerId,
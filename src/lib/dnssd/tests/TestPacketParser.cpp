@@ -0,0 +1,144 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/dnssd/PacketParser.h>
+
+#include <stdio.h>
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/dnssd/minimal_mdns/core/tests/QNameStrings.h>
+#include <lib/dnssd/minimal_mdns/records/IP.h>
+#include <lib/dnssd/minimal_mdns/records/Srv.h>
+#include <lib/dnssd/minimal_mdns/records/Txt.h>
+#include <lib/support/CodeUtils.h>
+
+using namespace chip;
+using namespace chip::Dnssd;
+using namespace mdns::Minimal;
+
+namespace {
+
+// Operational names must be <compressed-fabric>-<node>._matter._tcp.local
+const auto kTestOperationalName = testing::TestQName<4>({ "1234567898765432-ABCDEFEDCBAABCDE", "_matter", "_tcp", "local" });
+
+const auto kTestHostName = testing::TestQName<2>({ "abcd", "local" });
+
+// Same host name, in a different case so that it is not compressed as a pointer to the first one
+const auto kTestHostNameOtherCase = testing::TestQName<2>({ "ABCD", "LOCAL" });
+
+constexpr uint16_t kTestPort = 0x1234;
+
+/// Builds a response packet within a buffer, with offsets relative to the start of the buffer
+/// so that names get compressed as they would be over the network.
+class ResponseBuilder
+{
+public:
+    ResponseBuilder() : mHeader(mBuffer), mOutput(mBuffer, sizeof(mBuffer)), mWriter(&mOutput)
+    {
+        mHeader.Clear();
+        mHeader.SetFlags(mHeader.GetFlags().SetResponse());
+        mOutput.Skip(HeaderRef::kSizeBytes);
+    }
+
+    bool Add(const ResourceRecord & record) { return record.Append(mHeader, ResourceType::kAdditional, mWriter); }
+
+    BytesRange Packet()
+    {
+        EXPECT_TRUE(mWriter.Fit());
+        return BytesRange(mBuffer, mBuffer + mOutput.Needed());
+    }
+
+private:
+    uint8_t mBuffer[2048] = {};
+    HeaderRef mHeader;
+    chip::Encoding::BigEndian::BufferWriter mOutput;
+    RecordWriter mWriter;
+};
+
+bool AddOperationalRecords(ResponseBuilder & builder)
+{
+    Inet::IPAddress address;
+    VerifyOrReturnValue(Inet::IPAddress::FromString("fe80::1", address), false);
+
+    const char * entries[] = { "SII=23" };
+
+    return builder.Add(SrvResourceRecord(kTestOperationalName.Full(), kTestHostName.Full(), kTestPort)) &&
+        builder.Add(TxtResourceRecord(kTestOperationalName.Full(), entries)) &&
+        builder.Add(IPResourceRecord(kTestHostName.Full(), address));
+}
+
+void ExpectOperationalResolution(PacketParser & parser, size_t expectedIpCount)
+{
+    IncrementalResolver * resolver = parser.ResolverBegin();
+    ASSERT_TRUE(resolver->IsActiveOperationalParse());
+    EXPECT_FALSE(resolver->GetMissingRequiredInformation().HasAny());
+
+    ResolvedNodeData data;
+    ASSERT_EQ(resolver->Take(data), CHIP_NO_ERROR);
+    EXPECT_EQ(data.resolutionData.numIPs, expectedIpCount);
+    EXPECT_EQ(data.resolutionData.port, kTestPort);
+    EXPECT_TRUE(data.resolutionData.GetMrpRetryIntervalIdle().has_value());
+}
+
+TEST(TestPacketParser, TestRecordsBeforeSrv)
+{
+    ResponseBuilder builder;
+
+    Inet::IPAddress address;
+    ASSERT_TRUE(Inet::IPAddress::FromString("fe80::2", address));
+    ASSERT_TRUE(builder.Add(IPResourceRecord(kTestHostNameOtherCase.Full(), address)));
+    ASSERT_TRUE(AddOperationalRecords(builder));
+
+    ActiveResolveAttempts activeResolves(&System::SystemClock());
+    PacketParser parser(activeResolves);
+    parser.ParseResponse(Inet::InterfaceId::Null(), builder.Packet());
+
+    ExpectOperationalResolution(parser, 2);
+}
+
+TEST(TestPacketParser, TestMoreRecordsThanTableHolds)
+{
+    ResponseBuilder builder;
+
+    // Records of other hosts, usable by resolvers, fill up the parser table before the matter records.
+    constexpr size_t kOtherHostCount = 40;
+    char otherHostNames[kOtherHostCount][8];
+    QNamePart otherHostParts[kOtherHostCount][2];
+
+    for (size_t i = 0; i < kOtherHostCount; i++)
+    {
+        snprintf(otherHostNames[i], sizeof(otherHostNames[i]), "host%u", static_cast<unsigned>(i));
+        otherHostParts[i][0] = otherHostNames[i];
+        otherHostParts[i][1] = "local";
+
+        Inet::IPAddress address;
+        ASSERT_TRUE(Inet::IPAddress::FromString("fe80::100", address));
+        ASSERT_TRUE(builder.Add(IPResourceRecord(FullQName(otherHostParts[i]), address)));
+    }
+
+    ASSERT_TRUE(AddOperationalRecords(builder));
+
+    ActiveResolveAttempts activeResolves(&System::SystemClock());
+    PacketParser parser(activeResolves);
+    parser.ParseResponse(Inet::InterfaceId::Null(), builder.Packet());
+
+    ExpectOperationalResolution(parser, 1);
+}
+
+} // namespace
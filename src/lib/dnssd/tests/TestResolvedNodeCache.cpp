@@ -0,0 +1,167 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/dnssd/ResolvedNodeCache.h>
+#include <lib/support/CHIPMemString.h>
+
+namespace {
+
+using namespace chip;
+using namespace chip::System::Clock::Literals;
+using chip::Dnssd::ResolvedNodeCache;
+using chip::Dnssd::ResolvedNodeData;
+
+PeerId MakePeerId(NodeId nodeId)
+{
+    PeerId peerId;
+    return peerId.SetNodeId(nodeId).SetCompressedFabricId(123);
+}
+
+ResolvedNodeData MakeNodeData(NodeId nodeId, uint16_t port)
+{
+    ResolvedNodeData data;
+    data.operationalData.peerId = MakePeerId(nodeId);
+    data.resolutionData.port    = port;
+    data.resolutionData.numIPs  = 1;
+    EXPECT_TRUE(Inet::IPAddress::FromString("fe80::1", data.resolutionData.ipAddress[0]));
+    return data;
+}
+
+TEST(TestResolvedNodeCache, TestLookup)
+{
+    System::Clock::Internal::MockClock mockClock;
+    ResolvedNodeCache cache(&mockClock);
+
+    ResolvedNodeData data;
+    EXPECT_FALSE(cache.Contains(MakePeerId(1)));
+    EXPECT_FALSE(cache.Lookup(MakePeerId(1), data));
+
+    cache.Update(MakeNodeData(1, 1234), 120);
+
+    EXPECT_TRUE(cache.Contains(MakePeerId(1)));
+    EXPECT_FALSE(cache.Contains(MakePeerId(2)));
+
+    ASSERT_TRUE(cache.Lookup(MakePeerId(1), data));
+    EXPECT_EQ(data.operationalData.peerId, MakePeerId(1));
+    EXPECT_EQ(data.resolutionData.port, 1234);
+    EXPECT_EQ(data.resolutionData.numIPs, 1u);
+
+    // Newer data replaces the cached data
+    cache.Update(MakeNodeData(1, 5678), 120);
+    ASSERT_TRUE(cache.Lookup(MakePeerId(1), data));
+    EXPECT_EQ(data.resolutionData.port, 5678);
+
+    cache.Remove(MakePeerId(1));
+    EXPECT_FALSE(cache.Contains(MakePeerId(1)));
+}
+
+TEST(TestResolvedNodeCache, TestExpiry)
+{
+    System::Clock::Internal::MockClock mockClock;
+    ResolvedNodeCache cache(&mockClock);
+
+    mockClock.AdvanceMonotonic(1234_ms32);
+    cache.Update(MakeNodeData(1, 1234), 10);
+
+    // Data is served until the TTL expires
+    mockClock.AdvanceMonotonic(9999_ms32);
+    EXPECT_TRUE(cache.Contains(MakePeerId(1)));
+    mockClock.AdvanceMonotonic(1_ms32);
+    EXPECT_FALSE(cache.Contains(MakePeerId(1)));
+
+    ResolvedNodeData data;
+    EXPECT_FALSE(cache.Lookup(MakePeerId(1), data));
+}
+
+TEST(TestResolvedNodeCache, TestGoodbye)
+{
+    System::Clock::Internal::MockClock mockClock;
+    ResolvedNodeCache cache(&mockClock);
+
+    cache.Update(MakeNodeData(1, 1234), 120);
+    EXPECT_TRUE(cache.Contains(MakePeerId(1)));
+
+    // A zero TTL means the records are no longer valid
+    cache.Update(MakeNodeData(1, 1234), 0);
+    EXPECT_FALSE(cache.Contains(MakePeerId(1)));
+}
+
+TEST(TestResolvedNodeCache, TestRemoveHost)
+{
+    System::Clock::Internal::MockClock mockClock;
+    ResolvedNodeCache cache(&mockClock);
+
+    ResolvedNodeData data = MakeNodeData(1, 1234);
+    Platform::CopyString(data.resolutionData.hostName, "ABCDEF0123456789");
+    cache.Update(data, 120);
+
+    Inet::IPAddress otherAddress;
+    EXPECT_TRUE(Inet::IPAddress::FromString("fe80::2", otherAddress));
+
+    // Nothing matches
+    cache.RemoveHost("0123456789ABCDEF", otherAddress);
+    cache.RemoveHost(nullptr, Inet::IPAddress::Any);
+    cache.RemoveHost("", Inet::IPAddress::Any);
+    EXPECT_TRUE(cache.Contains(MakePeerId(1)));
+
+    // Matching host name
+    cache.RemoveHost("ABCDEF0123456789", Inet::IPAddress::Any);
+    EXPECT_FALSE(cache.Contains(MakePeerId(1)));
+
+    // Matching address
+    cache.Update(data, 120);
+    cache.RemoveHost(nullptr, data.resolutionData.ipAddress[0]);
+    EXPECT_FALSE(cache.Contains(MakePeerId(1)));
+}
+
+#if CHIP_CONFIG_MINMDNS_RESOLVE_CACHE_SIZE >= 2
+
+// test requires at least 2 slots: one used recently and one to replace
+TEST(TestResolvedNodeCache, TestLeastRecentlyUsedIsReplaced)
+{
+    System::Clock::Internal::MockClock mockClock;
+    ResolvedNodeCache cache(&mockClock);
+
+    for (NodeId id = 1; id <= ResolvedNodeCache::kCacheSize; id++)
+    {
+        mockClock.AdvanceMonotonic(1_ms32);
+        cache.Update(MakeNodeData(id, 1234), 120);
+    }
+
+    // Using the oldest node makes the second one the least recently used
+    ResolvedNodeData data;
+    mockClock.AdvanceMonotonic(1_ms32);
+    EXPECT_TRUE(cache.Lookup(MakePeerId(1), data));
+
+    mockClock.AdvanceMonotonic(1_ms32);
+    cache.Update(MakeNodeData(1000, 1234), 120);
+
+    EXPECT_TRUE(cache.Contains(MakePeerId(1000)));
+    EXPECT_TRUE(cache.Contains(MakePeerId(1)));
+    EXPECT_FALSE(cache.Contains(MakePeerId(2)));
+    for (NodeId id = 3; id <= ResolvedNodeCache::kCacheSize; id++)
+    {
+        EXPECT_TRUE(cache.Contains(MakePeerId(id)));
+    }
+}
+
+#endif
+
+} // namespace
@@ -274,24 +274,15 @@ void ExchangeManager::OnMessageReceived(const PacketHeader & packetHeader, const
     if (!packetHeader.IsGroupSession())
     {
         // Search for an existing exchange that the message applies to. If a match is found...
-        bool found = false;
-        mContextPool.ForEachActiveObject([&](auto * ec) {
-            if (ec->MatchExchange(session, packetHeader, payloadHeader))
-            {
-                ChipLogDetail(ExchangeManager, "Found matching exchange: " ChipLogFormatExchange ", Delegate: %p",
-                              ChipLogValueExchange(ec), ec->GetDelegate());
-
-                // Matched ExchangeContext; send to message handler.
-                TEMPORARY_RETURN_IGNORED ec->HandleMessage(packetHeader.GetMessageCounter(), payloadHeader, msgFlags,
-                                                           std::move(msgBuf));
-                found = true;
-                return Loop::Break;
-            }
-            return Loop::Continue;
-        });
-
-        if (found)
+        ExchangeContext * ec = FindExchange(session, packetHeader, payloadHeader);
+        if (ec != nullptr)
         {
+            ChipLogDetail(ExchangeManager, "Found matching exchange: " ChipLogFormatExchange ", Delegate: %p",
+                          ChipLogValueExchange(ec), ec->GetDelegate());
+
+            // Matched ExchangeContext; send to message handler.
+            TEMPORARY_RETURN_IGNORED ec->HandleMessage(packetHeader.GetMessageCounter(), payloadHeader, msgFlags,
+                                                       std::move(msgBuf));
             return;
         }
     }
@@ -449,6 +440,47 @@ void ExchangeManager::SendStandaloneAckIfNeeded(const PacketHeader & packetHeade
     // The exchange should be closed inside HandleMessage function. So don't bother close it here.
 }
 
+ExchangeContext *& ExchangeManager::LookupBucket(uint16_t exchangeId, bool isInitiator)
+{
+    // Exchange IDs are allocated sequentially, so they spread evenly over the buckets as is.
+    const size_t key = (static_cast<size_t>(exchangeId) << 1) | (isInitiator ? 1u : 0u);
+    return mLookupBuckets[key % CHIP_CONFIG_EXCHANGE_LOOKUP_BUCKETS];
+}
+
+void ExchangeManager::AddToLookup(ExchangeContext * ec)
+{
+    ExchangeContext *& bucket = LookupBucket(ec->GetExchangeId(), ec->IsInitiator());
+    ec->mNextInLookupBucket   = bucket;
+    bucket                    = ec;
+}
+
+void ExchangeManager::RemoveFromLookup(ExchangeContext * ec)
+{
+    ExchangeContext ** link = &LookupBucket(ec->GetExchangeId(), ec->IsInitiator());
+    while (*link != nullptr)
+    {
+        if (*link == ec)
+        {
+            *link                   = ec->mNextInLookupBucket;
+            ec->mNextInLookupBucket = nullptr;
+            return;
+        }
+        link = &(*link)->mNextInLookupBucket;
+    }
+}
+
+ExchangeContext * ExchangeManager::FindExchange(const SessionHandle & session, const PacketHeader & packetHeader,
+                                                const PayloadHeader & payloadHeader)
+{
+    // A message sent by an initiator belongs to a responder exchange, and vice versa.
+    ExchangeContext * ec = LookupBucket(payloadHeader.GetExchangeID(), !payloadHeader.IsInitiator());
+    while (ec != nullptr && !ec->MatchExchange(session, packetHeader, payloadHeader))
+    {
+        ec = ec->mNextInLookupBucket;
+    }
+    return ec;
+}
+
 void ExchangeManager::CloseAllContextsForDelegate(const ExchangeDelegate * delegate)
 {
     mContextPool.ForEachActiveObject([&](auto * ec) {
@@ -253,6 +253,17 @@ private:
     CHIP_ERROR UnregisterUMH(Protocols::Id protocolId, int16_t msgType,
                              Messaging::UnsolicitedMessageHandler ** outHandler = nullptr);
 
+    // Received messages are matched to exchanges through a hash table keyed on the exchange ID and the
+    // initiator flag, which never change during the lifetime of an exchange. Exchanges are added and
+    // removed by their constructor and destructor, and are chained through mNextInLookupBucket.
+    ExchangeContext * mLookupBuckets[CHIP_CONFIG_EXCHANGE_LOOKUP_BUCKETS] = {};
+
+    ExchangeContext *& LookupBucket(uint16_t exchangeId, bool isInitiator);
+    void AddToLookup(ExchangeContext * ec);
+    void RemoveFromLookup(ExchangeContext * ec);
+    ExchangeContext * FindExchange(const SessionHandle & session, const PacketHeader & packetHeader,
+                                   const PayloadHeader & payloadHeader);
+
     void OnMessageReceived(const PacketHeader & packetHeader, const PayloadHeader & payloadHeader, const SessionHandle & session,
                            DuplicateMessage isDuplicate, System::PacketBufferHandle && msgBuf) override;
     void SendStandaloneAckIfNeeded(const PacketHeader & packetHeader, const PayloadHeader & payloadHeader,
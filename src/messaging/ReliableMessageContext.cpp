@@ -41,7 +41,9 @@ using namespace chip::DeviceLayer;
 namespace chip {
 namespace Messaging {
 
-ReliableMessageContext::ReliableMessageContext() : mNextAckTime(0), mPendingPeerAckMessageCounter(0) {}
+ReliableMessageContext::ReliableMessageContext() :
+    mNextAckTime(0), mPendingPeerAckMessageCounter(0), mRetransEntry(nullptr)
+{}
 
 ExchangeContext * ReliableMessageContext::GetExchangeContext()
 {
@@ -50,13 +50,13 @@ namespace Messaging {
 
 System::Clock::Timeout ReliableMessageMgr::sAdditionalMRPBackoffTime = CHIP_CONFIG_MRP_RETRY_INTERVAL_SENDER_BOOST;
 
-ReliableMessageMgr::RetransTableEntry::RetransTableEntry(ReliableMessageContext * rc) :
-    ec(*rc->GetExchangeContext()), nextRetransTime(0), sendCount(0)
+RetransTableEntry::RetransTableEntry(ReliableMessageContext * rc) :
+    ec(*rc->GetExchangeContext()), nextRetransTime(0), scheduleIndex(kNotScheduled), sendCount(0)
 {
     ec->SetWaitingForAck(true);
 }
 
-ReliableMessageMgr::RetransTableEntry::~RetransTableEntry()
+RetransTableEntry::~RetransTableEntry()
 {
     ec->SetWaitingForAck(false);
 }
@@ -78,7 +78,7 @@ void ReliableMessageMgr::Shutdown()
 
     // Clear the retransmit table
     mRetransTable.ForEachActiveObject([&](auto * entry) {
-        mRetransTable.ReleaseObject(entry);
+        ReleaseRetransEntry(*entry);
         return Loop::Continue;
     });
 
@@ -162,10 +162,15 @@ void ReliableMessageMgr::ExecuteActions()
         }
     });
 
-    // Retransmit / cancel anything in the retrans table whose retrans timeout has expired
-    mRetransTable.ForEachActiveObject([&](auto * entry) {
-        if (entry->nextRetransTime > now)
-            return Loop::Continue;
+    // Retransmit / cancel anything in the retrans table whose retrans timeout has expired.
+    //
+    // Sending or giving up on an entry may release any number of other entries (e.g. through
+    // NotifySessionHang), so the earliest entry is looked up again on every iteration. Every
+    // processed entry is either released or rescheduled, and sendCount bounds how many times
+    // an entry can be rescheduled, so this terminates even for zero backoffs.
+    while (mRetransScheduleSize > 0 && mRetransSchedule[0]->nextRetransTime <= now)
+    {
+        RetransTableEntry * entry = mRetransSchedule[0];
 
         VerifyOrDie(!entry->retainedBuf.IsNull());
 
@@ -212,9 +217,9 @@ void ReliableMessageMgr::ExecuteActions()
             }
 
             // Do not StartTimer, we will schedule the timer at the end of the timer handler.
-            mRetransTable.ReleaseObject(entry);
+            ReleaseRetransEntry(*entry);
 
-            return Loop::Continue;
+            continue;
         }
 
         entry->sendCount++;
@@ -227,9 +232,7 @@ void ReliableMessageMgr::ExecuteActions()
         MATTER_LOG_METRIC(Tracing::kMetricDeviceRMPRetryCount, entry->sendCount);
 
         TEMPORARY_RETURN_IGNORED SendFromRetransTable(entry);
-
-        return Loop::Continue;
-    });
+    }
 
     TicklessDebugDumpRetransTable("ReliableMessageMgr::ExecuteActions Dumping mRetransTable entries after processing");
 }
@@ -261,6 +264,7 @@ CHIP_ERROR ReliableMessageMgr::AddToRetransTable(ReliableMessageContext * rc, Re
         ChipLogError(ExchangeManager, "mRetransTable Already Full");
         return CHIP_ERROR_RETRANS_TABLE_FULL;
     }
+    rc->mRetransEntry = *rEntry;
 
     return CHIP_NO_ERROR;
 }
@@ -338,29 +342,23 @@ void ReliableMessageMgr::StartRetransmision(RetransTableEntry * entry)
 
 bool ReliableMessageMgr::CheckAndRemRetransTable(ReliableMessageContext * rc, uint32_t ackMessageCounter)
 {
-    bool removed = false;
-    mRetransTable.ForEachActiveObject([&](auto * entry) {
-        if (entry->ec->GetReliableMessageContext() == rc && entry->retainedBuf.GetMessageCounter() == ackMessageCounter)
-        {
+    // An exchange has at most one message waiting for an ack, see AddToRetransTable.
+    RetransTableEntry * entry = rc->mRetransEntry;
+    VerifyOrReturnValue(entry != nullptr && entry->retainedBuf.GetMessageCounter() == ackMessageCounter, false);
+
 #if CHIP_CONFIG_MRP_ANALYTICS_ENABLED
-            auto session = entry->ec->GetSessionHandle();
-            NotifyMessageSendAnalytics(*entry, session, ReliableMessageAnalyticsDelegate::EventType::kAcknowledged);
+    auto session = entry->ec->GetSessionHandle();
+    NotifyMessageSendAnalytics(*entry, session, ReliableMessageAnalyticsDelegate::EventType::kAcknowledged);
 #endif // CHIP_CONFIG_MRP_ANALYTICS_ENABLED
 
-            // Clear the entry from the retransmision table.
-            ClearRetransTable(*entry);
+    // Clear the entry from the retransmision table.
+    ClearRetransTable(*entry);
 
-            ChipLogDetail(ExchangeManager,
-                          "Rxd Ack; Removing MessageCounter:" ChipLogFormatMessageCounter
-                          " from Retrans Table on exchange " ChipLogFormatExchange,
-                          ackMessageCounter, ChipLogValueExchange(rc->GetExchangeContext()));
-            removed = true;
-            return Loop::Break;
-        }
-        return Loop::Continue;
-    });
-
-    return removed;
+    ChipLogDetail(ExchangeManager,
+                  "Rxd Ack; Removing MessageCounter:" ChipLogFormatMessageCounter
+                  " from Retrans Table on exchange " ChipLogFormatExchange,
+                  ackMessageCounter, ChipLogValueExchange(rc->GetExchangeContext()));
+    return true;
 }
 
 CHIP_ERROR ReliableMessageMgr::SendFromRetransTable(RetransTableEntry * entry)
@@ -425,19 +423,15 @@ CHIP_ERROR ReliableMessageMgr::SendFromRetransTable(RetransTableEntry * entry)
 
 void ReliableMessageMgr::ClearRetransTable(ReliableMessageContext * rc)
 {
-    mRetransTable.ForEachActiveObject([&](auto * entry) {
-        if (entry->ec->GetReliableMessageContext() == rc)
-        {
-            ClearRetransTable(*entry);
-            return Loop::Break;
-        }
-        return Loop::Continue;
-    });
+    if (rc->mRetransEntry != nullptr)
+    {
+        ClearRetransTable(*rc->mRetransEntry);
+    }
 }
 
 void ReliableMessageMgr::ClearRetransTable(RetransTableEntry & entry)
 {
-    mRetransTable.ReleaseObject(&entry);
+    ReleaseRetransEntry(entry);
     // Expire any virtual ticks that have expired so all wakeup sources reflect the current time
     StartTimer();
 }
@@ -455,13 +449,10 @@ void ReliableMessageMgr::StartTimer()
     });
 
     // When do we need to next wake up for ReliableMessageProtocol retransmit?
-    mRetransTable.ForEachActiveObject([&](auto * entry) {
-        if (entry->nextRetransTime < nextWakeTime)
-        {
-            nextWakeTime = entry->nextRetransTime;
-        }
-        return Loop::Continue;
-    });
+    if (mRetransScheduleSize > 0 && mRetransSchedule[0]->nextRetransTime < nextWakeTime)
+    {
+        nextWakeTime = mRetransSchedule[0]->nextRetransTime;
+    }
 
     StopTimer();
 
@@ -558,6 +549,7 @@ void ReliableMessageMgr::CalculateNextRetransTime(RetransTableEntry & entry)
 
     System::Clock::Timeout backoff = ReliableMessageMgr::GetBackoff(baseTimeout, entry.sendCount);
     entry.nextRetransTime          = System::SystemClock().GetMonotonicTimestamp() + backoff;
+    ScheduleRetransEntry(entry);
 
 #if CHIP_PROGRESS_LOGGING
     const auto config       = sessionHandle->GetRemoteMRPConfig();
@@ -587,6 +579,89 @@ void ReliableMessageMgr::CalculateNextRetransTime(RetransTableEntry & entry)
 #endif // CHIP_PROGRESS_LOGGING
 }
 
+void ReliableMessageMgr::ReleaseRetransEntry(RetransTableEntry & entry)
+{
+    UnscheduleRetransEntry(entry);
+    entry.ec->GetReliableMessageContext()->mRetransEntry = nullptr;
+    mRetransTable.ReleaseObject(&entry);
+}
+
+void ReliableMessageMgr::ScheduleRetransEntry(RetransTableEntry & entry)
+{
+    if (entry.scheduleIndex == RetransTableEntry::kNotScheduled)
+    {
+        VerifyOrDie(mRetransScheduleSize < CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE);
+        PlaceInRetransSchedule(&entry, mRetransScheduleSize++);
+    }
+
+    // Only one of these moves the entry, depending on whether its time went down or up.
+    SiftRetransScheduleUp(entry.scheduleIndex);
+    SiftRetransScheduleDown(entry.scheduleIndex);
+}
+
+void ReliableMessageMgr::UnscheduleRetransEntry(RetransTableEntry & entry)
+{
+    VerifyOrReturn(entry.scheduleIndex != RetransTableEntry::kNotScheduled);
+
+    const uint16_t index     = entry.scheduleIndex;
+    RetransTableEntry * last = mRetransSchedule[--mRetransScheduleSize];
+    entry.scheduleIndex      = RetransTableEntry::kNotScheduled;
+    VerifyOrReturn(last != &entry);
+
+    PlaceInRetransSchedule(last, index);
+    SiftRetransScheduleUp(index);
+    SiftRetransScheduleDown(last->scheduleIndex);
+}
+
+void ReliableMessageMgr::SiftRetransScheduleUp(uint16_t index)
+{
+    RetransTableEntry * entry = mRetransSchedule[index];
+    while (index > 0)
+    {
+        const uint16_t parent = static_cast<uint16_t>((index - 1) / 2);
+        if (mRetransSchedule[parent]->nextRetransTime <= entry->nextRetransTime)
+        {
+            break;
+        }
+        PlaceInRetransSchedule(mRetransSchedule[parent], index);
+        index = parent;
+    }
+    PlaceInRetransSchedule(entry, index);
+}
+
+void ReliableMessageMgr::SiftRetransScheduleDown(uint16_t index)
+{
+    RetransTableEntry * entry = mRetransSchedule[index];
+    while (true)
+    {
+        const size_t left = 2 * static_cast<size_t>(index) + 1;
+        if (left >= mRetransScheduleSize)
+        {
+            break;
+        }
+
+        size_t child = left;
+        if (left + 1 < mRetransScheduleSize &&
+            mRetransSchedule[left + 1]->nextRetransTime < mRetransSchedule[left]->nextRetransTime)
+        {
+            child = left + 1;
+        }
+        if (entry->nextRetransTime <= mRetransSchedule[child]->nextRetransTime)
+        {
+            break;
+        }
+        PlaceInRetransSchedule(mRetransSchedule[child], index);
+        index = static_cast<uint16_t>(child);
+    }
+    PlaceInRetransSchedule(entry, index);
+}
+
+void ReliableMessageMgr::PlaceInRetransSchedule(RetransTableEntry * entry, uint16_t index)
+{
+    mRetransSchedule[index] = entry;
+    entry->scheduleIndex    = index;
+}
+
 #if CHIP_CONFIG_TEST
 int ReliableMessageMgr::TestGetCountRetransTable()
 {
@@ -44,33 +44,39 @@ namespace Messaging {
 enum class SendMessageFlags : uint16_t;
 class ReliableMessageContext;
 
+/**
+ *  @class RetransTableEntry
+ *
+ *  @brief
+ *    This class is part of the CHIP Reliable Messaging Protocol and is used
+ *    to keep track of CHIP messages that have been sent and are expecting an
+ *    acknowledgment back. If the acknowledgment is not received within a
+ *    specific timeout, the message would be retransmitted from this table.
+ *
+ */
+struct RetransTableEntry
+{
+    static constexpr uint16_t kNotScheduled = UINT16_MAX;
+
+    RetransTableEntry(ReliableMessageContext * rc);
+    ~RetransTableEntry();
+
+    ExchangeHandle ec;                        /**< The context for the stored CHIP message. */
+    EncryptedPacketBufferHandle retainedBuf;  /**< The packet buffer holding the CHIP message. */
+    System::Clock::Timestamp nextRetransTime; /**< A counter representing the next retransmission time for the message. */
+    uint16_t scheduleIndex;                   /**< Position in the retransmission schedule, kNotScheduled until the
+                                                   first retransmission time is calculated. */
+    uint8_t sendCount;                        /**< The number of times we have tried to send this entry,
+                                                   including both successfully and failure send. */
+#if CHIP_CONFIG_MRP_ANALYTICS_ENABLED
+    System::Clock::Timestamp initialSentTime; /**< Timestamp when the initial message was sent */
+#endif                                        // CHIP_CONFIG_MRP_ANALYTICS_ENABLED
+};
+
 class ReliableMessageMgr
 {
 public:
-    /**
-     *  @class RetransTableEntry
-     *
-     *  @brief
-     *    This class is part of the CHIP Reliable Messaging Protocol and is used
-     *    to keep track of CHIP messages that have been sent and are expecting an
-     *    acknowledgment back. If the acknowledgment is not received within a
-     *    specific timeout, the message would be retransmitted from this table.
-     *
-     */
-    struct RetransTableEntry
-    {
-        RetransTableEntry(ReliableMessageContext * rc);
-        ~RetransTableEntry();
-
-        ExchangeHandle ec;                        /**< The context for the stored CHIP message. */
-        EncryptedPacketBufferHandle retainedBuf;  /**< The packet buffer holding the CHIP message. */
-        System::Clock::Timestamp nextRetransTime; /**< A counter representing the next retransmission time for the message. */
-        uint8_t sendCount;                        /**< The number of times we have tried to send this entry,
-                                                       including both successfully and failure send. */
-#if CHIP_CONFIG_MRP_ANALYTICS_ENABLED
-        System::Clock::Timestamp initialSentTime; /**< Timestamp when the initial message was sent */
-#endif                                            // CHIP_CONFIG_MRP_ANALYTICS_ENABLED
-    };
+    using RetransTableEntry = Messaging::RetransTableEntry;
 
     ReliableMessageMgr(ObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> & contextPool);
     ~ReliableMessageMgr();
@@ -129,8 +135,7 @@ public:
     void StartRetransmision(RetransTableEntry * entry);
 
     /**
-     *  Iterate through active exchange contexts and retrans table entries. Clear the entry matching
-     *  the specified ExchangeContext and the message ID from the retransmision table.
+     *  Clear the entry matching the specified ExchangeContext and the message ID from the retransmision table.
      *
      *  @param[in]    rc                 A pointer to the ExchangeContext object.
      *  @param[in]    ackMessageCounter  The acknowledged message counter of the received packet.
@@ -243,6 +248,23 @@ private:
      */
     void CalculateNextRetransTime(RetransTableEntry & entry);
 
+    /**
+     * Removes the entry from the retransmission schedule and from the table.
+     *
+     * This is the only way entries leave mRetransTable, so that the schedule and
+     * ReliableMessageContext::mRetransEntry always match the table content.
+     */
+    void ReleaseRetransEntry(RetransTableEntry & entry);
+
+    // The retransmission schedule is a binary min-heap on nextRetransTime, so
+    // that finding the next entry to retransmit is O(1) and (re)scheduling or
+    // removing an entry is O(log n).
+    void ScheduleRetransEntry(RetransTableEntry & entry);
+    void UnscheduleRetransEntry(RetransTableEntry & entry);
+    void SiftRetransScheduleUp(uint16_t index);
+    void SiftRetransScheduleDown(uint16_t index);
+    void PlaceInRetransSchedule(RetransTableEntry * entry, uint16_t index);
+
     ObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> & mContextPool;
     chip::System::Layer * mSystemLayer;
 
@@ -266,6 +288,11 @@ private:
     // ReliableMessageProtocol Global tables for timer context
     ObjectPool<RetransTableEntry, CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE> mRetransTable;
 
+    static_assert(CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE < RetransTableEntry::kNotScheduled,
+                  "Schedule positions must fit in RetransTableEntry::scheduleIndex");
+    RetransTableEntry * mRetransSchedule[CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE];
+    uint16_t mRetransScheduleSize = 0;
+
     SessionUpdateDelegate * mSessionUpdateDelegate = nullptr;
 #if CHIP_CONFIG_MRP_ANALYTICS_ENABLED
     ReliableMessageAnalyticsDelegate * mAnalyticsDelegate = nullptr;
@@ -87,6 +87,25 @@ public:
     bool IsOnMessageReceivedCalled = false;
 };
 
+class RespondingAppDelegate : public UnsolicitedMessageHandler, public ExchangeDelegate
+{
+public:
+    CHIP_ERROR OnUnsolicitedMessageReceived(const PayloadHeader & payloadHeader, ExchangeDelegate *& newDelegate) override
+    {
+        newDelegate = this;
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR OnMessageReceived(ExchangeContext * ec, const PayloadHeader & payloadHeader,
+                                 System::PacketBufferHandle && buffer) override
+    {
+        return ec->SendMessage(Protocols::BDX::Id, kMsgType_TEST2, System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize),
+                               SendFlags(Messaging::SendMessageFlags::kNoAutoRequestAck));
+    }
+
+    void OnResponseTimeout(ExchangeContext * ec) override {}
+};
+
 class WaitForTimeoutDelegate : public ExchangeDelegate
 {
 public:
@@ -235,6 +254,43 @@ TEST_F(TestExchangeMgr, CheckUmhRegistrationTest)
     EXPECT_EQ(removedHandler, nullptr);
 }
 
+TEST_F(TestExchangeMgr, CheckResponseMatchesExchange)
+{
+    // On the loopback, the responder exchange created for an unsolicited message lives in the same
+    // exchange manager as the initiator exchange, with the same exchange ID.
+    RespondingAppDelegate respondingAppDelegate;
+    EXPECT_SUCCESS(
+        GetExchangeManager().RegisterUnsolicitedMessageHandlerForType(Protocols::BDX::Id, kMsgType_TEST1, &respondingAppDelegate));
+
+    MockAppDelegate delegates[4];
+    ExchangeContext * exchanges[MATTER_ARRAY_SIZE(delegates)];
+    for (size_t i = 0; i < MATTER_ARRAY_SIZE(delegates); i++)
+    {
+        exchanges[i] = (i % 2 == 0) ? NewExchangeToAlice(&delegates[i]) : NewExchangeToBob(&delegates[i]);
+        ASSERT_NE(exchanges[i], nullptr);
+    }
+
+    EXPECT_SUCCESS(exchanges[2]->SendMessage(Protocols::BDX::Id, kMsgType_TEST1,
+                                             System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize),
+                                             SendFlags(Messaging::SendMessageFlags::kNoAutoRequestAck)
+                                                 .Set(Messaging::SendMessageFlags::kExpectResponse)));
+    DrainAndServiceIO();
+
+    for (size_t i = 0; i < MATTER_ARRAY_SIZE(delegates); i++)
+    {
+        EXPECT_EQ(delegates[i].IsOnMessageReceivedCalled, i == 2);
+    }
+
+    for (size_t i = 0; i < MATTER_ARRAY_SIZE(delegates); i++)
+    {
+        if (i != 2)
+        {
+            exchanges[i]->Close();
+        }
+    }
+    EXPECT_SUCCESS(GetExchangeManager().UnregisterUnsolicitedMessageHandlerForType(Protocols::BDX::Id, kMsgType_TEST1));
+}
+
 TEST_F(TestExchangeMgr, CheckExchangeMessages)
 {
     CHIP_ERROR err;
@@ -373,6 +373,114 @@ TEST_F(TestReliableMessageProtocol, CheckAddClearRetrans)
     exchange->Close();
 }
 
+TEST_F(TestReliableMessageProtocol, CheckClearRetransPerExchange)
+{
+    MockAppDelegate mockAppDelegate(*this);
+    ReliableMessageMgr * rm = GetExchangeManager().GetReliableMessageMgr();
+    ASSERT_NE(rm, nullptr);
+
+    ExchangeContext * exchanges[3];
+    ReliableMessageMgr::RetransTableEntry * entries[3];
+    for (size_t i = 0; i < MATTER_ARRAY_SIZE(exchanges); i++)
+    {
+        exchanges[i] = NewExchangeToAlice(&mockAppDelegate);
+        ASSERT_NE(exchanges[i], nullptr);
+        EXPECT_SUCCESS(rm->AddToRetransTable(exchanges[i]->GetReliableMessageContext(), &entries[i]));
+    }
+    EXPECT_EQ(rm->TestGetCountRetransTable(), 3);
+
+    // An exchange only has one message waiting for an ack.
+    ReliableMessageMgr::RetransTableEntry * entry;
+    EXPECT_EQ(rm->AddToRetransTable(exchanges[0]->GetReliableMessageContext(), &entry), CHIP_ERROR_INCORRECT_STATE);
+
+    rm->ClearRetransTable(exchanges[1]->GetReliableMessageContext());
+    EXPECT_EQ(rm->TestGetCountRetransTable(), 2);
+    EXPECT_TRUE(exchanges[0]->GetReliableMessageContext()->IsWaitingForAck());
+    EXPECT_FALSE(exchanges[1]->GetReliableMessageContext()->IsWaitingForAck());
+    EXPECT_TRUE(exchanges[2]->GetReliableMessageContext()->IsWaitingForAck());
+
+    // Clearing an exchange without a pending message is a no-op.
+    rm->ClearRetransTable(exchanges[1]->GetReliableMessageContext());
+    EXPECT_EQ(rm->TestGetCountRetransTable(), 2);
+
+    rm->ClearRetransTable(*entries[2]);
+    rm->ClearRetransTable(exchanges[0]->GetReliableMessageContext());
+    EXPECT_EQ(rm->TestGetCountRetransTable(), 0);
+
+    for (auto * exchange : exchanges)
+    {
+        exchange->Close();
+    }
+}
+
+/**
+ * Tests that retransmissions of several exchanges happen according to their own
+ * retransmission times, independently of the order in which they were sent:
+ *
+ * 1) DUT sends a message on exchange A with a retry interval of 1000ms
+ * 2) DUT sends a message on exchange B with a retry interval of 64ms
+ *      - Force PEER to drop both messages
+ * 3) DUT resends the message of exchange B, which gets acknowledged, while
+ *    exchange A is still waiting for its retransmission
+ * 4) DUT resends the message of exchange A, which gets acknowledged
+ */
+TEST_F(TestReliableMessageProtocol, CheckRetransmissionOrderAcrossExchanges)
+{
+    MockAppDelegate mockSender(*this);
+    ReliableMessageMgr * rm = GetExchangeManager().GetReliableMessageMgr();
+    ASSERT_NE(rm, nullptr);
+
+    ExchangeContext * slowExchange = NewExchangeToAlice(&mockSender);
+    ASSERT_NE(slowExchange, nullptr);
+    ExchangeContext * fastExchange = NewExchangeToAlice(&mockSender);
+    ASSERT_NE(fastExchange, nullptr);
+
+    auto & loopback               = GetLoopback();
+    loopback.mSentMessageCount    = 0;
+    loopback.mNumMessagesToDrop   = 2;
+    loopback.mDroppedMessageCount = 0;
+
+    // The retransmission time is computed from the session parameters when the message is sent.
+    slowExchange->GetSessionHandle()->AsSecureSession()->SetRemoteSessionParameters(ReliableMessageProtocolConfig({
+        1000_ms32, // CHIP_CONFIG_MRP_LOCAL_IDLE_RETRY_INTERVAL
+        1000_ms32, // CHIP_CONFIG_MRP_LOCAL_ACTIVE_RETRY_INTERVAL
+    }));
+    EXPECT_EQ(slowExchange->SendMessage(Echo::MsgType::EchoRequest, MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD)),
+                                        SendMessageFlags::kExpectResponse),
+              CHIP_NO_ERROR);
+
+    fastExchange->GetSessionHandle()->AsSecureSession()->SetRemoteSessionParameters(ReliableMessageProtocolConfig({
+        64_ms32, // CHIP_CONFIG_MRP_LOCAL_IDLE_RETRY_INTERVAL
+        64_ms32, // CHIP_CONFIG_MRP_LOCAL_ACTIVE_RETRY_INTERVAL
+    }));
+    EXPECT_EQ(fastExchange->SendMessage(Echo::MsgType::EchoRequest, MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD)),
+                                        SendMessageFlags::kExpectResponse),
+              CHIP_NO_ERROR);
+    DrainAndServiceIO();
+
+    EXPECT_EQ(loopback.mDroppedMessageCount, 2u);
+    EXPECT_EQ(rm->TestGetCountRetransTable(), 2);
+
+    // Wait for the retransmission of the fast exchange (should take 70-88ms) to get acknowledged.
+    GetIOContext().DriveIOUntil(500_ms32, [&] { return rm->TestGetCountRetransTable() < 2; });
+    DrainAndServiceIO();
+
+    EXPECT_EQ(rm->TestGetCountRetransTable(), 1);
+    EXPECT_TRUE(slowExchange->GetReliableMessageContext()->IsWaitingForAck());
+    EXPECT_FALSE(fastExchange->GetReliableMessageContext()->IsWaitingForAck());
+
+    // Wait for the retransmission of the slow exchange (should take 1100-1375ms from the initial send).
+    GetIOContext().DriveIOUntil(2000_ms32, [&] { return rm->TestGetCountRetransTable() == 0; });
+    DrainAndServiceIO();
+
+    EXPECT_EQ(loopback.mDroppedMessageCount, 2u);
+    EXPECT_EQ(rm->TestGetCountRetransTable(), 0);
+    EXPECT_FALSE(slowExchange->GetReliableMessageContext()->IsWaitingForAck());
+
+    slowExchange->Close();
+    fastExchange->Close();
+}
+
 /**
  * Tests MRP retransmission logic with the following scenario:
  *
@@ -74,6 +74,25 @@ extern "C" int __cxa_atexit(void (*f)(void *), void * p, void * d);
 #define CHIP_CONFIG_BDX_MAX_NUM_TRANSFERS 1
 #endif // CHIP_CONFIG_BDX_MAX_NUM_TRANSFERS
 
+// Keep dirty paths precise for devices with many attributes changing between reports (see CHIP_IM_SERVER_MAX_NUM_DIRTY_SET).
+#ifndef CHIP_IM_SERVER_MAX_NUM_DIRTY_SET
+#define CHIP_IM_SERVER_MAX_NUM_DIRTY_SET 256
+#endif // CHIP_IM_SERVER_MAX_NUM_DIRTY_SET
+
+// Hosts have the RAM to share encoded attribute reports between subscribers (see CHIP_IM_SERVER_REPORT_CACHE_SIZE).
+#ifndef CHIP_IM_SERVER_REPORT_CACHE_SIZE
+#define CHIP_IM_SERVER_REPORT_CACHE_SIZE 4096
+#endif // CHIP_IM_SERVER_REPORT_CACHE_SIZE
+
+#ifndef CHIP_IM_SERVER_REPORT_CACHE_MAX_ENTRIES
+#define CHIP_IM_SERVER_REPORT_CACHE_MAX_ENTRIES 128
+#endif // CHIP_IM_SERVER_REPORT_CACHE_MAX_ENTRIES
+
+// Darwin controllers may be reached over CASE by several peers at once (see CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES).
+#ifndef CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES
+#define CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES 4
+#endif // CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES
+
 #ifndef CHIP_CONFIG_KVS_PATH
 #if TARGET_OS_IPHONE
 #define CHIP_CONFIG_KVS_PATH "chip.store"
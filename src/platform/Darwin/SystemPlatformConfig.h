@@ -42,3 +42,12 @@ struct ChipDeviceEvent;
 
 // ========== Platform-specific Configuration Overrides =========
 #define CHIP_CONFIG_MDNS_RESOLVE_LOOKUP_RESULTS 5
+
+// Keep freed heap packet buffers for reuse, except in ASAN builds where reused buffers would hide use-after-free errors.
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_HEAP_CACHE_SIZE
+#if __has_feature(address_sanitizer)
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_HEAP_CACHE_SIZE 0
+#else
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_HEAP_CACHE_SIZE 8
+#endif // __has_feature(address_sanitizer)
+#endif // CHIP_SYSTEM_CONFIG_PACKETBUFFER_HEAP_CACHE_SIZE
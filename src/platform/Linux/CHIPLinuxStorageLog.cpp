@@ -0,0 +1,531 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *          Provides an implementation of a key-value store for Linux backed by an append-only log file.
+ *
+ *          The log starts with an 8 byte magic, followed by records laid out as (all integers little endian):
+ *
+ *              uint32 crc     CRC-32 of everything in the record after this field
+ *              uint8  type    kRecordTypePut or kRecordTypeDelete
+ *              uint16 keyLen
+ *              uint32 valueLen
+ *              key, followed by value (empty for deletions)
+ */
+
+#include <platform/Linux/CHIPLinuxStorageLog.h>
+
+#include <algorithm>
+#include <array>
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <lib/core/CHIPEncoding.h>
+#include <lib/support/BufferReader.h>
+#include <lib/support/BufferWriter.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/SafeInt.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <platform/Linux/CHIPLinuxStorageIni.h>
+
+namespace chip {
+namespace DeviceLayer {
+namespace Internal {
+
+namespace {
+
+constexpr uint8_t kMagic[]             = { 'C', 'H', 'I', 'P', 'K', 'V', 'S', '1' };
+constexpr size_t kMagicSize            = sizeof(kMagic);
+constexpr size_t kRecordCrcSize        = sizeof(uint32_t);
+constexpr size_t kRecordHeaderSize     = kRecordCrcSize + sizeof(uint8_t) + sizeof(uint16_t) + sizeof(uint32_t);
+constexpr uint8_t kRecordTypePut       = 1;
+constexpr uint8_t kRecordTypeDelete    = 2;
+constexpr char kCompactionFileSuffix[] = ".compact";
+
+uint32_t Crc32(const uint8_t * data, size_t length)
+{
+    static const std::array<uint32_t, 256> sTable = [] {
+        std::array<uint32_t, 256> table{};
+        for (uint32_t i = 0; i < table.size(); i++)
+        {
+            uint32_t crc = i;
+            for (int bit = 0; bit < 8; bit++)
+            {
+                crc = (crc & 1) ? (0xEDB88320u ^ (crc >> 1)) : (crc >> 1);
+            }
+            table[i] = crc;
+        }
+        return table;
+    }();
+
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < length; i++)
+    {
+        crc = sTable[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+constexpr size_t RecordSize(size_t keyLength, size_t valueLength)
+{
+    return kRecordHeaderSize + keyLength + valueLength;
+}
+
+void AppendRecord(std::vector<uint8_t> & out, uint8_t type, const std::string & key, const uint8_t * value, size_t valueSize)
+{
+    const size_t start = out.size();
+    const size_t size  = RecordSize(key.size(), valueSize);
+    out.resize(start + size);
+
+    uint8_t * record = out.data() + start;
+    Encoding::LittleEndian::BufferWriter writer(record + kRecordCrcSize, size - kRecordCrcSize);
+    writer.Put8(type).Put16(static_cast<uint16_t>(key.size())).Put32(static_cast<uint32_t>(valueSize));
+    writer.Put(key.data(), key.size());
+    if (valueSize > 0)
+    {
+        writer.Put(value, valueSize);
+    }
+    Encoding::LittleEndian::Put32(record, Crc32(record + kRecordCrcSize, size - kRecordCrcSize));
+}
+
+CHIP_ERROR WriteAll(int fd, const uint8_t * data, size_t length, size_t offset)
+{
+    while (length > 0)
+    {
+        ssize_t written = pwrite(fd, data, length, static_cast<off_t>(offset));
+        if (written < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        VerifyOrReturnError(written > 0, CHIP_ERROR_PERSISTED_STORAGE_FAILED);
+        data += written;
+        offset += static_cast<size_t>(written);
+        length -= static_cast<size_t>(written);
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ReadAll(int fd, std::vector<uint8_t> & contents)
+{
+    struct stat info;
+    VerifyOrReturnError(fstat(fd, &info) == 0, CHIP_ERROR_PERSISTED_STORAGE_FAILED);
+    contents.resize(static_cast<size_t>(info.st_size));
+
+    size_t offset = 0;
+    while (offset < contents.size())
+    {
+        ssize_t count = pread(fd, contents.data() + offset, contents.size() - offset, static_cast<off_t>(offset));
+        if (count < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        VerifyOrReturnError(count >= 0, CHIP_ERROR_PERSISTED_STORAGE_FAILED);
+        if (count == 0)
+        {
+            break;
+        }
+        offset += static_cast<size_t>(count);
+    }
+    contents.resize(offset);
+    return CHIP_NO_ERROR;
+}
+
+// Stores written by ChipLinuxStorage are text files of key=value lines, possibly with [section] headers and comments.
+bool IsIniStore(const std::vector<uint8_t> & contents)
+{
+    size_t lineStart = 0;
+    while (lineStart < contents.size())
+    {
+        const auto newline = std::find(contents.begin() + static_cast<ptrdiff_t>(lineStart), contents.end(), '\n');
+        const size_t lineEnd = static_cast<size_t>(newline - contents.begin());
+
+        std::string line(reinterpret_cast<const char *>(contents.data()) + lineStart, lineEnd - lineStart);
+        lineStart = lineEnd + 1;
+
+        const size_t first = line.find_first_not_of(" \t\r");
+        if (first == std::string::npos)
+        {
+            continue;
+        }
+        line = line.substr(first, line.find_last_not_of(" \t\r") + 1 - first);
+
+        if (std::any_of(line.begin(), line.end(), [](char c) { return (c >= 0 && c < ' ' && c != '\t') || c == 0x7F; }))
+        {
+            return false;
+        }
+        if (line[0] == ';' || line[0] == '#' || (line[0] == '[' && line.back() == ']'))
+        {
+            continue;
+        }
+
+        const size_t separator = line.find('=');
+        if (separator == 0 || separator == std::string::npos)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// A rename is only durable once the directory holding the file has been synced.
+CHIP_ERROR SyncParentDirectory(const std::string & path)
+{
+    const size_t separator = path.find_last_of('/');
+    std::string directory  = ".";
+    if (separator != std::string::npos)
+    {
+        directory = (separator == 0) ? "/" : path.substr(0, separator);
+    }
+
+    int fd = open(directory.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    VerifyOrReturnError(fd >= 0, CHIP_ERROR_PERSISTED_STORAGE_FAILED);
+    int rv = fsync(fd);
+    close(fd);
+    return (rv == 0) ? CHIP_NO_ERROR : CHIP_ERROR_PERSISTED_STORAGE_FAILED;
+}
+
+} // namespace
+
+ChipLinuxStorageLog::~ChipLinuxStorageLog()
+{
+    if (mFd >= 0)
+    {
+        close(mFd);
+    }
+}
+
+CHIP_ERROR ChipLinuxStorageLog::Init(const char * path)
+{
+    std::lock_guard<std::mutex> lock(mLock);
+
+    VerifyOrReturnError(path != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    if (mFd >= 0)
+    {
+        ChipLogError(DeviceLayer, "ChipLinuxStorageLog::Init: Attempt to re-initialize with KVS log file: %s, IGNORING.", path);
+        return CHIP_NO_ERROR;
+    }
+
+    ChipLogDetail(DeviceLayer, "ChipLinuxStorageLog::Init: Using KVS log file: %s", path);
+
+    mPath.assign(path);
+    mFd = open(path, O_RDWR | O_CREAT | O_CLOEXEC, S_IRUSR | S_IWUSR);
+    VerifyOrReturnError(mFd >= 0, CHIP_ERROR_OPEN_FAILED,
+                        ChipLogError(DeviceLayer, "Failed to open KVS log file %s: %s", path, strerror(errno)));
+
+    CHIP_ERROR err = LoadFile();
+    if (err != CHIP_NO_ERROR)
+    {
+        // Leave the store unusable rather than serve or overwrite data that was not fully loaded.
+        ChipLogError(DeviceLayer, "Failed to load KVS log file %s: %" CHIP_ERROR_FORMAT, path, err.Format());
+        close(mFd);
+        mFd = -1;
+        mValues.clear();
+        mLogSize  = 0;
+        mLiveSize = 0;
+    }
+    return err;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::LoadFile()
+{
+    std::vector<uint8_t> contents;
+    ReturnErrorOnFailure(ReadAll(mFd, contents));
+
+    mValues.clear();
+    mLogSize  = 0;
+    mLiveSize = kMagicSize;
+
+    // A new file, or one that went down before its magic was fully written.
+    if (contents.empty() || (contents.size() < kMagicSize && memcmp(contents.data(), kMagic, contents.size()) == 0))
+    {
+        VerifyOrReturnError(ftruncate(mFd, 0) == 0, CHIP_ERROR_PERSISTED_STORAGE_FAILED);
+        ReturnErrorOnFailure(WriteAll(mFd, kMagic, kMagicSize, 0));
+        VerifyOrReturnError(fdatasync(mFd) == 0, CHIP_ERROR_PERSISTED_STORAGE_FAILED);
+        mLogSize = kMagicSize;
+        return CHIP_NO_ERROR;
+    }
+
+    if (contents.size() < kMagicSize || memcmp(contents.data(), kMagic, kMagicSize) != 0)
+    {
+        // Only convert files that ChipLinuxStorage could have written: anything else is left as it is.
+        VerifyOrReturnError(IsIniStore(contents), CHIP_ERROR_PERSISTED_STORAGE_FAILED,
+                            ChipLogError(DeviceLayer, "KVS file %s is neither a log nor a config file", mPath.c_str()));
+        return ImportIniStore();
+    }
+
+    return Load(contents);
+}
+
+CHIP_ERROR ChipLinuxStorageLog::Load(const std::vector<uint8_t> & contents)
+{
+    size_t offset = kMagicSize;
+    while (contents.size() - offset >= kRecordHeaderSize)
+    {
+        const uint8_t * record = contents.data() + offset;
+        const size_t remaining = contents.size() - offset;
+
+        uint32_t crc;
+        uint8_t type;
+        uint16_t keyLength;
+        uint32_t valueLength;
+        Encoding::LittleEndian::Reader reader(record, remaining);
+        CHIP_ERROR err = reader.Read32(&crc).Read8(&type).Read16(&keyLength).Read32(&valueLength).StatusCode();
+
+        const size_t size = RecordSize(keyLength, valueLength);
+        if (err != CHIP_NO_ERROR || size > remaining || Crc32(record + kRecordCrcSize, size - kRecordCrcSize) != crc)
+        {
+            break;
+        }
+
+        std::string key(reinterpret_cast<const char *>(record + kRecordHeaderSize), keyLength);
+        if (type == kRecordTypePut)
+        {
+            const uint8_t * value = record + kRecordHeaderSize + keyLength;
+            ApplyPut(std::move(key), std::vector<uint8_t>(value, value + valueLength));
+        }
+        else if (type == kRecordTypeDelete)
+        {
+            ApplyDelete(key);
+        }
+        else
+        {
+            break;
+        }
+        offset += size;
+    }
+
+    // Anything past the last valid record is what remains of a write that did not complete.
+    if (offset < contents.size())
+    {
+        ChipLogError(DeviceLayer, "Discarding %u trailing bytes of KVS log file %s", static_cast<unsigned>(contents.size() - offset),
+                     mPath.c_str());
+        VerifyOrReturnError(ftruncate(mFd, static_cast<off_t>(offset)) == 0, CHIP_ERROR_PERSISTED_STORAGE_FAILED);
+        VerifyOrReturnError(fdatasync(mFd) == 0, CHIP_ERROR_PERSISTED_STORAGE_FAILED);
+    }
+    mLogSize = offset;
+
+    return CompactIfNeeded();
+}
+
+CHIP_ERROR ChipLinuxStorageLog::ImportIniStore()
+{
+    ChipLinuxStorageIni ini;
+    std::vector<std::string> keys;
+    ReturnErrorOnFailure(ini.Init());
+    ReturnErrorOnFailure(ini.AddConfig(mPath));
+    ReturnErrorOnFailure(ini.GetKeys(keys));
+
+    for (const std::string & key : keys)
+    {
+        size_t size    = 0;
+        CHIP_ERROR err = ini.GetBinaryBlobValue(key.c_str(), nullptr, 0, size);
+        VerifyOrReturnError(err == CHIP_NO_ERROR || err == CHIP_ERROR_BUFFER_TOO_SMALL, err);
+
+        std::vector<uint8_t> value(size);
+        if (size > 0)
+        {
+            ReturnErrorOnFailure(ini.GetBinaryBlobValue(key.c_str(), value.data(), value.size(), size));
+            value.resize(size);
+        }
+        ApplyPut(key, std::move(value));
+    }
+
+    // The config file is only replaced once the log holding its entries is complete, so failing here leaves it as it was.
+    ChipLogProgress(DeviceLayer, "Converting %u entries of KVS config file %s to a log", static_cast<unsigned>(mValues.size()),
+                    mPath.c_str());
+    return CompactLocked();
+}
+
+CHIP_ERROR ChipLinuxStorageLog::Get(const char * key, void * value, size_t valueSize, size_t * readBytesSize, size_t offset)
+{
+    VerifyOrReturnError(key != nullptr && value != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    std::lock_guard<std::mutex> lock(mLock);
+
+    auto it = mValues.find(key);
+    VerifyOrReturnError(it != mValues.end(), CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+
+    const std::vector<uint8_t> & stored = it->second;
+    VerifyOrReturnError(offset <= stored.size(), CHIP_ERROR_INVALID_ARGUMENT);
+
+    const size_t remaining = stored.size() - offset;
+    const size_t copySize  = std::min(valueSize, remaining);
+    if (readBytesSize != nullptr)
+    {
+        *readBytesSize = copySize;
+    }
+    if (copySize > 0)
+    {
+        memcpy(value, stored.data() + offset, copySize);
+    }
+
+    return (valueSize < remaining) ? CHIP_ERROR_BUFFER_TOO_SMALL : CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::Put(const char * key, const void * value, size_t valueSize)
+{
+    VerifyOrReturnError(key != nullptr && (value != nullptr || valueSize == 0), CHIP_ERROR_INVALID_ARGUMENT);
+
+    std::string keyString(key);
+    VerifyOrReturnError(CanCastTo<uint16_t>(keyString.size()) && CanCastTo<uint32_t>(valueSize), CHIP_ERROR_INVALID_ARGUMENT);
+
+    std::lock_guard<std::mutex> lock(mLock);
+
+    const uint8_t * bytes = static_cast<const uint8_t *>(value);
+    ReturnErrorOnFailure(Append(kRecordTypePut, keyString, bytes, valueSize));
+    ApplyPut(std::move(keyString), std::vector<uint8_t>(bytes, bytes + valueSize));
+
+    return CompactIfNeeded();
+}
+
+CHIP_ERROR ChipLinuxStorageLog::Delete(const char * key)
+{
+    VerifyOrReturnError(key != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    std::lock_guard<std::mutex> lock(mLock);
+
+    std::string keyString(key);
+    VerifyOrReturnError(mValues.find(keyString) != mValues.end(), CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+
+    ReturnErrorOnFailure(Append(kRecordTypeDelete, keyString, nullptr, 0));
+    ApplyDelete(keyString);
+
+    return CompactIfNeeded();
+}
+
+CHIP_ERROR ChipLinuxStorageLog::Compact()
+{
+    std::lock_guard<std::mutex> lock(mLock);
+    return CompactLocked();
+}
+
+CHIP_ERROR ChipLinuxStorageLog::Append(uint8_t type, const std::string & key, const uint8_t * value, size_t valueSize)
+{
+    VerifyOrReturnError(mFd >= 0, CHIP_ERROR_INCORRECT_STATE);
+
+    std::vector<uint8_t> record;
+    AppendRecord(record, type, key, value, valueSize);
+
+    CHIP_ERROR err = WriteAll(mFd, record.data(), record.size(), mLogSize);
+    if (err == CHIP_NO_ERROR && fdatasync(mFd) != 0)
+    {
+        err = CHIP_ERROR_PERSISTED_STORAGE_FAILED;
+    }
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DeviceLayer, "Failed to append to KVS log file %s: %s", mPath.c_str(), strerror(errno));
+        // Drop whatever part of the record reached the file; replay would discard it anyway.
+        (void) ftruncate(mFd, static_cast<off_t>(mLogSize));
+        return err;
+    }
+
+    mLogSize += record.size();
+    return CHIP_NO_ERROR;
+}
+
+void ChipLinuxStorageLog::ApplyPut(std::string key, std::vector<uint8_t> value)
+{
+    mLiveSize += RecordSize(key.size(), value.size());
+
+    auto it = mValues.find(key);
+    if (it != mValues.end())
+    {
+        mLiveSize -= RecordSize(it->first.size(), it->second.size());
+        it->second = std::move(value);
+        return;
+    }
+    mValues.emplace(std::move(key), std::move(value));
+}
+
+void ChipLinuxStorageLog::ApplyDelete(const std::string & key)
+{
+    auto it = mValues.find(key);
+    if (it != mValues.end())
+    {
+        mLiveSize -= RecordSize(it->first.size(), it->second.size());
+        mValues.erase(it);
+    }
+}
+
+CHIP_ERROR ChipLinuxStorageLog::CompactIfNeeded()
+{
+    // Compacting once the superseded records outweigh the live ones keeps the log within twice the size of the
+    // live data, while the cost of compaction stays proportional to the writes that made it necessary.
+    const size_t garbage = mLogSize - mLiveSize;
+    if (garbage < kMinCompactionGarbage || garbage < mLiveSize)
+    {
+        return CHIP_NO_ERROR;
+    }
+
+    // Every write so far has already been made durable, so a failure here only delays reclaiming space.
+    CHIP_ERROR err = CompactLocked();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DeviceLayer, "Failed to compact KVS log file %s: %" CHIP_ERROR_FORMAT, mPath.c_str(), err.Format());
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::CompactLocked()
+{
+    VerifyOrReturnError(mFd >= 0, CHIP_ERROR_INCORRECT_STATE);
+
+    std::vector<uint8_t> contents;
+    contents.reserve(mLiveSize);
+    contents.insert(contents.end(), kMagic, kMagic + kMagicSize);
+    for (const auto & entry : mValues)
+    {
+        AppendRecord(contents, kRecordTypePut, entry.first, entry.second.data(), entry.second.size());
+    }
+
+    const std::string compactionPath = mPath + kCompactionFileSuffix;
+    int fd = open(compactionPath.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, S_IRUSR | S_IWUSR);
+    VerifyOrReturnError(fd >= 0, CHIP_ERROR_OPEN_FAILED,
+                        ChipLogError(DeviceLayer, "Failed to create %s: %s", compactionPath.c_str(), strerror(errno)));
+
+    CHIP_ERROR err = WriteAll(fd, contents.data(), contents.size(), 0);
+    if (err == CHIP_NO_ERROR && fdatasync(fd) != 0)
+    {
+        err = CHIP_ERROR_PERSISTED_STORAGE_FAILED;
+    }
+    if (err == CHIP_NO_ERROR && rename(compactionPath.c_str(), mPath.c_str()) != 0)
+    {
+        err = CHIP_ERROR_PERSISTED_STORAGE_FAILED;
+    }
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DeviceLayer, "Failed to write %s: %s", compactionPath.c_str(), strerror(errno));
+        close(fd);
+        unlink(compactionPath.c_str());
+        return err;
+    }
+
+    // The compacted file is now the log, whether or not the directory sync below succeeds.
+    close(mFd);
+    mFd      = fd;
+    mLogSize = contents.size();
+
+    return SyncParentDirectory(mPath);
+}
+
+} // namespace Internal
+} // namespace DeviceLayer
+} // namespace chip
@@ -0,0 +1,103 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *          Provides a key-value store for Linux backed by an append-only log file.
+ *
+ *          Every Put or Delete appends a single checksummed record to the log and syncs it, so the cost of a write
+ *          only depends on the size of the value being written. The full store is kept in memory and rebuilt by
+ *          replaying the log at Init. Once the log holds more superseded records than live ones, it is compacted
+ *          by writing the live entries to a temporary file that atomically replaces the log.
+ *
+ *          A record that was only partially written when the process or system went down fails its checksum on
+ *          the next Init and is dropped along with anything after it, so the store always reflects a prefix of
+ *          the writes that were made.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace chip {
+namespace DeviceLayer {
+namespace Internal {
+
+class ChipLinuxStorageLog
+{
+public:
+    // Compaction is skipped until the log has accumulated at least this many bytes of superseded records.
+    static constexpr size_t kMinCompactionGarbage = 32 * 1024;
+
+    ChipLinuxStorageLog() = default;
+    ~ChipLinuxStorageLog();
+
+    ChipLinuxStorageLog(const ChipLinuxStorageLog &)             = delete;
+    ChipLinuxStorageLog & operator=(const ChipLinuxStorageLog &) = delete;
+
+    /**
+     * Opens the log at the given path, creating it if needed, and loads its contents.
+     *
+     * A file at that path that is not a log is converted if it is a store written by ChipLinuxStorage. Any other file, or
+     * a store that cannot be converted, is left untouched and fails initialization.
+     */
+    CHIP_ERROR Init(const char * path);
+
+    /**
+     * Reads a value with the semantics of KeyValueStoreManager::Get.
+     */
+    CHIP_ERROR Get(const char * key, void * value, size_t valueSize, size_t * readBytesSize, size_t offset);
+    CHIP_ERROR Put(const char * key, const void * value, size_t valueSize);
+    CHIP_ERROR Delete(const char * key);
+
+    /**
+     * Rewrites the log so that it only holds the live entries.
+     */
+    CHIP_ERROR Compact();
+
+    /**
+     * Size of the log file, and the part of it that holds the records of live entries.
+     */
+    size_t GetLogSize() const { return mLogSize; }
+    size_t GetLiveSize() const { return mLiveSize; }
+
+private:
+    CHIP_ERROR LoadFile();
+    CHIP_ERROR Load(const std::vector<uint8_t> & contents);
+    CHIP_ERROR ImportIniStore();
+    CHIP_ERROR Append(uint8_t type, const std::string & key, const uint8_t * value, size_t valueSize);
+    void ApplyPut(std::string key, std::vector<uint8_t> value);
+    void ApplyDelete(const std::string & key);
+    CHIP_ERROR CompactIfNeeded();
+    CHIP_ERROR CompactLocked();
+
+    std::string mPath;
+    int mFd          = -1;
+    size_t mLogSize  = 0;
+    size_t mLiveSize = 0;
+    std::unordered_map<std::string, std::vector<uint8_t>> mValues;
+    std::mutex mLock;
+};
+
+} // namespace Internal
+} // namespace DeviceLayer
+} // namespace chip
@@ -64,6 +64,26 @@ using CHIP_CONFIG_PERSISTED_STORAGE_KEY_TYPE = const char *;
 #define CHIP_CONFIG_BDX_MAX_NUM_TRANSFERS 1
 #endif // CHIP_CONFIG_BDX_MAX_NUM_TRANSFERS
 
+// Linux hosts commonly run bridges, which may have many attributes changing between reports.
+#ifndef CHIP_IM_SERVER_MAX_NUM_DIRTY_SET
+#define CHIP_IM_SERVER_MAX_NUM_DIRTY_SET 256
+#endif // CHIP_IM_SERVER_MAX_NUM_DIRTY_SET
+
+// Hosts have the RAM to share encoded attribute reports between subscribers (see CHIP_IM_SERVER_REPORT_CACHE_SIZE).
+#ifndef CHIP_IM_SERVER_REPORT_CACHE_SIZE
+#define CHIP_IM_SERVER_REPORT_CACHE_SIZE 4096
+#endif // CHIP_IM_SERVER_REPORT_CACHE_SIZE
+
+#ifndef CHIP_IM_SERVER_REPORT_CACHE_MAX_ENTRIES
+#define CHIP_IM_SERVER_REPORT_CACHE_MAX_ENTRIES 128
+#endif // CHIP_IM_SERVER_REPORT_CACHE_MAX_ENTRIES
+
+// Controllers and bridges on hosts may be contacted by several administrators at once (see
+// CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES).
+#ifndef CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES
+#define CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES 4
+#endif // CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES
+
 // ==================== Security Configuration Overrides ====================
 
 #ifndef CHIP_CONFIG_KVS_PATH
@@ -46,3 +46,7 @@
 
 // On linux platform, we have sys/socket.h, so HAVE_SO_BINDTODEVICE should be set to 1
 #define HAVE_SO_BINDTODEVICE 1
+
+// recvmmsg and sendmmsg are available since Linux 2.6.33 and 3.0 respectively.
+#define HAVE_RECVMMSG 1
+#define HAVE_SENDMMSG 1
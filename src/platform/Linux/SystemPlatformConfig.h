@@ -42,3 +42,18 @@ struct ChipDeviceEvent;
 
 // ========== Platform-specific Configuration Overrides =========
 #define CHIP_CONFIG_MDNS_RESOLVE_LOOKUP_RESULTS 5
+
+// Keep freed heap packet buffers for reuse, except in ASAN builds where reused buffers would hide use-after-free errors.
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_HEAP_CACHE_SIZE
+#if defined(__SANITIZE_ADDRESS__)
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_HEAP_CACHE_SIZE 0
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer)
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_HEAP_CACHE_SIZE 0
+#endif // __has_feature(address_sanitizer)
+#endif // defined(__SANITIZE_ADDRESS__)
+#endif // CHIP_SYSTEM_CONFIG_PACKETBUFFER_HEAP_CACHE_SIZE
+
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_HEAP_CACHE_SIZE
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_HEAP_CACHE_SIZE 8
+#endif // CHIP_SYSTEM_CONFIG_PACKETBUFFER_HEAP_CACHE_SIZE
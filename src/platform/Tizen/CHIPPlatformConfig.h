@@ -47,3 +47,8 @@
 #ifndef CHIP_CONFIG_BDX_MAX_NUM_TRANSFERS
 #define CHIP_CONFIG_BDX_MAX_NUM_TRANSFERS 1
 #endif // CHIP_CONFIG_BDX_MAX_NUM_TRANSFERS
+
+// Keep dirty paths precise for devices with many attributes changing between reports (see CHIP_IM_SERVER_MAX_NUM_DIRTY_SET).
+#ifndef CHIP_IM_SERVER_MAX_NUM_DIRTY_SET
+#define CHIP_IM_SERVER_MAX_NUM_DIRTY_SET 256
+#endif // CHIP_IM_SERVER_MAX_NUM_DIRTY_SET
@@ -54,3 +54,8 @@ using CHIP_CONFIG_PERSISTED_STORAGE_KEY_TYPE = const char *;
 #ifndef CHIP_CONFIG_BDX_MAX_NUM_TRANSFERS
 #define CHIP_CONFIG_BDX_MAX_NUM_TRANSFERS 1
 #endif // CHIP_CONFIG_BDX_MAX_NUM_TRANSFERS
+
+// Keep dirty paths precise for devices with many attributes changing between reports (see CHIP_IM_SERVER_MAX_NUM_DIRTY_SET).
+#ifndef CHIP_IM_SERVER_MAX_NUM_DIRTY_SET
+#define CHIP_IM_SERVER_MAX_NUM_DIRTY_SET 256
+#endif // CHIP_IM_SERVER_MAX_NUM_DIRTY_SET
@@ -0,0 +1,252 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test suite for the append-only log
+ *      key-value store used on Linux.
+ *
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <platform/Linux/CHIPLinuxStorage.h>
+#include <platform/Linux/CHIPLinuxStorageLog.h>
+
+#include <stdio.h>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace chip;
+using namespace chip::DeviceLayer::Internal;
+
+namespace {
+
+class TestLinuxStorageLog : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { Platform::MemoryShutdown(); }
+
+    void SetUp() override
+    {
+        mPath = "/tmp/chip_kvs_log_test_" + std::to_string(getpid());
+        unlink(mPath.c_str());
+    }
+    void TearDown() override
+    {
+        unlink(mPath.c_str());
+        rmdir((mPath + ".compact").c_str());
+    }
+
+protected:
+    std::string mPath;
+};
+
+std::string GetString(ChipLinuxStorageLog & storage, const char * key)
+{
+    char buffer[64];
+    size_t readSize = 0;
+    if (storage.Get(key, buffer, sizeof(buffer), &readSize, 0) != CHIP_NO_ERROR)
+    {
+        return "<missing>";
+    }
+    return std::string(buffer, readSize);
+}
+
+CHIP_ERROR PutString(ChipLinuxStorageLog & storage, const char * key, const std::string & value)
+{
+    return storage.Put(key, value.data(), value.size());
+}
+
+void WriteFile(const std::string & path, const std::string & contents)
+{
+    FILE * file = fopen(path.c_str(), "wb");
+    ASSERT_NE(file, nullptr);
+    EXPECT_EQ(fwrite(contents.data(), 1, contents.size(), file), contents.size());
+    fclose(file);
+}
+
+std::string ReadFile(const std::string & path)
+{
+    std::string contents;
+    FILE * file = fopen(path.c_str(), "rb");
+    if (file != nullptr)
+    {
+        char buffer[256];
+        size_t readSize;
+        while ((readSize = fread(buffer, 1, sizeof(buffer), file)) > 0)
+        {
+            contents.append(buffer, readSize);
+        }
+        fclose(file);
+    }
+    return contents;
+}
+
+TEST_F(TestLinuxStorageLog, TestReplay)
+{
+    {
+        ChipLinuxStorageLog storage;
+        ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+        EXPECT_EQ(PutString(storage, "a", "first"), CHIP_NO_ERROR);
+        EXPECT_EQ(PutString(storage, "b", "second"), CHIP_NO_ERROR);
+        EXPECT_EQ(PutString(storage, "a", "third"), CHIP_NO_ERROR);
+        EXPECT_EQ(PutString(storage, "empty", ""), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.Delete("b"), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.Delete("b"), CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+    }
+
+    ChipLinuxStorageLog storage;
+    ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+    EXPECT_EQ(GetString(storage, "a"), "third");
+    EXPECT_EQ(GetString(storage, "b"), "<missing>");
+    EXPECT_EQ(GetString(storage, "empty"), "");
+
+    // Offset and partial reads.
+    char buffer[2];
+    size_t readSize = 0;
+    EXPECT_EQ(storage.Get("a", buffer, sizeof(buffer), &readSize, 1), CHIP_ERROR_BUFFER_TOO_SMALL);
+    EXPECT_EQ(readSize, 2u);
+    EXPECT_EQ(std::string(buffer, readSize), "hi");
+    EXPECT_EQ(storage.Get("a", buffer, sizeof(buffer), &readSize, 3), CHIP_NO_ERROR);
+    EXPECT_EQ(std::string(buffer, readSize), "rd");
+    EXPECT_EQ(storage.Get("a", buffer, sizeof(buffer), &readSize, 6), CHIP_ERROR_INVALID_ARGUMENT);
+}
+
+TEST_F(TestLinuxStorageLog, TestTornWrite)
+{
+    size_t sizeBeforeLastWrite;
+    {
+        ChipLinuxStorageLog storage;
+        ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+        EXPECT_EQ(PutString(storage, "a", "kept"), CHIP_NO_ERROR);
+        sizeBeforeLastWrite = storage.GetLogSize();
+        EXPECT_EQ(PutString(storage, "a", "torn"), CHIP_NO_ERROR);
+    }
+
+    // Simulate going down in the middle of the last write.
+    ASSERT_EQ(truncate(mPath.c_str(), static_cast<off_t>(sizeBeforeLastWrite + 5)), 0);
+
+    {
+        ChipLinuxStorageLog storage;
+        ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.GetLogSize(), sizeBeforeLastWrite);
+        EXPECT_EQ(GetString(storage, "a"), "kept");
+        EXPECT_EQ(PutString(storage, "b", "after"), CHIP_NO_ERROR);
+    }
+
+    ChipLinuxStorageLog storage;
+    ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+    EXPECT_EQ(GetString(storage, "a"), "kept");
+    EXPECT_EQ(GetString(storage, "b"), "after");
+}
+
+TEST_F(TestLinuxStorageLog, TestCompaction)
+{
+    const std::string value(40, 'x');
+    {
+        ChipLinuxStorageLog storage;
+        ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+        EXPECT_EQ(PutString(storage, "other", "value"), CHIP_NO_ERROR);
+        for (int i = 0; i < 5000; i++)
+        {
+            ASSERT_EQ(PutString(storage, "counter", value + std::to_string(i)), CHIP_NO_ERROR);
+            ASSERT_LE(storage.GetLogSize(), 2 * storage.GetLiveSize() + ChipLinuxStorageLog::kMinCompactionGarbage + 128);
+        }
+
+        EXPECT_EQ(storage.Compact(), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.GetLogSize(), storage.GetLiveSize());
+    }
+
+    ChipLinuxStorageLog storage;
+    ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+    EXPECT_EQ(GetString(storage, "counter"), value + "4999");
+    EXPECT_EQ(GetString(storage, "other"), "value");
+}
+
+TEST_F(TestLinuxStorageLog, TestImportIniStore)
+{
+    {
+        ChipLinuxStorage ini;
+        const uint8_t blob[] = { 0x00, 0x01, 0xFF };
+        ASSERT_EQ(ini.Init(mPath.c_str()), CHIP_NO_ERROR);
+        EXPECT_EQ(ini.WriteValueBin("f/1/k", blob, sizeof(blob)), CHIP_NO_ERROR);
+        EXPECT_EQ(ini.WriteValueBin("key with=escapes", reinterpret_cast<const uint8_t *>("abc"), 3), CHIP_NO_ERROR);
+        EXPECT_EQ(ini.Commit(), CHIP_NO_ERROR);
+    }
+
+    {
+        ChipLinuxStorageLog storage;
+        ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+        EXPECT_EQ(GetString(storage, "f/1/k"), std::string("\x00\x01\xFF", 3));
+        EXPECT_EQ(GetString(storage, "key with=escapes"), "abc");
+        EXPECT_EQ(PutString(storage, "new", "value"), CHIP_NO_ERROR);
+    }
+
+    // The store is now a log.
+    ChipLinuxStorageLog storage;
+    ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+    EXPECT_EQ(GetString(storage, "key with=escapes"), "abc");
+    EXPECT_EQ(GetString(storage, "new"), "value");
+}
+
+TEST_F(TestLinuxStorageLog, TestUnknownFileLeftUntouched)
+{
+    const std::string contents("\x7F" "ELF\x02\x01\x01\x00key=value\n", 17);
+    WriteFile(mPath, contents);
+
+    ChipLinuxStorageLog storage;
+    EXPECT_NE(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+    EXPECT_EQ(ReadFile(mPath), contents);
+
+    // A store that failed to load does not accept writes.
+    EXPECT_NE(PutString(storage, "a", "first"), CHIP_NO_ERROR);
+    EXPECT_EQ(ReadFile(mPath), contents);
+}
+
+TEST_F(TestLinuxStorageLog, TestFailedImportLeavesIniStore)
+{
+    {
+        ChipLinuxStorage ini;
+        ASSERT_EQ(ini.Init(mPath.c_str()), CHIP_NO_ERROR);
+        EXPECT_EQ(ini.WriteValueBin("key", reinterpret_cast<const uint8_t *>("value"), 5), CHIP_NO_ERROR);
+        EXPECT_EQ(ini.Commit(), CHIP_NO_ERROR);
+    }
+    const std::string contents = ReadFile(mPath);
+
+    // The log holding the imported entries cannot be written.
+    ASSERT_EQ(mkdir((mPath + ".compact").c_str(), S_IRWXU), 0);
+
+    {
+        ChipLinuxStorageLog storage;
+        EXPECT_NE(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+        EXPECT_EQ(GetString(storage, "key"), "<missing>");
+    }
+    EXPECT_EQ(ReadFile(mPath), contents);
+
+    ASSERT_EQ(rmdir((mPath + ".compact").c_str()), 0);
+
+    ChipLinuxStorageLog storage;
+    ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+    EXPECT_EQ(GetString(storage, "key"), "value");
+}
+
+} // namespace
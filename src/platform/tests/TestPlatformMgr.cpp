@@ -206,6 +206,70 @@ TEST_F(TestPlatformMgr, RunEventLoopStopBeforeSleep)
     PlatformMgr().Shutdown();
 }
 
+#if CHIP_DEVICE_LAYER_TARGET_LINUX && CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+
+static std::atomic<int> backgroundWorkRan{ 0 };
+
+static void CountBackgroundWork(intptr_t)
+{
+    backgroundWorkRan++;
+}
+
+TEST_F(TestPlatformMgr, BackgroundEventLoopStartStop)
+{
+    EXPECT_EQ(PlatformMgr().InitChipStack(), CHIP_NO_ERROR);
+
+    // Stopping right after starting usually happens before the background threads run; they must still terminate.
+    for (size_t i = 0; i < 10; i++)
+    {
+        EXPECT_EQ(PlatformMgr().StartBackgroundEventLoopTask(), CHIP_NO_ERROR);
+        EXPECT_EQ(PlatformMgr().StopBackgroundEventLoopTask(), CHIP_NO_ERROR);
+    }
+
+    // Work queued before stopping is processed before the threads terminate.
+    backgroundWorkRan = 0;
+    EXPECT_EQ(PlatformMgr().StartBackgroundEventLoopTask(), CHIP_NO_ERROR);
+    EXPECT_EQ(PlatformMgr().StartBackgroundEventLoopTask(), CHIP_ERROR_POSIX(EALREADY));
+    for (size_t i = 0; i < 5; i++)
+    {
+        EXPECT_SUCCESS(PlatformMgr().ScheduleBackgroundWork(CountBackgroundWork));
+    }
+    EXPECT_EQ(PlatformMgr().StopBackgroundEventLoopTask(), CHIP_NO_ERROR);
+    EXPECT_EQ(backgroundWorkRan, 5);
+
+    PlatformMgr().Shutdown();
+}
+
+TEST_F(TestPlatformMgr, BackgroundWorkFallsBackToEventLoop)
+{
+    stopRan           = false;
+    backgroundWorkRan = 0;
+
+    EXPECT_EQ(PlatformMgr().InitChipStack(), CHIP_NO_ERROR);
+
+    // Without background threads, background work is posted to the foreground event loop.
+    EXPECT_SUCCESS(PlatformMgr().ScheduleBackgroundWork(CountBackgroundWork));
+    EXPECT_SUCCESS(PlatformMgr().ScheduleBackgroundWork(StopTheLoop));
+    PlatformMgr().RunEventLoop();
+    EXPECT_TRUE(stopRan);
+    EXPECT_EQ(backgroundWorkRan, 1);
+
+    // The same holds once the background threads are stopped.
+    EXPECT_EQ(PlatformMgr().StartBackgroundEventLoopTask(), CHIP_NO_ERROR);
+    EXPECT_EQ(PlatformMgr().StopBackgroundEventLoopTask(), CHIP_NO_ERROR);
+
+    stopRan = false;
+    EXPECT_SUCCESS(PlatformMgr().ScheduleBackgroundWork(CountBackgroundWork));
+    EXPECT_SUCCESS(PlatformMgr().ScheduleBackgroundWork(StopTheLoop));
+    PlatformMgr().RunEventLoop();
+    EXPECT_TRUE(stopRan);
+    EXPECT_EQ(backgroundWorkRan, 2);
+
+    PlatformMgr().Shutdown();
+}
+
+#endif // CHIP_DEVICE_LAYER_TARGET_LINUX && CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+
 TEST_F(TestPlatformMgr, TryLockChipStack)
 {
     EXPECT_EQ(PlatformMgr().InitChipStack(), CHIP_NO_ERROR);
@@ -0,0 +1,117 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ * @file BdxBlockSource.h
+ *
+ *  This file defines an interface through which a BDX Sender reads the data of the file it serves.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/Span.h>
+
+#include <algorithm>
+#include <stdint.h>
+#include <string.h>
+
+namespace chip {
+namespace bdx {
+
+/**
+ * Random access to the data served by a BDX Sender.
+ *
+ * A BlockSource is expected to stay open for the whole transfer, so that serving a block does not reopen the underlying file.
+ * It does not hold any per-transfer state: a single BlockSource may serve any number of concurrent transfers of the same data.
+ */
+class BlockSource
+{
+public:
+    virtual ~BlockSource() = default;
+
+    /**
+     * @return The size of the data in bytes.
+     */
+    virtual uint64_t GetSize() const = 0;
+
+    /**
+     * Copies the data starting at the given offset into the buffer.
+     *
+     * @param[in]     offset  The offset of the first byte to read.
+     * @param[in,out] buffer  The buffer to fill. On success, it is resized to the number of bytes read, which is only less than
+     *                        its original size when the end of the data is reached.
+     */
+    virtual CHIP_ERROR ReadBlock(uint64_t offset, MutableByteSpan & buffer) = 0;
+
+    /**
+     * Fills the data of the next block of a transfer.
+     *
+     * @param[in]     offset       The offset of the first byte of the block.
+     * @param[in]     transferEnd  The offset at which the transfer ends, or 0 if it ends with the data.
+     * @param[in,out] buffer       The buffer of the block, of the negotiated block size. It is resized to the block length.
+     * @param[out]    isEof        Whether the block is the last one of the transfer.
+     */
+    CHIP_ERROR ReadTransferBlock(uint64_t offset, uint64_t transferEnd, MutableByteSpan & buffer, bool & isEof)
+    {
+        const uint64_t endOffset = (transferEnd > 0) ? std::min(transferEnd, GetSize()) : GetSize();
+        VerifyOrReturnError(offset <= endOffset, CHIP_ERROR_INVALID_ARGUMENT);
+
+        if (endOffset - offset < buffer.size())
+        {
+            buffer.reduce_size(static_cast<size_t>(endOffset - offset));
+        }
+        ReturnErrorOnFailure(ReadBlock(offset, buffer));
+
+        isEof = (offset + buffer.size() == endOffset);
+        return CHIP_NO_ERROR;
+    }
+};
+
+/**
+ * A BlockSource serving data which is already in memory (e.g. an image stored in memory-mapped flash).
+ */
+class MemoryBlockSource : public BlockSource
+{
+public:
+    MemoryBlockSource() = default;
+    explicit MemoryBlockSource(ByteSpan data) : mData(data) {}
+
+    void SetData(ByteSpan data) { mData = data; }
+
+    uint64_t GetSize() const override { return mData.size(); }
+
+    CHIP_ERROR ReadBlock(uint64_t offset, MutableByteSpan & buffer) override
+    {
+        VerifyOrReturnError(offset <= mData.size(), CHIP_ERROR_INVALID_ARGUMENT);
+
+        ByteSpan remaining = mData.SubSpan(static_cast<size_t>(offset));
+        buffer.reduce_size(std::min(buffer.size(), remaining.size()));
+        if (!buffer.empty())
+        {
+            memcpy(buffer.data(), remaining.data(), buffer.size());
+        }
+        return CHIP_NO_ERROR;
+    }
+
+private:
+    ByteSpan mData;
+};
+
+} // namespace bdx
+} // namespace chip
@@ -32,6 +32,19 @@ namespace bdx {
 constexpr System::Clock::Timeout TransferFacilitator::kDefaultPollFreq;
 constexpr System::Clock::Timeout TransferFacilitator::kImmediatePollDelay;
 
+namespace {
+
+// A TransferSession in the error state keeps reporting kInternalError until it is reset, so pending output is only handled up
+// to the event ending the transfer.
+bool IsFinalOutput(TransferSession::OutputEventType eventType)
+{
+    return eventType == TransferSession::OutputEventType::kInternalError ||
+        eventType == TransferSession::OutputEventType::kStatusReceived ||
+        eventType == TransferSession::OutputEventType::kTransferTimeout;
+}
+
+} // namespace
+
 TransferFacilitator::~TransferFacilitator()
 {
     ResetTransfer();
@@ -70,6 +83,9 @@ CHIP_ERROR TransferFacilitator::OnMessageReceived(chip::Messaging::ExchangeConte
     // transfer is finished.
     mExchangeCtx->WillSendMessage();
 
+    // Respond right away rather than on the next poll, which would otherwise bound every round trip of the transfer.
+    ProcessPendingOutput();
+
     return err;
 }
 
@@ -90,12 +106,30 @@ void TransferFacilitator::PollForOutput()
 {
     TransferSession::OutputEvent outEvent;
     mTransfer.PollOutput(outEvent, System::SystemClock().GetMonotonicTimestamp());
+    const TransferSession::OutputEventType eventType = outEvent.EventType;
     HandleTransferSessionOutput(outEvent);
+    if (eventType != TransferSession::OutputEventType::kNone && !IsFinalOutput(eventType))
+    {
+        ProcessPendingOutput();
+    }
 
     VerifyOrReturn(mSystemLayer != nullptr, ChipLogError(BDX, "%s mSystemLayer is null", __FUNCTION__));
     TEMPORARY_RETURN_IGNORED mSystemLayer->StartTimer(mPollFreq, PollTimerHandler, this);
 }
 
+void TransferFacilitator::ProcessPendingOutput()
+{
+    TransferSession::OutputEvent outEvent;
+    TransferSession::OutputEventType eventType;
+    do
+    {
+        mTransfer.PollOutput(outEvent, System::SystemClock().GetMonotonicTimestamp());
+        eventType = outEvent.EventType;
+        VerifyOrReturn(eventType != TransferSession::OutputEventType::kNone);
+        HandleTransferSessionOutput(outEvent);
+    } while (!IsFinalOutput(eventType));
+}
+
 void TransferFacilitator::ScheduleImmediatePoll()
 {
     VerifyOrReturn(mSystemLayer != nullptr, ChipLogError(BDX, "%s mSystemLayer is null", __FUNCTION__));
@@ -126,7 +160,8 @@ CHIP_ERROR Initiator::InitiateTransfer(System::Layer * layer, TransferRole role,
 
     ReturnErrorOnFailure(mTransfer.StartTransfer(role, initData, timeout));
 
-    return mSystemLayer->StartTimer(mPollFreq, PollTimerHandler, this);
+    // The caller may still be setting up the exchange, so the init message is sent from the timer rather than from here.
+    return mSystemLayer->StartTimer(kImmediatePollDelay, PollTimerHandler, this);
 }
 
 } // namespace bdx
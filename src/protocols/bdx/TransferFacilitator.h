@@ -38,7 +38,9 @@ namespace bdx {
  *
  * This class does not define any methods for beginning a transfer or initializing the underlying TransferSession object (see
  * Initiator and Responder below).
- * This class contains a repeating timer which regurlaly polls the TransferSession state machine.
+ * Output produced by a received message is handled as soon as the message is processed. This class also contains a repeating
+ * timer which regurlaly polls the TransferSession state machine, so that timeouts and output prepared outside of
+ * HandleTransferSessionOutput are noticed.
  * A CHIP node may have many TransferFacilitator instances but only one TransferFacilitator should be used for each BDX transfer.
  */
 class TransferFacilitator : public Messaging::ExchangeDelegate, public Messaging::UnsolicitedMessageHandler
@@ -86,10 +88,16 @@ protected:
     static void PollTimerHandler(chip::System::Layer * systemLayer, void * appState);
 
     /**
-     * Polls the TransferSession object and calls HandleTransferSessionOutput.
+     * Polls the TransferSession object and calls HandleTransferSessionOutput, then handles any output prepared in response.
      */
     void PollForOutput();
 
+    /**
+     * Calls HandleTransferSessionOutput for every pending output of the TransferSession object, including output prepared by
+     * HandleTransferSessionOutput itself (e.g. a Block prepared when handling a BlockQuery).
+     */
+    void ProcessPendingOutput();
+
     /**
      * Starts the poll timer with a very short timeout.
      */
@@ -0,0 +1,82 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <protocols/bdx/BdxBlockSource.h>
+
+using namespace ::chip;
+using namespace ::chip::bdx;
+
+namespace {
+
+const uint8_t kData[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+TEST(TestBdxBlockSource, ReadsBlocksUntilEndOfData)
+{
+    MemoryBlockSource source{ ByteSpan(kData) };
+    EXPECT_EQ(source.GetSize(), sizeof(kData));
+
+    uint8_t block[4];
+    bool isEof = true;
+
+    MutableByteSpan buffer(block);
+    EXPECT_EQ(source.ReadTransferBlock(0, 0, buffer, isEof), CHIP_NO_ERROR);
+    EXPECT_TRUE(buffer.data_equal(ByteSpan(kData, 4)));
+    EXPECT_FALSE(isEof);
+
+    buffer = MutableByteSpan(block);
+    EXPECT_EQ(source.ReadTransferBlock(4, 0, buffer, isEof), CHIP_NO_ERROR);
+    EXPECT_TRUE(buffer.data_equal(ByteSpan(kData + 4, 4)));
+    EXPECT_FALSE(isEof);
+
+    buffer = MutableByteSpan(block);
+    EXPECT_EQ(source.ReadTransferBlock(8, 0, buffer, isEof), CHIP_NO_ERROR);
+    EXPECT_TRUE(buffer.data_equal(ByteSpan(kData + 8, 2)));
+    EXPECT_TRUE(isEof);
+
+    // A block ending exactly with the data is the last one.
+    buffer = MutableByteSpan(block, 2);
+    EXPECT_EQ(source.ReadTransferBlock(8, 0, buffer, isEof), CHIP_NO_ERROR);
+    EXPECT_EQ(buffer.size(), 2u);
+    EXPECT_TRUE(isEof);
+
+    buffer = MutableByteSpan(block);
+    EXPECT_EQ(source.ReadTransferBlock(sizeof(kData) + 1, 0, buffer, isEof), CHIP_ERROR_INVALID_ARGUMENT);
+}
+
+TEST(TestBdxBlockSource, StopsAtTransferEnd)
+{
+    MemoryBlockSource source{ ByteSpan(kData) };
+
+    uint8_t block[4];
+    bool isEof = false;
+
+    MutableByteSpan buffer(block);
+    EXPECT_EQ(source.ReadTransferBlock(2, 5, buffer, isEof), CHIP_NO_ERROR);
+    EXPECT_TRUE(buffer.data_equal(ByteSpan(kData + 2, 3)));
+    EXPECT_TRUE(isEof);
+
+    // A transfer ending beyond the data ends with the data.
+    buffer = MutableByteSpan(block);
+    EXPECT_EQ(source.ReadTransferBlock(8, 100, buffer, isEof), CHIP_NO_ERROR);
+    EXPECT_TRUE(buffer.data_equal(ByteSpan(kData + 8, 2)));
+    EXPECT_TRUE(isEof);
+}
+
+} // namespace
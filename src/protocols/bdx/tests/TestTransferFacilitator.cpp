@@ -133,6 +133,8 @@ public:
 
     void ScheduleImmediatePoll() { Initiator::ScheduleImmediatePoll(); }
 
+    CHIP_ERROR AbortTransfer() { return mTransfer.AbortTransfer(StatusCode::kUnknown); }
+
     std::optional<TransferSessionOutputHandler> mTransferSessionOutputHandler{ std::nullopt };
 };
 
@@ -212,3 +214,36 @@ TEST_F(TestTransferFacilitator, PollsForOutput)
     // Check if the timer was started
     EXPECT_TRUE(timerStarted);
 }
+
+TEST_F(TestTransferFacilitator, HandlesOutputPreparedByHandlerWithoutWaitingForPoll)
+{
+    TestInitiator initiator;
+    gSystemLayerAndClock.mStartTimerHook = std::nullopt;
+
+    auto initData = TransferSession::TransferInitData();
+
+    initData.TransferCtlFlags = TransferControlFlags::kSenderDrive;
+    initData.MaxBlockSize     = 1024;
+    initData.Length           = 10000;
+    initData.FileDesignator   = reinterpret_cast<const uint8_t *>("test_file.txt");
+    initData.FileDesLength    = static_cast<uint16_t>(strlen(reinterpret_cast<const char *>(initData.FileDesignator)));
+
+    gSystemLayerAndClock.SetMonotonic(0_ms);
+
+    EXPECT_EQ(initiator.InitiateTransfer(&gSystemLayerAndClock, TransferRole::kSender, initData, System::Clock::Seconds16(10),
+                                         System::Clock::Milliseconds32(2000)),
+              CHIP_NO_ERROR);
+
+    // Aborting the transfer when the init message goes out prepares a StatusReport, which must be handled by the same poll.
+    int messagesToSend                      = 0;
+    initiator.mTransferSessionOutputHandler = [&messagesToSend, &initiator](TransferSession::OutputEvent & event) {
+        if (event.EventType == TransferSession::OutputEventType::kMsgToSend && ++messagesToSend == 1)
+        {
+            EXPECT_EQ(initiator.AbortTransfer(), CHIP_NO_ERROR);
+        }
+    };
+
+    // The init message is sent without waiting for the poll period.
+    gSystemLayerAndClock.AdvanceMonotonic(1_ms);
+    EXPECT_EQ(messagesToSend, 2);
+}
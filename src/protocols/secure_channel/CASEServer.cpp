@@ -48,24 +48,31 @@ CHIP_ERROR CASEServer::ListenForSessionEstablishment(Messaging::ExchangeManager
     mGroupDataProvider         = responderGroupDataProvider;
 
     // Set up the group state provider that persists across all handshakes.
-    GetSession().SetGroupDataProvider(mGroupDataProvider);
+    for (auto & responder : mResponders)
+    {
+        responder.Release();
+        responder.mSession.SetGroupDataProvider(mGroupDataProvider);
+    }
 
     ChipLogProgress(Inet, "CASE Server enabling CASE session setups");
     TEMPORARY_RETURN_IGNORED mExchangeManager->RegisterUnsolicitedMessageHandlerForType(
         Protocols::SecureChannel::MsgType::CASE_Sigma1, this);
 
-    PrepareForSessionEstablishment();
+    // See OnHandshakeCompleted for why this should never fail.
+    VerifyOrDie(PrepareForSessionEstablishment(mResponders[0]) == CHIP_NO_ERROR);
 
     return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR CASEServer::InitCASEHandshake(Messaging::ExchangeContext * ec)
+CHIP_ERROR CASEServer::InitCASEHandshake(Responder & responder, Messaging::ExchangeContext * ec)
 {
     MATTER_TRACE_SCOPE("InitCASEHandshake", "CASEServer");
     VerifyOrReturnError(ec != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
 
+    responder.mPeerAddress = ec->GetSessionHandle()->AsUnauthenticatedSession()->GetPeerAddress();
+
     // Hand over the exchange context to the CASE session.
-    ec->SetDelegate(&GetSession());
+    ec->SetDelegate(&responder.mSession);
 
     return CHIP_NO_ERROR;
 }
@@ -82,67 +89,53 @@ CHIP_ERROR CASEServer::OnMessageReceived(Messaging::ExchangeContext * ec, const
 {
     MATTER_TRACE_SCOPE("OnMessageReceived", "CASEServer");
 
-    bool busy = GetSession().GetState() != CASESession::State::kInitialized;
-    CHIP_FAULT_INJECT(FaultInjection::kFault_CASEServerBusy, busy = true);
-    if (busy)
+    if (!ec->GetSessionHandle()->IsUnauthenticatedSession())
     {
-        // We are in the middle of CASE handshake
+        ChipLogError(Inet, "CASE Server received Sigma1 message %s EC %p", "over encrypted session. Ignoring.", ec);
+        return CHIP_ERROR_INCORRECT_STATE;
+    }
 
-        // Invoke watchdog to fix any stuck handshakes
-        bool watchdogFired = GetSession().InvokeBackgroundWorkWatchdog();
-        if (!watchdogFired)
-        {
-            // Handshake wasn't stuck, send the busy status report and let the existing handshake continue.
+    const Transport::PeerAddress & peerAddress = ec->GetSessionHandle()->AsUnauthenticatedSession()->GetPeerAddress();
 
-            // A successful CASE handshake can take several seconds and some may time out (30 seconds or more).
+    Responder * responder = FindResponderForHandshake(peerAddress);
+    CHIP_FAULT_INJECT(FaultInjection::kFault_CASEServerBusy, responder = nullptr);
+    if (responder == nullptr)
+    {
+        // We are in the middle of as many CASE handshakes as we can handle
 
-            System::Clock::Milliseconds16 delay = System::Clock::kZero;
-            if (GetSession().GetState() == CASESession::State::kSentSigma2)
-            {
-                // The delay should be however long we think it will take for
-                // that to time out.
-                auto sigma2Timeout = CASESession::ComputeSigma2ResponseTimeout(GetSession().GetRemoteMRPConfig());
-                if (sigma2Timeout < System::Clock::Milliseconds16::max())
-                {
-                    delay = std::chrono::duration_cast<System::Clock::Milliseconds16>(sigma2Timeout);
-                }
-                else
-                {
-                    // Avoid overflow issues, just wait for as long as we can to
-                    // get close to our expected Sigma2 timeout.
-                    delay = System::Clock::Milliseconds16::max();
-                }
-            }
-            else
-            {
-                // For now, setting minimum wait time to 5000 milliseconds if we
-                // have no other information.
-                delay = System::Clock::Milliseconds16(5000);
-            }
-            CHIP_ERROR err = SendBusyStatusReport(ec, delay);
-            if (err != CHIP_NO_ERROR)
+        // Invoke watchdog to fix any stuck handshakes
+        bool watchdogFired = false;
+        for (auto & candidate : mResponders)
+        {
+            if (candidate.IsHandshakeInProgress() && candidate.mSession.InvokeBackgroundWorkWatchdog())
             {
-                ChipLogError(Inet, "Failed to send the busy status report, err:%" CHIP_ERROR_FORMAT, err.Format());
+                watchdogFired = true;
             }
-            return err;
+        }
+
+        if (watchdogFired)
+        {
+            responder = FindResponderForHandshake(peerAddress);
         }
     }
 
-    if (!ec->GetSessionHandle()->IsUnauthenticatedSession())
+    if (responder == nullptr)
     {
-        ChipLogError(Inet, "CASE Server received Sigma1 message %s EC %p", "over encrypted session. Ignoring.", ec);
-        return CHIP_ERROR_INCORRECT_STATE;
+        // Handshakes weren't stuck, send the busy status report and let the existing handshakes continue.
+        CHIP_ERROR err = SendBusyStatusReport(ec, ComputeBusyDelay());
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(Inet, "Failed to send the busy status report, err:%" CHIP_ERROR_FORMAT, err.Format());
+        }
+        return err;
     }
 
     ChipLogProgress(Inet, "CASE Server received Sigma1 message %s EC %p", ". Starting handshake.", ec);
 
-    CHIP_ERROR err = InitCASEHandshake(ec);
+    CHIP_ERROR err = InitCASEHandshake(*responder, ec);
     SuccessOrExit(err);
 
-    // TODO - Enable multiple concurrent CASE session establishment
-    // https://github.com/project-chip/connectedhomeip/issues/8342
-
-    err = GetSession().OnMessageReceived(ec, payloadHeader, std::move(payload));
+    err = responder->mSession.OnMessageReceived(ec, payloadHeader, std::move(payload));
     SuccessOrExit(err);
 
 exit:
@@ -151,9 +144,81 @@ exit:
     return err;
 }
 
-void CASEServer::PrepareForSessionEstablishment(const ScopedNodeId & previouslyEstablishedPeer)
+CASEServer::Responder * CASEServer::FindResponderForHandshake(const Transport::PeerAddress & peerAddress)
+{
+    Responder * available     = nullptr;
+    size_t handshakesWithPeer = 0;
+
+    for (auto & responder : mResponders)
+    {
+        if (responder.IsHandshakeInProgress())
+        {
+            // Peers are told apart by address only, as each new connection from a peer may come from a different port.
+            if (responder.mPeerAddress.GetTransportType() == peerAddress.GetTransportType() &&
+                responder.mPeerAddress.GetIPAddress() == peerAddress.GetIPAddress())
+            {
+                handshakesWithPeer++;
+            }
+        }
+        else if (available == nullptr || (!available->IsPrepared() && responder.IsPrepared()))
+        {
+            // Prefer a responder which already has a secure session reserved.
+            available = &responder;
+        }
+    }
+
+    VerifyOrReturnValue(handshakesWithPeer < mMaxHandshakesPerPeer, nullptr);
+    VerifyOrReturnValue(available != nullptr, nullptr);
+
+    if (!available->IsPrepared())
+    {
+        CHIP_ERROR err = PrepareForSessionEstablishment(*available);
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(Inet, "Unable to set up an additional CASE handshake: %" CHIP_ERROR_FORMAT, err.Format());
+            return nullptr;
+        }
+    }
+
+    return available;
+}
+
+System::Clock::Milliseconds16 CASEServer::ComputeBusyDelay()
+{
+    // A successful CASE handshake can take several seconds and some may time out (30 seconds or more).
+    bool waitingForSigma3                         = false;
+    System::Clock::Milliseconds16 earliestTimeout = System::Clock::Milliseconds16::max();
+
+    for (auto & responder : mResponders)
+    {
+        if (responder.mSession.GetState() == CASESession::State::kSentSigma2)
+        {
+            // The delay should be however long we think it will take for
+            // the first of these handshakes to time out. Timeouts that do not
+            // fit are left at the maximum to avoid overflow issues, which waits
+            // for as long as we can to get close to our expected Sigma2 timeout.
+            auto sigma2Timeout = CASESession::ComputeSigma2ResponseTimeout(responder.mSession.GetRemoteMRPConfig());
+            if (sigma2Timeout < earliestTimeout)
+            {
+                earliestTimeout = std::chrono::duration_cast<System::Clock::Milliseconds16>(sigma2Timeout);
+            }
+            waitingForSigma3 = true;
+        }
+    }
+
+    if (waitingForSigma3)
+    {
+        return earliestTimeout;
+    }
+
+    // For now, setting minimum wait time to 5000 milliseconds if we
+    // have no other information.
+    return System::Clock::Milliseconds16(5000);
+}
+
+CHIP_ERROR CASEServer::PrepareForSessionEstablishment(Responder & responder, const ScopedNodeId & previouslyEstablishedPeer)
 {
-    GetSession().Clear();
+    responder.mSession.Clear();
 
     //
     // This releases our reference to a previously pinned session. If that was a successfully established session and is now
@@ -164,7 +229,7 @@ void CASEServer::PrepareForSessionEstablishment(const ScopedNodeId & previouslyE
     // de-allocated since no one else is holding onto this session. This will mean that when we get to allocating a session below,
     // we'll at least have one free session available in the session table, and won't need to evict an arbitrary session.
     //
-    mPinnedSecureSession.ClearValue();
+    responder.mPinnedSecureSession.ClearValue();
 
     //
     // Indicate to the underlying CASE session to prepare for session establishment requests coming its way. This will
@@ -175,16 +240,14 @@ void CASEServer::PrepareForSessionEstablishment(const ScopedNodeId & previouslyE
     // slot (and thereby free'ing up the slot for the next session attempt). However, this transfer isn't necessary - just
     // evicting a session will ensure it is available for the next attempt.
     //
-    // This call can fail if we have run out memory to allocate SecureSessions. Continuing without taking any action
-    // however will render this node deaf to future handshake requests, so it's better to die here to raise attention to the problem
-    // / facilitate recovery.
-    //
-    // TODO(#17568): Once session eviction is actually in place, this call should NEVER fail and if so, is a logic bug.
-    // Dying here on failure is even more appropriate then.
-    //
-    VerifyOrDie(GetSession().PrepareForSessionEstablishment(*mSessionManager, mFabrics, mSessionResumptionStorage,
-                                                            mCertificateValidityPolicy, this, previouslyEstablishedPeer,
-                                                            GetLocalMRPConfig()) == CHIP_NO_ERROR);
+    CHIP_ERROR err = responder.mSession.PrepareForSessionEstablishment(*mSessionManager, mFabrics, mSessionResumptionStorage,
+                                                                       mCertificateValidityPolicy, &responder,
+                                                                       previouslyEstablishedPeer, GetLocalMRPConfig());
+    if (err != CHIP_NO_ERROR)
+    {
+        responder.Release();
+        return err;
+    }
 
     //
     // PairingSession::mSecureSessionHolder is a weak-reference. If MarkForEviction is called on this session, the session is
@@ -196,36 +259,57 @@ void CASEServer::PrepareForSessionEstablishment(const ScopedNodeId & previouslyE
     //
     // Let's create a SessionHandle strong-reference to it to keep it resident.
     //
-    mPinnedSecureSession = GetSession().CopySecureSession();
+    responder.mPinnedSecureSession = responder.mSession.CopySecureSession();
+    if (!responder.mPinnedSecureSession.HasValue())
+    {
+        responder.Release();
+        return CHIP_ERROR_NO_MEMORY;
+    }
 
+    return CHIP_NO_ERROR;
+}
+
+void CASEServer::OnHandshakeCompleted(Responder & responder, const ScopedNodeId & previouslyEstablishedPeer)
+{
+    if (&responder != &mResponders[0])
+    {
+        // Additional responders only hold onto a secure session for the duration of their handshake.
+        responder.Release();
+        return;
+    }
+
+    //
+    // Preparing the first responder can fail if we have run out memory to allocate SecureSessions. Continuing without taking any
+    // action however will render this node deaf to future handshake requests, so it's better to die here to raise attention to
+    // the problem / facilitate recovery.
     //
-    // If we've gotten this far, it means we have successfully allocated a SecureSession to back our next attempt. If we haven't,
-    // there is a bug somewhere and we should raise attention to it by dying.
+    // TODO(#17568): Once session eviction is actually in place, this call should NEVER fail and if so, is a logic bug.
+    // Dying here on failure is even more appropriate then.
     //
-    VerifyOrDie(mPinnedSecureSession.HasValue());
+    VerifyOrDie(PrepareForSessionEstablishment(responder, previouslyEstablishedPeer) == CHIP_NO_ERROR);
 }
 
-void CASEServer::OnSessionEstablishmentError(CHIP_ERROR err)
+void CASEServer::Responder::OnSessionEstablishmentError(CHIP_ERROR err)
 {
     MATTER_TRACE_SCOPE("OnSessionEstablishmentError", "CASEServer");
     ChipLogError(Inet, "CASE Session establishment failed: %" CHIP_ERROR_FORMAT, err.Format());
 
     MATTER_TRACE_SCOPE("CASEFail", "CASESession");
-    PrepareForSessionEstablishment();
+    mServer->OnHandshakeCompleted(*this);
 }
 
-void CASEServer::OnSessionEstablished(const SessionHandle & session)
+void CASEServer::Responder::OnSessionEstablished(const SessionHandle & session)
 {
     MATTER_TRACE_SCOPE("OnSessionEstablished", "CASEServer");
     ChipLogProgress(Inet, "CASE Session established to peer: " ChipLogFormatScopedNodeId,
                     ChipLogValueScopedNodeId(session->GetPeer()));
-    PrepareForSessionEstablishment(session->GetPeer());
+    mServer->OnHandshakeCompleted(*this, session->GetPeer());
 }
 
 CHIP_ERROR CASEServer::SendBusyStatusReport(Messaging::ExchangeContext * ec, System::Clock::Milliseconds16 minimumWaitTime)
 {
     MATTER_TRACE_SCOPE("SendBusyStatusReport", "CASEServer");
-    ChipLogProgress(Inet, "Already in the middle of CASE handshake, sending busy status report");
+    ChipLogProgress(Inet, "Already in the middle of CASE handshakes, sending busy status report");
 
     System::PacketBufferHandle handle = Protocols::SecureChannel::StatusReport::MakeBusyStatusReportMessage(minimumWaitTime);
     VerifyOrReturnError(!handle.IsNull(), CHIP_ERROR_NO_MEMORY);
@@ -19,25 +19,31 @@
 
 #include <credentials/CertificateValidityPolicy.h>
 #include <credentials/GroupDataProvider.h>
+#include <lib/core/CHIPConfig.h>
 #include <messaging/ExchangeDelegate.h>
 #include <messaging/ExchangeMgr.h>
 #include <protocols/secure_channel/CASESession.h>
 #include <system/SystemClock.h>
+#include <transport/raw/PeerAddress.h>
 
 namespace chip {
 
-class CASEServer : public SessionEstablishmentDelegate,
-                   public Messaging::UnsolicitedMessageHandler,
-                   public Messaging::ExchangeDelegate
+class CASEServer : public Messaging::UnsolicitedMessageHandler, public Messaging::ExchangeDelegate
 {
 public:
-    CASEServer() {}
+    CASEServer()
+    {
+        for (auto & responder : mResponders)
+        {
+            responder.mServer = this;
+        }
+    }
     ~CASEServer() override { Shutdown(); }
 
     /*
-     * This method will shutdown this object, releasing the strong reference to the pinned SecureSession object.
-     * It will also unregister the unsolicited handler and clear out the session object (which will release the weak
-     * reference through the underlying SessionHolder).
+     * This method will shutdown this object, releasing the strong references to the pinned SecureSession objects.
+     * It will also unregister the unsolicited handler and clear out the session objects (which will release the weak
+     * references through the underlying SessionHolders).
      *
      */
     void Shutdown()
@@ -49,8 +55,10 @@ public:
             mExchangeManager = nullptr;
         }
 
-        GetSession().Clear();
-        mPinnedSecureSession.ClearValue();
+        for (auto & responder : mResponders)
+        {
+            responder.Release();
+        }
     }
 
     CHIP_ERROR ListenForSessionEstablishment(Messaging::ExchangeManager * exchangeManager, SessionManager * sessionManager,
@@ -58,9 +66,11 @@ public:
                                              Credentials::CertificateValidityPolicy * policy,
                                              Credentials::GroupDataProvider * responderGroupDataProvider);
 
-    //////////// SessionEstablishmentDelegate Implementation ///////////////
-    void OnSessionEstablishmentError(CHIP_ERROR error) override;
-    void OnSessionEstablished(const SessionHandle & session) override;
+    /*
+     * Limits the number of handshakes that can be in progress at the same time from a single peer address.
+     * Defaults to CHIP_CONFIG_CASE_SERVER_MAX_HANDSHAKES_PER_PEER.
+     */
+    void SetMaxHandshakesPerPeer(size_t maxHandshakesPerPeer) { mMaxHandshakesPerPeer = maxHandshakesPerPeer; }
 
     //// UnsolicitedMessageHandler Implementation ////
     CHIP_ERROR OnUnsolicitedMessageReceived(const PayloadHeader & payloadHeader, ExchangeDelegate *& newDelegate) override;
@@ -71,33 +81,80 @@ public:
     void OnResponseTimeout(Messaging::ExchangeContext * ec) override {}
     Messaging::ExchangeMessageDispatch & GetMessageDispatch() override { return GetSession().GetMessageDispatch(); }
 
-    CASESession & GetSession() { return mPairingSession; }
+    // Session of the responder which is always kept ready for the next handshake.
+    CASESession & GetSession() { return mResponders[0].mSession; }
 
 private:
+    //
+    // A CASE session handling one incoming handshake at a time, along with the
+    // secure session reserved for it.
+    //
+    class Responder : public SessionEstablishmentDelegate
+    {
+    public:
+        //////////// SessionEstablishmentDelegate Implementation ///////////////
+        void OnSessionEstablishmentError(CHIP_ERROR error) override;
+        void OnSessionEstablished(const SessionHandle & session) override;
+
+        bool IsPrepared() const { return mPinnedSecureSession.HasValue(); }
+        bool IsHandshakeInProgress() { return mSession.GetState() != CASESession::State::kInitialized; }
+
+        // Clears the session and gives up the secure session reserved for it.
+        void Release()
+        {
+            mSession.Clear();
+            mPinnedSecureSession.ClearValue();
+        }
+
+        CASEServer * mServer = nullptr;
+        CASESession mSession;
+
+        //
+        // When we're in the process of establishing a session, this is used
+        // to maintain an additional, strong reference to the underlying SecureSession.
+        // This is because the existing reference in PairingSession is a weak one
+        // (i.e a SessionHolder) and can lose its reference if the session is evicted
+        // for any reason.
+        //
+        // This initially points to a session that is not yet active. Upon activation, it
+        // transfers ownership of the session to the SecureSessionManager and this reference
+        // is released before simultaneously acquiring ownership of a new SecureSession.
+        //
+        Optional<SessionHandle> mPinnedSecureSession;
+
+        // Address the Sigma1 of the handshake in progress was received from.
+        Transport::PeerAddress mPeerAddress;
+    };
+
     Messaging::ExchangeManager * mExchangeManager                       = nullptr;
     SessionResumptionStorage * mSessionResumptionStorage                = nullptr;
     Credentials::CertificateValidityPolicy * mCertificateValidityPolicy = nullptr;
 
     //
-    // When we're in the process of establishing a session, this is used
-    // to maintain an additional, strong reference to the underlying SecureSession.
-    // This is because the existing reference in PairingSession is a weak one
-    // (i.e a SessionHolder) and can lose its reference if the session is evicted
-    // for any reason.
-    //
-    // This initially points to a session that is not yet active. Upon activation, it
-    // transfers ownership of the session to the SecureSessionManager and this reference
-    // is released before simultaneously acquiring ownership of a new SecureSession.
+    // The first responder is prepared up front and after each handshake, so that the node always
+    // has a secure session available for the next one. The others only reserve a secure session
+    // when a Sigma1 arrives while the first one is busy, and release it once their handshake is over.
     //
-    Optional<SessionHandle> mPinnedSecureSession;
+    Responder mResponders[CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES];
+    size_t mMaxHandshakesPerPeer = CHIP_CONFIG_CASE_SERVER_MAX_HANDSHAKES_PER_PEER;
 
-    CASESession mPairingSession;
     SessionManager * mSessionManager = nullptr;
 
     FabricTable * mFabrics                              = nullptr;
     Credentials::GroupDataProvider * mGroupDataProvider = nullptr;
 
-    CHIP_ERROR InitCASEHandshake(Messaging::ExchangeContext * ec);
+    CHIP_ERROR InitCASEHandshake(Responder & responder, Messaging::ExchangeContext * ec);
+
+    /*
+     * Returns a responder ready to handle the handshake started by a Sigma1 received from peerAddress,
+     * or nullptr if the handshake cannot be handled at this time and a busy status report should be sent.
+     */
+    Responder * FindResponderForHandshake(const Transport::PeerAddress & peerAddress);
+
+    /*
+     * Minimum wait time to report in the busy status report, based on the handshakes in progress.
+     */
+    System::Clock::Milliseconds16 ComputeBusyDelay();
 
     /*
      * This will clean up any state from a previous session establishment
@@ -108,7 +165,13 @@ private:
      * should be set to the scoped node-id of the peer associated with that session.
      *
      */
-    void PrepareForSessionEstablishment(const ScopedNodeId & previouslyEstablishedPeer = ScopedNodeId());
+    CHIP_ERROR PrepareForSessionEstablishment(Responder & responder,
+                                              const ScopedNodeId & previouslyEstablishedPeer = ScopedNodeId());
+
+    /*
+     * Called by a responder whose handshake is over, successfully or not.
+     */
+    void OnHandshakeCompleted(Responder & responder, const ScopedNodeId & previouslyEstablishedPeer = ScopedNodeId());
 
     // If we are in the middle of handshake and receive a Sigma1 then respond with Busy status code.
     // @param[in] ec              Exchange Context
@@ -2001,6 +2001,10 @@ CHIP_ERROR CASESession::HandleSigma3a(System::PacketBufferHandle && msg)
             SuccessOrExit(err = signedDataTlvReader.ExitContainer(containerType));
         }
 
+        // Initiators re-establishing sessions present credentials that were already verified.
+        data.verifiedChainFromCache = mFabricsTable->FindVerifiedCredentials(data.initiatorNOC, data.initiatorICAC, data.fabricRCAC,
+                                                                             data.validContext, data.verifiedChain);
+
         SuccessOrExit(err = helper->ScheduleWork());
         mHandleSigma3Helper = helper;
         mExchangeCtxt.Value()->WillSendMessage();
@@ -2089,16 +2093,17 @@ CHIP_ERROR CASESession::HandleSigma3b(HandleSigma3Data & data, bool & cancel)
     // Step 5/6
     // Validate initiator identity located in msg->Start()
     // Constructing responder identity
-    CompressedFabricId unused;
-    FabricId initiatorFabricId;
-    P256PublicKey initiatorPublicKey;
-    ReturnErrorOnFailure(FabricTable::VerifyCredentials(data.initiatorNOC, data.initiatorICAC, data.fabricRCAC, data.validContext,
-                                                        unused, initiatorFabricId, data.initiatorNodeId, initiatorPublicKey));
-    VerifyOrReturnError(data.fabricId == initiatorFabricId, CHIP_ERROR_INVALID_CASE_PARAMETER);
+    if (!data.verifiedChainFromCache)
+    {
+        ReturnErrorOnFailure(FabricTable::VerifyCredentials(data.initiatorNOC, data.initiatorICAC, data.fabricRCAC,
+                                                            data.validContext, data.verifiedChain));
+    }
+    VerifyOrReturnError(data.fabricId == data.verifiedChain.fabricId, CHIP_ERROR_INVALID_CASE_PARAMETER);
+    data.initiatorNodeId = data.verifiedChain.nodeId;
 
     // Step 7 - Validate Signature
-    ReturnErrorOnFailure(initiatorPublicKey.ECDSA_validate_msg_signature(data.msgR3SignedSpan.data(), data.msgR3SignedSpan.size(),
-                                                                         data.tbsData3Signature));
+    ReturnErrorOnFailure(data.verifiedChain.nocPublicKey.ECDSA_validate_msg_signature(
+        data.msgR3SignedSpan.data(), data.msgR3SignedSpan.size(), data.tbsData3Signature));
 
     return CHIP_NO_ERROR;
 }
@@ -2111,6 +2116,12 @@ CHIP_ERROR CASESession::HandleSigma3c(HandleSigma3Data & data, CHIP_ERROR status
 
     SuccessOrExit(err = status);
 
+    if (!data.verifiedChainFromCache)
+    {
+        mFabricsTable->CacheVerifiedCredentials(mFabricIndex, data.initiatorNOC, data.initiatorICAC, data.fabricRCAC,
+                                                data.validContext, data.verifiedChain);
+    }
+
     mPeerNodeId = data.initiatorNodeId;
 
     {
@@ -332,6 +332,10 @@ protected:
         NodeId initiatorNodeId;
 
         Credentials::ValidationContext validContext;
+
+        // Outcome of the initiator credentials verification, already known when they were found in the fabric table cache.
+        Credentials::VerifiedCertChain verifiedChain;
+        bool verifiedChainFromCache = false;
     };
 
     /**
@@ -626,10 +626,11 @@ TEST_F(TestCASESession, ClientReceivesBusyTest)
 
     ServiceEvents();
 
-    // We should have one full handshake and one Sigma1 + Busy + ack.  If that
-    // ever changes (e.g. because our server starts supporting multiple parallel
-    // handshakes), this test needs to be fixed so that the server is still
-    // responding BUSY to the client.
+    // We should have one full handshake and one Sigma1 + Busy + ack.  Both
+    // handshakes come from the same loopback address, so the server only
+    // takes on one of them as long as it allows a single handshake per peer.
+    // If that ever changes, this test needs to be fixed so that the server is
+    // still responding BUSY to the client.
     EXPECT_EQ(loopback.mSentMessageCount, sTestCaseMessageCount + 3);
     EXPECT_EQ(delegateCommissioner1.mNumPairingComplete, 1u);
     EXPECT_EQ(delegateCommissioner2.mNumPairingComplete, 0u);
@@ -643,6 +644,54 @@ TEST_F(TestCASESession, ClientReceivesBusyTest)
     gPairingServer.Shutdown();
 }
 
+#if CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES > 1
+TEST_F(TestCASESession, ServerHandlesConcurrentHandshakesTest)
+{
+    TemporarySessionManager sessionManager(*this);
+    TestCASESecurePairingDelegate delegateCommissioner1, delegateCommissioner2;
+    CASESession pairingCommissioner1, pairingCommissioner2;
+
+    pairingCommissioner1.SetGroupDataProvider(&gCommissionerGroupDataProvider);
+    pairingCommissioner2.SetGroupDataProvider(&gCommissionerGroupDataProvider);
+
+    auto & loopback            = GetLoopback();
+    loopback.mSentMessageCount = 0;
+
+    // Both handshakes come from the same loopback address.
+    gPairingServer.SetMaxHandshakesPerPeer(2);
+    EXPECT_EQ(gPairingServer.ListenForSessionEstablishment(&GetExchangeManager(), &GetSecureSessionManager(), &gDeviceFabrics,
+                                                           nullptr, nullptr, &gDeviceGroupDataProvider),
+              CHIP_NO_ERROR);
+
+    ExchangeContext * contextCommissioner1 = NewUnauthenticatedExchangeToBob(&pairingCommissioner1);
+    ExchangeContext * contextCommissioner2 = NewUnauthenticatedExchangeToBob(&pairingCommissioner2);
+
+    EXPECT_EQ(pairingCommissioner1.EstablishSession(sessionManager, &gCommissionerFabrics,
+                                                    ScopedNodeId{ Node01_01, gCommissionerFabricIndex }, contextCommissioner1,
+                                                    nullptr, nullptr, &delegateCommissioner1, NullOptional),
+              CHIP_NO_ERROR);
+    EXPECT_SUCCESS(pairingCommissioner2.EstablishSession(sessionManager, &gCommissionerFabrics,
+                                                         ScopedNodeId{ Node01_01, gCommissionerFabricIndex }, contextCommissioner2,
+                                                         nullptr, nullptr, &delegateCommissioner2, NullOptional));
+
+    ServiceEvents();
+
+    // Both handshakes should have completed, without any busy response.
+    EXPECT_EQ(loopback.mSentMessageCount, 2 * sTestCaseMessageCount);
+    EXPECT_EQ(delegateCommissioner1.mNumPairingComplete, 1u);
+    EXPECT_EQ(delegateCommissioner2.mNumPairingComplete, 1u);
+
+    EXPECT_EQ(delegateCommissioner1.mNumPairingErrors, 0u);
+    EXPECT_EQ(delegateCommissioner2.mNumPairingErrors, 0u);
+
+    EXPECT_EQ(delegateCommissioner1.mNumBusyResponses, 0u);
+    EXPECT_EQ(delegateCommissioner2.mNumBusyResponses, 0u);
+
+    gPairingServer.Shutdown();
+    gPairingServer.SetMaxHandshakesPerPeer(CHIP_CONFIG_CASE_SERVER_MAX_HANDSHAKES_PER_PEER);
+}
+#endif // CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES > 1
+
 #if CHIP_WITH_NLFAULTINJECTION
 
 /* This tests that Corrupting Signature during a CASE Handshake will lead to CASE Failing and to the Correct Error returned.
@@ -381,6 +381,48 @@
 #define CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE 15
 #endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE */
 
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_HEAP_CACHE_SIZE
+ *
+ *  @brief
+ *      When packet buffers are allocated from the heap (CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE is 0), the number of freed
+ *      buffers of each size class (small and MTU-sized) that are kept for reuse instead of being returned to the heap.
+ *
+ *      Buffers of a size class occupy the memory block of the whole class, whatever their requested size. Buffers larger than
+ *      the MTU are always allocated with their exact size.
+ *
+ *      Zero (0), the default, allocates every buffer with its exact size. Platforms with memory to spare, such as Linux and
+ *      Darwin hosts, enable it in their SystemPlatformConfig.h, except in ASAN builds where reusing buffers would hide
+ *      use-after-free errors.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_HEAP_CACHE_SIZE
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_HEAP_CACHE_SIZE 0
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_HEAP_CACHE_SIZE */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_HEAP_SMALL_SIZE
+ *
+ *  @brief
+ *      Allocation size, reserved space included, of the small packet buffer size class (see
+ *      CHIP_SYSTEM_CONFIG_PACKETBUFFER_HEAP_CACHE_SIZE), which should fit acknowledgements and status reports.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_HEAP_SMALL_SIZE
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_HEAP_SMALL_SIZE 256
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_HEAP_SMALL_SIZE */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_HEAP_THREAD_CACHE
+ *
+ *  @brief
+ *      Keep the packet buffers cached for reuse (see CHIP_SYSTEM_CONFIG_PACKETBUFFER_HEAP_CACHE_SIZE) in per-thread free lists
+ *      (1), which need no locking, instead of free lists shared by all threads (0). Requires \c thread_local support.
+ *
+ *      Buffers cached by a thread are returned to the heap when it exits.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_HEAP_THREAD_CACHE
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_HEAP_THREAD_CACHE 0
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_HEAP_THREAD_CACHE */
+
 /**
  *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_LWIP_PBUF_RAM
  *
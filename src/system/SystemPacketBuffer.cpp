@@ -123,6 +123,194 @@ void PacketBuffer::InternalCheck(const PacketBuffer * buffer)
 }
 #endif // CHIP_SYSTEM_PACKETBUFFER_HAS_CHECK
 
+namespace {
+
+#if CHIP_SYSTEM_PACKETBUFFER_HAS_HEAP_CACHE
+
+// Allocation sizes of the size classes. A buffer of at most one of these sizes is held in a memory block of the smallest
+// matching class, and freed blocks are kept in per-class free lists. AllocSize() remains the requested size, from which Free()
+// finds the class of the block again.
+constexpr size_t kSizeClasses[]  = { CHIP_SYSTEM_CONFIG_PACKETBUFFER_HEAP_SMALL_SIZE, PacketBuffer::kMaxSizeWithoutReserve };
+constexpr size_t kNumSizeClasses = sizeof(kSizeClasses) / sizeof(kSizeClasses[0]);
+constexpr size_t kNoSizeClass    = kNumSizeClasses;
+
+static_assert(CHIP_SYSTEM_CONFIG_PACKETBUFFER_HEAP_SMALL_SIZE < PacketBuffer::kMaxSizeWithoutReserve,
+              "The small packet buffer size class must be smaller than the MTU size class");
+
+size_t SizeClassFor(size_t allocSize)
+{
+    for (size_t sizeClass = 0; sizeClass < kNumSizeClasses; sizeClass++)
+    {
+        if (allocSize <= kSizeClasses[sizeClass])
+        {
+            return sizeClass;
+        }
+    }
+    return kNoSizeClass;
+}
+
+// Free blocks are linked through their first bytes.
+struct CachedBlock
+{
+    CachedBlock * next;
+};
+
+struct FreeList
+{
+    CachedBlock * head = nullptr;
+    size_t count     = 0;
+};
+
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_HEAP_THREAD_CACHE
+
+struct ThreadFreeLists
+{
+    ~ThreadFreeLists() { PacketBuffer::ReleaseCachedBuffers(); }
+
+    FreeList lists[kNumSizeClasses];
+};
+
+thread_local ThreadFreeLists tFreeLists;
+
+FreeList * AcquireFreeLists()
+{
+    return tFreeLists.lists;
+}
+
+void ReleaseFreeLists() {}
+
+#else // CHIP_SYSTEM_CONFIG_PACKETBUFFER_HEAP_THREAD_CACHE
+
+FreeList sFreeLists[kNumSizeClasses];
+
+#if !CHIP_SYSTEM_CONFIG_NO_LOCKING
+Mutex sFreeListsMutex;
+
+bool InitFreeListsMutex()
+{
+    SuccessOrDie(Mutex::Init(sFreeListsMutex));
+    return true;
+}
+
+[[maybe_unused]] const bool sFreeListsMutexInitialized = InitFreeListsMutex();
+#endif // !CHIP_SYSTEM_CONFIG_NO_LOCKING
+
+FreeList * AcquireFreeLists()
+{
+#if !CHIP_SYSTEM_CONFIG_NO_LOCKING
+#if CHIP_SYSTEM_CONFIG_FREERTOS_LOCKING
+    if (!sFreeListsMutex.isInitialized())
+    {
+        SuccessOrDie(Mutex::Init(sFreeListsMutex));
+    }
+#endif
+    sFreeListsMutex.Lock();
+#endif // !CHIP_SYSTEM_CONFIG_NO_LOCKING
+    return sFreeLists;
+}
+
+void ReleaseFreeLists()
+{
+#if !CHIP_SYSTEM_CONFIG_NO_LOCKING
+    sFreeListsMutex.Unlock();
+#endif // !CHIP_SYSTEM_CONFIG_NO_LOCKING
+}
+
+#endif // CHIP_SYSTEM_CONFIG_PACKETBUFFER_HEAP_THREAD_CACHE
+
+#endif // CHIP_SYSTEM_PACKETBUFFER_HAS_HEAP_CACHE
+
+} // namespace
+
+size_t PacketBuffer::BlockSizeFor(size_t allocSize)
+{
+#if CHIP_SYSTEM_PACKETBUFFER_HAS_HEAP_CACHE
+    const size_t sizeClass = SizeClassFor(allocSize);
+    if (sizeClass != kNoSizeClass)
+    {
+        return kStructureSize + kSizeClasses[sizeClass];
+    }
+#endif // CHIP_SYSTEM_PACKETBUFFER_HAS_HEAP_CACHE
+    return kStructureSize + allocSize;
+}
+
+void * PacketBuffer::AllocateBlock(size_t allocSize)
+{
+#if CHIP_SYSTEM_PACKETBUFFER_HAS_HEAP_CACHE
+    const size_t sizeClass = SizeClassFor(allocSize);
+    if (sizeClass != kNoSizeClass)
+    {
+        FreeList & freeList = AcquireFreeLists()[sizeClass];
+        CachedBlock * block = freeList.head;
+        if (block != nullptr)
+        {
+            freeList.head = block->next;
+            freeList.count--;
+            SYSTEM_STATS_DECREMENT(chip::System::Stats::kSystemLayer_NumCachedPacketBufs);
+        }
+        ReleaseFreeLists();
+
+        if (block != nullptr)
+        {
+            return block;
+        }
+    }
+#endif // CHIP_SYSTEM_PACKETBUFFER_HAS_HEAP_CACHE
+    return chip::Platform::MemoryAlloc(BlockSizeFor(allocSize));
+}
+
+void PacketBuffer::FreeBlock(PacketBuffer * buffer, size_t allocSize)
+{
+#if CHIP_SYSTEM_PACKETBUFFER_HAS_HEAP_CACHE
+    const size_t sizeClass = SizeClassFor(allocSize);
+    if (sizeClass != kNoSizeClass)
+    {
+        FreeList & freeList = AcquireFreeLists()[sizeClass];
+        const bool cached   = freeList.count < CHIP_SYSTEM_CONFIG_PACKETBUFFER_HEAP_CACHE_SIZE;
+        if (cached)
+        {
+            CachedBlock * block = reinterpret_cast<CachedBlock *>(buffer);
+            block->next         = freeList.head;
+            freeList.head       = block;
+            freeList.count++;
+            SYSTEM_STATS_INCREMENT(chip::System::Stats::kSystemLayer_NumCachedPacketBufs);
+        }
+        ReleaseFreeLists();
+
+        VerifyOrReturn(!cached);
+    }
+#endif // CHIP_SYSTEM_PACKETBUFFER_HAS_HEAP_CACHE
+    chip::Platform::MemoryFree(buffer);
+}
+
+#if CHIP_SYSTEM_PACKETBUFFER_HAS_HEAP_CACHE
+void PacketBuffer::ReleaseCachedBuffers()
+{
+    FreeList * freeLists = AcquireFreeLists();
+    CachedBlock * blocks = nullptr;
+    for (size_t sizeClass = 0; sizeClass < kNumSizeClasses; sizeClass++)
+    {
+        while (freeLists[sizeClass].head != nullptr)
+        {
+            CachedBlock * block       = freeLists[sizeClass].head;
+            freeLists[sizeClass].head = block->next;
+            block->next               = blocks;
+            blocks                    = block;
+            SYSTEM_STATS_DECREMENT(chip::System::Stats::kSystemLayer_NumCachedPacketBufs);
+        }
+        freeLists[sizeClass].count = 0;
+    }
+    ReleaseFreeLists();
+
+    while (blocks != nullptr)
+    {
+        CachedBlock * next = blocks->next;
+        chip::Platform::MemoryFree(blocks);
+        blocks = next;
+    }
+}
+#endif // CHIP_SYSTEM_PACKETBUFFER_HAS_HEAP_CACHE
+
 // Number of unused bytes below which \c RightSize() won't bother reallocating.
 constexpr uint16_t kRightSizingThreshold = 16;
 
@@ -138,13 +326,14 @@ void PacketBufferHandle::InternalRightSize()
     const uint8_t * const start   = mBuffer->ReserveStart();
     const uint8_t * const payload = mBuffer->Start();
     const size_t usedSize         = static_cast<size_t>(payload - start + static_cast<ptrdiff_t>(mBuffer->len));
-    if (usedSize + kRightSizingThreshold > mBuffer->alloc_size)
+    // With size classes, a smaller buffer may still need the same memory block.
+    if (usedSize + kRightSizingThreshold > mBuffer->alloc_size ||
+        PacketBuffer::BlockSizeFor(usedSize) == PacketBuffer::BlockSizeFor(mBuffer->alloc_size))
     {
         return;
     }
 
-    const size_t blockSize   = usedSize + PacketBuffer::kStructureSize;
-    PacketBuffer * newBuffer = reinterpret_cast<PacketBuffer *>(chip::Platform::MemoryAlloc(blockSize));
+    PacketBuffer * newBuffer = reinterpret_cast<PacketBuffer *>(PacketBuffer::AllocateBlock(usedSize));
     if (newBuffer == nullptr)
     {
         ChipLogError(chipSystemLayer, "PacketBuffer: pool EMPTY.");
@@ -642,9 +831,8 @@ PacketBufferHandle PacketBufferHandle::New(size_t aAvailableSize, uint16_t aRese
 
 #elif CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
     // sumOfSizes is essentially (kStructureSize + lAllocSize) which we already
-    // checked to fit in a size_t.
-    const size_t lBlockSize = static_cast<size_t>(sumOfSizes);
-    lPacket                 = reinterpret_cast<PacketBuffer *>(chip::Platform::MemoryAlloc(lBlockSize));
+    // checked to fit in a size_t. Size class blocks are no larger than kBlockSize.
+    lPacket = reinterpret_cast<PacketBuffer *>(PacketBuffer::AllocateBlock(lAllocSize));
 
 #else
 #error "Unimplemented PacketBuffer storage case"
@@ -725,13 +913,14 @@ void PacketBuffer::Free(PacketBuffer * aPacket)
             SYSTEM_STATS_DECREMENT(chip::System::Stats::kSystemLayer_NumPacketBufs);
 #if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
             ::chip::Platform::MemoryDebugCheckPointer(aPacket, aPacket->alloc_size + kStructureSize);
+            const size_t lAllocSize = aPacket->alloc_size;
 #endif
             aPacket->Clear();
 #if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_POOL
             aPacket->next = sFreeList;
             sFreeList     = aPacket;
 #elif CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
-            chip::Platform::MemoryFree(aPacket);
+            FreeBlock(aPacket, lAllocSize);
 #endif
             aPacket       = lNextPacket;
         }
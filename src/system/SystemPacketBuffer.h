@@ -83,7 +83,9 @@ struct pbuf
  *
  *      New objects of PacketBuffer class are initialized at the beginning of an allocation of memory obtained from the underlying
  *      environment, e.g. from LwIP pbuf target pools, from the standard C library heap, from an internal buffer pool. In the
- *      simple pool case, the size of the data buffer is PacketBuffer::kBlockSize.
+ *      simple pool case, the size of the data buffer is PacketBuffer::kBlockSize. In the heap case, buffers no larger than the MTU
+ *      are held in memory blocks of a few size classes, which are reused after being freed (see
+ *      CHIP_SYSTEM_CONFIG_PACKETBUFFER_HEAP_CACHE_SIZE).
  *
  *      PacketBuffer objects may be chained to accommodate larger payloads.  Chaining, however, is not transparent, and users of the
  *      class must explicitly decide to support chaining.  Examples of classes written with chaining support are as follows:
@@ -373,6 +375,14 @@ public:
 #endif
     }
 
+#if CHIP_SYSTEM_PACKETBUFFER_HAS_HEAP_CACHE
+    /**
+     * Return the freed buffers kept for reuse to the heap: the ones cached by the calling thread when per-thread caches are
+     * enabled, all of them otherwise.
+     */
+    static void ReleaseCachedBuffers();
+#endif // CHIP_SYSTEM_PACKETBUFFER_HAS_HEAP_CACHE
+
 private:
     // Memory required for a maximum-size PacketBuffer.
     static constexpr uint16_t kBlockSize = PacketBuffer::kStructureSize + PacketBuffer::kMaxSizeWithoutReserve;
@@ -393,6 +403,13 @@ private:
     static void InternalCheck(const PacketBuffer * buffer);
 #endif
 
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
+    // Memory blocks of heap buffers, taken from the size-classed free lists when CHIP_SYSTEM_PACKETBUFFER_HAS_HEAP_CACHE.
+    static size_t BlockSizeFor(size_t allocSize);
+    static void * AllocateBlock(size_t allocSize);
+    static void FreeBlock(PacketBuffer * buffer, size_t allocSize);
+#endif // CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
+
     void AddRef();
     bool HasSoleOwnership() const { return (this->ref == 1); }
     static void Free(PacketBuffer * aPacket);
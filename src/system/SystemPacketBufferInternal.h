@@ -38,6 +38,17 @@
 #define CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP 0
 #endif
 
+/**
+ * CHIP_SYSTEM_PACKETBUFFER_HAS_HEAP_CACHE
+ *
+ * True if freed heap packet buffers are kept for reuse in size-classed free lists.
+ */
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP && (CHIP_SYSTEM_CONFIG_PACKETBUFFER_HEAP_CACHE_SIZE > 0)
+#define CHIP_SYSTEM_PACKETBUFFER_HAS_HEAP_CACHE 1
+#else
+#define CHIP_SYSTEM_PACKETBUFFER_HAS_HEAP_CACHE 0
+#endif
+
 /**
  * CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_POOL
  *
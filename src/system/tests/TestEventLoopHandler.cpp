@@ -21,7 +21,7 @@
 #include <pw_unit_test/framework.h>
 #include <system/SystemConfig.h>
 
-// EventLoopHandlers are only supported by a select-based LayerSocketsLoop
+// EventLoopHandlers are only supported by a select- or epoll-based LayerSocketsLoop
 #if CHIP_SYSTEM_CONFIG_USE_SOCKETS && !CHIP_SYSTEM_CONFIG_USE_DISPATCH
 // The fake PlatformManagerImpl does not drive the system layer event loop
 #if !CHIP_DEVICE_LAYER_TARGET_FAKE
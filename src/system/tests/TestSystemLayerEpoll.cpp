@@ -0,0 +1,204 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This is a unit test suite for the socket watches of <tt>chip::System::LayerImplEpoll</tt>.
+ *
+ */
+
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/tests/ExtraPwTestMacros.h>
+#include <system/SystemLayerImplEpoll.h>
+
+using namespace chip;
+using namespace chip::System;
+
+namespace {
+
+class TestSystemLayerEpoll : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite()
+    {
+        ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR);
+        EXPECT_SUCCESS(sLayer.Init());
+    }
+
+    static void TearDownTestSuite()
+    {
+        sLayer.Shutdown();
+        Platform::MemoryShutdown();
+    }
+
+    // Runs a single epoll_wait() batch; callers make sure that something is ready so that it does not block.
+    static void ServiceEvents()
+    {
+        sLayer.PrepareEvents();
+        sLayer.WaitForEvents();
+        sLayer.HandleEvents();
+    }
+
+    static LayerImplEpoll sLayer;
+};
+
+LayerImplEpoll TestSystemLayerEpoll::sLayer;
+
+// A connected pair of non-blocking sockets, the first of which is watched.
+struct SocketPair
+{
+    SocketPair() { VerifyOrDie(socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, mFds) == 0); }
+    ~SocketPair()
+    {
+        CloseIfOpen(mFds[0]);
+        CloseIfOpen(mFds[1]);
+    }
+
+    static void CloseIfOpen(int & fd)
+    {
+        if (fd >= 0)
+        {
+            close(fd);
+            fd = -1;
+        }
+    }
+
+    int & Watched() { return mFds[0]; }
+    void SendByte() { EXPECT_EQ(write(mFds[1], "x", 1), 1); }
+
+    int mFds[2];
+};
+
+struct CallbackRecord
+{
+    SocketEvents mEvents;
+    int mCount = 0;
+};
+
+void RecordCallback(SocketEvents events, intptr_t data)
+{
+    CallbackRecord * record = reinterpret_cast<CallbackRecord *>(data);
+    record->mEvents         = events;
+    record->mCount++;
+}
+
+TEST_F(TestSystemLayerEpoll, TestReadAndWriteCallbacks)
+{
+    SocketPair sockets;
+    CallbackRecord record;
+    SocketWatchToken token;
+
+    EXPECT_SUCCESS(sLayer.StartWatchingSocket(sockets.Watched(), &token));
+    EXPECT_SUCCESS(sLayer.SetCallback(token, RecordCallback, reinterpret_cast<intptr_t>(&record)));
+
+    // A connected socket is writable right away.
+    EXPECT_SUCCESS(sLayer.RequestCallbackOnPendingWrite(token));
+    ServiceEvents();
+    EXPECT_EQ(record.mCount, 1);
+    EXPECT_TRUE(record.mEvents.Has(SocketEventFlags::kWrite));
+    EXPECT_FALSE(record.mEvents.Has(SocketEventFlags::kRead));
+
+    EXPECT_SUCCESS(sLayer.ClearCallbackOnPendingWrite(token));
+    EXPECT_SUCCESS(sLayer.RequestCallbackOnPendingRead(token));
+    sockets.SendByte();
+    ServiceEvents();
+    EXPECT_EQ(record.mCount, 2);
+    EXPECT_TRUE(record.mEvents.Has(SocketEventFlags::kRead));
+    EXPECT_FALSE(record.mEvents.Has(SocketEventFlags::kWrite));
+
+    EXPECT_SUCCESS(sLayer.StopWatchingSocket(&token));
+    EXPECT_EQ(token, sLayer.InvalidSocketWatchToken());
+}
+
+// Two watches become readable in the same batch. The callback of whichever is dispatched first stops the other one and
+// watches a new socket in its place, with the same FD number and in the same slot. The events already collected for the
+// stopped watch must not reach the new one.
+struct ReuseContext
+{
+    SocketPair mSockets[2];
+    SocketPair mReplacement;
+    SocketWatchToken mTokens[2];
+    int mOriginalCallbacks = 0;
+    CallbackRecord mReplacementRecord;
+    bool mSameSlot = false;
+};
+
+ReuseContext * gReuseContext = nullptr;
+
+void ReplaceOtherWatchCallback(SocketEvents, intptr_t data)
+{
+    ReuseContext & context = *gReuseContext;
+    const size_t other     = (data == 0) ? 1 : 0;
+
+    context.mOriginalCallbacks++;
+
+    // Consume the data so that this watch does not show up again in the next batch.
+    char byte;
+    EXPECT_EQ(read(context.mSockets[data].Watched(), &byte, 1), 1);
+
+    const SocketWatchToken oldToken = context.mTokens[other];
+    const int fd                    = context.mSockets[other].Watched();
+    EXPECT_SUCCESS(TestSystemLayerEpoll::sLayer.StopWatchingSocket(&context.mTokens[other]));
+
+    // Move the idle replacement socket onto the FD number that was just released.
+    VerifyOrDie(dup2(context.mReplacement.Watched(), fd) == fd);
+
+    EXPECT_SUCCESS(TestSystemLayerEpoll::sLayer.StartWatchingSocket(fd, &context.mTokens[other]));
+    EXPECT_SUCCESS(TestSystemLayerEpoll::sLayer.SetCallback(context.mTokens[other], RecordCallback,
+                                                            reinterpret_cast<intptr_t>(&context.mReplacementRecord)));
+    EXPECT_SUCCESS(TestSystemLayerEpoll::sLayer.RequestCallbackOnPendingRead(context.mTokens[other]));
+    context.mSameSlot = (context.mTokens[other] == oldToken);
+}
+
+TEST_F(TestSystemLayerEpoll, TestStaleEventsAfterFdReuse)
+{
+    ReuseContext context;
+    gReuseContext = &context;
+
+    for (intptr_t i = 0; i < 2; i++)
+    {
+        EXPECT_SUCCESS(sLayer.StartWatchingSocket(context.mSockets[i].Watched(), &context.mTokens[i]));
+        EXPECT_SUCCESS(sLayer.SetCallback(context.mTokens[i], ReplaceOtherWatchCallback, i));
+        EXPECT_SUCCESS(sLayer.RequestCallbackOnPendingRead(context.mTokens[i]));
+        context.mSockets[i].SendByte();
+    }
+
+    ServiceEvents();
+
+    EXPECT_TRUE(context.mSameSlot);
+    EXPECT_EQ(context.mOriginalCallbacks, 1);
+    EXPECT_EQ(context.mReplacementRecord.mCount, 0);
+
+    // The new registration still works once it actually becomes readable.
+    context.mReplacement.SendByte();
+    ServiceEvents();
+    EXPECT_EQ(context.mReplacementRecord.mCount, 1);
+    EXPECT_TRUE(context.mReplacementRecord.mEvents.Has(SocketEventFlags::kRead));
+
+    EXPECT_SUCCESS(sLayer.StopWatchingSocket(&context.mTokens[0]));
+    EXPECT_SUCCESS(sLayer.StopWatchingSocket(&context.mTokens[1]));
+    gReuseContext = nullptr;
+}
+
+} // namespace
@@ -39,6 +39,7 @@
 #include <lib/support/tests/ExtraPwTestMacros.h>
 #include <platform/CHIPDeviceLayer.h>
 #include <system/SystemPacketBuffer.h>
+#include <system/SystemStats.h>
 
 #if CHIP_SYSTEM_CONFIG_USE_LWIP
 #include <lwip/init.h>
@@ -184,6 +185,9 @@ public:
     void CheckHandleConstruct();
     void CheckHandleFree();
     void CheckHandleHold();
+#if CHIP_SYSTEM_PACKETBUFFER_HAS_HEAP_CACHE
+    void CheckHeapSizeClasses();
+#endif
     void CheckHandleMove();
     void CheckHandleRelease();
     void CheckHandleRetain();
@@ -1719,6 +1723,44 @@ TEST_F_FROM_FIXTURE(TestSystemPacketBuffer, CheckHandleCloneData)
 #endif // CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
 }
 
+#if CHIP_SYSTEM_PACKETBUFFER_HAS_HEAP_CACHE
+TEST_F_FROM_FIXTURE(TestSystemPacketBuffer, CheckHeapSizeClasses)
+{
+    PacketBuffer::ReleaseCachedBuffers();
+    EXPECT_TRUE(SYSTEM_STATS_TEST_IN_USE(Stats::kSystemLayer_NumCachedPacketBufs, 0));
+
+    // A freed buffer is reused for the next allocation of its size class, whatever the requested size.
+    const PacketBuffer * small = PacketBufferHandle::New(10).Get();
+    EXPECT_TRUE(SYSTEM_STATS_TEST_IN_USE(Stats::kSystemLayer_NumCachedPacketBufs, 1));
+    {
+        PacketBufferHandle handle = PacketBufferHandle::New(20);
+        EXPECT_EQ(handle.Get(), small);
+        EXPECT_EQ(handle->AllocSize(), 20u + PacketBuffer::kDefaultHeaderReserve);
+        EXPECT_TRUE(SYSTEM_STATS_TEST_IN_USE(Stats::kSystemLayer_NumCachedPacketBufs, 0));
+
+        PacketBufferHandle mtu = PacketBufferHandle::New(PacketBuffer::kMaxSize);
+        ASSERT_FALSE(mtu.IsNull());
+        EXPECT_NE(mtu.Get(), small);
+    }
+    EXPECT_TRUE(SYSTEM_STATS_TEST_IN_USE(Stats::kSystemLayer_NumCachedPacketBufs, 2));
+
+    // The number of cached buffers of a size class is bounded.
+    {
+        std::vector<PacketBufferHandle> buffers;
+        for (int i = 0; i < CHIP_SYSTEM_CONFIG_PACKETBUFFER_HEAP_CACHE_SIZE + 1; i++)
+        {
+            buffers.push_back(PacketBufferHandle::New(10));
+            ASSERT_FALSE(buffers.back().IsNull());
+        }
+    }
+    EXPECT_TRUE(
+        SYSTEM_STATS_TEST_IN_USE(Stats::kSystemLayer_NumCachedPacketBufs, CHIP_SYSTEM_CONFIG_PACKETBUFFER_HEAP_CACHE_SIZE + 1));
+
+    PacketBuffer::ReleaseCachedBuffers();
+    EXPECT_TRUE(SYSTEM_STATS_TEST_IN_USE(Stats::kSystemLayer_NumCachedPacketBufs, 0));
+}
+#endif // CHIP_SYSTEM_PACKETBUFFER_HAS_HEAP_CACHE
+
 TEST_F(TestSystemPacketBuffer, CheckPacketBufferWriter)
 {
     static const char kPayload[] = "Hello, world!";
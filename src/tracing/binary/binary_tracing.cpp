@@ -0,0 +1,356 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <tracing/binary/binary_tracing.h>
+
+#include <lib/support/CodeUtils.h>
+#include <system/SystemError.h>
+#include <tracing/metric_event.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <thread>
+
+namespace chip {
+namespace Tracing {
+namespace Binary {
+
+namespace {
+
+// Dump format, all integers in host byte order:
+//
+//   header:  char magic[8], uint32 version, uint32 record size, uint32 string count, uint32 thread count
+//   strings: uint8 kind (kLabelStrings or kGroupStrings), uint16 id, uint16 length, char text[length]
+//   threads: uint64 thread id, uint64 total records written, uint32 record count, Record records[record count]
+//
+// Records of a thread are ordered from oldest to newest.
+constexpr char kMagic[8]        = { 'M', 'T', 'R', 'B', 'T', 'R', 'C', '\0' };
+constexpr uint32_t kVersion     = 1;
+constexpr uint8_t kLabelStrings = 0;
+constexpr uint8_t kGroupStrings = 1;
+
+constexpr const char kMetricGroup[]  = "Metric";
+constexpr const char kCounterGroup[] = "Counter";
+
+std::atomic<uint32_t> gNextInstanceId{ 1 };
+
+struct ThreadCache
+{
+    uint32_t instanceId = 0;
+    void * buffer       = nullptr;
+};
+
+thread_local ThreadCache tThreadCache;
+
+// Unique among live threads: the address of a thread local.
+const void * ThreadKey()
+{
+    return &tThreadCache;
+}
+
+uint64_t CurrentThreadId()
+{
+#if defined(__linux__)
+    return static_cast<uint64_t>(syscall(SYS_gettid));
+#else
+    return static_cast<uint64_t>(std::hash<std::thread::id>()(std::this_thread::get_id()));
+#endif
+}
+
+uint64_t NowNs()
+{
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+size_t RoundUpToPowerOfTwo(size_t value)
+{
+    size_t result = 1;
+    while (result < value)
+    {
+        result <<= 1;
+    }
+    return result;
+}
+
+CHIP_ERROR WriteAll(int fd, const void * data, size_t size)
+{
+    const uint8_t * p = static_cast<const uint8_t *>(data);
+    while (size > 0)
+    {
+        ssize_t written = write(fd, p, size);
+        if (written < 0)
+        {
+            VerifyOrReturnError(errno == EINTR, CHIP_ERROR_POSIX(errno));
+            continue;
+        }
+        p += written;
+        size -= static_cast<size_t>(written);
+    }
+    return CHIP_NO_ERROR;
+}
+
+template <typename T>
+CHIP_ERROR WriteValue(int fd, T value)
+{
+    return WriteAll(fd, &value, sizeof(value));
+}
+
+} // namespace
+
+template <size_t kSize>
+size_t BinaryBackend::StringTable<kSize>::Intern(const char * string)
+{
+    // Labels are mostly string literals, so their addresses are spread out but aligned.
+    size_t index = (reinterpret_cast<uintptr_t>(string) >> 3) & (kSize - 1);
+    for (size_t probe = 0; probe < kSize; probe++)
+    {
+        const char * current = mSlots[index].load(std::memory_order_acquire);
+        if (current == nullptr &&
+            mSlots[index].compare_exchange_strong(current, string, std::memory_order_acq_rel, std::memory_order_acquire))
+        {
+            return index + 1;
+        }
+        if (current == string)
+        {
+            return index + 1;
+        }
+        index = (index + 1) & (kSize - 1);
+    }
+    return 0;
+}
+
+BinaryBackend::BinaryBackend(size_t recordsPerThread) :
+    mInstanceId(gNextInstanceId.fetch_add(1, std::memory_order_relaxed)),
+    mRecordMask(RoundUpToPowerOfTwo(std::max<size_t>(recordsPerThread, 1)) - 1)
+{}
+
+void BinaryBackend::TraceBegin(const char * label, const char * group)
+{
+    Append(RecordType::kBegin, mLabels.Intern(label), mGroups.Intern(group), 0);
+}
+
+void BinaryBackend::TraceEnd(const char * label, const char * group)
+{
+    Append(RecordType::kEnd, mLabels.Intern(label), mGroups.Intern(group), 0);
+}
+
+void BinaryBackend::TraceInstant(const char * label, const char * group)
+{
+    Append(RecordType::kInstant, mLabels.Intern(label), mGroups.Intern(group), 0);
+}
+
+void BinaryBackend::TraceCounter(const char * label)
+{
+    const size_t id = mLabels.Intern(label);
+    uint32_t value  = 0;
+    if (id != 0)
+    {
+        value = mCounters[id - 1].fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+    Append(RecordType::kCounter, id, mGroups.Intern(kCounterGroup), value);
+}
+
+void BinaryBackend::LogMetricEvent(const MetricEvent & event)
+{
+    using ValueType = MetricEvent::Value::Type;
+
+    uint32_t value = 0;
+    switch (event.ValueType())
+    {
+    case ValueType::kInt32:
+        value = static_cast<uint32_t>(event.ValueInt32());
+        break;
+    case ValueType::kUInt32:
+        value = event.ValueUInt32();
+        break;
+    case ValueType::kChipErrorCode:
+        value = event.ValueErrorCode();
+        break;
+    default:
+        break;
+    }
+    Append(RecordType::kMetric, mLabels.Intern(event.key()), mGroups.Intern(kMetricGroup), value);
+}
+
+void BinaryBackend::Append(RecordType type, size_t label, size_t group, uint32_t value)
+{
+    ThreadBuffer * buffer = CurrentThreadBuffer();
+    if (buffer == nullptr || label == 0 || group == 0)
+    {
+        mDroppedEvents.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    // Only the owning thread writes to the buffer, the counter is atomic for the benefit of dumps.
+    const uint64_t index = buffer->written.load(std::memory_order_relaxed);
+
+    Record & record    = buffer->records[static_cast<size_t>(index) & mRecordMask];
+    record.timestampNs = NowNs();
+    record.value       = value;
+    record.label       = static_cast<uint16_t>(label);
+    record.group       = static_cast<uint8_t>(group);
+    record.type        = type;
+
+    buffer->written.store(index + 1, std::memory_order_release);
+}
+
+BinaryBackend::ThreadBuffer * BinaryBackend::CurrentThreadBuffer()
+{
+    ThreadCache & cache = tThreadCache;
+    if (cache.instanceId != mInstanceId)
+    {
+        cache.buffer     = FindOrClaimThreadBuffer();
+        cache.instanceId = mInstanceId;
+    }
+    return static_cast<ThreadBuffer *>(cache.buffer);
+}
+
+BinaryBackend::ThreadBuffer * BinaryBackend::FindOrClaimThreadBuffer()
+{
+    const void * key = ThreadKey();
+
+    // The thread may already own a buffer if it alternates between several backends.
+    const size_t claimed = std::min(mClaimedThreads.load(std::memory_order_acquire), kMaxThreads);
+    for (size_t i = 0; i < claimed; i++)
+    {
+        if (mThreads[i].owner.load(std::memory_order_acquire) == key)
+        {
+            return mThreads[i].ready.load(std::memory_order_acquire) ? &mThreads[i] : nullptr;
+        }
+    }
+
+    const size_t index = mClaimedThreads.fetch_add(1, std::memory_order_acq_rel);
+    VerifyOrReturnValue(index < kMaxThreads, nullptr);
+
+    ThreadBuffer & buffer = mThreads[index];
+    buffer.owner.store(key, std::memory_order_release);
+    buffer.threadId.store(CurrentThreadId(), std::memory_order_relaxed);
+    VerifyOrReturnValue(buffer.records.Calloc(mRecordMask + 1), nullptr);
+    buffer.ready.store(true, std::memory_order_release);
+
+    return &buffer;
+}
+
+template <size_t kSize>
+uint32_t BinaryBackend::CountStrings(const StringTable<kSize> & table)
+{
+    uint32_t count = 0;
+    for (size_t id = 1; id <= table.Size(); id++)
+    {
+        count += (table.Get(id) != nullptr) ? 1 : 0;
+    }
+    return count;
+}
+
+template <size_t kSize>
+CHIP_ERROR BinaryBackend::WriteStrings(int fd, uint8_t kind, const StringTable<kSize> & table, uint32_t count)
+{
+    for (size_t id = 1; id <= table.Size() && count > 0; id++)
+    {
+        const char * string = table.Get(id);
+        if (string == nullptr)
+        {
+            continue;
+        }
+        count--;
+
+        const uint16_t length = static_cast<uint16_t>(std::min<size_t>(strlen(string), UINT16_MAX));
+        ReturnErrorOnFailure(WriteValue(fd, kind));
+        ReturnErrorOnFailure(WriteValue(fd, static_cast<uint16_t>(id)));
+        ReturnErrorOnFailure(WriteValue(fd, length));
+        ReturnErrorOnFailure(WriteAll(fd, string, length));
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR BinaryBackend::DumpToFd(int fd)
+{
+    // Strings and buffers may get added while dumping: the counts written in the header are
+    // taken first and never more than that many strings and buffers are written afterwards.
+    const uint32_t labelCount = CountStrings(mLabels);
+    const uint32_t groupCount = CountStrings(mGroups);
+
+    uint32_t threadCount = 0;
+    for (auto & buffer : mThreads)
+    {
+        threadCount += buffer.ready.load(std::memory_order_acquire) ? 1 : 0;
+    }
+
+    ReturnErrorOnFailure(WriteAll(fd, kMagic, sizeof(kMagic)));
+    ReturnErrorOnFailure(WriteValue(fd, kVersion));
+    ReturnErrorOnFailure(WriteValue(fd, static_cast<uint32_t>(sizeof(Record))));
+    ReturnErrorOnFailure(WriteValue(fd, static_cast<uint32_t>(labelCount + groupCount)));
+    ReturnErrorOnFailure(WriteValue(fd, threadCount));
+
+    ReturnErrorOnFailure(WriteStrings(fd, kLabelStrings, mLabels, labelCount));
+    ReturnErrorOnFailure(WriteStrings(fd, kGroupStrings, mGroups, groupCount));
+
+    for (auto & buffer : mThreads)
+    {
+        if (threadCount == 0)
+        {
+            break;
+        }
+        if (!buffer.ready.load(std::memory_order_acquire))
+        {
+            continue;
+        }
+        threadCount--;
+
+        const uint64_t written  = buffer.written.load(std::memory_order_acquire);
+        const uint64_t capacity = mRecordMask + 1;
+        const uint64_t count    = std::min(written, capacity);
+
+        ReturnErrorOnFailure(WriteValue(fd, buffer.threadId.load(std::memory_order_relaxed)));
+        ReturnErrorOnFailure(WriteValue(fd, written));
+        ReturnErrorOnFailure(WriteValue(fd, static_cast<uint32_t>(count)));
+
+        // Oldest records first: from the write position to the end of the buffer, then from the start.
+        const size_t start = static_cast<size_t>(written - count) & mRecordMask;
+        const size_t head  = std::min(static_cast<size_t>(count), static_cast<size_t>(capacity) - start);
+        ReturnErrorOnFailure(WriteAll(fd, &buffer.records[start], head * sizeof(Record)));
+        ReturnErrorOnFailure(WriteAll(fd, &buffer.records[0], (static_cast<size_t>(count) - head) * sizeof(Record)));
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR BinaryBackend::DumpToFile(const char * path)
+{
+    int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    VerifyOrReturnError(fd >= 0, CHIP_ERROR_POSIX(errno));
+
+    CHIP_ERROR err = DumpToFd(fd);
+    close(fd);
+    return err;
+}
+
+} // namespace Binary
+} // namespace Tracing
+} // namespace chip
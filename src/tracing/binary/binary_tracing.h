@@ -0,0 +1,164 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/support/ScopedBuffer.h>
+#include <tracing/backend.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace chip {
+namespace Tracing {
+namespace Binary {
+
+/// A Backend that records fixed size binary events into in-memory ring buffers.
+///
+/// Recording an event interns the label and group pointers (tracing labels are
+/// constant strings, see src/tracing/README.md), reads a monotonic clock and
+/// stores 16 bytes in a ring buffer owned by the calling thread. There is no
+/// locking, no formatting and no allocation past the first event of a thread,
+/// so this backend is cheap enough to stay registered in production builds.
+///
+/// Ring buffers keep the most recent events of each thread. They are written out
+/// with DumpToFile/DumpToFd (e.g. on demand or from a crash handler) and converted
+/// offline by scripts/tools/convert_binary_trace.py.
+///
+/// THREAD SAFETY:
+///    Any thread may record events. The first kMaxThreads threads get a ring
+///    buffer; events of other threads, as well as events using more distinct
+///    strings than the intern tables hold, are counted in DroppedEvents().
+///    Dumping while other threads record is allowed, but records that are
+///    being overwritten during the dump may come out torn.
+class BinaryBackend : public ::chip::Tracing::Backend
+{
+public:
+    static constexpr size_t kMaxThreads              = 16;
+    static constexpr size_t kMaxLabels               = 1024;
+    static constexpr size_t kMaxGroups               = 64;
+    static constexpr size_t kDefaultRecordsPerThread = 4096;
+
+    enum class RecordType : uint8_t
+    {
+        kBegin   = 1,
+        kEnd     = 2,
+        kInstant = 3,
+        kCounter = 4, // value is the updated counter value
+        kMetric  = 5, // value is the metric value, if any
+    };
+
+    /// Binary layout of a single event, as found in dumps (in host byte order).
+    struct Record
+    {
+        uint64_t timestampNs; // steady clock
+        uint32_t value;
+        uint16_t label; // 0 if the label could not be interned
+        uint8_t group;  // 0 if the group could not be interned
+        RecordType type;
+    };
+    static_assert(sizeof(Record) == 16, "Record layout is part of the dump format");
+
+    /// `recordsPerThread` is rounded up to a power of two.
+    explicit BinaryBackend(size_t recordsPerThread = kDefaultRecordsPerThread);
+
+    BinaryBackend(const BinaryBackend &)             = delete;
+    BinaryBackend & operator=(const BinaryBackend &) = delete;
+
+    void TraceBegin(const char * label, const char * group) override;
+    void TraceEnd(const char * label, const char * group) override;
+    void TraceInstant(const char * label, const char * group) override;
+    void TraceCounter(const char * label) override;
+    void LogMetricEvent(const MetricEvent & event) override;
+
+    /// Writes all recorded events to the given file, replacing its content.
+    CHIP_ERROR DumpToFile(const char * path);
+
+    /// Writes all recorded events to an open file descriptor.
+    ///
+    /// Only async-signal-safe functions are used, so this may be called from
+    /// a fatal signal handler to capture the events leading up to a crash.
+    CHIP_ERROR DumpToFd(int fd);
+
+    /// Number of events that could not be recorded.
+    uint64_t DroppedEvents() const { return mDroppedEvents.load(std::memory_order_relaxed); }
+
+private:
+    /// Maps constant string pointers to small identifiers, without locking.
+    ///
+    /// Identifiers are 1-based slot indexes in an open addressed table. The same
+    /// text at different addresses (e.g. literals from different translation units)
+    /// may get several identifiers, which the offline converter merges back.
+    template <size_t kSize>
+    class StringTable
+    {
+    public:
+        static_assert((kSize & (kSize - 1)) == 0, "Table size must be a power of two");
+
+        /// Returns 0 if the table is full.
+        size_t Intern(const char * string);
+
+        /// Returns nullptr for unused identifiers.
+        const char * Get(size_t id) const { return mSlots[id - 1].load(std::memory_order_acquire); }
+
+        static constexpr size_t Size() { return kSize; }
+
+    private:
+        std::atomic<const char *> mSlots[kSize] = {};
+    };
+
+    struct ThreadBuffer
+    {
+        // Set once the buffer is allocated; the buffer is never released before the backend.
+        std::atomic<bool> ready{ false };
+        // Identifies the thread currently owning the buffer, see ThreadKey().
+        std::atomic<const void *> owner{ nullptr };
+        std::atomic<uint64_t> threadId{ 0 };
+        // Total number of records ever written to the buffer.
+        std::atomic<uint64_t> written{ 0 };
+        Platform::ScopedMemoryBuffer<Record> records;
+    };
+
+    void Append(RecordType type, size_t label, size_t group, uint32_t value);
+
+    ThreadBuffer * CurrentThreadBuffer();
+    ThreadBuffer * FindOrClaimThreadBuffer();
+
+    template <size_t kSize>
+    static uint32_t CountStrings(const StringTable<kSize> & table);
+    template <size_t kSize>
+    static CHIP_ERROR WriteStrings(int fd, uint8_t kind, const StringTable<kSize> & table, uint32_t count);
+
+    // Distinguishes backends in thread local caches, as a backend address may be reused.
+    const uint32_t mInstanceId;
+    const size_t mRecordMask;
+
+    StringTable<kMaxLabels> mLabels;
+    StringTable<kMaxGroups> mGroups;
+    std::atomic<uint32_t> mCounters[kMaxLabels] = {};
+
+    ThreadBuffer mThreads[kMaxThreads];
+    std::atomic<size_t> mClaimedThreads{ 0 };
+
+    std::atomic<uint64_t> mDroppedEvents{ 0 };
+};
+
+} // namespace Binary
+} // namespace Tracing
+} // namespace chip
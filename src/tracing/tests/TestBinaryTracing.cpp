@@ -0,0 +1,248 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <tracing/binary/binary_tracing.h>
+#include <tracing/macros.h>
+#include <tracing/metric_event.h>
+#include <tracing/registry.h>
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace chip;
+using namespace chip::Tracing;
+using namespace chip::Tracing::Binary;
+
+namespace {
+
+using RecordType = BinaryBackend::RecordType;
+
+struct DecodedEvent
+{
+    RecordType type;
+    std::string label;
+    std::string group;
+    uint32_t value;
+};
+
+struct DecodedThread
+{
+    uint64_t written = 0;
+    std::vector<DecodedEvent> events;
+};
+
+/// Minimal reader of the dump format, see binary_tracing.cpp.
+class DumpReader
+{
+public:
+    explicit DumpReader(std::vector<uint8_t> data) : mData(std::move(data)) {}
+
+    bool Decode(std::vector<DecodedThread> & threads)
+    {
+        char magic[8];
+        uint32_t version, recordSize, stringCount, threadCount;
+        if (!Read(magic) || memcmp(magic, "MTRBTRC", 8) != 0 || !Read(version) || !Read(recordSize) || !Read(stringCount) ||
+            !Read(threadCount) || recordSize != sizeof(BinaryBackend::Record))
+        {
+            return false;
+        }
+
+        std::map<std::pair<uint8_t, uint16_t>, std::string> strings;
+        for (uint32_t i = 0; i < stringCount; i++)
+        {
+            uint8_t kind;
+            uint16_t id, length;
+            if (!Read(kind) || !Read(id) || !Read(length) || mOffset + length > mData.size())
+            {
+                return false;
+            }
+            strings[{ kind, id }] = std::string(reinterpret_cast<const char *>(&mData[mOffset]), length);
+            mOffset += length;
+        }
+
+        for (uint32_t i = 0; i < threadCount; i++)
+        {
+            DecodedThread thread;
+            uint64_t threadId;
+            uint32_t count;
+            if (!Read(threadId) || !Read(thread.written) || !Read(count))
+            {
+                return false;
+            }
+            for (uint32_t j = 0; j < count; j++)
+            {
+                BinaryBackend::Record record;
+                if (!Read(record))
+                {
+                    return false;
+                }
+                thread.events.push_back({ record.type, strings[{ 0, record.label }], strings[{ 1, record.group }], record.value });
+            }
+            threads.push_back(std::move(thread));
+        }
+        return mOffset == mData.size();
+    }
+
+private:
+    template <typename T>
+    bool Read(T & value)
+    {
+        if (mOffset + sizeof(T) > mData.size())
+        {
+            return false;
+        }
+        memcpy(&value, &mData[mOffset], sizeof(T));
+        mOffset += sizeof(T);
+        return true;
+    }
+
+    std::vector<uint8_t> mData;
+    size_t mOffset = 0;
+};
+
+class TestBinaryTracing : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { Platform::MemoryShutdown(); }
+
+protected:
+    static std::vector<DecodedThread> Dump(BinaryBackend & backend)
+    {
+        FILE * file = tmpfile();
+        EXPECT_NE(file, nullptr);
+        EXPECT_EQ(backend.DumpToFd(fileno(file)), CHIP_NO_ERROR);
+
+        std::vector<uint8_t> data(static_cast<size_t>(lseek(fileno(file), 0, SEEK_END)));
+        EXPECT_EQ(pread(fileno(file), data.data(), data.size(), 0), static_cast<ssize_t>(data.size()));
+        fclose(file);
+
+        std::vector<DecodedThread> threads;
+        EXPECT_TRUE(DumpReader(std::move(data)).Decode(threads));
+        return threads;
+    }
+};
+
+TEST_F(TestBinaryTracing, TestEvents)
+{
+    BinaryBackend backend;
+
+    backend.TraceBegin("A", "Group");
+    backend.TraceInstant("B", "Other");
+    backend.TraceCounter("C");
+    backend.TraceCounter("C");
+    backend.LogMetricEvent(MetricEvent(MetricEvent::Type::kInstantEvent, "M", static_cast<uint32_t>(42)));
+    backend.TraceEnd("A", "Group");
+
+    std::vector<DecodedThread> threads = Dump(backend);
+    ASSERT_EQ(threads.size(), 1u);
+    EXPECT_EQ(threads[0].written, 6u);
+
+    const std::vector<DecodedEvent> & events = threads[0].events;
+    ASSERT_EQ(events.size(), 6u);
+    EXPECT_EQ(events[0].type, RecordType::kBegin);
+    EXPECT_EQ(events[0].label, "A");
+    EXPECT_EQ(events[0].group, "Group");
+    EXPECT_EQ(events[1].type, RecordType::kInstant);
+    EXPECT_EQ(events[1].label, "B");
+    EXPECT_EQ(events[1].group, "Other");
+    EXPECT_EQ(events[2].type, RecordType::kCounter);
+    EXPECT_EQ(events[2].value, 1u);
+    EXPECT_EQ(events[3].type, RecordType::kCounter);
+    EXPECT_EQ(events[3].label, "C");
+    EXPECT_EQ(events[3].value, 2u);
+    EXPECT_EQ(events[4].type, RecordType::kMetric);
+    EXPECT_EQ(events[4].label, "M");
+    EXPECT_EQ(events[4].value, 42u);
+    EXPECT_EQ(events[5].type, RecordType::kEnd);
+    EXPECT_EQ(events[5].label, "A");
+
+    EXPECT_EQ(backend.DroppedEvents(), 0u);
+}
+
+TEST_F(TestBinaryTracing, TestRingBufferKeepsNewestEvents)
+{
+    static const char * const kLabels[] = { "0", "1", "2", "3", "4", "5", "6", "7", "8", "9" };
+
+    BinaryBackend backend(3); // rounded up to 4 records
+    for (const char * label : kLabels)
+    {
+        backend.TraceInstant(label, "Group");
+    }
+
+    std::vector<DecodedThread> threads = Dump(backend);
+    ASSERT_EQ(threads.size(), 1u);
+    EXPECT_EQ(threads[0].written, 10u);
+    ASSERT_EQ(threads[0].events.size(), 4u);
+    EXPECT_EQ(threads[0].events[0].label, "6");
+    EXPECT_EQ(threads[0].events[3].label, "9");
+}
+
+TEST_F(TestBinaryTracing, TestPerThreadBuffers)
+{
+    BinaryBackend backend;
+
+    backend.TraceInstant("main", "Group");
+    std::thread([&backend] {
+        for (int i = 0; i < 3; i++)
+        {
+            backend.TraceInstant("worker", "Group");
+        }
+    }).join();
+    backend.TraceInstant("main", "Group");
+
+    std::vector<DecodedThread> threads = Dump(backend);
+    ASSERT_EQ(threads.size(), 2u);
+    ASSERT_EQ(threads[0].events.size(), 2u);
+    EXPECT_EQ(threads[0].events[1].label, "main");
+    ASSERT_EQ(threads[1].events.size(), 3u);
+    EXPECT_EQ(threads[1].events[0].label, "worker");
+}
+
+TEST_F(TestBinaryTracing, TestRegisteredBackend)
+{
+    BinaryBackend first;
+    BinaryBackend second;
+
+    {
+        ScopedRegistration registerFirst(first);
+        ScopedRegistration registerSecond(second);
+        MATTER_TRACE_SCOPE("Scope", "Group");
+    }
+
+    // A thread alternating between backends keeps a single buffer in each.
+    for (BinaryBackend * backend : { &first, &second })
+    {
+        std::vector<DecodedThread> threads = Dump(*backend);
+        ASSERT_EQ(threads.size(), 1u);
+        ASSERT_EQ(threads[0].events.size(), 2u);
+        EXPECT_EQ(threads[0].events[0].type, RecordType::kBegin);
+        EXPECT_EQ(threads[0].events[1].type, RecordType::kEnd);
+        EXPECT_EQ(threads[0].events[1].label, "Scope");
+    }
+}
+
+} // namespace
@@ -52,7 +52,10 @@ void SecureSession::Activate(const ScopedNodeId & localNode, const ScopedNodeId
     MoveToState(State::kActive);
 
     if (mSecureSessionType == Type::kCASE)
+    {
+        mTable.AddToPeerIndex(this);
         mTable.NewerSessionAvailable(this);
+    }
 
     ChipLogDetail(Inet, "SecureSession[%p]: Activated - Type:%d LSID:%d", this, to_underlying(mSecureSessionType), mLocalSessionId);
 }
@@ -0,0 +1,166 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Open-addressing hash index over the sessions owned by a SecureSessionTable.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/ScopedNodeId.h>
+#include <lib/support/CodeUtils.h>
+#include <transport/SecureSession.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace Transport {
+
+/**
+ * A fixed-size, linear-probing hash index of SecureSession pointers.
+ *
+ * The index does not own the sessions; it only stores pointers to sessions held by the
+ * SecureSessionTable pool. Several sessions may hash to the same key (e.g. multiple sessions to
+ * the same peer), so callers walk the probe chain with ForEachCandidate() and filter on the
+ * actual key. Removal uses backward-shift deletion, so no tombstones accumulate and a probe
+ * chain always ends at the first empty slot.
+ *
+ * The capacity is at least twice the session pool size, which keeps the load factor at or below
+ * one half and guarantees that an insertion always finds a free slot.
+ *
+ * @tparam Hasher provides `static uint32_t Hash(const SecureSession &)`. The value it returns for
+ *                a session must not change while that session is in the index.
+ */
+template <typename Hasher>
+class SecureSessionIndex
+{
+public:
+    static constexpr size_t kCapacity = []() {
+        size_t capacity = 1;
+        while (capacity < 2 * CHIP_CONFIG_SECURE_SESSION_POOL_SIZE)
+        {
+            capacity <<= 1;
+        }
+        return capacity;
+    }();
+
+    void Insert(SecureSession * session)
+    {
+        size_t slot = SlotFor(Hasher::Hash(*session));
+        for (size_t i = 0; i < kCapacity; i++, slot = NextSlot(slot))
+        {
+            VerifyOrDie(mSlots[slot] != session);
+            if (mSlots[slot] == nullptr)
+            {
+                mSlots[slot] = session;
+                return;
+            }
+        }
+        VerifyOrDieWithMsg(false, SecureChannel, "Secure session index is full");
+    }
+
+    /**
+     * Remove a session from the index. Removing a session that is not in the index is a no-op.
+     */
+    void Remove(SecureSession * session)
+    {
+        size_t slot = SlotFor(Hasher::Hash(*session));
+        for (size_t i = 0; mSlots[slot] != session; i++, slot = NextSlot(slot))
+        {
+            if (mSlots[slot] == nullptr || i == kCapacity)
+            {
+                return;
+            }
+        }
+
+        // Backward-shift deletion: pull later members of the probe chain into the hole as long as
+        // that does not move them in front of their home slot.
+        size_t hole = slot;
+        for (size_t next = NextSlot(hole); mSlots[next] != nullptr; next = NextSlot(next))
+        {
+            size_t home = SlotFor(Hasher::Hash(*mSlots[next]));
+            if (((next - home) & kMask) >= ((next - hole) & kMask))
+            {
+                mSlots[hole] = mSlots[next];
+                hole         = next;
+            }
+        }
+        mSlots[hole] = nullptr;
+    }
+
+    /**
+     * Call `function` for every session whose hash could match `hash`, until it returns Loop::Break.
+     * The callee is responsible for checking that the session actually matches the key it is looking
+     * for. The index must not be modified from within `function`.
+     */
+    template <typename Function>
+    Loop ForEachCandidate(uint32_t hash, Function && function) const
+    {
+        size_t slot = SlotFor(hash);
+        for (size_t i = 0; i < kCapacity && mSlots[slot] != nullptr; i++, slot = NextSlot(slot))
+        {
+            if (function(mSlots[slot]) == Loop::Break)
+            {
+                return Loop::Break;
+            }
+        }
+        return Loop::Finish;
+    }
+
+private:
+    static constexpr size_t kMask = kCapacity - 1;
+
+    static size_t SlotFor(uint32_t hash) { return static_cast<size_t>(hash) & kMask; }
+    static size_t NextSlot(size_t slot) { return (slot + 1) & kMask; }
+
+    SecureSession * mSlots[kCapacity] = {};
+};
+
+/**
+ * Indexes sessions by the local session ID, which is fixed for the lifetime of a session.
+ */
+struct LocalSessionIdHasher
+{
+    static uint32_t Hash(uint16_t localSessionId)
+    {
+        // Session IDs are handed out sequentially; a multiplicative hash spreads runs of them over the
+        // whole table instead of filling consecutive slots.
+        return (static_cast<uint32_t>(localSessionId) * 0x9E3779B1u) >> 16;
+    }
+    static uint32_t Hash(const SecureSession & session) { return Hash(session.GetLocalSessionId()); }
+};
+
+/**
+ * Indexes CASE sessions by their peer. Only sessions whose peer can no longer change (i.e. activated
+ * CASE sessions) may be placed in an index using this hasher.
+ */
+struct PeerHasher
+{
+    static uint32_t Hash(const ScopedNodeId & peer)
+    {
+        uint64_t nodeId = peer.GetNodeId();
+        uint32_t hash   = static_cast<uint32_t>(nodeId) ^ static_cast<uint32_t>(nodeId >> 32) ^ peer.GetFabricIndex();
+        return (hash * 0x9E3779B1u) >> 16;
+    }
+    static uint32_t Hash(const SecureSession & session) { return Hash(session.GetPeer()); }
+};
+
+} // namespace Transport
+} // namespace chip
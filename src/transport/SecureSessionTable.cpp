@@ -52,8 +52,13 @@ Optional<SessionHandle> SecureSessionTable::CreateNewSecureSessionForTest(Secure
         }
     }
 
-    SecureSession * result = mEntries.CreateObject(*this, secureSessionType, localSessionId, localNodeId, peerNodeId, peerCATs,
-                                                   peerSessionId, fabricIndex, config);
+    SecureSession * result = CreateSessionObject(*this, secureSessionType, localSessionId, localNodeId, peerNodeId, peerCATs,
+                                                 peerSessionId, fabricIndex, config);
+    if (result != nullptr && secureSessionType == SecureSession::Type::kCASE)
+    {
+        // Test sessions are created already active, with their peer set.
+        AddToPeerIndex(result);
+    }
     return result != nullptr ? MakeOptional<SessionHandle>(*result) : Optional<SessionHandle>::Missing();
 }
 
@@ -73,7 +78,7 @@ Optional<SessionHandle> SecureSessionTable::CreateNewSecureSession(SecureSession
     //
     if (mEntries.Allocated() < GetMaxSessionTableSize())
     {
-        allocated = mEntries.CreateObject(*this, secureSessionType, sessionId.Value());
+        allocated = CreateSessionObject(*this, secureSessionType, sessionId.Value());
     }
     else
     {
@@ -216,7 +221,7 @@ SecureSession * SecureSessionTable::EvictAndAllocate(uint16_t localSessionId, Se
         if (newCount < prevCount)
         {
             ChipLogProgress(SecureChannel, "Successfully evicted a session!");
-            auto * retSession = mEntries.CreateObject(*this, secureSessionType, localSessionId);
+            auto * retSession = CreateSessionObject(*this, secureSessionType, localSessionId);
             VerifyOrDie(session != nullptr);
             return retSession;
         }
@@ -338,9 +343,15 @@ void SecureSessionTable::DefaultEvictionPolicy(EvictionPolicyContext & evictionC
 }
 
 Optional<SessionHandle> SecureSessionTable::FindSecureSessionByLocalKey(uint16_t localSessionId)
+{
+    SecureSession * result = FindSessionByLocalId(localSessionId);
+    return result != nullptr ? MakeOptional<SessionHandle>(*result) : Optional<SessionHandle>::Missing();
+}
+
+SecureSession * SecureSessionTable::FindSessionByLocalId(uint16_t localSessionId) const
 {
     SecureSession * result = nullptr;
-    mEntries.ForEachActiveObject([&](auto session) {
+    mSessionsByLocalId.ForEachCandidate(LocalSessionIdHasher::Hash(localSessionId), [&](SecureSession * session) {
         if (session->GetLocalSessionId() == localSessionId)
         {
             result = session;
@@ -348,56 +359,20 @@ Optional<SessionHandle> SecureSessionTable::FindSecureSessionByLocalKey(uint16_t
         }
         return Loop::Continue;
     });
-    return result != nullptr ? MakeOptional<SessionHandle>(*result) : Optional<SessionHandle>::Missing();
+    return result;
 }
 
 Optional<uint16_t> SecureSessionTable::FindUnusedSessionId()
 {
-    uint16_t candidate_base = 0;
-    uint64_t candidate_mask = 0;
-    for (uint32_t i = 0; i <= kMaxSessionID; i += 64)
-    {
-        // candidate_base is the base session ID we are searching from.
-        // We have a 64-bit mask anchored at this ID and iterate over the
-        // whole session table, setting bits in the mask for in-use IDs.
-        // If we can iterate through the entire session table and have
-        // any bits clear in the mask, we have available session IDs.
-        candidate_base = static_cast<uint16_t>(i + mNextSessionId);
-        candidate_mask = 0;
-        {
-            uint16_t shift = static_cast<uint16_t>(kUnsecuredSessionId - candidate_base);
-            if (shift <= 63)
-            {
-                candidate_mask |= (1ULL << shift); // kUnsecuredSessionId is never available
-            }
-        }
-        mEntries.ForEachActiveObject([&](auto session) {
-            uint16_t shift = static_cast<uint16_t>(session->GetLocalSessionId() - candidate_base);
-            if (shift <= 63)
-            {
-                candidate_mask |= (1ULL << shift);
-            }
-            if (candidate_mask == UINT64_MAX)
-            {
-                return Loop::Break; // No bits clear means this bucket is full.
-            }
-            return Loop::Continue;
-        });
-        if (candidate_mask != UINT64_MAX)
-        {
-            break; // Any bit clear means we have an available ID in this bucket.
-        }
-    }
-    if (candidate_mask != UINT64_MAX)
+    // There are at most mEntries.Allocated() IDs in use, plus kUnsecuredSessionId which is never
+    // available, so one of the first Allocated() + 2 candidates is free unless the ID space is exhausted.
+    uint16_t candidate = mNextSessionId;
+    for (size_t i = 0; i <= kMaxSessionID && i < mEntries.Allocated() + 2; i++, candidate++)
     {
-        uint16_t offset = 0;
-        while (candidate_mask & 1)
+        if (candidate != kUnsecuredSessionId && FindSessionByLocalId(candidate) == nullptr)
         {
-            candidate_mask >>= 1;
-            ++offset;
+            return MakeOptional<uint16_t>(candidate);
         }
-        uint16_t available = static_cast<uint16_t>(candidate_base + offset);
-        return MakeOptional<uint16_t>(available);
     }
 
     return NullOptional;
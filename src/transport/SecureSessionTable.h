@@ -22,6 +22,7 @@
 #include <lib/support/SortUtils.h>
 #include <system/TimeSource.h>
 #include <transport/SecureSession.h>
+#include <transport/SecureSessionIndex.h>
 
 namespace chip {
 namespace Transport {
@@ -76,7 +77,12 @@ public:
     CHECK_RETURN_VALUE
     Optional<SessionHandle> CreateNewSecureSession(SecureSession::Type secureSessionType, ScopedNodeId sessionEvictionHint);
 
-    void ReleaseSession(SecureSession * session) { mEntries.ReleaseObject(session); }
+    void ReleaseSession(SecureSession * session)
+    {
+        mSessionsByLocalId.Remove(session);
+        mCASESessionsByPeer.Remove(session);
+        mEntries.ReleaseObject(session);
+    }
 
     template <typename Function>
     Loop ForEachSession(Function && function)
@@ -94,13 +100,55 @@ public:
     CHECK_RETURN_VALUE
     Optional<SessionHandle> FindSecureSessionByLocalKey(uint16_t localSessionId);
 
+    /**
+     * Make an activated CASE session findable by its peer. Called once the peer of the session is
+     * known; it may not change afterwards.
+     *
+     * This is an internal API, using raw pointer to a session is allowed here.
+     */
+    void AddToPeerIndex(SecureSession * session)
+    {
+        VerifyOrDie(session->GetSecureSessionType() == SecureSession::Type::kCASE);
+        mCASESessionsByPeer.Insert(session);
+    }
+
+    /**
+     * Call `function` with each CASE session to the given peer, until it returns Loop::Break.
+     *
+     * Sessions that are still being established are not visited, since their peer is not known yet.
+     * `function` may release sessions or create new ones.
+     */
+    template <typename Function>
+    Loop ForEachCASESessionWithPeer(const ScopedNodeId & peer, Function && function)
+    {
+        // Snapshot the matches first so that the callee is free to modify the table.
+        SecureSession * matches[CHIP_CONFIG_SECURE_SESSION_POOL_SIZE];
+        size_t matchCount = 0;
+        mCASESessionsByPeer.ForEachCandidate(PeerHasher::Hash(peer), [&](SecureSession * session) {
+            if (session->GetPeer() == peer && matchCount < MATTER_ARRAY_SIZE(matches))
+            {
+                matches[matchCount++] = session;
+            }
+            return Loop::Continue;
+        });
+
+        for (size_t i = 0; i < matchCount; i++)
+        {
+            if (function(matches[i]) == Loop::Break)
+            {
+                return Loop::Break;
+            }
+        }
+        return Loop::Finish;
+    }
+
     // Select SessionHolders which are pointing to a session with the same peer as the given session. Shift them to the given
     // session.
     // This is an internal API, using raw pointer to a session is allowed here.
     void NewerSessionAvailable(SecureSession * session)
     {
         VerifyOrDie(session->GetSecureSessionType() == SecureSession::Type::kCASE);
-        mEntries.ForEachActiveObject([&](SecureSession * oldSession) {
+        ForEachCASESessionWithPeer(session->GetPeer(), [&](SecureSession * oldSession) {
             if (session == oldSession)
                 return Loop::Continue;
 
@@ -110,8 +158,7 @@ public:
             //
             // See documentation for SessionDelegate::GetNewSessionHandlingPolicy about how session auto-shifting works, and how
             // to disable it for a specific SessionHolder in a specific scenario.
-            if (oldSession->GetSecureSessionType() == SecureSession::Type::kCASE && oldSession->GetPeer() == session->GetPeer() &&
-                oldSession->GetPeerCATs() == session->GetPeerCATs())
+            if (oldSession->GetPeerCATs() == session->GetPeerCATs())
             {
                 oldSession->NewerSessionAvailable(SessionHandle(*session));
             }
@@ -243,22 +290,39 @@ private:
     /**
      * Find an available session ID that is unused in the secure session table.
      *
-     * The search algorithm iterates over the session ID space in the outer loop
-     * and the session table in the inner loop to locate an available session ID
-     * from the starting mNextSessionId clue.
-     *
-     * The outer-loop considers 64 session IDs in each iteration to give a
-     * runtime complexity of O(CHIP_CONFIG_PEER_CONNECTION_POOL_SIZE^2/64).  Speed up could be
-     * achieved with a sorted session table or additional storage.
+     * Candidate IDs are probed in order from the starting mNextSessionId clue using the
+     * local session ID index. Since at most CHIP_CONFIG_SECURE_SESSION_POOL_SIZE IDs can be
+     * in use, this settles after at most that many (constant-time) probes.
      *
      * @return an unused session ID if any is found, else NullOptional
      */
     CHECK_RETURN_VALUE
     Optional<uint16_t> FindUnusedSessionId();
 
+    SecureSession * FindSessionByLocalId(uint16_t localSessionId) const;
+
+    /**
+     * Allocate a session object out of the pool and add it to the local session ID index.
+     */
+    template <typename... Args>
+    SecureSession * CreateSessionObject(Args &&... args)
+    {
+        SecureSession * session = mEntries.CreateObject(std::forward<Args>(args)...);
+        if (session != nullptr)
+        {
+            mSessionsByLocalId.Insert(session);
+        }
+        return session;
+    }
+
     bool mRunningEvictionLogic = false;
     ObjectPool<SecureSession, CHIP_CONFIG_SECURE_SESSION_POOL_SIZE> mEntries;
 
+    // Lookup indices over mEntries. Every allocated session is in mSessionsByLocalId; only activated
+    // CASE sessions are in mCASESessionsByPeer.
+    SecureSessionIndex<LocalSessionIdHasher> mSessionsByLocalId;
+    SecureSessionIndex<PeerHasher> mCASESessionsByPeer;
+
     size_t GetMaxSessionTableSize() const
     {
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
@@ -579,13 +579,10 @@ void SessionManager::MarkSessionsAsDefunct(const ScopedNodeId & node, const Opti
 
 void SessionManager::UpdateAllSessionsPeerAddress(const ScopedNodeId & node, const Transport::PeerAddress & addr)
 {
-    mSecureSessions.ForEachSession([&node, &addr](auto session) {
+    mSecureSessions.ForEachCASESessionWithPeer(node, [&addr](auto session) {
         // Arguably we should only be updating active and defunct sessions, but there is no harm
         // in updating evicted sessions.
-        if (session->GetPeer() == node && Transport::SecureSession::Type::kCASE == session->GetSecureSessionType())
-        {
-            session->SetPeerAddress(addr);
-        }
+        session->SetPeerAddress(addr);
         return Loop::Continue;
     });
 }
@@ -1010,60 +1007,119 @@ void SessionManager::SecureUnicastMessageDispatch(const PacketHeader & partialPa
     }
 }
 
+/**
+ * Helper function to decrypt the payload of a groupcast message whose privacy header, if any,
+ * has already been deobfuscated.
+ *
+ * The payload is decrypted into a separate buffer, leaving the message as received.
+ *
+ * @return true if the message was decrypted successfully
+ * @return false if the message could not be decrypted
+ */
+static bool GroupPayloadDecryptAttempt(const CryptoContext & context, PacketHeader & packetHeaderCopy,
+                                       PayloadHeader & payloadHeader, const System::PacketBufferHandle & msg,
+                                       const MessageAuthenticationCode & mac,
+                                       const Credentials::GroupDataProvider::GroupSession & groupContext,
+                                       System::PacketBufferHandle & plaintext)
+{
+    uint16_t headerSize = 0;
+    if (packetHeaderCopy.Decode(msg->Start(), msg->DataLength(), &headerSize) != CHIP_NO_ERROR)
+    {
+        ChipLogError(Inet, "Failed to decode Groupcast packet header. Discarding.");
+        return false;
+    }
+
+    // Optimization to reduce number of decryption attempts
+    GroupId groupId = packetHeaderCopy.GetDestinationGroupId().Value();
+    if (groupId != groupContext.group_id)
+    {
+        return false;
+    }
+
+    CryptoContext::NonceStorage nonce;
+    CHIP_ERROR err = CryptoContext::BuildNonce(nonce, packetHeaderCopy.GetSecurityFlags(), packetHeaderCopy.GetMessageCounter(),
+                                               packetHeaderCopy.GetSourceNodeId().Value());
+    VerifyOrReturnValue(err == CHIP_NO_ERROR, false);
+
+    uint16_t footerLen = packetHeaderCopy.MICTagLength();
+    VerifyOrReturnValue(static_cast<size_t>(headerSize) + footerLen <= msg->DataLength(), false);
+    size_t payloadLength = msg->DataLength() - headerSize - footerLen;
+
+    if (plaintext.IsNull())
+    {
+        plaintext = System::PacketBufferHandle::New(payloadLength, 0);
+        if (plaintext.IsNull())
+        {
+            ChipLogError(Inet, "Failed to allocate Groupcast message buffer. Discarding.");
+            return false;
+        }
+    }
+    VerifyOrReturnValue(plaintext->MaxDataLength() >= payloadLength, false);
+
+    err = context.Decrypt(msg->Start() + headerSize, payloadLength, plaintext->Start(), nonce, packetHeaderCopy, mac);
+    VerifyOrReturnValue(err == CHIP_NO_ERROR, false);
+    plaintext->SetDataLength(payloadLength);
+
+    if (payloadHeader.DecodeAndConsume(plaintext) != CHIP_NO_ERROR)
+    {
+        // The buffer may have been partially consumed, so do not reuse it for the next attempt.
+        plaintext = nullptr;
+        return false;
+    }
+    return true;
+}
+
 /**
  * Helper function to implement a single attempt to decrypt a groupcast message
  * using the given group key and privacy setting.
  *
+ * The privacy header is deobfuscated in place and restored before returning, so that the same
+ * message can be tried against every candidate key without copying it.
+ *
  * @param[in] partialPacketHeader The partial packet header with non-obfuscated message fields (result of calling DecodeFixed).
  * @param[out] packetHeaderCopy A copy of the packet header, to be filled with privacy decrypted fields
  * @param[out] payloadHeader The payload header of the decrypted message
  * @param[in] applyPrivacy Whether to apply privacy deobfuscation
- * @param[out] msgCopy A copy of the message, to be filled with the decrypted message
+ * @param[in] msg The message to decrypt, left unchanged on return
  * @param[in] mac The MAC of the message
  * @param[in] groupContext The group context to use for decryption key material
+ * @param[in,out] plaintext Buffer receiving the decrypted payload, allocated on first use. On success, it
+ *                          starts with the application payload.
  *
  * @return true if the message was decrypted successfully
  * @return false if the message could not be decrypted
  */
 static bool GroupKeyDecryptAttempt(const PacketHeader & partialPacketHeader, PacketHeader & packetHeaderCopy,
-                                   PayloadHeader & payloadHeader, bool applyPrivacy, System::PacketBufferHandle & msgCopy,
+                                   PayloadHeader & payloadHeader, bool applyPrivacy, const System::PacketBufferHandle & msg,
                                    const MessageAuthenticationCode & mac,
-                                   const Credentials::GroupDataProvider::GroupSession & groupContext)
+                                   const Credentials::GroupDataProvider::GroupSession & groupContext,
+                                   System::PacketBufferHandle & plaintext)
 {
-    bool decrypted = false;
+    constexpr size_t kMaxPrivacyHeaderLength = PacketHeader::kPrivacyHeaderMinLength + 2 * sizeof(NodeId);
+
     CryptoContext context(groupContext.keyContext);
+    uint8_t * privacyHeader = partialPacketHeader.PrivacyHeader(msg->Start());
+    size_t privacyLength    = partialPacketHeader.PrivacyHeaderLength();
+    uint8_t obfuscatedHeader[kMaxPrivacyHeaderLength];
+    bool decrypted = true;
 
     if (applyPrivacy)
     {
         // Perform privacy deobfuscation, if applicable.
-        uint8_t * privacyHeader = partialPacketHeader.PrivacyHeader(msgCopy->Start());
-        size_t privacyLength    = partialPacketHeader.PrivacyHeaderLength();
-        if (CHIP_NO_ERROR != context.PrivacyDecrypt(privacyHeader, privacyLength, privacyHeader, partialPacketHeader, mac))
-        {
-            return false;
-        }
+        VerifyOrReturnValue(privacyLength <= sizeof(obfuscatedHeader), false);
+        VerifyOrReturnValue(PacketHeader::kPrivacyHeaderOffset + privacyLength <= msg->DataLength(), false);
+        memcpy(obfuscatedHeader, privacyHeader, privacyLength);
+        decrypted =
+            (CHIP_NO_ERROR == context.PrivacyDecrypt(privacyHeader, privacyLength, privacyHeader, partialPacketHeader, mac));
     }
 
-    if (packetHeaderCopy.DecodeAndConsume(msgCopy) != CHIP_NO_ERROR)
-    {
-        ChipLogError(Inet, "Failed to decode Groupcast packet header. Discarding.");
-        return false;
-    }
+    decrypted =
+        decrypted && GroupPayloadDecryptAttempt(context, packetHeaderCopy, payloadHeader, msg, mac, groupContext, plaintext);
 
-    // Optimization to reduce number of decryption attempts
-    GroupId groupId = packetHeaderCopy.GetDestinationGroupId().Value();
-    if (groupId != groupContext.group_id)
+    if (applyPrivacy)
     {
-        return false;
+        memcpy(privacyHeader, obfuscatedHeader, privacyLength);
     }
-
-    CryptoContext::NonceStorage nonce;
-    CHIP_ERROR nonceResult =
-        CryptoContext::BuildNonce(nonce, packetHeaderCopy.GetSecurityFlags(), packetHeaderCopy.GetMessageCounter(),
-                                  packetHeaderCopy.GetSourceNodeId().Value());
-    decrypted = (nonceResult == CHIP_NO_ERROR) &&
-        (CHIP_NO_ERROR == SecureMessageCodec::Decrypt(context, nonce, payloadHeader, packetHeaderCopy, msgCopy));
-
     return decrypted;
 }
 
@@ -1077,7 +1133,7 @@ void SessionManager::SecureGroupMessageDispatch(const PacketHeader & partialPack
 
     PayloadHeader payloadHeader;
     PacketHeader packetHeaderCopy; /// Packet header decoded per group key, with privacy decrypted fields
-    System::PacketBufferHandle msgCopy;
+    System::PacketBufferHandle plaintext;
     Credentials::GroupDataProvider * groups = Credentials::GetGroupDataProvider();
     VerifyOrReturn(nullptr != groups);
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -1120,30 +1176,16 @@ void SessionManager::SecureGroupMessageDispatch(const PacketHeader & partialPack
     bool decrypted = false;
     while (!decrypted && iter->Next(groupContext))
     {
-        CryptoContext context(groupContext.keyContext);
-        msgCopy = msg.CloneData();
-        if (msgCopy.IsNull())
-        {
-            ChipLogError(Inet, "Failed to clone Groupcast message buffer. Discarding.");
-            return;
-        }
-
         bool privacy = partialPacketHeader.HasPrivacyFlag();
-        decrypted =
-            GroupKeyDecryptAttempt(partialPacketHeader, packetHeaderCopy, payloadHeader, privacy, msgCopy, mac, groupContext);
+        decrypted = GroupKeyDecryptAttempt(partialPacketHeader, packetHeaderCopy, payloadHeader, privacy, msg, mac, groupContext,
+                                           plaintext);
 
 #if CHIP_CONFIG_PRIVACY_ACCEPT_NONSPEC_SVE2
         if (privacy && !decrypted)
         {
             // Try processing the P=1 message again without privacy as a work-around for invalid early-SVE2 nodes.
-            msgCopy = msg.CloneData();
-            if (msgCopy.IsNull())
-            {
-                ChipLogError(Inet, "Failed to clone Groupcast message buffer. Discarding.");
-                return;
-            }
-            decrypted =
-                GroupKeyDecryptAttempt(partialPacketHeader, packetHeaderCopy, payloadHeader, false, msgCopy, mac, groupContext);
+            decrypted = GroupKeyDecryptAttempt(partialPacketHeader, packetHeaderCopy, payloadHeader, false, msg, mac, groupContext,
+                                               plaintext);
         }
 #endif // CHIP_CONFIG_PRIVACY_ACCEPT_NONSPEC_SVE2
     }
@@ -1154,7 +1196,7 @@ void SessionManager::SecureGroupMessageDispatch(const PacketHeader & partialPack
         ChipLogError(Inet, "Failed to decrypt group message. Discarding everything");
         return;
     }
-    msg = std::move(msgCopy);
+    msg = std::move(plaintext);
 
     // MCSP check
     if (packetHeaderCopy.IsValidMCSPMsg())
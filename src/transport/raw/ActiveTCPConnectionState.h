@@ -122,6 +122,13 @@ private:
     Inet::TCPEndPointHandle mEndPoint;
     ReleaseFnType mReleaseConnection;
 
+    // Links maintained by TCPBase, which indexes in-use connections by endpoint and by peer address, and keeps them in a list
+    // ordered by last use. Free connections are kept in a separate list, linked through mLessRecentlyUsed.
+    ActiveTCPConnectionState * mNextInEndPointBucket = nullptr;
+    ActiveTCPConnectionState * mNextInPeerBucket     = nullptr;
+    ActiveTCPConnectionState * mMoreRecentlyUsed     = nullptr;
+    ActiveTCPConnectionState * mLessRecentlyUsed     = nullptr;
+
     void Init(Inet::TCPEndPointHandle endPoint, const PeerAddress & peerAddr, ReleaseFnType releaseConnection)
     {
         mEndPoint          = endPoint;
@@ -63,6 +63,15 @@ CHIP_ERROR GetPeerAddress(Inet::TCPEndPoint & endPoint, PeerAddress & outAddr)
     return CHIP_NO_ERROR;
 }
 
+// Spreads values whose low bits barely vary (e.g. addresses of pool allocated endpoints) over all the bits.
+size_t MixBits(uint64_t value)
+{
+    value ^= value >> 33;
+    value *= 0xff51afd7ed558ccdULL;
+    value ^= value >> 33;
+    return static_cast<size_t>(value);
+}
+
 } // namespace
 
 TCPBase::~TCPBase()
@@ -132,41 +141,178 @@ void TCPBase::Close()
     mState = TCPState::kNotReady;
 }
 
+void TCPBase::InitConnections()
+{
+    mFreeConnections = nullptr;
+    for (size_t i = mActiveConnectionsSize; i > 0; i--)
+    {
+        ActiveTCPConnectionState & connection = mActiveConnections[i - 1];
+        connection.Init(nullptr, PeerAddress::Uninitialized(), [](auto &) {});
+        connection.mLessRecentlyUsed = mFreeConnections;
+        mFreeConnections             = &connection;
+    }
+}
+
 ActiveTCPConnectionState * TCPBase::AllocateConnection(const Inet::TCPEndPointHandle & endpoint, const PeerAddress & address)
 {
-    // If a peer initiates a connection through HandleIncomingConnection but the connection is never claimed
-    // in ProcessSingleMessage, we'll be left with a dangling ActiveTCPConnectionState which can be
-    // reclaimed.  Don't try to reclaim these connections unless we're out of space
-    for (int reclaim = 0; reclaim < 2; reclaim++)
+    ActiveTCPConnectionState * activeConnection = TakeFreeConnection();
+
+    if (activeConnection == nullptr)
     {
-        for (size_t i = 0; i < mActiveConnectionsSize; i++)
+        // Out of space. If a peer initiates a connection through HandleIncomingConnection but the connection is never claimed
+        // in ProcessSingleMessage, we'll be left with a dangling ActiveTCPConnectionState (i.e. with a ref count of 0) which
+        // can be reclaimed. Evict the least recently used one.
+        for (ActiveTCPConnectionState * conn = mLeastRecentlyUsed; conn != nullptr; conn = conn->mMoreRecentlyUsed)
         {
-            ActiveTCPConnectionState * activeConnection = &mActiveConnections[i];
-            if (!activeConnection->InUse() && (activeConnection->GetReferenceCount() == 0))
+            if (conn->GetReferenceCount() == 0)
             {
-                // Update state for the active connection
-                activeConnection->Init(endpoint, address, [this](auto & conn) { TCPDisconnect(conn, true); });
-                return activeConnection;
+                ActiveTCPConnectionHandle releaseUnclaimed(conn);
+                break;
             }
         }
+        activeConnection = TakeFreeConnection();
+    }
 
-        // Out of space; reclaim connections that were never claimed by ProcessSingleMessage
-        // (i.e. that have a ref count of 0)
-        for (size_t i = 0; i < mActiveConnectionsSize; i++)
+    if (activeConnection == nullptr)
+    {
+        // All free connections are still referenced, although they were closed.
+        for (ActiveTCPConnectionState * conn = mFreeConnections; conn != nullptr; conn = conn->mLessRecentlyUsed)
         {
-            ActiveTCPConnectionState * activeConnection = &mActiveConnections[i];
-            if (!activeConnection->InUse() && (activeConnection->GetReferenceCount() != 0))
-            {
-                char addrStr[Transport::PeerAddress::kMaxToStringSize];
-                activeConnection->mPeerAddr.ToString(addrStr);
-                ChipLogError(Inet, "Leaked TCP connection %p to %s.", activeConnection, addrStr);
-            }
-            ActiveTCPConnectionHandle releaseUnclaimed(activeConnection);
+            char addrStr[Transport::PeerAddress::kMaxToStringSize];
+            conn->mPeerAddr.ToString(addrStr);
+            ChipLogError(Inet, "Leaked TCP connection %p to %s.", conn, addrStr);
+        }
+        return nullptr;
+    }
+
+    // Update state for the active connection
+    activeConnection->Init(endpoint, address, [this](auto & conn) { TCPDisconnect(conn, true); });
+    IndexConnection(*activeConnection);
+    return activeConnection;
+}
+
+ActiveTCPConnectionState * TCPBase::TakeFreeConnection()
+{
+    for (ActiveTCPConnectionState ** link = &mFreeConnections; *link != nullptr; link = &(*link)->mLessRecentlyUsed)
+    {
+        ActiveTCPConnectionState * connection = *link;
+        if (connection->GetReferenceCount() == 0)
+        {
+            *link                         = connection->mLessRecentlyUsed;
+            connection->mLessRecentlyUsed = nullptr;
+            return connection;
         }
     }
     return nullptr;
 }
 
+void TCPBase::FreeConnection(ActiveTCPConnectionState & connection)
+{
+    if (connection.InUse())
+    {
+        UnindexConnection(connection);
+    }
+    connection.Free();
+    connection.mLessRecentlyUsed = mFreeConnections;
+    mFreeConnections             = &connection;
+}
+
+size_t TCPBase::EndPointBucket(const Inet::TCPEndPoint & endPoint) const
+{
+    return MixBits(reinterpret_cast<uintptr_t>(&endPoint)) % mActiveConnectionsSize;
+}
+
+size_t TCPBase::PeerBucket(const PeerAddress & address) const
+{
+    // Only hash fields compared by PeerAddress::operator==.
+    const uint32_t * ip = address.GetIPAddress().Addr;
+    uint64_t hash       = MixBits((static_cast<uint64_t>(ip[0]) << 32) | ip[1]);
+    hash                = MixBits(hash ^ ((static_cast<uint64_t>(ip[2]) << 32) | ip[3]));
+    return MixBits(hash ^ address.GetPort()) % mActiveConnectionsSize;
+}
+
+void TCPBase::IndexConnection(ActiveTCPConnectionState & connection)
+{
+    ConnectionBucket & endPointBucket = mConnectionBuckets[EndPointBucket(*connection.mEndPoint)];
+    connection.mNextInEndPointBucket  = endPointBucket.byEndPoint;
+    endPointBucket.byEndPoint         = &connection;
+
+    ConnectionBucket & peerBucket = mConnectionBuckets[PeerBucket(connection.mPeerAddr)];
+    connection.mNextInPeerBucket  = peerBucket.byPeer;
+    peerBucket.byPeer             = &connection;
+
+    LinkUsedConnection(connection);
+}
+
+void TCPBase::UnindexConnection(ActiveTCPConnectionState & connection)
+{
+    ActiveTCPConnectionState ** link = &mConnectionBuckets[EndPointBucket(*connection.mEndPoint)].byEndPoint;
+    while (*link != &connection)
+    {
+        link = &(*link)->mNextInEndPointBucket;
+    }
+    *link                            = connection.mNextInEndPointBucket;
+    connection.mNextInEndPointBucket = nullptr;
+
+    link = &mConnectionBuckets[PeerBucket(connection.mPeerAddr)].byPeer;
+    while (*link != &connection)
+    {
+        link = &(*link)->mNextInPeerBucket;
+    }
+    *link                        = connection.mNextInPeerBucket;
+    connection.mNextInPeerBucket = nullptr;
+
+    UnlinkUsedConnection(connection);
+}
+
+void TCPBase::UnlinkUsedConnection(ActiveTCPConnectionState & connection)
+{
+    if (connection.mMoreRecentlyUsed != nullptr)
+    {
+        connection.mMoreRecentlyUsed->mLessRecentlyUsed = connection.mLessRecentlyUsed;
+    }
+    else
+    {
+        mMostRecentlyUsed = connection.mLessRecentlyUsed;
+    }
+
+    if (connection.mLessRecentlyUsed != nullptr)
+    {
+        connection.mLessRecentlyUsed->mMoreRecentlyUsed = connection.mMoreRecentlyUsed;
+    }
+    else
+    {
+        mLeastRecentlyUsed = connection.mMoreRecentlyUsed;
+    }
+
+    connection.mMoreRecentlyUsed = nullptr;
+    connection.mLessRecentlyUsed = nullptr;
+}
+
+void TCPBase::LinkUsedConnection(ActiveTCPConnectionState & connection)
+{
+    connection.mMoreRecentlyUsed = nullptr;
+    connection.mLessRecentlyUsed = mMostRecentlyUsed;
+    if (mMostRecentlyUsed != nullptr)
+    {
+        mMostRecentlyUsed->mMoreRecentlyUsed = &connection;
+    }
+    else
+    {
+        mLeastRecentlyUsed = &connection;
+    }
+    mMostRecentlyUsed = &connection;
+}
+
+void TCPBase::MarkConnectionUsed(ActiveTCPConnectionState & connection)
+{
+    if (connection.InUse() && mMostRecentlyUsed != &connection)
+    {
+        UnlinkUsedConnection(connection);
+        LinkUsedConnection(connection);
+    }
+}
+
 // Find an ActiveTCPConnectionState corresponding to a peer address
 ActiveTCPConnectionHandle TCPBase::FindInUseConnection(const PeerAddress & address)
 {
@@ -175,30 +321,25 @@ ActiveTCPConnectionHandle TCPBase::FindInUseConnection(const PeerAddress & addre
         return nullptr;
     }
 
-    for (size_t i = 0; i < mActiveConnectionsSize; i++)
+    ActiveTCPConnectionState * conn = mConnectionBuckets[PeerBucket(address)].byPeer;
+    for (; conn != nullptr; conn = conn->mNextInPeerBucket)
     {
-        auto & conn = mActiveConnections[i];
-        if (!conn.InUse())
-        {
-            continue;
-        }
-
-        if (conn.mPeerAddr == address)
+        if (conn->mPeerAddr == address)
         {
             Inet::IPAddress addr;
             uint16_t port;
-            if (conn.IsConnected())
+            if (conn->IsConnected())
             {
                 // Failure to get peer information means the connection is bad; close it
-                CHIP_ERROR err = conn.mEndPoint->GetPeerInfo(&addr, &port);
+                CHIP_ERROR err = conn->mEndPoint->GetPeerInfo(&addr, &port);
                 if (err != CHIP_NO_ERROR)
                 {
-                    CloseConnectionInternal(conn, err, SuppressCallback::No);
+                    CloseConnectionInternal(*conn, err, SuppressCallback::No);
                     return nullptr;
                 }
             }
 
-            return ActiveTCPConnectionHandle(&conn);
+            return ActiveTCPConnectionHandle(conn);
         }
     }
 
@@ -208,11 +349,12 @@ ActiveTCPConnectionHandle TCPBase::FindInUseConnection(const PeerAddress & addre
 // Find the ActiveTCPConnectionState for a given TCPEndPoint
 ActiveTCPConnectionState * TCPBase::FindActiveConnection(const Inet::TCPEndPointHandle & endPoint)
 {
-    for (size_t i = 0; i < mActiveConnectionsSize; i++)
+    ActiveTCPConnectionState * conn = mConnectionBuckets[EndPointBucket(*endPoint)].byEndPoint;
+    for (; conn != nullptr; conn = conn->mNextInEndPointBucket)
     {
-        if (mActiveConnections[i].mEndPoint == endPoint && mActiveConnections[i].IsConnected())
+        if (conn->mEndPoint == endPoint && conn->IsConnected())
         {
-            return &mActiveConnections[i];
+            return conn;
         }
     }
     return nullptr;
@@ -220,11 +362,12 @@ ActiveTCPConnectionState * TCPBase::FindActiveConnection(const Inet::TCPEndPoint
 
 ActiveTCPConnectionHandle TCPBase::FindInUseConnection(const Inet::TCPEndPoint & endPoint)
 {
-    for (size_t i = 0; i < mActiveConnectionsSize; i++)
+    ActiveTCPConnectionState * conn = mConnectionBuckets[EndPointBucket(endPoint)].byEndPoint;
+    for (; conn != nullptr; conn = conn->mNextInEndPointBucket)
     {
-        if (mActiveConnections[i].mEndPoint == endPoint)
+        if (conn->mEndPoint == endPoint)
         {
-            return ActiveTCPConnectionHandle(&mActiveConnections[i]);
+            return ActiveTCPConnectionHandle(conn);
         }
     }
     return nullptr;
@@ -259,6 +402,7 @@ CHIP_ERROR TCPBase::SendMessage(const Transport::PeerAddress & address, System::
     // Must find a previously-established connection with an owning reference
     auto connection = FindInUseConnection(address);
     VerifyOrReturnError(!connection.IsNull(), CHIP_ERROR_INCORRECT_STATE);
+    MarkConnectionUsed(*connection);
     if (connection->IsConnected())
     {
         return connection->mEndPoint->Send(std::move(msgBuf));
@@ -271,6 +415,7 @@ CHIP_ERROR TCPBase::SendMessage(const ActiveTCPConnectionHandle & connection, Sy
 {
     VerifyOrReturnError(!connection.IsNull(), CHIP_ERROR_INVALID_ARGUMENT);
     ReturnErrorOnFailure(PrepareBuffer(msgBuf));
+    MarkConnectionUsed(*connection);
 
     if (connection->IsConnected())
     {
@@ -375,6 +520,7 @@ CHIP_ERROR TCPBase::ProcessReceivedBuffer(const Inet::TCPEndPointHandle & endPoi
     ActiveTCPConnectionState * state = FindActiveConnection(endPoint);
     // There must be a preceding TCPConnect to hold a reference to connection
     VerifyOrReturnError(state != nullptr, CHIP_ERROR_INTERNAL);
+    MarkConnectionUsed(*state);
     state->mReceived.AddToEnd(std::move(buffer));
 
     while (!state->mReceived.IsNull())
@@ -410,8 +556,8 @@ CHIP_ERROR TCPBase::ProcessReceivedBuffer(const Inet::TCPEndPointHandle & endPoi
 
         if (messageSize == 0)
         {
-            // No payload but considered a valid message. Return success to keep the connection alive.
-            return CHIP_NO_ERROR;
+            // No payload but considered a valid message, which keeps the connection alive. Further messages may follow.
+            continue;
         }
 
         ReturnErrorOnFailure(ProcessSingleMessage(peerAddress, *state, messageSize));
@@ -426,17 +572,35 @@ CHIP_ERROR TCPBase::ProcessSingleMessage(const PeerAddress & peerAddress, Active
     // `state->mReceived->Start()` currently points to the message data.
     // On exit, `state->mReceived` will have had `messageSize` bytes consumed, no matter what.
     System::PacketBufferHandle message;
+    const size_t headLength = state.mReceived->DataLength();
 
-    if (state.mReceived->DataLength() == messageSize)
+    if (headLength == messageSize)
     {
         // In this case, the head packet buffer contains exactly the message.
         // This is common because typical messages fit in a network packet, and are delivered as such.
         // Peel off the head to pass upstream, which effectively consumes it from `state->mReceived`.
         message = state.mReceived.PopHead();
     }
+    else if (headLength > messageSize && headLength - messageSize < messageSize)
+    {
+        // The head packet buffer contains the message followed by (the start of) further messages, which happens when the peer
+        // sends faster than we read. Upper layers must own the buffer they are given, so one of the two parts has to be copied:
+        // since the trailing data is the smaller one, move it to a fresh buffer and pass the head buffer upstream as is.
+        System::PacketBufferHandle trailing =
+            System::PacketBufferHandle::NewWithData(state.mReceived->Start() + messageSize, headLength - messageSize, 0, 0);
+        VerifyOrReturnError(!trailing.IsNull(), CHIP_ERROR_NO_MEMORY);
+
+        message = state.mReceived.PopHead();
+        message->SetDataLength(messageSize);
+        if (!state.mReceived.IsNull())
+        {
+            trailing->AddToEnd(std::move(state.mReceived));
+        }
+        state.mReceived = std::move(trailing);
+    }
     else
     {
-        // The message is either longer or shorter than the head buffer.
+        // The message is either spread over several buffers, or small compared to the data following it in the head buffer.
         // In either case, copy the message to a fresh linear buffer to pass upstream. We always copy, rather than provide
         // a shared reference to the current buffer, in case upper layers manipulate the buffer in ways that would affect
         // our use, e.g. chaining it elsewhere or reusing space beyond the current message.
@@ -468,6 +632,7 @@ void TCPBase::CloseConnectionInternal(ActiveTCPConnectionState & connection, CHI
     connection.mPeerAddr.ToString(addrStr);
     ChipLogProgress(Inet, "Closing connection with peer %s.", addrStr);
 
+    UnindexConnection(connection);
     Inet::TCPEndPointHandle endpoint = connection.mEndPoint;
     connection.mEndPoint.Release();
     if (err == CHIP_NO_ERROR)
@@ -497,7 +662,7 @@ void TCPBase::CloseConnectionInternal(ActiveTCPConnectionState & connection, CHI
         }
     }
 
-    connection.Free();
+    FreeConnection(connection);
     mUsedEndPointCount--;
 }
 
@@ -646,7 +811,7 @@ CHIP_ERROR TCPBase::DoHandleIncomingConnection(const Inet::TCPEndPointHandle & l
     ActiveTCPConnectionState * activeConnection = AllocateConnection(endPoint, addr);
     VerifyOrReturnError(activeConnection != nullptr, CHIP_ERROR_TOO_MANY_CONNECTIONS);
 
-    auto connectionCleanup = ScopeExit([&]() { activeConnection->Free(); });
+    auto connectionCleanup = ScopeExit([&]() { FreeConnection(*activeConnection); });
 
     endPoint->mAppState          = this;
     endPoint->OnDataReceived     = HandleTCPEndPointDataReceived;
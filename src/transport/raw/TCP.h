@@ -123,11 +123,27 @@ protected:
 
 public:
     using PendingPacketPoolType = PoolInterface<PendingPacket, const PeerAddress &, System::PacketBufferHandle &&>;
-    TCPBase(ActiveTCPConnectionState * activeConnectionsBuffer, size_t bufferSize, PendingPacketPoolType & packetBuffers) :
-        mActiveConnections(activeConnectionsBuffer), mActiveConnectionsSize(bufferSize), mPendingPackets(packetBuffers)
+
+    /**
+     * Heads of the chains of in-use connections whose endpoint, respectively peer address, hashes to the bucket.
+     */
+    struct ConnectionBucket
     {
-        // activeConnectionsBuffer must be initialized by the caller.
-    }
+        ActiveTCPConnectionState * byEndPoint = nullptr;
+        ActiveTCPConnectionState * byPeer     = nullptr;
+    };
+
+    /**
+     * @param activeConnectionsBuffer  The connections, which must be set up by the caller through InitConnections.
+     * @param bufferSize               The number of connections, and of buckets.
+     * @param connectionBuckets        The buckets used to look connections up, one per connection.
+     * @param packetBuffers            The pool of packets waiting for a connection to complete.
+     */
+    TCPBase(ActiveTCPConnectionState * activeConnectionsBuffer, size_t bufferSize, ConnectionBucket * connectionBuckets,
+            PendingPacketPoolType & packetBuffers) :
+        mActiveConnections(activeConnectionsBuffer), mActiveConnectionsSize(bufferSize), mConnectionBuckets(connectionBuckets),
+        mPendingPackets(packetBuffers)
+    {}
     ~TCPBase() override;
 
     /**
@@ -206,6 +222,12 @@ public:
     static bool sForceFailureInDoHandleIncomingConnection;
 #endif
 
+protected:
+    /**
+     * Initialize the connections buffer, making every connection free.
+     */
+    void InitConnections();
+
 private:
     // Allow tests to access private members.
     template <size_t kActiveConnectionsSize, size_t kPendingPacketSize>
@@ -227,6 +249,38 @@ private:
      */
     ActiveTCPConnectionHandle FindInUseConnection(const Inet::TCPEndPoint & endPoint);
 
+    size_t EndPointBucket(const Inet::TCPEndPoint & endPoint) const;
+    size_t PeerBucket(const PeerAddress & address) const;
+
+    /**
+     * Add a newly allocated connection to the lookup buckets, as the most recently used one.
+     */
+    void IndexConnection(ActiveTCPConnectionState & connection);
+
+    /**
+     * Remove a connection from the lookup buckets, before its endpoint is released.
+     */
+    void UnindexConnection(ActiveTCPConnectionState & connection);
+
+    // Add a connection to, respectively remove it from, the list of in-use connections.
+    void LinkUsedConnection(ActiveTCPConnectionState & connection);
+    void UnlinkUsedConnection(ActiveTCPConnectionState & connection);
+
+    /**
+     * Mark a connection as the most recently used one, which makes it the last candidate for eviction.
+     */
+    void MarkConnectionUsed(ActiveTCPConnectionState & connection);
+
+    /**
+     * Free a connection and return it to the free list.
+     */
+    void FreeConnection(ActiveTCPConnectionState & connection);
+
+    /**
+     * Take a connection which is no longer referenced from the free list, or return nullptr if there is none.
+     */
+    ActiveTCPConnectionState * TakeFreeConnection();
+
     /**
      * Sends the specified message once a connection has been established.
      *
@@ -326,6 +380,14 @@ private:
     ActiveTCPConnectionState * mActiveConnections;
     const size_t mActiveConnectionsSize;
 
+    // In-use connections, looked up by endpoint and by peer address, and listed from most to least recently used.
+    ConnectionBucket * mConnectionBuckets;
+    ActiveTCPConnectionState * mMostRecentlyUsed  = nullptr;
+    ActiveTCPConnectionState * mLeastRecentlyUsed = nullptr;
+
+    // Connections which are not in use, although they may still be referenced.
+    ActiveTCPConnectionState * mFreeConnections = nullptr;
+
     // Data to be sent when connections succeed
     PendingPacketPoolType & mPendingPackets;
 };
@@ -334,18 +396,13 @@ template <size_t kActiveConnectionsSize, size_t kPendingPacketSize>
 class TCP : public TCPBase
 {
 public:
-    TCP() : TCPBase(mConnectionsBuffer, kActiveConnectionsSize, mPendingPackets)
-    {
-        for (size_t i = 0; i < kActiveConnectionsSize; ++i)
-        {
-            mConnectionsBuffer[i].Init(nullptr, PeerAddress::Uninitialized(), [](auto &) {});
-        }
-    }
+    TCP() : TCPBase(mConnectionsBuffer, kActiveConnectionsSize, mConnectionBuckets, mPendingPackets) { InitConnections(); }
 
     ~TCP() override { mPendingPackets.ReleaseAll(); }
 
 private:
     ActiveTCPConnectionState mConnectionsBuffer[kActiveConnectionsSize];
+    ConnectionBucket mConnectionBuckets[kActiveConnectionsSize];
     PoolImpl<PendingPacket, kPendingPacketSize, ObjectPoolMem::kInline, PendingPacketPoolType::Interface> mPendingPackets;
 };
 
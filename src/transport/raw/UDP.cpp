@@ -55,6 +55,9 @@ CHIP_ERROR UDP::Init(UdpListenParameters & params)
     err = mUDPEndPoint->Listen(OnUdpReceive, OnUdpError, this);
     SuccessOrExit(err);
 
+    // Bursts of responses and reports from many peers are read with as few system calls as the platform allows.
+    mUDPEndPoint->SetReceiveBatchSize(INET_CONFIG_UDP_MAX_BATCH_SIZE);
+
     mUDPEndpointType = params.GetAddressType();
 
     mState = State::kInitialized;
@@ -79,6 +82,9 @@ uint16_t UDP::GetBoundPort()
 
 void UDP::Close()
 {
+#if HAVE_SENDMMSG
+    FlushSendQueue();
+#endif // HAVE_SENDMMSG
     mUDPEndPoint.Release();
     mState = State::kNotReady;
 }
@@ -99,8 +105,64 @@ CHIP_ERROR UDP::SendMessage(const Transport::PeerAddress & address, System::Pack
     // Drop the message and return. Free the buffer.
     CHIP_FAULT_INJECT(FaultInjection::kFault_DropOutgoingUDPMsg, msgBuf = nullptr; return CHIP_ERROR_CONNECTION_ABORTED;);
 
+#if HAVE_SENDMMSG
+    VerifyOrReturnError(!msgBuf.IsNull(), CHIP_ERROR_INVALID_ARGUMENT);
+
+    // The first message queued in a pass of the event loop schedules the flush that sends them all. Should that fail,
+    // the message is sent right away instead.
+    if (mSendQueueCount == 0 && mUDPEndPoint->GetSystemLayer().ScheduleWork(HandleSendQueueFlush, this) != CHIP_NO_ERROR)
+    {
+        return mUDPEndPoint->SendMsg(&addrInfo, std::move(msgBuf));
+    }
+
+    mSendQueueInfos[mSendQueueCount] = addrInfo;
+    mSendQueue[mSendQueueCount]      = std::move(msgBuf);
+    mSendQueueCount++;
+
+    // A full queue does not wait for the end of the pass.
+    if (mSendQueueCount == MATTER_ARRAY_SIZE(mSendQueue))
+    {
+        FlushSendQueue();
+    }
+
+    return CHIP_NO_ERROR;
+#else
     return mUDPEndPoint->SendMsg(&addrInfo, std::move(msgBuf));
+#endif // HAVE_SENDMMSG
+}
+
+#if HAVE_SENDMMSG
+void UDP::HandleSendQueueFlush(System::Layer * systemLayer, void * appState)
+{
+    static_cast<UDP *>(appState)->FlushSendQueue();
+}
+
+void UDP::FlushSendQueue()
+{
+    VerifyOrReturn(mSendQueueCount > 0);
+
+    // Nothing is left to flush once this returns, so the scheduled flush is no longer needed (this may be that flush).
+    mUDPEndPoint->GetSystemLayer().CancelTimer(HandleSendQueueFlush, this);
+
+    // A message that cannot be sent is dropped, like a message that is lost on the way, and the rest still go out.
+    size_t sentCount = 0;
+    while (sentCount < mSendQueueCount)
+    {
+        size_t batchSentCount = 0;
+        CHIP_ERROR err        = mUDPEndPoint->SendMsgs(&mSendQueueInfos[sentCount], &mSendQueue[sentCount],
+                                                       mSendQueueCount - sentCount, batchSentCount);
+        sentCount += batchSentCount;
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(Inet, "Failed to send UDP message: %" CHIP_ERROR_FORMAT, err.Format());
+            mSendQueue[sentCount] = nullptr;
+            sentCount++;
+        }
+    }
+
+    mSendQueueCount = 0;
 }
+#endif // HAVE_SENDMMSG
 
 void UDP::OnUdpReceive(Inet::UDPEndPoint * endPoint, System::PacketBufferHandle && buffer, const Inet::IPPacketInfo * pktInfo)
 {
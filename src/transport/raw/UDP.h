@@ -108,6 +108,8 @@ class DLL_EXPORT UDP : public Base
     };
 
 public:
+    ~UDP() override { Close(); }
+
     /**
      * Initialize a UDP transport on a given port.
      *
@@ -123,10 +125,18 @@ public:
     uint16_t GetBoundPort();
 
     /**
-     * Close the open endpoint without destroying the object
+     * Close the open endpoint without destroying the object; messages still queued for sending are sent first.
      */
     void Close() override;
 
+    /**
+     * Send a message to the given peer.
+     *
+     * @details
+     *   Where the platform can send several datagrams with one system call (see HAVE_SENDMMSG), the message is queued and
+     *   sent together with the others queued during the same pass of the event loop, once that pass is over. Errors
+     *   sending a queued message are then logged rather than returned.
+     */
     CHIP_ERROR SendMessage(const Transport::PeerAddress & address, System::PacketBufferHandle && msgBuf) override;
 
     CHIP_ERROR MulticastGroupJoinLeave(const Transport::PeerAddress & address, bool join) override;
@@ -149,6 +159,17 @@ private:
 
     static void OnUdpError(Inet::UDPEndPoint * endPoint, CHIP_ERROR err, const Inet::IPPacketInfo * pktInfo);
 
+#if HAVE_SENDMMSG
+    static void HandleSendQueueFlush(System::Layer * systemLayer, void * appState);
+
+    // Sends the queued messages; a flush is scheduled on the system layer whenever the queue is not empty.
+    void FlushSendQueue();
+
+    Inet::IPPacketInfo mSendQueueInfos[INET_CONFIG_UDP_MAX_BATCH_SIZE];    ///< Destinations of the queued messages
+    System::PacketBufferHandle mSendQueue[INET_CONFIG_UDP_MAX_BATCH_SIZE]; ///< Messages waiting for the next flush
+    size_t mSendQueueCount = 0;                                            ///< Number of queued messages
+#endif // HAVE_SENDMMSG
+
     Inet::UDPEndPointHandle mUDPEndPoint;                                 ///< UDP socket used by the transport
     Inet::IPAddressType mUDPEndpointType = Inet::IPAddressType::kUnknown; ///< Socket listening type
     State mState                         = State::kNotReady;              ///< State of the UDP transport
@@ -49,6 +49,22 @@ public:
         return result;
     }
     static Inet::TCPEndPointHandle & GetEndpoint(Connection & state) { return state.mHolder->mEndPoint; }
+    static Inet::TCPEndPointHandle GetEndpoint(ActiveTCPConnectionState & state) { return state.mEndPoint; }
+
+    // Looks a connection up without taking a reference to it, so that unclaimed connections stay unclaimed.
+    static ActiveTCPConnectionState * FindActiveConnection(TCPImpl & tcp, const Inet::TCPEndPointHandle & endPoint)
+    {
+        return tcp.FindActiveConnection(endPoint);
+    }
+
+    static ActiveTCPConnectionState * GetMostRecentlyUsed(TCPImpl & tcp) { return tcp.mMostRecentlyUsed; }
+    static ActiveTCPConnectionState * GetLeastRecentlyUsed(TCPImpl & tcp) { return tcp.mLeastRecentlyUsed; }
+
+    static size_t GetPeerBucket(TCPImpl & tcp, const PeerAddress & peerAddress) { return tcp.PeerBucket(peerAddress); }
+    static size_t GetEndpointBucket(TCPImpl & tcp, const Inet::TCPEndPointHandle & endPoint)
+    {
+        return tcp.EndPointBucket(*endPoint);
+    }
 
     static CHIP_ERROR ProcessReceivedBuffer(TCPImpl & tcp, Inet::TCPEndPointHandle & endPoint, const PeerAddress & peerAddress,
                                             System::PacketBufferHandle && buffer)
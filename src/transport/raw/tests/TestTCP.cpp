@@ -713,6 +713,27 @@ protected:
         gMockTransportMgrDelegate.DisconnectTest(tcp);
     }
 
+    /////////////////////////// Connection table tests
+    struct TestClient
+    {
+        TCPImpl tcp;
+        uint16_t port;
+        MockTransportMgrDelegate delegate{ mIOContext };
+    };
+
+    // Connects the client to the server, and returns the server side of the connection once the server accepted it.
+    ActiveTCPConnectionState * ConnectClient(TestClient & client, MockTransportMgrDelegate & serverDelegate, const IPAddress & addr,
+                                             uint16_t serverPort)
+    {
+        EXPECT_SUCCESS(client.delegate.InitializeMessageTest(client.tcp, addr, client.port));
+        serverDelegate.mHandleConnectionReceivedCalled = nullptr;
+
+        EXPECT_SUCCESS(client.tcp.TCPConnect(Transport::PeerAddress::TCP(addr, serverPort), nullptr, client.delegate.refHolder));
+        mIOContext->DriveIOUntil(chip::System::Clock::Seconds16(5),
+                                 [&serverDelegate]() { return serverDelegate.mHandleConnectionReceivedCalled != nullptr; });
+        return static_cast<ActiveTCPConnectionState *>(serverDelegate.mHandleConnectionReceivedCalled);
+    }
+
     // Callback used by CheckProcessReceivedBuffer.
     static CHIP_ERROR TestDataCallbackCheck(const uint8_t * message, size_t length, int count,
                                             ActiveTCPConnectionHandle & connection, void * data)
@@ -911,6 +932,201 @@ TEST_F(TestTCP, CheckTCPEndpointAfterCloseTest)
     ASSERT_TRUE(lEndPoint.IsNull());
 }
 
+TEST_F(TestTCP, CheckUnclaimedConnectionEviction)
+{
+    TCPImpl tcp;
+
+    IPAddress addr;
+    IPAddress::FromString("::1", addr);
+
+    uint16_t port;
+    MockTransportMgrDelegate gMockTransportMgrDelegate(mIOContext);
+    ASSERT_SUCCESS(gMockTransportMgrDelegate.InitializeMessageTest(tcp, addr, port));
+
+    // Incoming connections nothing claimed fill the table, from the least to the most recently used.
+    TestClient clients[kMaxTcpActiveConnectionCount + 2];
+    ActiveTCPConnectionState * incoming[kMaxTcpActiveConnectionCount + 2] = {};
+    for (size_t i = 0; i < kMaxTcpActiveConnectionCount; i++)
+    {
+        incoming[i] = ConnectClient(clients[i], gMockTransportMgrDelegate, addr, port);
+        ASSERT_NE(incoming[i], nullptr);
+    }
+    EXPECT_EQ(TestAccess::GetLeastRecentlyUsed(tcp), incoming[0]);
+    EXPECT_EQ(TestAccess::GetMostRecentlyUsed(tcp), incoming[kMaxTcpActiveConnectionCount - 1]);
+
+    // Another incoming connection only evicts the least recently used one.
+    incoming[kMaxTcpActiveConnectionCount] =
+        ConnectClient(clients[kMaxTcpActiveConnectionCount], gMockTransportMgrDelegate, addr, port);
+    ASSERT_NE(incoming[kMaxTcpActiveConnectionCount], nullptr);
+    EXPECT_EQ(TestAccess::GetLeastRecentlyUsed(tcp), incoming[1]);
+    EXPECT_EQ(TestAccess::GetMostRecentlyUsed(tcp), incoming[kMaxTcpActiveConnectionCount]);
+
+    mIOContext->DriveIOUntil(chip::System::Clock::Seconds16(5),
+                             [&clients]() { return clients[0].delegate.mHandleConnectionCloseCalled != nullptr; });
+    EXPECT_NE(clients[0].delegate.mHandleConnectionCloseCalled, nullptr);
+
+    // Claimed connections are not evicted, even when they are the least recently used.
+    ActiveTCPConnectionHandle claimed(incoming[1]);
+    incoming[kMaxTcpActiveConnectionCount + 1] =
+        ConnectClient(clients[kMaxTcpActiveConnectionCount + 1], gMockTransportMgrDelegate, addr, port);
+    ASSERT_NE(incoming[kMaxTcpActiveConnectionCount + 1], nullptr);
+    EXPECT_EQ(TestAccess::GetLeastRecentlyUsed(tcp), incoming[1]);
+    EXPECT_EQ(TestAccess::GetMostRecentlyUsed(tcp), incoming[kMaxTcpActiveConnectionCount + 1]);
+
+    mIOContext->DriveIOUntil(chip::System::Clock::Seconds16(5),
+                             [&clients]() { return clients[2].delegate.mHandleConnectionCloseCalled != nullptr; });
+    EXPECT_NE(clients[2].delegate.mHandleConnectionCloseCalled, nullptr);
+    EXPECT_EQ(clients[1].delegate.mHandleConnectionCloseCalled, nullptr);
+
+    claimed.Release();
+    for (auto & client : clients)
+    {
+        client.delegate.DisconnectTest(client.tcp);
+    }
+    gMockTransportMgrDelegate.DisconnectTest(tcp);
+}
+
+TEST_F(TestTCP, CheckConnectionUseOrder)
+{
+    TCPImpl tcp;
+
+    IPAddress addr;
+    IPAddress::FromString("::1", addr);
+
+    uint16_t port;
+    MockTransportMgrDelegate gMockTransportMgrDelegate(mIOContext);
+    ASSERT_SUCCESS(gMockTransportMgrDelegate.InitializeMessageTest(tcp, addr, port));
+
+    TestClient clients[3];
+    ActiveTCPConnectionState * incoming[3] = {};
+    for (size_t i = 0; i < MATTER_ARRAY_SIZE(clients); i++)
+    {
+        incoming[i] = ConnectClient(clients[i], gMockTransportMgrDelegate, addr, port);
+        ASSERT_NE(incoming[i], nullptr);
+    }
+    EXPECT_EQ(TestAccess::GetLeastRecentlyUsed(tcp), incoming[0]);
+    EXPECT_EQ(TestAccess::GetMostRecentlyUsed(tcp), incoming[2]);
+
+    // Receiving a message moves the connection to the front.
+    chip::System::PacketBufferHandle buffer;
+    ASSERT_SUCCESS(gMockTransportMgrDelegate.BufferWithHeader(kMessageCounter, buffer, PAYLOAD));
+    ASSERT_SUCCESS(clients[1].tcp.SendMessage(Transport::PeerAddress::TCP(addr, port), std::move(buffer)));
+    mIOContext->DriveIOUntil(chip::System::Clock::Seconds16(5),
+                             [&]() { return gMockTransportMgrDelegate.mReceiveHandlerCallCount != 0; });
+    EXPECT_EQ(gMockTransportMgrDelegate.mReceiveHandlerCallCount, 1);
+    EXPECT_EQ(TestAccess::GetLeastRecentlyUsed(tcp), incoming[0]);
+    EXPECT_EQ(TestAccess::GetMostRecentlyUsed(tcp), incoming[1]);
+
+    // So does sending one.
+    ActiveTCPConnectionHandle connection(incoming[0]);
+    ASSERT_SUCCESS(gMockTransportMgrDelegate.BufferWithHeader(kMessageCounter + 1, buffer, PAYLOAD_RESPONSE));
+    ASSERT_SUCCESS(tcp.SendMessage(connection, std::move(buffer)));
+    EXPECT_EQ(TestAccess::GetLeastRecentlyUsed(tcp), incoming[2]);
+    EXPECT_EQ(TestAccess::GetMostRecentlyUsed(tcp), incoming[0]);
+
+    connection.Release();
+    for (auto & client : clients)
+    {
+        client.delegate.DisconnectTest(client.tcp);
+    }
+    gMockTransportMgrDelegate.DisconnectTest(tcp);
+}
+
+TEST_F(TestTCP, CheckConnectionLookupWithSharedBuckets)
+{
+    TCPImpl tcp;
+
+    IPAddress addr;
+    IPAddress::FromString("::1", addr);
+
+    uint16_t port;
+    MockTransportMgrDelegate gMockTransportMgrDelegate(mIOContext);
+    ASSERT_SUCCESS(gMockTransportMgrDelegate.InitializeMessageTest(tcp, addr, port));
+
+    // Buckets depend on client ports and endpoint addresses: reconnect until connections shared a peer bucket and an endpoint
+    // bucket.
+    constexpr int kMaxAttempts = 20;
+    bool peerBucketShared      = false;
+    bool endPointBucketShared  = false;
+    for (int attempt = 0; attempt < kMaxAttempts && !(peerBucketShared && endPointBucketShared); attempt++)
+    {
+        TestClient clients[kMaxTcpActiveConnectionCount];
+        ActiveTCPConnectionHandle incoming[kMaxTcpActiveConnectionCount];
+        TCPEndPointHandle endPoints[kMaxTcpActiveConnectionCount];
+        Transport::PeerAddress peerAddresses[kMaxTcpActiveConnectionCount];
+        for (size_t i = 0; i < kMaxTcpActiveConnectionCount; i++)
+        {
+            ActiveTCPConnectionState * connection = ConnectClient(clients[i], gMockTransportMgrDelegate, addr, port);
+            ASSERT_NE(connection, nullptr);
+            incoming[i]      = ActiveTCPConnectionHandle(connection);
+            endPoints[i]     = TestAccess::GetEndpoint(*connection);
+            peerAddresses[i] = connection->mPeerAddr;
+        }
+
+        // Pick two connections sharing a bucket not covered yet. The more recent one is ahead of the other in the bucket.
+        size_t older = kMaxTcpActiveConnectionCount;
+        size_t newer = 0;
+        for (size_t i = 0; i < kMaxTcpActiveConnectionCount && older == kMaxTcpActiveConnectionCount; i++)
+        {
+            for (size_t j = i + 1; j < kMaxTcpActiveConnectionCount; j++)
+            {
+                bool samePeerBucket =
+                    TestAccess::GetPeerBucket(tcp, peerAddresses[i]) == TestAccess::GetPeerBucket(tcp, peerAddresses[j]);
+                bool sameEndPointBucket =
+                    TestAccess::GetEndpointBucket(tcp, endPoints[i]) == TestAccess::GetEndpointBucket(tcp, endPoints[j]);
+                if ((samePeerBucket && !peerBucketShared) || (sameEndPointBucket && !endPointBucketShared))
+                {
+                    peerBucketShared     = peerBucketShared || samePeerBucket;
+                    endPointBucketShared = endPointBucketShared || sameEndPointBucket;
+                    older                = i;
+                    newer                = j;
+                    break;
+                }
+            }
+        }
+
+        if (older != kMaxTcpActiveConnectionCount)
+        {
+            // Close the head of the bucket first, then the connection that was behind it.
+            bool closed[kMaxTcpActiveConnectionCount] = {};
+            for (size_t toClose : { newer, older })
+            {
+                clients[toClose].delegate.refHolder.Release();
+                mIOContext->DriveIOUntil(chip::System::Clock::Seconds16(5),
+                                         [&]() { return !incoming[toClose]->IsConnected(); });
+                ASSERT_FALSE(incoming[toClose]->IsConnected());
+                closed[toClose] = true;
+
+                // The connections left are still found by peer address and by endpoint, and the closed ones are not.
+                for (size_t i = 0; i < kMaxTcpActiveConnectionCount; i++)
+                {
+                    auto found = TestAccess::FindActiveConnection(tcp, peerAddresses[i]);
+                    EXPECT_EQ(static_cast<bool>(found), !closed[i]);
+                    if (found)
+                    {
+                        EXPECT_EQ(TestAccess::GetEndpoint(found), endPoints[i]);
+                    }
+                    EXPECT_EQ(TestAccess::FindActiveConnection(tcp, endPoints[i]), closed[i] ? nullptr : &*incoming[i]);
+                }
+            }
+        }
+
+        for (auto & connection : incoming)
+        {
+            connection.Release();
+        }
+        for (auto & client : clients)
+        {
+            client.delegate.DisconnectTest(client.tcp);
+        }
+        mIOContext->DriveIOUntil(chip::System::Clock::Seconds16(5), [&tcp]() { return !tcp.HasActiveConnections(); });
+    }
+
+    EXPECT_TRUE(peerBucketShared);
+    EXPECT_TRUE(endPointBucketShared);
+    gMockTransportMgrDelegate.DisconnectTest(tcp);
+}
+
 TEST_F(TestTCP, CheckProcessReceivedBuffer)
 {
     TCPImpl tcp;
@@ -974,6 +1190,43 @@ TEST_F(TestTCP, CheckProcessReceivedBuffer)
     EXPECT_EQ(err, CHIP_NO_ERROR);
     EXPECT_EQ(gMockTransportMgrDelegate.mReceiveHandlerCallCount, 2);
 
+    // Test two messages in a single packet buffer, followed by the start of a third one.
+    gMockTransportMgrDelegate.mReceiveHandlerCallCount = 0;
+    EXPECT_TRUE(testData[0].Init((const uint32_t[]){ 151, 0 }));
+    EXPECT_TRUE(testData[1].Init((const uint32_t[]){ 152, 0 }));
+    const size_t coalescedLength = testData[0].mTotalLength + testData[1].mTotalLength;
+    buf                          = System::PacketBufferHandle::New(coalescedLength + 10, 0);
+    ASSERT_FALSE(buf.IsNull());
+    memcpy(buf->Start(), testData[0].mPayload, testData[0].mTotalLength);
+    memcpy(buf->Start() + testData[0].mTotalLength, testData[1].mPayload, testData[1].mTotalLength);
+    memcpy(buf->Start() + coalescedLength, testData[1].mPayload, 10);
+    buf->SetDataLength(coalescedLength + 10);
+    err = TestAccess::ProcessReceivedBuffer(tcp, lEndPoint, lPeerAddress, std::move(buf));
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+    EXPECT_EQ(gMockTransportMgrDelegate.mReceiveHandlerCallCount, 2);
+
+    // Complete the third message.
+    gMockTransportMgrDelegate.mReceiveHandlerCallCount = 0;
+    gMockTransportMgrDelegate.SetCallback(TestDataCallbackCheck, &testData[1]);
+    buf = System::PacketBufferHandle::NewWithData(testData[1].mPayload + 10, testData[1].mTotalLength - 10, 0, 0);
+    ASSERT_FALSE(buf.IsNull());
+    err = TestAccess::ProcessReceivedBuffer(tcp, lEndPoint, lPeerAddress, std::move(buf));
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+    EXPECT_EQ(gMockTransportMgrDelegate.mReceiveHandlerCallCount, 1);
+    gMockTransportMgrDelegate.SetCallback(TestDataCallbackCheck, testData);
+
+    // Test a message following a message with zero size in the same packet buffer.
+    gMockTransportMgrDelegate.mReceiveHandlerCallCount = 0;
+    EXPECT_TRUE(testData[0].Init((const uint32_t[]){ 161, 0 }));
+    buf = System::PacketBufferHandle::New(kPacketSizeBytes + testData[0].mTotalLength, 0);
+    ASSERT_FALSE(buf.IsNull());
+    memset(buf->Start(), 0, kPacketSizeBytes);
+    memcpy(buf->Start() + kPacketSizeBytes, testData[0].mPayload, testData[0].mTotalLength);
+    buf->SetDataLength(kPacketSizeBytes + testData[0].mTotalLength);
+    err = TestAccess::ProcessReceivedBuffer(tcp, lEndPoint, lPeerAddress, std::move(buf));
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+    EXPECT_EQ(gMockTransportMgrDelegate.mReceiveHandlerCallCount, 1);
+
     // Test a single packet buffer that is larger than
     // kMaxSizeWithoutReserve but less than CHIP_CONFIG_MAX_LARGE_PAYLOAD_SIZE_BYTES.
     gMockTransportMgrDelegate.mReceiveHandlerCallCount = 0;
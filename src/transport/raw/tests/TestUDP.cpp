@@ -112,13 +112,10 @@ protected:
         EXPECT_EQ(err, CHIP_NO_ERROR);
     }
 
-    void CheckMessageTest(const IPAddress & addr)
+    void CheckMessageTest(const IPAddress & addr, int messageCount = 1)
     {
         uint16_t payload_len = sizeof(PAYLOAD);
 
-        chip::System::PacketBufferHandle buffer = chip::System::PacketBufferHandle::NewWithData(PAYLOAD, payload_len);
-        EXPECT_FALSE(buffer.IsNull());
-
         CHIP_ERROR err = CHIP_NO_ERROR;
 
         Transport::UDP udp;
@@ -137,16 +134,23 @@ protected:
         PacketHeader header;
         header.SetSourceNodeId(kSourceNodeId).SetDestinationNodeId(kDestinationNodeId).SetMessageCounter(kMessageCounter);
 
-        err = header.EncodeBeforeData(buffer);
-        EXPECT_EQ(err, CHIP_NO_ERROR);
+        for (int i = 0; i < messageCount; i++)
+        {
+            chip::System::PacketBufferHandle buffer = chip::System::PacketBufferHandle::NewWithData(PAYLOAD, payload_len);
+            ASSERT_FALSE(buffer.IsNull());
 
-        // Should be able to send a message to itself by just calling send.
-        err = udp.SendMessage(Transport::PeerAddress::UDP(addr, udp.GetBoundPort()), std::move(buffer));
-        EXPECT_EQ(err, CHIP_NO_ERROR);
+            err = header.EncodeBeforeData(buffer);
+            EXPECT_EQ(err, CHIP_NO_ERROR);
+
+            // Should be able to send a message to itself by just calling send.
+            err = udp.SendMessage(Transport::PeerAddress::UDP(addr, udp.GetBoundPort()), std::move(buffer));
+            EXPECT_EQ(err, CHIP_NO_ERROR);
+        }
 
-        mIOContext->DriveIOUntil(chip::System::Clock::Seconds16(1), []() { return ReceiveHandlerCallCount != 0; });
+        mIOContext->DriveIOUntil(chip::System::Clock::Seconds16(1),
+                                 [messageCount]() { return ReceiveHandlerCallCount >= messageCount; });
 
-        EXPECT_EQ(ReceiveHandlerCallCount, 1);
+        EXPECT_EQ(ReceiveHandlerCallCount, messageCount);
     }
 };
 
@@ -177,3 +181,11 @@ TEST_F(TestUDP, CheckMessageTest6)
     IPAddress::FromString("::1", addr);
     CheckMessageTest(addr);
 }
+
+// Messages sent in a burst are queued and sent in batches; more than a batch fills the queue, which is flushed early.
+TEST_F(TestUDP, CheckBurstMessageTest6)
+{
+    IPAddress addr;
+    IPAddress::FromString("::1", addr);
+    CheckMessageTest(addr, 2 * INET_CONFIG_UDP_MAX_BATCH_SIZE + 1);
+}
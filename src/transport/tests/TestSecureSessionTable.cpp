@@ -43,6 +43,7 @@ public:
     static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
 
     void ValidateSessionSorting();
+    void ValidateSessionLookup();
 
 private:
     struct SessionParameters
@@ -452,6 +453,94 @@ void TestSecureSessionTable::ValidateSessionSorting()
     }
 }
 
+void TestSecureSessionTable::ValidateSessionLookup()
+{
+    const ReliableMessageProtocolConfig config(System::Clock::Milliseconds32(0), System::Clock::Milliseconds32(0),
+                                               System::Clock::Milliseconds16(0));
+    const ScopedNodeId peer1(2, kFabric1);
+    const ScopedNodeId peer2(3, kFabric2);
+
+    mSessionTable = Platform::MakeUnique<SecureSessionTable>();
+    ASSERT_NE(mSessionTable.get(), nullptr);
+    mSessionTable->Init();
+
+    // Force the session ID allocator to wrap around, so that kUnsecuredSessionId has to be skipped.
+    mSessionTable->mNextSessionId = kMaxSessionID;
+
+    // Activate alternating sessions against two peers. The sessions are kept alive by the reference
+    // taken in Activate() until they are marked for eviction.
+    std::vector<SecureSession *> sessions;
+    for (unsigned int i = 0; i < CHIP_CONFIG_SECURE_SESSION_POOL_SIZE; i++)
+    {
+        auto session = mSessionTable->CreateNewSecureSession(SecureSession::Type::kCASE, ScopedNodeId());
+        ASSERT_TRUE(session.HasValue());
+
+        const ScopedNodeId & peer = (i % 2 == 0) ? peer1 : peer2;
+        SecureSession * secureSession = session.Value()->AsSecureSession();
+        secureSession->Activate(ScopedNodeId(1, peer.GetFabricIndex()), peer, CATValues(), static_cast<uint16_t>(i), config);
+        EXPECT_NE(secureSession->GetLocalSessionId(), kUnsecuredSessionId);
+        sessions.push_back(secureSession);
+    }
+
+    // Every session is found by its local session ID, and an ID that was never handed out is not.
+    for (auto * session : sessions)
+    {
+        auto found = mSessionTable->FindSecureSessionByLocalKey(session->GetLocalSessionId());
+        ASSERT_TRUE(found.HasValue());
+        EXPECT_EQ(found.Value()->AsSecureSession(), session);
+    }
+    EXPECT_FALSE(mSessionTable->FindSecureSessionByLocalKey(kUnsecuredSessionId).HasValue());
+    EXPECT_FALSE(mSessionTable->FindSecureSessionByLocalKey(static_cast<uint16_t>(kMaxSessionID - 1)).HasValue());
+
+    auto countSessionsWithPeer = [this](const ScopedNodeId & peer) {
+        unsigned int count = 0;
+        mSessionTable->ForEachCASESessionWithPeer(peer, [&](SecureSession * session) {
+            EXPECT_EQ(session->GetPeer(), peer);
+            count++;
+            return Loop::Continue;
+        });
+        return count;
+    };
+
+    EXPECT_EQ(countSessionsWithPeer(peer1), (CHIP_CONFIG_SECURE_SESSION_POOL_SIZE + 1) / 2u);
+    EXPECT_EQ(countSessionsWithPeer(peer2), CHIP_CONFIG_SECURE_SESSION_POOL_SIZE / 2u);
+    EXPECT_EQ(countSessionsWithPeer(ScopedNodeId(2, kFabric2)), 0u);
+
+    // Release the sessions to the first peer, and make sure the remaining ones can still be found
+    // while the released IDs can not.
+    std::vector<uint16_t> releasedIds;
+    for (unsigned int i = 0; i < sessions.size(); i += 2)
+    {
+        releasedIds.push_back(sessions[i]->GetLocalSessionId());
+        sessions[i]->MarkForEviction();
+    }
+    for (unsigned int i = 1; i < sessions.size(); i += 2)
+    {
+        auto found = mSessionTable->FindSecureSessionByLocalKey(sessions[i]->GetLocalSessionId());
+        ASSERT_TRUE(found.HasValue());
+        EXPECT_EQ(found.Value()->AsSecureSession(), sessions[i]);
+    }
+    for (auto id : releasedIds)
+    {
+        EXPECT_FALSE(mSessionTable->FindSecureSessionByLocalKey(id).HasValue());
+    }
+    EXPECT_EQ(countSessionsWithPeer(peer1), 0u);
+    EXPECT_EQ(countSessionsWithPeer(peer2), CHIP_CONFIG_SECURE_SESSION_POOL_SIZE / 2u);
+
+    // Newly allocated sessions never reuse an ID that is still in use.
+    auto session = mSessionTable->CreateNewSecureSession(SecureSession::Type::kCASE, ScopedNodeId());
+    ASSERT_TRUE(session.HasValue());
+    for (unsigned int i = 1; i < sessions.size(); i += 2)
+    {
+        EXPECT_NE(session.Value()->AsSecureSession()->GetLocalSessionId(), sessions[i]->GetLocalSessionId());
+    }
+}
+
+TEST_F(TestSecureSessionTable, ValidateSessionLookup)
+{
+    ValidateSessionLookup();
+}
+
 TEST_F(TestSecureSessionTable, ValidateSessionSorting)
 {
     // This calls TestSecureSessionTable::ValidateSessionSorting instead of just doing the